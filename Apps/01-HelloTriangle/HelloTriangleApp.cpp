@@ -82,6 +82,7 @@ public:
             }
         );
         m_render_state.SetName("Triangle Render State");
+        m_render_state.PrewarmPipelines({ GetViewState() }, { Rhi::RenderPrimitive::Triangle });
 
         const Rhi::CommandQueue& cmd_queue = GetRenderContext().GetRenderCommandKit().GetQueue();
         for (HelloTriangleFrame& frame : GetFrames())
@@ -67,6 +67,8 @@ TexturedCubeApp::~TexturedCubeApp()
 
 void TexturedCubeApp::Init()
 {
+    // Start loading texture image file in background while user interface is initialized
+    GetImageLoader().Prefetch({ "MethaneBubbles.jpg" });
     UserInterfaceApp::Init();
 
     const rhi::CommandQueue render_cmd_queue = GetRenderContext().GetRenderCommandKit().GetQueue();
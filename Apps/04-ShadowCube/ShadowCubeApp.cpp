@@ -70,6 +70,8 @@ ShadowCubeApp::~ShadowCubeApp()
 
 void ShadowCubeApp::Init()
 {
+    // Start loading texture image files in background while user interface is initialized
+    GetImageLoader().Prefetch({ "MethaneBubbles.jpg", "MarbleWhite.jpg" });
     UserInterfaceApp::Init();
 
     const rhi::RenderContext& render_context = GetRenderContext();
@@ -60,6 +60,7 @@ static const float           g_scene_scale  = 22.F;
 namespace pin = Methane::Platform::Input;
 static const std::map<pin::Keyboard::State, ParallelRenderingAppAction> g_parallel_rendering_action_by_keyboard_state{
     { { pin::Keyboard::Key::P            }, ParallelRenderingAppAction::SwitchParallelRendering },
+    { { pin::Keyboard::Key::B            }, ParallelRenderingAppAction::SwitchTransientBindings },
     { { pin::Keyboard::Key::Equal        }, ParallelRenderingAppAction::IncreaseCubesGridSize },
     { { pin::Keyboard::Key::Minus        }, ParallelRenderingAppAction::DecreaseCubesGridSize },
     { { pin::Keyboard::Key::RightBracket }, ParallelRenderingAppAction::IncreaseRenderThreadsCount },
@@ -69,8 +70,8 @@ static const std::map<pin::Keyboard::State, ParallelRenderingAppAction> g_parall
 bool ParallelRenderingApp::Settings::operator==(const Settings& other) const noexcept
 {
     META_FUNCTION_TASK();
-    return std::tie(cubes_grid_size, render_thread_count, parallel_rendering_enabled) ==
-           std::tie(other.cubes_grid_size, other.render_thread_count, other.parallel_rendering_enabled);
+    return std::tie(cubes_grid_size, render_thread_count, parallel_rendering_enabled, transient_bindings_enabled) ==
+           std::tie(other.cubes_grid_size, other.render_thread_count, other.parallel_rendering_enabled, other.transient_bindings_enabled);
 }
 
 uint32_t ParallelRenderingApp::Settings::GetTotalCubesCount() const noexcept
@@ -103,6 +104,7 @@ ParallelRenderingApp::ParallelRenderingApp()
     add_option("-p,--parallel-render", m_settings.parallel_rendering_enabled, "enable parallel rendering")->group(options_group);
     add_option("-g,--cubes-grid-size", m_settings.cubes_grid_size,            "cubes grid size")->group(options_group);
     add_option("-t,--threads-count",   m_settings.render_thread_count,        "render threads count")->group(options_group);
+    add_option("-b,--transient-bindings", m_settings.transient_bindings_enabled, "enable transient cube program bindings created for each frame")->group(options_group);
 
     // Setup animations
     GetAnimations().emplace_back(std::make_shared<Data::TimeAnimation>(std::bind(&ParallelRenderingApp::Animate, this, std::placeholders::_1, std::placeholders::_2)));
@@ -160,6 +162,7 @@ void ParallelRenderingApp::Init()
     render_state_settings.program.SetName("Render Pipeline State");
     render_state_settings.depth.enabled = true;
     m_render_state = GetRenderContext().CreateRenderState( render_state_settings);
+    m_render_state.PrewarmPipelines({ GetViewState() }, { rhi::RenderPrimitive::Triangle });
 
     // Create cube mesh buffer resources
     const uint32_t cubes_count = m_settings.GetTotalCubesCount();
@@ -204,19 +207,18 @@ void ParallelRenderingApp::Init()
         }, frame.index);
         frame.cubes_array.program_bindings_per_instance[0].SetName(fmt::format("Cube 0 Bindings {}", frame.index));
 
-        program_bindings_task_flow.for_each_index(1U, cubes_count, 1U,
-            [this, &frame, uniform_data_size](const uint32_t cube_index)
-            {
-                META_UNUSED(uniform_data_size); // workaround for Clang error unused-lambda-capture uniform_data_size (false positive)
-                rhi::ProgramBindings& cube_program_bindings = frame.cubes_array.program_bindings_per_instance[cube_index];
-                cube_program_bindings = rhi::ProgramBindings(frame.cubes_array.program_bindings_per_instance[0], {
-                    {
-                        { rhi::ShaderType::All, "g_uniforms" },
-                        { { frame.cubes_array.uniforms_buffer.GetInterface(), m_cube_array_buffers_ptr->GetUniformsBufferOffset(cube_index), uniform_data_size } }
-                    }
-                }, frame.index);
-                cube_program_bindings.SetName(fmt::format("Cube {} Bindings {}", cube_index, frame.index));
-            });
+        // Transient program bindings of other cubes are created for each frame in Render
+        if (!m_settings.transient_bindings_enabled)
+        {
+            program_bindings_task_flow.for_each_index(1U, cubes_count, 1U,
+                [this, &frame](const uint32_t cube_index)
+                {
+                    rhi::ProgramBindings& cube_program_bindings = frame.cubes_array.program_bindings_per_instance[cube_index];
+                    cube_program_bindings = rhi::ProgramBindings(frame.cubes_array.program_bindings_per_instance[0],
+                                                                 GetCubeUniformsResourceViews(frame, cube_index), frame.index);
+                    cube_program_bindings.SetName(fmt::format("Cube {} Bindings {}", cube_index, frame.index));
+                });
+        }
 
         if (m_settings.parallel_rendering_enabled)
         {
@@ -364,20 +366,67 @@ bool ParallelRenderingApp::Update()
     if (!UserInterfaceApp::Update())
         return false;
 
+    // Cube instance uniforms are updated in Render, when uniforms buffer of the current frame is released by GPU
+    return true;
+}
+
+rhi::ProgramBindings::ResourceViewsByArgument ParallelRenderingApp::GetCubeUniformsResourceViews(const ParallelRenderingFrame& frame,
+                                                                                               uint32_t cube_index) const
+{
+    META_FUNCTION_TASK();
+    return {
+        {
+            { rhi::ShaderType::All, "g_uniforms" },
+            { { frame.cubes_array.uniforms_buffer.GetInterface(), m_cube_array_buffers_ptr->GetUniformsBufferOffset(cube_index), MeshBuffers::GetUniformSize() } }
+        }
+    };
+}
+
+void ParallelRenderingApp::CreateTransientCubeBindings(ParallelRenderingFrame& frame) const
+{
+    META_FUNCTION_TASK();
+    // Transient program bindings of the previous frame using the same frame buffer are released here after its completion,
+    // so their descriptors are reset wholesale with the per-frame pools instead of being freed one by one
+    std::vector<rhi::ProgramBindings>& program_bindings_per_instance = frame.cubes_array.program_bindings_per_instance;
+    tf::Taskflow task_flow;
+    task_flow.for_each_index(1U, static_cast<uint32_t>(program_bindings_per_instance.size()), 1U,
+        [this, &frame, &program_bindings_per_instance](const uint32_t cube_index)
+        {
+            program_bindings_per_instance[cube_index] = program_bindings_per_instance[0].CreateTransientCopy(
+                GetCubeUniformsResourceViews(frame, cube_index), frame.index);
+        });
+
+    GetRenderContext().GetParallelExecutor().run(task_flow).get();
+}
+
+void ParallelRenderingApp::UpdateCubeUniforms(const rhi::Buffer& uniforms_buffer, const rhi::CommandQueue& render_cmd_queue)
+{
+    META_FUNCTION_TASK();
+    // Uniforms are written straight to the persistently mapped buffer memory when it is available,
+    // otherwise they are stored in mesh buffers and uploaded to the uniforms buffer with SetData
+    const rhi::Buffer::MappedSpan uniforms_buffer_span = uniforms_buffer.GetMappedSpan();
+
     // Update MVP-matrices for all cube instances so that they are positioned in a cube grid
     tf::Taskflow task_flow;
     task_flow.for_each_index(0U, static_cast<uint32_t>(m_cube_array_parameters.size()), 1U,
-        [this](const uint32_t cube_index)
+        [this, &uniforms_buffer_span](const uint32_t cube_index)
         {
             const CubeParameters& cube_params = m_cube_array_parameters[cube_index];
             hlslpp::Uniforms uniforms{};
             uniforms.mvp_matrix = hlslpp::transpose(hlslpp::mul(cube_params.model_matrix, m_camera.GetViewProjMatrix()));
             uniforms.texture_index = cube_params.thread_index;
-            m_cube_array_buffers_ptr->SetFinalPassUniforms(std::move(uniforms), cube_index);
+            if (uniforms_buffer_span)
+                m_cube_array_buffers_ptr->SetFinalPassUniforms(uniforms, cube_index, uniforms_buffer_span);
+            else
+                m_cube_array_buffers_ptr->SetFinalPassUniforms(std::move(uniforms), cube_index);
         });
 
     GetRenderContext().GetParallelExecutor().run(task_flow).get();
-    return true;
+
+    if (!uniforms_buffer_span)
+    {
+        uniforms_buffer.SetData(render_cmd_queue, m_cube_array_buffers_ptr->GetFinalPassUniformsSubresource());
+    }
 }
 
 bool ParallelRenderingApp::Render()
@@ -387,9 +436,14 @@ bool ParallelRenderingApp::Render()
         return false;
 
     // Update uniforms buffer related to current frame
-    const ParallelRenderingFrame& frame  = GetCurrentFrame();
+    ParallelRenderingFrame& frame  = GetCurrentFrame();
     const rhi::CommandQueue render_cmd_queue = GetRenderContext().GetRenderCommandKit().GetQueue();
-    frame.cubes_array.uniforms_buffer.SetData(render_cmd_queue, m_cube_array_buffers_ptr->GetFinalPassUniformsSubresource());
+    UpdateCubeUniforms(frame.cubes_array.uniforms_buffer, render_cmd_queue);
+
+    if (m_settings.transient_bindings_enabled)
+    {
+        CreateTransientCubeBindings(frame);
+    }
 
     // Render cube instances of 'CUBE_MAP_ARRAY_SIZE' count
     if (m_settings.parallel_rendering_enabled)
@@ -476,6 +530,7 @@ std::string ParallelRenderingApp::GetParametersString()
     ss << "Parallel Rendering parameters:"
         << std::endl << "  - parallel rendering:   " << (m_settings.parallel_rendering_enabled ? "ON" : "OFF")
         << std::endl << "  - render threads count: " << m_settings.GetActiveRenderThreadCount()
+        << std::endl << "  - transient bindings:   " << (m_settings.transient_bindings_enabled ? "ON" : "OFF")
         << std::endl << "  - cubes grid size:      " << m_settings.cubes_grid_size
         << std::endl << "  - total cubes count:    " << m_settings.GetTotalCubesCount()
         << std::endl << "  - texture array size:   " << g_texture_size.GetWidth() <<
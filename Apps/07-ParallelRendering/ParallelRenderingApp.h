@@ -63,6 +63,7 @@ public:
         uint32_t cubes_grid_size            = 12U; // total_cubes_count = pow(cubes_grid_size, 3)
         uint32_t render_thread_count        = std::thread::hardware_concurrency();
         bool     parallel_rendering_enabled = true;
+        bool     transient_bindings_enabled = false; // cube program bindings are created for each frame from transient descriptor pools
 
         bool operator==(const Settings& other) const noexcept;
 
@@ -103,6 +104,9 @@ private:
 
     CubeArrayParameters InitializeCubeArrayParameters() const;
     bool Animate(double elapsed_seconds, double delta_seconds);
+    rhi::ProgramBindings::ResourceViewsByArgument GetCubeUniformsResourceViews(const ParallelRenderingFrame& frame, uint32_t cube_index) const;
+    void CreateTransientCubeBindings(ParallelRenderingFrame& frame) const;
+    void UpdateCubeUniforms(const rhi::Buffer& uniforms_buffer, const rhi::CommandQueue& render_cmd_queue);
     void RenderCubesRange(const rhi::RenderCommandList& remder_cmd_list,
                           const std::vector<rhi::ProgramBindings>& program_bindings_per_instance,
                           uint32_t begin_instance_index, const uint32_t end_instance_index) const;
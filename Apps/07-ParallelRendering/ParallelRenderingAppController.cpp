@@ -52,6 +52,10 @@ void ParallelRenderingAppController::OnKeyboardStateAction(ParallelRenderingAppA
         app_settings.parallel_rendering_enabled = !app_settings.parallel_rendering_enabled;
         break;
 
+    case ParallelRenderingAppAction::SwitchTransientBindings:
+        app_settings.transient_bindings_enabled = !app_settings.transient_bindings_enabled;
+        break;
+
     case ParallelRenderingAppAction::IncreaseCubesGridSize:
         app_settings.cubes_grid_size++;
         break;
@@ -80,6 +84,7 @@ std::string ParallelRenderingAppController::GetKeyboardActionName(ParallelRender
     switch(action)
     {
     case ParallelRenderingAppAction::SwitchParallelRendering:    return "switch parallel rendering";
+    case ParallelRenderingAppAction::SwitchTransientBindings:    return "switch transient program bindings";
     case ParallelRenderingAppAction::IncreaseCubesGridSize:      return "increase cubes grid size";
     case ParallelRenderingAppAction::DecreaseCubesGridSize:      return "decrease cubes grid size";
     case ParallelRenderingAppAction::IncreaseRenderThreadsCount: return "increase render threads count";
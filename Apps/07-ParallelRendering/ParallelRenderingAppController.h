@@ -35,6 +35,7 @@ enum class ParallelRenderingAppAction
 {
     None,
     SwitchParallelRendering,
+    SwitchTransientBindings,
     IncreaseCubesGridSize,
     DecreaseCubesGridSize,
     IncreaseRenderThreadsCount,
@@ -23,6 +23,9 @@ Common application settings for Methane samples and tutorials.
 
 #include <Methane/Tutorials/AppSettings.h>
 #include <Methane/Data/AppIconsProvider.h>
+#include <Methane/Platform/Utils.h>
+
+#include <fmt/format.h>
 
 namespace Methane::Tutorials
 {
@@ -74,7 +77,7 @@ Graphics::CombinedAppSettings GetGraphicsTutorialAppSettings(const std::string&
     const DepthStencilValues         default_clear_depth_stencil(1.F, Graphics::Stencil(0));
     const Color4F                    default_clear_color(0.0F, 0.2F, 0.4F, 1.0F);
 
-    return Graphics::CombinedAppSettings
+    Graphics::CombinedAppSettings app_settings
     {                                                           // =========================
         Platform::AppSettings {                                 // platform_app:
             app_name,                                           //   - name
@@ -109,6 +112,10 @@ Graphics::CombinedAppSettings GetGraphicsTutorialAppSettings(const std::string&
             1000U,                                              //   - unsync_max_fps (MacOS only)
         }                                                       // =========================
     };
+
+    // Pipeline cache is shared by all tutorials to warm start pipeline states creation on subsequent launches
+    app_settings.graphics_app.SetPipelineCachePath(fmt::format("{}/MethanePipelineCache.bin", Platform::GetExecutableDir()));
+    return app_settings;
 }
 
 UserInterface::IApp::Settings GetUserInterfaceTutorialAppSettings(AppOptions::Mask app_options)
@@ -31,6 +31,7 @@ NOTE:
 
 #include "IttApiHelper.h"
 #include "ScopeTimer.h"
+#include "MemoryAllocations.h"
 
 #if defined(__GNUC__) && !defined(__llvm__) && !defined(__INTEL_COMPILER)
 #define __GCC_COMPILER__
@@ -102,7 +103,8 @@ ITT_DOMAIN_EXTERN();
     FrameMark; \
     ITT_PROCESS_MARKER("Methane-Frame-Delimiter"); \
     ITT_MARKER_ARG("Frame-Buffer-Index", static_cast<int64_t>(frame_buffer_index)); \
-    ITT_MARKER_ARG("Frame-Index", static_cast<int64_t>(frame_index))
+    ITT_MARKER_ARG("Frame-Index", static_cast<int64_t>(frame_index)); \
+    META_MEMORY_ALLOCATIONS_FRAME_DELIMITER()
 
 #define META_CPU_FRAME_START(/*const char* */name) \
     TracyCFrameMarkStart(name)
@@ -143,7 +145,8 @@ ITT_DOMAIN_EXTERN();
 
 #else // ifdef META_INSTRUMENTATION_ENABLED
 
-#define META_CPU_FRAME_DELIMITER(/* uint32_t */ frame_buffer_index, /* uint32_t */ frame_index)
+#define META_CPU_FRAME_DELIMITER(/* uint32_t */ frame_buffer_index, /* uint32_t */ frame_index) \
+    META_MEMORY_ALLOCATIONS_FRAME_DELIMITER()
 #define META_CPU_FRAME_START(/*const char* */name)
 #define META_CPU_FRAME_END(/*const char* */name)
 #define META_SCOPE_TASK(/*const char* */name)
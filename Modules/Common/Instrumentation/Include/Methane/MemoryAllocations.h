@@ -0,0 +1,91 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/MemoryAllocations.h
+Memory allocations tracking with per-thread and per-frame counters of the
+instrumented "new" and "delete" operators, enabled with build option
+METHANE_MEMORY_ALLOCATIONS_TRACKING_ENABLED.
+
+******************************************************************************/
+
+#pragma once
+
+#ifdef METHANE_MEMORY_ALLOCATIONS_TRACKING_ENABLED
+
+#include <string>
+#include <cstdint>
+
+namespace Methane::MemoryAllocations
+{
+
+struct Counters
+{
+    uint64_t allocations_count   = 0U;
+    uint64_t allocated_size      = 0U;
+    uint64_t deallocations_count = 0U;
+
+    [[nodiscard]] bool IsEmpty() const noexcept { return !allocations_count && !deallocations_count; }
+
+    [[nodiscard]] friend bool operator==(const Counters& left, const Counters& right) noexcept
+    {
+        return left.allocations_count   == right.allocations_count &&
+               left.allocated_size      == right.allocated_size &&
+               left.deallocations_count == right.deallocations_count;
+    }
+
+    [[nodiscard]] friend bool operator!=(const Counters& left, const Counters& right) noexcept { return !(left == right); }
+
+    // Counters difference is saturated at zero, because counters of exited threads are moved between slots non-atomically
+    [[nodiscard]] Counters operator-(const Counters& other) const noexcept;
+
+    [[nodiscard]] explicit operator std::string() const;
+};
+
+struct FrameStatistics
+{
+    uint64_t frames_count                = 0U;
+    uint64_t allocating_frames_count     = 0U;
+    uint64_t max_frame_allocations_count = 0U;
+    uint64_t max_frame_allocated_size    = 0U;
+    Counters last_frame;
+};
+
+// Counters of allocations made by the calling thread during its lifetime
+[[nodiscard]] Counters GetThreadCounters() noexcept;
+
+// Counters of allocations made by all threads since application start
+[[nodiscard]] Counters GetTotalCounters() noexcept;
+
+// Counters of allocations made by all threads since the last frame delimiter
+[[nodiscard]] Counters GetCurrentFrameCounters() noexcept;
+
+// Statistics of frames split by META_CPU_FRAME_DELIMITER since application start or the last reset
+[[nodiscard]] FrameStatistics GetFrameStatistics() noexcept;
+
+void ResetFrameStatistics() noexcept;
+void OnFrameDelimiter() noexcept;
+
+} // namespace Methane::MemoryAllocations
+
+#define META_MEMORY_ALLOCATIONS_FRAME_DELIMITER() Methane::MemoryAllocations::OnFrameDelimiter()
+
+#else // ifdef METHANE_MEMORY_ALLOCATIONS_TRACKING_ENABLED
+
+#define META_MEMORY_ALLOCATIONS_FRAME_DELIMITER()
+
+#endif // ifdef METHANE_MEMORY_ALLOCATIONS_TRACKING_ENABLED
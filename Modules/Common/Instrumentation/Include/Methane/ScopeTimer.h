@@ -17,7 +17,8 @@ limitations under the License.
 *******************************************************************************
 
 FILE: Methane/ScopeTimer.h
-Code scope measurement timer with aggregating and averaging of timings.
+Code scope measurement timer with aggregating and averaging of timings,
+duration histograms and trace events recording in per-thread buffers.
 
 ******************************************************************************/
 
@@ -30,7 +31,13 @@ Code scope measurement timer with aggregating and averaging of timings.
 #include <Methane/Memory.hpp>
 
 #include <string>
+#include <string_view>
 #include <map>
+#include <deque>
+#include <vector>
+#include <mutex>
+#include <atomic>
+#include <ostream>
 
 namespace Methane
 {
@@ -39,11 +46,13 @@ class ScopeTimer : public Timer // NOSONAR - custom destructor is required
 {
 public:
     using ScopeId = uint32_t;
+    using Counter = ITT_COUNTER_TYPE(uint64_t);
 
     struct Registration
     {
         const char* name;
         ScopeId     id;
+        Counter*    counter_ptr = nullptr;
     };
 
     class Aggregator // NOSONAR - custom destructor is required
@@ -51,10 +60,20 @@ public:
         friend class ScopeTimer;
 
     public:
-        struct Timing
+        // Merged timings of the scope from all threads collected since the last flush,
+        // minimum, maximum and percentile durations are approximated with histogram buckets of 1/8 octave width
+        struct ScopeStatistics
         {
-            TimeDuration duration;
-            uint32_t     count    = 0U;
+            const char*  name = nullptr;
+            uint64_t     count = 0U;
+            TimeDuration total_duration{ };
+            TimeDuration min_duration{ };
+            TimeDuration max_duration{ };
+            TimeDuration p50_duration{ };
+            TimeDuration p95_duration{ };
+            TimeDuration p99_duration{ };
+
+            [[nodiscard]] TimeDuration GetAverageDuration() const noexcept;
         };
 
         [[nodiscard]] static Aggregator& Get() noexcept;
@@ -69,25 +88,74 @@ public:
         void SetLogger(Ptr<ILogger> logger_ptr) noexcept             { m_logger_ptr = std::move(logger_ptr); }
         [[nodiscard]] const Ptr<ILogger>& GetLogger() const noexcept { return m_logger_ptr; }
 
+        // Scope names are expected to be static strings, which are registered once and never unregistered
+        Registration RegisterScope(const char* scope_name);
+
+        [[nodiscard]] std::vector<ScopeStatistics> GetScopeStatistics();
         void LogTimings(ILogger& logger) noexcept;
         void Flush() noexcept;
 
+        // Trace events of all scope timings are recorded when enabled and written in Chrome trace event JSON format,
+        // when trace file path is set, trace is enabled and written to file on every flush
+        void SetTraceEnabled(bool trace_enabled) noexcept;
+        void SetTraceFilePath(const std::string& trace_file_path);
+        [[nodiscard]] bool IsTraceEnabled() const noexcept { return m_trace_enabled.load(std::memory_order_relaxed); }
+        [[nodiscard]] size_t GetTraceEventsCount();
+        void WriteTrace(std::ostream& trace_stream);
+        void ClearTrace();
+
     protected:
-        Registration RegisterScope(const char* scope_name);
-        void AddScopeTiming(const Registration& scope_registration, TimeDuration duration) noexcept;
+        void AddScopeTiming(const Registration& scope_registration, TimePoint start_time, TimeDuration duration) noexcept;
 
     private:
-        Aggregator() = default;
+        class ThreadBuffer;
+        class ThreadBufferHolder;
 
-        using ScopeIdByName = std::map<const char*, ScopeId>;
-        using ScopeTimings  = std::vector<Timing>; // index == ScopeId
-        using ScopeCounters = std::vector<ITT_COUNTER_TYPE(uint64_t)>; // index == ScopeId
+        struct ScopeTotals
+        {
+            uint64_t              count = 0U;
+            uint64_t              total_duration_ns = 0U;
+            std::vector<uint64_t> histogram;
+        };
+
+        struct TraceEvent
+        {
+            ScopeId      scope_id;
+            uint32_t     thread_index;
+            TimePoint    start_time;
+            TimeDuration duration;
+        };
 
-        ScopeId       m_new_scope_id = 0U;
-        ScopeIdByName m_scope_id_by_name;
-        ScopeTimings  m_timing_by_scope_id;
-        ScopeCounters m_counters_by_scope_id;
-        Ptr<ILogger>  m_logger_ptr;
+        using ScopeIdByName  = std::map<std::string_view, ScopeId, std::less<>>;
+        using ScopeNames     = std::vector<const char*>;          // index == ScopeId
+        using ScopeCounters  = std::deque<Counter>;               // index == ScopeId
+        using ScopesTotals   = std::vector<ScopeTotals>;          // index == ScopeId
+        using ThreadBuffers  = UniquePtrs<ThreadBuffer>;
+        using TraceEvents    = std::vector<TraceEvent>;
+
+        Aggregator();
+
+        [[nodiscard]] ThreadBuffer& GetThreadBuffer();
+        [[nodiscard]] ThreadBuffer& AcquireThreadBuffer();
+        void ReleaseThreadBuffer(ThreadBuffer& thread_buffer) noexcept;
+        void CollectScopeTotals();
+        void CollectTraceEvents();
+        [[nodiscard]] std::vector<ScopeStatistics> GetCollectedScopeStatistics() const;
+        void WriteTraceFile() noexcept;
+
+        mutable std::mutex          m_mutex;
+        ScopeIdByName               m_scope_id_by_name;
+        ScopeNames                  m_scope_names;
+        ScopeCounters               m_counters_by_scope_id;
+        ThreadBuffers               m_thread_buffers;
+        std::vector<ThreadBuffer*>  m_free_thread_buffers;
+        ScopesTotals                m_collected_totals;       // totals collected from thread buffers
+        ScopesTotals                m_flushed_totals;         // totals at the moment of last flush
+        std::atomic<bool>           m_trace_enabled{ false };
+        const TimePoint             m_trace_start_time;
+        TraceEvents                 m_trace_events;
+        std::string                 m_trace_file_path;
+        Ptr<ILogger>                m_logger_ptr;
     };
 
     template<typename TLogger>
@@ -97,6 +165,7 @@ public:
     }
 
     explicit ScopeTimer(const char* scope_name);
+    explicit ScopeTimer(const Registration& scope_registration);
     ScopeTimer(const ScopeTimer&) = delete;
     ScopeTimer(ScopeTimer&&) = delete;
     ~ScopeTimer();
@@ -120,9 +189,12 @@ private:
 #ifdef METHANE_SCOPE_TIMERS_ENABLED
 
 #define META_SCOPE_TIMERS_INITIALIZE(LOGGER_TYPE) Methane::ScopeTimer::InitializeLogger<LOGGER_TYPE>()
-#define META_SCOPE_TIMER(SCOPE_NAME) Methane::ScopeTimer scope_timer(SCOPE_NAME)
+#define META_SCOPE_TIMER(SCOPE_NAME) \
+    static const Methane::ScopeTimer::Registration s_scope_timer_registration = Methane::ScopeTimer::Aggregator::Get().RegisterScope(SCOPE_NAME); \
+    Methane::ScopeTimer scope_timer(s_scope_timer_registration)
 #define META_FUNCTION_TIMER() META_SCOPE_TIMER(__func__)
 #define META_SCOPE_TIMERS_FLUSH() Methane::ScopeTimer::Aggregator::Get().Flush()
+#define META_SCOPE_TIMERS_TRACE_FILE(TRACE_FILE_PATH) Methane::ScopeTimer::Aggregator::Get().SetTraceFilePath(TRACE_FILE_PATH)
 
 #else // ifdef METHANE_SCOPE_TIMERS_ENABLED
 
@@ -130,5 +202,6 @@ private:
 #define META_SCOPE_TIMER(SCOPE_NAME)
 #define META_FUNCTION_TIMER()
 #define META_SCOPE_TIMERS_FLUSH()
+#define META_SCOPE_TIMERS_TRACE_FILE(TRACE_FILE_PATH)
 
 #endif // ifdef METHANE_SCOPE_TIMERS_ENABLED
@@ -19,14 +19,19 @@ limitations under the License.
 FILE: Methane/InstrumentMemoryAllocations.cpp
 Overloading "new" and "delete" operators with additional instrumentation:
  - Memory allocations tracking with Tracy
+ - Memory allocations counting per thread and per frame
 
 ******************************************************************************/
 
-#include <tracy/Tracy.hpp>
+#include <Methane/MemoryAllocations.h>
 
 #include <cstdlib>
 #include <new>
 
+#ifdef TRACY_ENABLE
+
+#include <tracy/Tracy.hpp>
+
 #if defined(TRACY_MEMORY_CALL_STACK_DEPTH) && TRACY_MEMORY_CALL_STACK_DEPTH > 0
 
 #define TRACY_ALLOC(ptr, size) TracyAllocS(ptr, size, TRACY_MEMORY_CALL_STACK_DEPTH)
@@ -39,54 +44,390 @@ Overloading "new" and "delete" operators with additional instrumentation:
 
 #endif // TRACY_MEMORY_CALL_STACK_DEPTH
 
-void* operator new(std::size_t size)
+#else // ifdef TRACY_ENABLE
+
+#define TRACY_ALLOC(ptr, size)
+#define TRACY_FREE(ptr)
+
+#endif // ifdef TRACY_ENABLE
+
+#ifdef METHANE_MEMORY_ALLOCATIONS_TRACKING_ENABLED
+
+#include <fmt/format.h>
+
+#include <array>
+#include <atomic>
+#include <mutex>
+#include <algorithm>
+
+namespace Methane::MemoryAllocations
+{
+
+static constexpr uint32_t g_thread_slots_count = 256U;
+
+// Counters of every thread are written to its own cache line slot only by the owning thread,
+// so they are updated with relaxed stores; slot 0 is shared by exited threads and threads which did not get own slot.
+// Slots are preallocated statically, because no allocations can be made from the instrumented allocation functions.
+struct alignas(64) ThreadSlot
+{
+    std::atomic<uint64_t> allocations_count{ 0U };
+    std::atomic<uint64_t> allocated_size{ 0U };
+    std::atomic<uint64_t> deallocations_count{ 0U };
+    std::atomic<bool>     is_acquired{ false };
+};
+
+static std::array<ThreadSlot, g_thread_slots_count> g_thread_slots;
+static std::mutex      g_frame_mutex;
+static Counters        g_frame_start_counters;
+static FrameStatistics g_frame_statistics;
+
+static ThreadSlot& GetSharedThreadSlot() noexcept
+{
+    return g_thread_slots[0];
+}
+
+static void AddCounter(std::atomic<uint64_t>& counter, uint64_t value, bool is_shared) noexcept
+{
+    if (is_shared)
+        counter.fetch_add(value, std::memory_order_relaxed);
+    else
+        counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+}
+
+static Counters GetSlotCounters(const ThreadSlot& slot) noexcept
+{
+    return Counters{
+        slot.allocations_count.load(std::memory_order_relaxed),
+        slot.allocated_size.load(std::memory_order_relaxed),
+        slot.deallocations_count.load(std::memory_order_relaxed)
+    };
+}
+
+class ThreadSlotHolder
+{
+public:
+    ThreadSlotHolder() noexcept
+        : m_slot(AcquireSlot())
+    { }
+
+    ThreadSlotHolder(const ThreadSlotHolder&) = delete;
+    ThreadSlotHolder(ThreadSlotHolder&&) = delete;
+
+    // Thread counters are moved to the shared slot on thread exit, so that totals are preserved;
+    // allocations made by the thread after this point, e.g. in other thread-local destructors, are counted in the shared slot
+    ~ThreadSlotHolder();
+
+    ThreadSlotHolder& operator=(const ThreadSlotHolder&) = delete;
+    ThreadSlotHolder& operator=(ThreadSlotHolder&&) = delete;
+
+    ThreadSlot& GetSlot() const noexcept { return m_slot; }
+
+private:
+    static ThreadSlot& AcquireSlot() noexcept
+    {
+        for(uint32_t slot_index = 1U; slot_index < g_thread_slots_count; ++slot_index)
+        {
+            ThreadSlot& slot = g_thread_slots[slot_index];
+            if (!slot.is_acquired.load(std::memory_order_relaxed) &&
+                !slot.is_acquired.exchange(true, std::memory_order_acquire))
+                return slot;
+        }
+        return GetSharedThreadSlot();
+    }
+
+    ThreadSlot& m_slot;
+};
+
+// Thread-local counters and slot pointer are trivially destructible, so they can be used after thread-local destructors
+static thread_local Counters    t_thread_counters;
+static thread_local ThreadSlot* t_thread_slot_ptr = nullptr;
+
+ThreadSlotHolder::~ThreadSlotHolder()
+{
+    ThreadSlot& shared_slot = GetSharedThreadSlot();
+    t_thread_slot_ptr = &shared_slot;
+    if (&m_slot == &shared_slot)
+        return;
+
+    shared_slot.allocations_count.fetch_add(m_slot.allocations_count.exchange(0U, std::memory_order_relaxed), std::memory_order_relaxed);
+    shared_slot.allocated_size.fetch_add(m_slot.allocated_size.exchange(0U, std::memory_order_relaxed), std::memory_order_relaxed);
+    shared_slot.deallocations_count.fetch_add(m_slot.deallocations_count.exchange(0U, std::memory_order_relaxed), std::memory_order_relaxed);
+    m_slot.is_acquired.store(false, std::memory_order_release);
+}
+
+static ThreadSlot& GetThreadSlot() noexcept
+{
+    if (t_thread_slot_ptr)
+        return *t_thread_slot_ptr;
+
+    // Thread-local holder is constructed on the first allocation of the thread and releases its slot on thread exit
+    thread_local const ThreadSlotHolder s_thread_slot_holder;
+    t_thread_slot_ptr = &s_thread_slot_holder.GetSlot();
+    return *t_thread_slot_ptr;
+}
+
+static void OnAllocation(std::size_t size) noexcept
+{
+    t_thread_counters.allocations_count++;
+    t_thread_counters.allocated_size += size;
+
+    ThreadSlot& slot = GetThreadSlot();
+    const bool is_shared_slot = &slot == &GetSharedThreadSlot();
+    AddCounter(slot.allocations_count, 1U, is_shared_slot);
+    AddCounter(slot.allocated_size, size, is_shared_slot);
+}
+
+static void OnDeallocation(const void* ptr) noexcept
+{
+    if (!ptr)
+        return;
+
+    t_thread_counters.deallocations_count++;
+
+    ThreadSlot& slot = GetThreadSlot();
+    AddCounter(slot.deallocations_count, 1U, &slot == &GetSharedThreadSlot());
+}
+
+static uint64_t SubtractSaturated(uint64_t left, uint64_t right) noexcept
+{
+    return left > right ? left - right : 0U;
+}
+
+Counters Counters::operator-(const Counters& other) const noexcept
+{
+    return Counters{
+        SubtractSaturated(allocations_count, other.allocations_count),
+        SubtractSaturated(allocated_size, other.allocated_size),
+        SubtractSaturated(deallocations_count, other.deallocations_count)
+    };
+}
+
+Counters::operator std::string() const
+{
+    return fmt::format("{} allocations of {} bytes and {} deallocations", allocations_count, allocated_size, deallocations_count);
+}
+
+Counters GetThreadCounters() noexcept
+{
+    return t_thread_counters;
+}
+
+Counters GetTotalCounters() noexcept
+{
+    Counters total_counters;
+    for(const ThreadSlot& slot : g_thread_slots)
+    {
+        const Counters slot_counters = GetSlotCounters(slot);
+        total_counters.allocations_count   += slot_counters.allocations_count;
+        total_counters.allocated_size      += slot_counters.allocated_size;
+        total_counters.deallocations_count += slot_counters.deallocations_count;
+    }
+    return total_counters;
+}
+
+Counters GetCurrentFrameCounters() noexcept
+{
+    const Counters total_counters = GetTotalCounters();
+    std::scoped_lock lock(g_frame_mutex);
+    return total_counters - g_frame_start_counters;
+}
+
+FrameStatistics GetFrameStatistics() noexcept
+{
+    std::scoped_lock lock(g_frame_mutex);
+    return g_frame_statistics;
+}
+
+void ResetFrameStatistics() noexcept
+{
+    const Counters total_counters = GetTotalCounters();
+    std::scoped_lock lock(g_frame_mutex);
+    g_frame_start_counters = total_counters;
+    g_frame_statistics     = FrameStatistics{};
+}
+
+void OnFrameDelimiter() noexcept
+{
+    const Counters total_counters = GetTotalCounters();
+    std::scoped_lock lock(g_frame_mutex);
+    const Counters frame_counters = total_counters - g_frame_start_counters;
+    g_frame_start_counters = total_counters;
+
+    g_frame_statistics.frames_count++;
+    if (frame_counters.allocations_count)
+        g_frame_statistics.allocating_frames_count++;
+
+    g_frame_statistics.max_frame_allocations_count = std::max(g_frame_statistics.max_frame_allocations_count, frame_counters.allocations_count);
+    g_frame_statistics.max_frame_allocated_size    = std::max(g_frame_statistics.max_frame_allocated_size, frame_counters.allocated_size);
+    g_frame_statistics.last_frame                  = frame_counters;
+}
+
+} // namespace Methane::MemoryAllocations
+
+#define TRACK_ALLOC(size) Methane::MemoryAllocations::OnAllocation(size)
+#define TRACK_FREE(ptr) Methane::MemoryAllocations::OnDeallocation(ptr)
+
+#else // ifdef METHANE_MEMORY_ALLOCATIONS_TRACKING_ENABLED
+
+#define TRACK_ALLOC(size)
+#define TRACK_FREE(ptr)
+
+#endif // ifdef METHANE_MEMORY_ALLOCATIONS_TRACKING_ENABLED
+
+static void* AllocateMemory(std::size_t size) noexcept
 {
     void* ptr = std::malloc(size);
     if (!ptr)
-        throw std::bad_alloc();
+        return nullptr;
 
     TRACY_ALLOC(ptr, size);
+    TRACK_ALLOC(size);
     return ptr;
 }
 
-void* operator new(std::size_t size, std::align_val_t align)
+static void* AllocateAlignedMemory(std::size_t size, std::align_val_t align) noexcept
 {
 #if defined(_WIN32)
     void* ptr = _aligned_malloc(size, static_cast<std::size_t>(align));
 #elif defined(__APPLE__)
     void* ptr = nullptr;
-    const int error = posix_memalign(&ptr, static_cast<size_t>(align), size);
-    if (error)
-        throw std::bad_alloc();
+    if (posix_memalign(&ptr, static_cast<size_t>(align), size))
+        return nullptr;
 #else // Linux
     void* ptr = aligned_alloc(static_cast<std::size_t>(align), size);
 #endif
 
     if (!ptr)
-        throw std::bad_alloc{};
+        return nullptr;
 
     TRACY_ALLOC(ptr, size);
+    TRACK_ALLOC(size);
     return ptr;
 }
 
-void operator delete(void* ptr) noexcept
+static void FreeMemory(void* ptr) noexcept
 {
     TRACY_FREE(ptr);
+    TRACK_FREE(ptr);
     std::free(ptr);
 }
 
-void operator delete(void* ptr, size_t) noexcept
-{
-    TRACY_FREE(ptr);
-    std::free(ptr);
-}
-
-void operator delete(void* ptr, std::align_val_t) noexcept
+static void FreeAlignedMemory(void* ptr) noexcept
 {
     TRACY_FREE(ptr);
+    TRACK_FREE(ptr);
 #if defined(_WIN32)
     _aligned_free(ptr);
 #else
     free(ptr);
 #endif
-}
\ No newline at end of file
+}
+
+// Non-throwing and array operators are overloaded too, because they may be implemented
+// with separate allocator in C++ runtime, which is not compatible with overloaded "delete" operators
+
+void* operator new(std::size_t size)
+{
+    void* ptr = AllocateMemory(size);
+    if (!ptr)
+        throw std::bad_alloc();
+    return ptr;
+}
+
+void* operator new(std::size_t size, std::align_val_t align)
+{
+    void* ptr = AllocateAlignedMemory(size, align);
+    if (!ptr)
+        throw std::bad_alloc();
+    return ptr;
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+    return AllocateMemory(size);
+}
+
+void* operator new(std::size_t size, std::align_val_t align, const std::nothrow_t&) noexcept
+{
+    return AllocateAlignedMemory(size, align);
+}
+
+void* operator new[](std::size_t size)
+{
+    return operator new(size);
+}
+
+void* operator new[](std::size_t size, std::align_val_t align)
+{
+    return operator new(size, align);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+    return AllocateMemory(size);
+}
+
+void* operator new[](std::size_t size, std::align_val_t align, const std::nothrow_t&) noexcept
+{
+    return AllocateAlignedMemory(size, align);
+}
+
+void operator delete(void* ptr) noexcept
+{
+    FreeMemory(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    FreeMemory(ptr);
+}
+
+void operator delete(void* ptr, const std::nothrow_t&) noexcept
+{
+    FreeMemory(ptr);
+}
+
+void operator delete(void* ptr, std::align_val_t) noexcept
+{
+    FreeAlignedMemory(ptr);
+}
+
+void operator delete(void* ptr, std::size_t, std::align_val_t) noexcept
+{
+    FreeAlignedMemory(ptr);
+}
+
+void operator delete(void* ptr, std::align_val_t, const std::nothrow_t&) noexcept
+{
+    FreeAlignedMemory(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+    FreeMemory(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept
+{
+    FreeMemory(ptr);
+}
+
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept
+{
+    FreeMemory(ptr);
+}
+
+void operator delete[](void* ptr, std::align_val_t) noexcept
+{
+    FreeAlignedMemory(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t, std::align_val_t) noexcept
+{
+    FreeAlignedMemory(ptr);
+}
+
+void operator delete[](void* ptr, std::align_val_t, const std::nothrow_t&) noexcept
+{
+    FreeAlignedMemory(ptr);
+}
@@ -17,20 +17,358 @@ limitations under the License.
 *******************************************************************************
 
 FILE: Methane/ScopeTimer.cpp
-Code scope measurement timer with aggregating and averaging of timings.
+Code scope measurement timer with aggregating and averaging of timings,
+duration histograms and trace events recording in per-thread buffers.
 
 ******************************************************************************/
 
 #include <Methane/ScopeTimer.h>
+#include <Methane/MemoryAllocations.h>
 #include <Methane/Instrumentation.h>
 
 #include <sstream>
+#include <fstream>
+#include <iomanip>
 #include <chrono>
+#include <array>
+#include <algorithm>
+#include <cmath>
 #include <cassert>
 
 namespace Methane
 {
 
+static constexpr uint32_t g_histogram_octave_buckets_count = 8U;   // relative error of bucket middle is less than 6.25%
+static constexpr uint32_t g_histogram_buckets_count        = 304U; // durations up to 2^40 ns (~18 minutes)
+static constexpr uint32_t g_scopes_block_size              = 64U;
+static constexpr uint32_t g_scopes_blocks_count            = 64U;  // up to 4096 scopes
+static constexpr uint32_t g_trace_chunk_size               = 4096U;
+
+static uint64_t GetDurationNs(Timer::TimeDuration duration) noexcept
+{
+    return static_cast<uint64_t>(std::max<int64_t>(0, std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count()));
+}
+
+static uint32_t GetHistogramBucketIndex(uint64_t duration_ns) noexcept
+{
+    // Durations below 8 ns are counted exactly, larger durations are split in 8 buckets per octave
+    if (duration_ns < g_histogram_octave_buckets_count)
+        return static_cast<uint32_t>(duration_ns);
+
+    const auto octave       = static_cast<uint32_t>(std::ilogb(static_cast<double>(duration_ns)));
+    const auto octave_index = static_cast<uint32_t>(duration_ns >> (octave - 3U)) & 7U;
+    return std::min((octave - 2U) * g_histogram_octave_buckets_count + octave_index, g_histogram_buckets_count - 1U);
+}
+
+static uint64_t GetHistogramBucketMiddleNs(uint32_t bucket_index) noexcept
+{
+    if (bucket_index < g_histogram_octave_buckets_count)
+        return bucket_index;
+
+    const uint32_t octave       = bucket_index / g_histogram_octave_buckets_count + 2U;
+    const uint32_t octave_index = bucket_index % g_histogram_octave_buckets_count;
+    const uint64_t bucket_width = uint64_t(1U) << (octave - 3U);
+    return (uint64_t(g_histogram_octave_buckets_count + octave_index) << (octave - 3U)) + bucket_width / 2U;
+}
+
+static Timer::TimeDuration GetHistogramPercentile(const std::vector<uint64_t>& histogram, uint64_t samples_count, double percentile)
+{
+    // Nearest-rank method: percentile value is the smallest sample with rank not less than P% of samples count
+    const auto sample_rank = std::max<uint64_t>(1U, static_cast<uint64_t>(std::ceil(percentile * static_cast<double>(samples_count) / 100.0)));
+    uint64_t   rank        = 0U;
+    for(uint32_t bucket_index = 0U; bucket_index < histogram.size(); ++bucket_index)
+    {
+        rank += histogram[bucket_index];
+        if (rank >= sample_rank)
+            return std::chrono::duration_cast<Timer::TimeDuration>(std::chrono::nanoseconds(GetHistogramBucketMiddleNs(bucket_index)));
+    }
+    return Timer::TimeDuration{ };
+}
+
+static void WriteJsonString(std::ostream& out_stream, std::string_view str)
+{
+    out_stream << '"';
+    for(const char c : str)
+    {
+        switch(c)
+        {
+        case '"':  out_stream << "\\\""; break;
+        case '\\': out_stream << "\\\\"; break;
+        case '\n': out_stream << "\\n"; break;
+        case '\t': out_stream << "\\t"; break;
+        default:
+            if (static_cast<unsigned char>(c) < 0x20U)
+                out_stream << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(c) << std::dec << std::setfill(' ');
+            else
+                out_stream << c;
+        }
+    }
+    out_stream << '"';
+}
+
+static double GetDurationMSec(Timer::TimeDuration duration) noexcept
+{
+    return std::chrono::duration_cast<std::chrono::duration<double, std::milli>>(duration).count();
+}
+
+static void LogScopeStatistics(ILogger& logger, const std::vector<ScopeTimer::Aggregator::ScopeStatistics>& scopes_statistics)
+{
+    if (scopes_statistics.empty())
+        return;
+
+    std::stringstream ss;
+    ss << std::endl << "Aggregated performance timings:" << std::endl << std::fixed;
+
+    for(const ScopeTimer::Aggregator::ScopeStatistics& scope_statistics : scopes_statistics)
+    {
+        ss << "  - "        << scope_statistics.name
+           << ": "          << GetDurationMSec(scope_statistics.GetAverageDuration())
+           << " ms. average (p50 " << GetDurationMSec(scope_statistics.p50_duration)
+           << ", p95 "      << GetDurationMSec(scope_statistics.p95_duration)
+           << ", p99 "      << GetDurationMSec(scope_statistics.p99_duration)
+           << ", max "      << GetDurationMSec(scope_statistics.max_duration)
+           << " ms.) with " << scope_statistics.count
+           << " invocations count;" << std::endl;
+    }
+
+    logger.Log(ss.str());
+}
+
+#ifdef METHANE_MEMORY_ALLOCATIONS_TRACKING_ENABLED
+static void LogMemoryAllocations(ILogger& logger)
+{
+    const MemoryAllocations::FrameStatistics frame_statistics = MemoryAllocations::GetFrameStatistics();
+    const MemoryAllocations::Counters        total_counters   = MemoryAllocations::GetTotalCounters();
+
+    std::stringstream ss;
+    ss << std::endl << "Memory allocations:" << std::endl
+       << "  - total: " << static_cast<std::string>(total_counters) << ";" << std::endl;
+
+    if (frame_statistics.frames_count)
+    {
+        ss << "  - frames: " << frame_statistics.allocating_frames_count << " of " << frame_statistics.frames_count
+           << " frames have allocated memory, maximum " << frame_statistics.max_frame_allocations_count
+           << " allocations of " << frame_statistics.max_frame_allocated_size << " bytes per frame;" << std::endl
+           << "  - last frame: " << static_cast<std::string>(frame_statistics.last_frame) << ";" << std::endl;
+    }
+
+    logger.Log(ss.str());
+}
+#endif
+
+// Thread buffer is written only by the owning thread without locks:
+// scope counters are atomics updated with relaxed stores and read on collection under aggregator mutex,
+// trace events are appended to the single-producer single-consumer list of chunks, consumed on collection.
+class ScopeTimer::Aggregator::ThreadBuffer
+{
+public:
+    explicit ThreadBuffer(uint32_t thread_index) noexcept
+        : m_thread_index(thread_index)
+    { }
+
+    ThreadBuffer(const ThreadBuffer&) = delete;
+    ThreadBuffer(ThreadBuffer&&) = delete;
+
+    ~ThreadBuffer()
+    {
+        for(std::atomic<ScopeCountersBlock*>& scopes_block_ptr : m_scopes_blocks)
+        {
+            delete scopes_block_ptr.load(std::memory_order_acquire);
+        }
+        TraceChunk* trace_chunk_ptr = m_trace_head_ptr ? m_trace_head_ptr : m_trace_first_ptr.load(std::memory_order_acquire);
+        while(trace_chunk_ptr)
+        {
+            TraceChunk* next_trace_chunk_ptr = trace_chunk_ptr->next_ptr.load(std::memory_order_acquire);
+            delete trace_chunk_ptr;
+            trace_chunk_ptr = next_trace_chunk_ptr;
+        }
+    }
+
+    ThreadBuffer& operator=(const ThreadBuffer&) = delete;
+    ThreadBuffer& operator=(ThreadBuffer&&) = delete;
+
+    [[nodiscard]] uint32_t GetThreadIndex() const noexcept { return m_thread_index; }
+
+    // Called from the owning thread only
+    void AddScopeTiming(ScopeId scope_id, uint64_t duration_ns) noexcept
+    {
+        const uint32_t block_index = scope_id / g_scopes_block_size;
+        if (block_index >= g_scopes_blocks_count)
+        {
+            assert(false);
+            return;
+        }
+
+        ScopeCountersBlock* scopes_block_ptr = m_scopes_blocks[block_index].load(std::memory_order_relaxed);
+        if (!scopes_block_ptr)
+        {
+            scopes_block_ptr = new ScopeCountersBlock();
+            m_scopes_blocks[block_index].store(scopes_block_ptr, std::memory_order_release);
+        }
+
+        ScopeCounters& scope_counters = (*scopes_block_ptr)[scope_id % g_scopes_block_size];
+        Increment(scope_counters.count, uint64_t(1U));
+        Increment(scope_counters.total_duration_ns, duration_ns);
+        Increment(scope_counters.histogram[GetHistogramBucketIndex(duration_ns)], 1U);
+    }
+
+    // Called from the owning thread only
+    void AddTraceEvent(ScopeId scope_id, TimePoint start_time, TimeDuration duration)
+    {
+        if (!m_trace_tail_ptr)
+        {
+            m_trace_tail_ptr = new TraceChunk();
+            m_trace_first_ptr.store(m_trace_tail_ptr, std::memory_order_release);
+        }
+
+        uint32_t events_count = m_trace_tail_ptr->count.load(std::memory_order_relaxed);
+        if (events_count == g_trace_chunk_size)
+        {
+            auto* next_trace_chunk_ptr = new TraceChunk();
+            m_trace_tail_ptr->next_ptr.store(next_trace_chunk_ptr, std::memory_order_release);
+            m_trace_tail_ptr = next_trace_chunk_ptr;
+            events_count = 0U;
+        }
+
+        m_trace_tail_ptr->events[events_count] = TraceRecord{ scope_id, start_time, duration };
+        m_trace_tail_ptr->count.store(events_count + 1U, std::memory_order_release);
+    }
+
+    // Called under aggregator mutex
+    void AddScopeTotals(ScopesTotals& scopes_totals) const
+    {
+        for(uint32_t block_index = 0U; block_index < g_scopes_blocks_count; ++block_index)
+        {
+            const ScopeCountersBlock* scopes_block_ptr = m_scopes_blocks[block_index].load(std::memory_order_acquire);
+            if (!scopes_block_ptr)
+                continue;
+
+            const size_t scopes_count = std::min<size_t>(g_scopes_block_size, scopes_totals.size() - std::min<size_t>(scopes_totals.size(), block_index * g_scopes_block_size));
+            for(size_t index = 0U; index < scopes_count; ++index)
+            {
+                const ScopeCounters& scope_counters = (*scopes_block_ptr)[index];
+                const uint64_t scope_count = scope_counters.count.load(std::memory_order_relaxed);
+                if (!scope_count)
+                    continue;
+
+                ScopeTotals& scope_totals = scopes_totals[block_index * g_scopes_block_size + index];
+                scope_totals.count             += scope_count;
+                scope_totals.total_duration_ns += scope_counters.total_duration_ns.load(std::memory_order_relaxed);
+                scope_totals.histogram.resize(g_histogram_buckets_count, 0U);
+                for(uint32_t bucket_index = 0U; bucket_index < g_histogram_buckets_count; ++bucket_index)
+                {
+                    scope_totals.histogram[bucket_index] += scope_counters.histogram[bucket_index].load(std::memory_order_relaxed);
+                }
+            }
+        }
+    }
+
+    // Called under aggregator mutex
+    template<typename ConsumeFuncType>
+    void ConsumeTraceEvents(const ConsumeFuncType& consume_trace_event)
+    {
+        if (!m_trace_head_ptr)
+        {
+            m_trace_head_ptr = m_trace_first_ptr.load(std::memory_order_acquire);
+            if (!m_trace_head_ptr)
+                return;
+        }
+
+        while(true)
+        {
+            const uint32_t events_count = m_trace_head_ptr->count.load(std::memory_order_acquire);
+            for(uint32_t event_index = m_trace_head_consumed_count; event_index < events_count; ++event_index)
+            {
+                const TraceRecord& trace_record = m_trace_head_ptr->events[event_index];
+                consume_trace_event(trace_record.scope_id, trace_record.start_time, trace_record.duration);
+            }
+            m_trace_head_consumed_count = events_count;
+
+            // Fully consumed chunk is released only when producer has moved to the next chunk
+            TraceChunk* next_trace_chunk_ptr = events_count == g_trace_chunk_size
+                                             ? m_trace_head_ptr->next_ptr.load(std::memory_order_acquire)
+                                             : nullptr;
+            if (!next_trace_chunk_ptr)
+                return;
+
+            delete m_trace_head_ptr;
+            m_trace_head_ptr = next_trace_chunk_ptr;
+            m_trace_head_consumed_count = 0U;
+        }
+    }
+
+private:
+    struct ScopeCounters
+    {
+        std::atomic<uint64_t> count;
+        std::atomic<uint64_t> total_duration_ns;
+        std::array<std::atomic<uint32_t>, g_histogram_buckets_count> histogram;
+    };
+
+    struct TraceRecord
+    {
+        ScopeId      scope_id;
+        TimePoint    start_time;
+        TimeDuration duration;
+    };
+
+    struct TraceChunk
+    {
+        std::array<TraceRecord, g_trace_chunk_size> events;
+        std::atomic<uint32_t>                       count{ 0U };
+        std::atomic<TraceChunk*>                    next_ptr{ nullptr };
+    };
+
+    using ScopeCountersBlock = std::array<ScopeCounters, g_scopes_block_size>;
+
+    // Counters are written by the owning thread only, so atomic read-modify-write operations are not required
+    template<typename T>
+    static void Increment(std::atomic<T>& counter, T value) noexcept
+    {
+        counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+    }
+
+    const uint32_t                                                    m_thread_index;
+    std::array<std::atomic<ScopeCountersBlock*>, g_scopes_blocks_count> m_scopes_blocks{ };
+    std::atomic<TraceChunk*>                                          m_trace_first_ptr{ nullptr };
+    TraceChunk*                                                       m_trace_tail_ptr = nullptr;  // producer side
+    TraceChunk*                                                       m_trace_head_ptr = nullptr;  // consumer side
+    uint32_t                                                          m_trace_head_consumed_count = 0U;
+};
+
+// Thread buffer is acquired on first scope timing in thread and returned back to aggregator on thread exit
+// for reuse by other threads, so that collected timings of finished threads are preserved
+class ScopeTimer::Aggregator::ThreadBufferHolder
+{
+public:
+    explicit ThreadBufferHolder(Aggregator& aggregator)
+        : m_aggregator(aggregator)
+        , m_thread_buffer(aggregator.AcquireThreadBuffer())
+    { }
+
+    ThreadBufferHolder(const ThreadBufferHolder&) = delete;
+    ThreadBufferHolder(ThreadBufferHolder&&) = delete;
+
+    ~ThreadBufferHolder()
+    {
+        m_aggregator.ReleaseThreadBuffer(m_thread_buffer);
+    }
+
+    ThreadBufferHolder& operator=(const ThreadBufferHolder&) = delete;
+    ThreadBufferHolder& operator=(ThreadBufferHolder&&) = delete;
+
+    [[nodiscard]] ThreadBuffer& GetThreadBuffer() const noexcept { return m_thread_buffer; }
+
+private:
+    Aggregator&   m_aggregator;
+    ThreadBuffer& m_thread_buffer;
+};
+
+Timer::TimeDuration ScopeTimer::Aggregator::ScopeStatistics::GetAverageDuration() const noexcept
+{
+    return count ? total_duration / static_cast<TimeDuration::rep>(count) : TimeDuration{ };
+}
+
 ScopeTimer::Aggregator& ScopeTimer::Aggregator::Get() noexcept
 {
     META_FUNCTION_TASK();
@@ -38,86 +376,300 @@ ScopeTimer::Aggregator& ScopeTimer::Aggregator::Get() noexcept
     return s_scope_aggregator;
 }
 
+ScopeTimer::Aggregator::Aggregator()
+    : m_trace_start_time(Clock::now())
+{ }
+
 ScopeTimer::Aggregator::~Aggregator()
 {
     META_FUNCTION_TASK();
     Flush();
 }
 
-void ScopeTimer::Aggregator::Flush() noexcept
+ScopeTimer::Registration ScopeTimer::Aggregator::RegisterScope(const char* scope_name)
 {
     META_FUNCTION_TASK();
-    if (m_logger_ptr)
+    std::scoped_lock lock(m_mutex);
+    const auto [ scope_name_and_id_it, scope_added ] = m_scope_id_by_name.try_emplace(std::string_view(scope_name), static_cast<ScopeId>(m_scope_names.size()));
+    const ScopeId scope_id = scope_name_and_id_it->second;
+    if (scope_added)
     {
-        LogTimings(*m_logger_ptr);
+        m_scope_names.push_back(scope_name);
+        m_counters_by_scope_id.emplace_back(ITT_COUNTER_INIT(scope_name, g_methane_itt_domain_name));
+#ifdef TRACY_ENABLE
+        TracyPlotConfig(scope_name, tracy::PlotFormatType::Number, false, false, 0);
+#endif
     }
+    return Registration{ m_scope_names[scope_id], scope_id, &m_counters_by_scope_id[scope_id] };
+}
 
-    m_timing_by_scope_id.clear();
-    m_scope_id_by_name.clear();
-    m_new_scope_id = 0U;
+std::vector<ScopeTimer::Aggregator::ScopeStatistics> ScopeTimer::Aggregator::GetScopeStatistics()
+{
+    META_FUNCTION_TASK();
+    std::scoped_lock lock(m_mutex);
+    CollectScopeTotals();
+    return GetCollectedScopeStatistics();
 }
 
 void ScopeTimer::Aggregator::LogTimings(ILogger& logger) noexcept
 {
     META_FUNCTION_TASK();
-    if (m_timing_by_scope_id.empty())
-        return;
+    try
+    {
+        LogScopeStatistics(logger, GetScopeStatistics());
+#ifdef METHANE_MEMORY_ALLOCATIONS_TRACKING_ENABLED
+        LogMemoryAllocations(logger);
+#endif
+    }
+    catch(const std::exception&)
+    {
+        assert(false);
+    }
+}
 
-    std::stringstream ss;
-    ss << std::endl << "Aggregated performance timings:" << std::endl;
+void ScopeTimer::Aggregator::Flush() noexcept
+{
+    META_FUNCTION_TASK();
+    try
+    {
+        std::vector<ScopeStatistics> scopes_statistics;
+        {
+            std::scoped_lock lock(m_mutex);
+            CollectScopeTotals();
+            scopes_statistics = GetCollectedScopeStatistics();
+            m_flushed_totals = m_collected_totals;
+        }
 
-    for (const auto& [scope_name, scope_id] : m_scope_id_by_name)
+        if (m_logger_ptr)
+        {
+            LogScopeStatistics(*m_logger_ptr, scopes_statistics);
+#ifdef METHANE_MEMORY_ALLOCATIONS_TRACKING_ENABLED
+            LogMemoryAllocations(*m_logger_ptr);
+#endif
+        }
+
+#ifdef METHANE_MEMORY_ALLOCATIONS_TRACKING_ENABLED
+        // Frame allocation statistics are accumulated since the last flush, same as scope timings
+        MemoryAllocations::ResetFrameStatistics();
+#endif
+    }
+    catch(const std::exception&)
     {
-        if (scope_id >= m_timing_by_scope_id.size())
-            continue;
+        assert(false);
+    }
 
-        const Timing& scope_timing = m_timing_by_scope_id[scope_id];
-        const double total_duration_sec = std::chrono::duration_cast<std::chrono::duration<double>>(scope_timing.duration).count();
-        const double average_duration_ms = total_duration_sec * 1000.0 / scope_timing.count;
+    WriteTraceFile();
+}
 
-        ss << "  - "       << scope_name
-           << ": "         << std::fixed << average_duration_ms
-           << " ms. with " << scope_timing.count
-           << " invocations count;" << std::endl;
+void ScopeTimer::Aggregator::SetTraceEnabled(bool trace_enabled) noexcept
+{
+    META_FUNCTION_TASK();
+    m_trace_enabled.store(trace_enabled, std::memory_order_relaxed);
+}
+
+void ScopeTimer::Aggregator::SetTraceFilePath(const std::string& trace_file_path)
+{
+    META_FUNCTION_TASK();
+    {
+        std::scoped_lock lock(m_mutex);
+        m_trace_file_path = trace_file_path;
     }
+    SetTraceEnabled(!trace_file_path.empty());
+}
 
-    logger.Log(ss.str());
+size_t ScopeTimer::Aggregator::GetTraceEventsCount()
+{
+    META_FUNCTION_TASK();
+    std::scoped_lock lock(m_mutex);
+    CollectTraceEvents();
+    return m_trace_events.size();
 }
 
-ScopeTimer::Registration ScopeTimer::Aggregator::RegisterScope(const char* scope_name)
+void ScopeTimer::Aggregator::WriteTrace(std::ostream& trace_stream)
 {
     META_FUNCTION_TASK();
-    const auto [ scope_name_and_id_it, scope_added ] = m_scope_id_by_name.try_emplace(scope_name, m_new_scope_id);
-    if (scope_added)
+    std::scoped_lock lock(m_mutex);
+    CollectTraceEvents();
+
+    // Chrome trace event format with complete events, which can be opened in chrome://tracing or https://ui.perfetto.dev
+    trace_stream << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    trace_stream << std::fixed << std::setprecision(3);
+    bool is_first_event = true;
+    for(const TraceEvent& trace_event : m_trace_events)
     {
-        m_new_scope_id++;
-        m_timing_by_scope_id.resize(m_new_scope_id);
-        m_counters_by_scope_id.emplace_back(ITT_COUNTER_INIT(scope_name_and_id_it->first, g_methane_itt_domain_name));
-#ifdef TRACY_ENABLE
-        TracyPlotConfig(scope_name_and_id_it->first, tracy::PlotFormatType::Number, false, false, 0);
-#endif
+        trace_stream << (is_first_event ? "\n" : ",\n") << "{\"name\":";
+        WriteJsonString(trace_stream, m_scope_names[trace_event.scope_id]);
+        trace_stream << ",\"cat\":\"ScopeTimer\",\"ph\":\"X\",\"pid\":0,\"tid\":" << trace_event.thread_index
+                     << ",\"ts\":"  << std::chrono::duration_cast<std::chrono::duration<double, std::micro>>(trace_event.start_time - m_trace_start_time).count()
+                     << ",\"dur\":" << std::chrono::duration_cast<std::chrono::duration<double, std::micro>>(trace_event.duration).count()
+                     << "}";
+        is_first_event = false;
     }
-    return Registration{ scope_name_and_id_it->first, scope_name_and_id_it->second };
+    trace_stream << "\n]}\n";
 }
 
-void ScopeTimer::Aggregator::AddScopeTiming(const Registration& scope_registration, TimeDuration duration) noexcept
+void ScopeTimer::Aggregator::ClearTrace()
 {
     META_FUNCTION_TASK();
-    ITT_COUNTER_VALUE(m_counters_by_scope_id[scope_registration.id], std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count());
+    std::scoped_lock lock(m_mutex);
+    CollectTraceEvents();
+    m_trace_events.clear();
+}
+
+void ScopeTimer::Aggregator::AddScopeTiming(const Registration& scope_registration, TimePoint start_time, TimeDuration duration) noexcept
+{
+    META_FUNCTION_TASK();
+    const uint64_t duration_ns = GetDurationNs(duration);
+
+#ifdef ITT_INSTRUMENTATION_ENABLED
+    if (scope_registration.counter_ptr)
+    {
+        ITT_COUNTER_VALUE(*scope_registration.counter_ptr, duration_ns);
+    }
+#endif
 
 #ifdef TRACY_ENABLE
-    TracyPlot(scope_registration.name, std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count());
+    TracyPlot(scope_registration.name, static_cast<int64_t>(duration_ns));
 #endif
 
-    if (scope_registration.id >= m_timing_by_scope_id.size())
+    try
+    {
+        ThreadBuffer& thread_buffer = GetThreadBuffer();
+        thread_buffer.AddScopeTiming(scope_registration.id, duration_ns);
+        if (IsTraceEnabled())
+        {
+            thread_buffer.AddTraceEvent(scope_registration.id, start_time, duration);
+        }
+    }
+    catch(const std::exception&)
     {
         assert(false);
-        return;
     }
+}
+
+ScopeTimer::Aggregator::ThreadBuffer& ScopeTimer::Aggregator::GetThreadBuffer()
+{
+    thread_local const ThreadBufferHolder s_thread_buffer_holder(*this);
+    return s_thread_buffer_holder.GetThreadBuffer();
+}
 
-    Timing& scope_timing = m_timing_by_scope_id[scope_registration.id];
-    scope_timing.count++;
-    scope_timing.duration += duration;
+ScopeTimer::Aggregator::ThreadBuffer& ScopeTimer::Aggregator::AcquireThreadBuffer()
+{
+    META_FUNCTION_TASK();
+    std::scoped_lock lock(m_mutex);
+    if (!m_free_thread_buffers.empty())
+    {
+        ThreadBuffer& thread_buffer = *m_free_thread_buffers.back();
+        m_free_thread_buffers.pop_back();
+        return thread_buffer;
+    }
+    return *m_thread_buffers.emplace_back(std::make_unique<ThreadBuffer>(static_cast<uint32_t>(m_thread_buffers.size())));
+}
+
+void ScopeTimer::Aggregator::ReleaseThreadBuffer(ThreadBuffer& thread_buffer) noexcept
+{
+    META_FUNCTION_TASK();
+    try
+    {
+        std::scoped_lock lock(m_mutex);
+        m_free_thread_buffers.push_back(&thread_buffer);
+    }
+    catch(const std::exception&)
+    {
+        assert(false);
+    }
+}
+
+void ScopeTimer::Aggregator::CollectScopeTotals()
+{
+    META_FUNCTION_TASK();
+    m_collected_totals.assign(m_scope_names.size(), ScopeTotals{});
+    for(const UniquePtr<ThreadBuffer>& thread_buffer_ptr : m_thread_buffers)
+    {
+        thread_buffer_ptr->AddScopeTotals(m_collected_totals);
+    }
+}
+
+void ScopeTimer::Aggregator::CollectTraceEvents()
+{
+    META_FUNCTION_TASK();
+    for(const UniquePtr<ThreadBuffer>& thread_buffer_ptr : m_thread_buffers)
+    {
+        const uint32_t thread_index = thread_buffer_ptr->GetThreadIndex();
+        thread_buffer_ptr->ConsumeTraceEvents(
+            [this, thread_index](ScopeId scope_id, TimePoint start_time, TimeDuration duration)
+            {
+                m_trace_events.push_back(TraceEvent{ scope_id, thread_index, start_time, duration });
+            });
+    }
+}
+
+std::vector<ScopeTimer::Aggregator::ScopeStatistics> ScopeTimer::Aggregator::GetCollectedScopeStatistics() const
+{
+    META_FUNCTION_TASK();
+    std::vector<ScopeStatistics> scopes_statistics;
+    std::vector<uint64_t>        histogram(g_histogram_buckets_count, 0U);
+
+    // Scopes statistics are sorted by name and contain only timings added after the last flush
+    for(const auto& [scope_name, scope_id] : m_scope_id_by_name)
+    {
+        const ScopeTotals& collected_totals = m_collected_totals[scope_id];
+        const ScopeTotals* flushed_totals_ptr = scope_id < m_flushed_totals.size() ? &m_flushed_totals[scope_id] : nullptr;
+        const uint64_t     flushed_count      = flushed_totals_ptr ? flushed_totals_ptr->count : 0U;
+        if (collected_totals.count <= flushed_count)
+            continue;
+
+        for(uint32_t bucket_index = 0U; bucket_index < g_histogram_buckets_count; ++bucket_index)
+        {
+            const uint64_t flushed_bucket_count = flushed_totals_ptr && !flushed_totals_ptr->histogram.empty() ? flushed_totals_ptr->histogram[bucket_index] : 0U;
+            histogram[bucket_index] = collected_totals.histogram[bucket_index] - flushed_bucket_count;
+        }
+
+        const auto min_bucket_it = std::find_if(histogram.begin(), histogram.end(), [](uint64_t count) { return count > 0U; });
+        const auto max_bucket_it = std::find_if(histogram.rbegin(), histogram.rend(), [](uint64_t count) { return count > 0U; });
+
+        ScopeStatistics scope_statistics;
+        scope_statistics.name           = m_scope_names[scope_id];
+        scope_statistics.count          = collected_totals.count - flushed_count;
+        scope_statistics.total_duration = std::chrono::duration_cast<TimeDuration>(std::chrono::nanoseconds(
+                                              collected_totals.total_duration_ns - (flushed_totals_ptr ? flushed_totals_ptr->total_duration_ns : 0U)));
+        scope_statistics.min_duration   = std::chrono::duration_cast<TimeDuration>(std::chrono::nanoseconds(
+                                              GetHistogramBucketMiddleNs(static_cast<uint32_t>(std::distance(histogram.begin(), min_bucket_it)))));
+        scope_statistics.max_duration   = std::chrono::duration_cast<TimeDuration>(std::chrono::nanoseconds(
+                                              GetHistogramBucketMiddleNs(static_cast<uint32_t>(std::distance(max_bucket_it, histogram.rend()) - 1))));
+        scope_statistics.p50_duration   = GetHistogramPercentile(histogram, scope_statistics.count, 50.0);
+        scope_statistics.p95_duration   = GetHistogramPercentile(histogram, scope_statistics.count, 95.0);
+        scope_statistics.p99_duration   = GetHistogramPercentile(histogram, scope_statistics.count, 99.0);
+        scopes_statistics.push_back(scope_statistics);
+    }
+    return scopes_statistics;
+}
+
+void ScopeTimer::Aggregator::WriteTraceFile() noexcept
+{
+    META_FUNCTION_TASK();
+    try
+    {
+        std::string trace_file_path;
+        {
+            std::scoped_lock lock(m_mutex);
+            trace_file_path = m_trace_file_path;
+        }
+        if (trace_file_path.empty())
+            return;
+
+        std::ofstream trace_file(trace_file_path, std::ios::trunc);
+        WriteTrace(trace_file);
+        if (m_logger_ptr)
+        {
+            m_logger_ptr->Log(trace_file ? "Scope timers trace was written to file: " + trace_file_path
+                                         : "Failed to write scope timers trace to file: " + trace_file_path);
+        }
+    }
+    catch(const std::exception&)
+    {
+        assert(false);
+    }
 }
 
 ScopeTimer::ScopeTimer(const char* scope_name)
@@ -125,10 +677,15 @@ ScopeTimer::ScopeTimer(const char* scope_name)
     , m_registration(Aggregator::Get().RegisterScope(scope_name))
 { }
 
+ScopeTimer::ScopeTimer(const Registration& scope_registration)
+    : Timer()
+    , m_registration(scope_registration)
+{ }
+
 ScopeTimer::~ScopeTimer()
 {
     META_FUNCTION_TASK();
-    Aggregator::Get().AddScopeTiming(m_registration, GetElapsedDuration());
+    Aggregator::Get().AddScopeTiming(m_registration, GetStartTime(), GetElapsedDuration());
 }
 
 } // namespace Methane
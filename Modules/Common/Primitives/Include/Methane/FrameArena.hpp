@@ -0,0 +1,163 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/FrameArena.hpp
+Per-frame bump allocator of temporary memory released all at once on frame reset,
+and STL allocator adapter to place containers of frame temporaries in arena memory.
+
+******************************************************************************/
+
+#pragma once
+
+#include "Checks.hpp"
+
+#include <memory>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+
+namespace Methane
+{
+
+// Arena is not thread-safe: it is intended to be owned by the thread encoding the frame.
+// Blocks allocated during the frame are coalesced to a single block of the same total capacity on reset,
+// so the arena stops allocating from heap after the first frames with the maximum memory consumption.
+class FrameArena
+{
+public:
+    static constexpr size_t default_block_size = 64U * 1024U;
+
+    explicit FrameArena(size_t block_size = default_block_size)
+        : m_block_size(block_size)
+    {
+        META_CHECK_ARG_NOT_ZERO(block_size);
+    }
+
+    FrameArena(const FrameArena&) = delete;
+    FrameArena(FrameArena&&) noexcept = default;
+    FrameArena& operator=(const FrameArena&) = delete;
+    FrameArena& operator=(FrameArena&&) noexcept = default;
+
+    [[nodiscard]] void* Allocate(size_t size, size_t alignment = alignof(std::max_align_t))
+    {
+        META_CHECK_ARG_DESCR(alignment, alignment && !(alignment & (alignment - 1U)), "alignment must be a power of two");
+        while (m_block_index < m_blocks.size())
+        {
+            Block& block = m_blocks[m_block_index];
+            const auto   block_address  = reinterpret_cast<uintptr_t>(block.data_ptr.get()); // NOSONAR
+            const size_t aligned_offset = ((block_address + m_block_offset + alignment - 1U) & ~(alignment - 1U)) - block_address;
+            if (aligned_offset + size <= block.size)
+            {
+                m_used_size   += aligned_offset + size - m_block_offset;
+                m_block_offset = aligned_offset + size;
+                return block.data_ptr.get() + aligned_offset;
+            }
+            m_block_index++;
+            m_block_offset = 0U;
+        }
+
+        m_blocks.emplace_back(std::max(m_block_size, size + alignment));
+        m_block_index = m_blocks.size() - 1U;
+        return Allocate(size, alignment);
+    }
+
+    template<typename T>
+    [[nodiscard]] T* Allocate(size_t count = 1U)
+    {
+        return static_cast<T*>(Allocate(sizeof(T) * count, alignof(T)));
+    }
+
+    // Releases all memory allocated in the frame, objects placed in arena are not destroyed
+    void Reset()
+    {
+        if (m_blocks.size() > 1U)
+        {
+            const size_t capacity = GetCapacity();
+            m_blocks.clear();
+            m_blocks.emplace_back(capacity);
+        }
+        m_block_index  = 0U;
+        m_block_offset = 0U;
+        m_used_size    = 0U;
+    }
+
+    [[nodiscard]] size_t GetUsedSize() const noexcept   { return m_used_size; }
+    [[nodiscard]] size_t GetBlocksCount() const noexcept { return m_blocks.size(); }
+    [[nodiscard]] size_t GetCapacity() const noexcept
+    {
+        size_t capacity = 0U;
+        for(const Block& block : m_blocks)
+            capacity += block.size;
+        return capacity;
+    }
+
+private:
+    struct Block
+    {
+        explicit Block(size_t block_size)
+            : data_ptr(std::make_unique<std::byte[]>(block_size))
+            , size(block_size)
+        { }
+
+        std::unique_ptr<std::byte[]> data_ptr;
+        size_t                       size;
+    };
+
+    size_t             m_block_size;
+    std::vector<Block> m_blocks;
+    size_t             m_block_index  = 0U;
+    size_t             m_block_offset = 0U;
+    size_t             m_used_size    = 0U;
+};
+
+// STL allocator placing container elements in frame arena, deallocation is deferred to the arena reset
+template<typename T>
+class FrameArenaAllocator
+{
+public:
+    using value_type = T;
+
+    explicit FrameArenaAllocator(FrameArena& arena) noexcept
+        : m_arena_ptr(&arena)
+    { }
+
+    template<typename U>
+    FrameArenaAllocator(const FrameArenaAllocator<U>& other) noexcept // NOSONAR - implicit conversion is required by allocator requirements
+        : m_arena_ptr(&other.GetArena())
+    { }
+
+    [[nodiscard]] T* allocate(size_t count)  { return m_arena_ptr->Allocate<T>(count); }
+    void deallocate(T*, size_t) const noexcept { /* memory is released on arena reset */ }
+
+    [[nodiscard]] FrameArena& GetArena() const noexcept { return *m_arena_ptr; }
+
+    template<typename U>
+    [[nodiscard]] bool operator==(const FrameArenaAllocator<U>& other) const noexcept { return m_arena_ptr == &other.GetArena(); }
+
+    template<typename U>
+    [[nodiscard]] bool operator!=(const FrameArenaAllocator<U>& other) const noexcept { return !(*this == other); }
+
+private:
+    FrameArena* m_arena_ptr;
+};
+
+template<typename T>
+using FrameVector = std::vector<T, FrameArenaAllocator<T>>;
+
+} // namespace Methane
@@ -0,0 +1,116 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Data/AnimationsBatch.h
+Batch of animations of the same type stored in contiguous arrays (structure of arrays),
+which are updated with one virtual call per range of animations and removed with swap-and-pop.
+
+******************************************************************************/
+
+#pragma once
+
+#include "TimeAnimation.h"
+
+#include <Methane/Timer.hpp>
+
+#include <vector>
+#include <limits>
+
+namespace Methane::Data
+{
+
+class AnimationsBatch
+{
+public:
+    using TimePoint    = Timer::TimePoint;
+    using TimeDuration = Timer::TimeDuration;
+
+    AnimationsBatch() = default;
+    AnimationsBatch(const AnimationsBatch&) = delete;
+    AnimationsBatch(AnimationsBatch&&) = delete;
+    virtual ~AnimationsBatch() = default;
+
+    AnimationsBatch& operator=(const AnimationsBatch&) = delete;
+    AnimationsBatch& operator=(AnimationsBatch&&) = delete;
+
+    [[nodiscard]] size_t GetCount() const noexcept { return m_durations.size(); }
+    [[nodiscard]] bool   IsEmpty() const noexcept  { return m_durations.empty(); }
+
+    // Updates animations in range [begin_index, end_index) to the given time point,
+    // non-overlapping ranges of the same batch can be updated in parallel
+    virtual void Update(TimePoint update_time, size_t begin_index, size_t end_index) = 0;
+    virtual void DryUpdate() = 0;
+
+    // Removes animations completed on last update by moving the last animations in place of them,
+    // so the order of animations in batch is not preserved
+    size_t RemoveCompleted();
+    void   DelayStartTime(TimeDuration delay_duration) noexcept;
+    void   Clear();
+
+protected:
+    void AddAnimation(double duration_sec);
+
+    // Returns false when animation time is over and its update function should not be called
+    [[nodiscard]] bool GetElapsedSeconds(size_t index, TimePoint update_time, double& elapsed_seconds, double& delta_seconds) const noexcept
+    {
+        elapsed_seconds = std::chrono::duration_cast<std::chrono::duration<double>>(update_time - m_start_times[index]).count();
+        delta_seconds   = elapsed_seconds - m_prev_elapsed_seconds[index];
+        return elapsed_seconds < m_durations[index];
+    }
+
+    void SetUpdated(size_t index, double elapsed_seconds, bool is_running) noexcept
+    {
+        m_prev_elapsed_seconds[index] = elapsed_seconds;
+        m_completed_flags[index]      = is_running ? 0U : 1U;
+    }
+
+    [[nodiscard]] double GetPrevElapsedSeconds(size_t index) const noexcept { return m_prev_elapsed_seconds[index]; }
+
+    virtual void MoveAnimation(size_t from_index, size_t to_index) = 0;
+    virtual void PopAnimation() = 0;
+    virtual void ClearAnimations() = 0;
+
+private:
+    std::vector<TimePoint> m_start_times;
+    std::vector<double>    m_durations;
+    std::vector<double>    m_prev_elapsed_seconds;
+    std::vector<uint8_t>   m_completed_flags; // not std::vector<bool> to allow writing flags from parallel threads
+};
+
+class TimeAnimationsBatch final : public AnimationsBatch
+{
+public:
+    using FunctionType = TimeAnimation::FunctionType;
+
+    void Add(const FunctionType& update_function, double duration_sec = std::numeric_limits<double>::max());
+
+    // AnimationsBatch overrides
+    void Update(TimePoint update_time, size_t begin_index, size_t end_index) override;
+    void DryUpdate() override;
+
+protected:
+    // AnimationsBatch overrides
+    void MoveAnimation(size_t from_index, size_t to_index) override;
+    void PopAnimation() override;
+    void ClearAnimations() override;
+
+private:
+    std::vector<FunctionType> m_update_functions;
+};
+
+} // namespace Methane::Data
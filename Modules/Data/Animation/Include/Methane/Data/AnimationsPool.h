@@ -24,10 +24,23 @@ Pool of animations for centralized updating, adding and removing in application.
 #pragma once
 
 #include <Methane/Memory.hpp>
+#include <Methane/Instrumentation.h>
 
 #include "Animation.h"
+#include "AnimationsBatch.h"
+#include "ValueAnimationsBatch.hpp"
 
 #include <deque>
+#include <functional>
+#include <vector>
+#include <typeindex>
+#include <unordered_map>
+
+namespace tf // NOSONAR
+{
+// TaskFlow Executor class forward declaration from <taskflow/core/executor.hpp>
+class Executor;
+}
 
 namespace Methane::Data
 {
@@ -37,11 +50,43 @@ using Animations = std::deque<Ptr<Animation>>;
 class AnimationsPool : public Animations
 {
 public:
+    static constexpr size_t default_parallel_update_threshold = 4096U;
+
     void Update();
     void DryUpdate() const;
     void Pause();
     void Resume();
 
+    // Batched animations are stored by value in contiguous per-type arrays and can not be controlled individually,
+    // they are removed from pool when update function returns false or animation duration is over;
+    // animations added from update functions of batched animations are deferred until the end of batches update
+    void AddTimeAnimation(const TimeAnimation::FunctionType& update_function,
+                          double duration_sec = std::numeric_limits<double>::max());
+
+    template<typename ValueType>
+    void AddValueAnimation(ValueType& value, const typename ValueAnimation<ValueType>::FunctionType& update_function,
+                           double duration_sec = std::numeric_limits<double>::max())
+    {
+        META_FUNCTION_TASK();
+        if (m_is_updating_batches)
+        {
+            m_deferred_batch_additions.emplace_back([this, &value, update_function, duration_sec]()
+            {
+                GetBatch<ValueAnimationsBatch<ValueType>>().Add(value, update_function, duration_sec);
+            });
+            return;
+        }
+        GetBatch<ValueAnimationsBatch<ValueType>>().Add(value, update_function, duration_sec);
+    }
+
+    [[nodiscard]] size_t GetBatchedAnimationsCount() const noexcept;
+    void ClearBatchedAnimations();
+
+    // Batches with animations count above threshold are updated in parallel with executor tasks,
+    // so their update functions must not modify state shared with other animations
+    void SetParallelExecutor(tf::Executor* parallel_executor_ptr,
+                             size_t parallel_update_threshold = default_parallel_update_threshold) noexcept;
+
     // When animations are paused dry updates are called on every app update at the same point in time,
     // such behavior consumes CPU cycles on pause but could be useful to keep GPU state in sync with CPU when it does not depend just on animation time
     [[nodiscard]] bool IsPaused() const noexcept                  { return m_is_paused; }
@@ -50,8 +95,30 @@ public:
     void SetDryUpdateOnPauseEnabled(bool enabled) noexcept  { m_is_dry_update_on_pause_enabled = enabled; }
 
 private:
-    bool m_is_paused = false;
-    bool m_is_dry_update_on_pause_enabled = false;
+    template<typename BatchType>
+    BatchType& GetBatch()
+    {
+        auto batch_it = m_batch_by_type.find(typeid(BatchType));
+        if (batch_it == m_batch_by_type.end())
+        {
+            m_batches.emplace_back(std::make_unique<BatchType>());
+            batch_it = m_batch_by_type.try_emplace(typeid(BatchType), m_batches.back().get()).first;
+        }
+        return static_cast<BatchType&>(*batch_it->second);
+    }
+
+    void UpdateAnimations();
+    void UpdateBatches();
+
+    std::vector<UniquePtr<AnimationsBatch>>               m_batches;
+    std::unordered_map<std::type_index, AnimationsBatch*> m_batch_by_type;
+    std::vector<std::function<void()>>                    m_deferred_batch_additions;
+    tf::Executor*                                         m_parallel_executor_ptr = nullptr;
+    size_t                                                m_parallel_update_threshold = default_parallel_update_threshold;
+    Timer::TimePoint                                      m_pause_time;
+    bool                                                  m_is_updating_batches = false;
+    bool                                                  m_is_paused = false;
+    bool                                                  m_is_dry_update_on_pause_enabled = false;
 };
 
 } // namespace Methane::Data
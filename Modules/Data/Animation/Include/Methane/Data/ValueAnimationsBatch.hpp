@@ -0,0 +1,102 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Data/ValueAnimationsBatch.hpp
+Batch of value animations of the same value type stored in contiguous arrays.
+
+******************************************************************************/
+
+#pragma once
+
+#include "AnimationsBatch.h"
+#include "ValueAnimation.hpp"
+
+#include <Methane/Instrumentation.h>
+
+namespace Methane::Data
+{
+
+template<typename ValueType>
+class ValueAnimationsBatch final : public AnimationsBatch
+{
+public:
+    using FunctionType = typename ValueAnimation<ValueType>::FunctionType;
+
+    void Add(ValueType& value, const FunctionType& update_function,
+             double duration_sec = std::numeric_limits<double>::max())
+    {
+        META_FUNCTION_TASK();
+        AddAnimation(duration_sec);
+        m_value_ptrs.emplace_back(&value);
+        m_start_values.emplace_back(value);
+        m_update_functions.emplace_back(update_function);
+    }
+
+    // AnimationsBatch overrides
+    void Update(TimePoint update_time, size_t begin_index, size_t end_index) override
+    {
+        META_FUNCTION_TASK();
+        for(size_t index = begin_index; index < end_index; ++index)
+        {
+            double elapsed_seconds = 0.0;
+            double delta_seconds   = 0.0;
+            const bool is_running  = GetElapsedSeconds(index, update_time, elapsed_seconds, delta_seconds) &&
+                                     m_update_functions[index](*m_value_ptrs[index], m_start_values[index], elapsed_seconds, delta_seconds);
+            SetUpdated(index, elapsed_seconds, is_running);
+        }
+    }
+
+    void DryUpdate() override
+    {
+        META_FUNCTION_TASK();
+        for(size_t index = 0U; index < m_update_functions.size(); ++index)
+        {
+            m_update_functions[index](*m_value_ptrs[index], m_start_values[index], GetPrevElapsedSeconds(index), 0.0);
+        }
+    }
+
+protected:
+    // AnimationsBatch overrides
+    void MoveAnimation(size_t from_index, size_t to_index) override
+    {
+        m_value_ptrs[to_index]       = m_value_ptrs[from_index];
+        m_start_values[to_index]     = std::move(m_start_values[from_index]);
+        m_update_functions[to_index] = std::move(m_update_functions[from_index]);
+    }
+
+    void PopAnimation() override
+    {
+        m_value_ptrs.pop_back();
+        m_start_values.pop_back();
+        m_update_functions.pop_back();
+    }
+
+    void ClearAnimations() override
+    {
+        m_value_ptrs.clear();
+        m_start_values.clear();
+        m_update_functions.clear();
+    }
+
+private:
+    std::vector<ValueType*>   m_value_ptrs;
+    std::vector<ValueType>    m_start_values;
+    std::vector<FunctionType> m_update_functions;
+};
+
+} // namespace Methane::Data
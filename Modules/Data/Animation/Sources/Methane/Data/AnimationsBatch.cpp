@@ -0,0 +1,135 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Data/AnimationsBatch.cpp
+Batch of animations of the same type stored in contiguous arrays (structure of arrays),
+which are updated with one virtual call per range of animations and removed with swap-and-pop.
+
+******************************************************************************/
+
+#include <Methane/Data/AnimationsBatch.h>
+#include <Methane/Instrumentation.h>
+
+namespace Methane::Data
+{
+
+size_t AnimationsBatch::RemoveCompleted()
+{
+    META_FUNCTION_TASK();
+    size_t removed_count = 0U;
+    for(size_t index = 0U; index < m_completed_flags.size();)
+    {
+        if (!m_completed_flags[index])
+        {
+            ++index;
+            continue;
+        }
+
+        if (const size_t last_index = m_completed_flags.size() - 1U;
+            index != last_index)
+        {
+            m_start_times[index]          = m_start_times[last_index];
+            m_durations[index]            = m_durations[last_index];
+            m_prev_elapsed_seconds[index] = m_prev_elapsed_seconds[last_index];
+            m_completed_flags[index]      = m_completed_flags[last_index];
+            MoveAnimation(last_index, index);
+        }
+
+        m_start_times.pop_back();
+        m_durations.pop_back();
+        m_prev_elapsed_seconds.pop_back();
+        m_completed_flags.pop_back();
+        PopAnimation();
+        ++removed_count;
+    }
+    return removed_count;
+}
+
+void AnimationsBatch::DelayStartTime(TimeDuration delay_duration) noexcept
+{
+    META_FUNCTION_TASK();
+    for(TimePoint& start_time : m_start_times)
+    {
+        start_time += delay_duration;
+    }
+}
+
+void AnimationsBatch::Clear()
+{
+    META_FUNCTION_TASK();
+    m_start_times.clear();
+    m_durations.clear();
+    m_prev_elapsed_seconds.clear();
+    m_completed_flags.clear();
+    ClearAnimations();
+}
+
+void AnimationsBatch::AddAnimation(double duration_sec)
+{
+    META_FUNCTION_TASK();
+    m_start_times.emplace_back(Timer::Clock::now());
+    m_durations.emplace_back(duration_sec);
+    m_prev_elapsed_seconds.emplace_back(0.0);
+    m_completed_flags.emplace_back(0U);
+}
+
+void TimeAnimationsBatch::Add(const FunctionType& update_function, double duration_sec)
+{
+    META_FUNCTION_TASK();
+    AddAnimation(duration_sec);
+    m_update_functions.emplace_back(update_function);
+}
+
+void TimeAnimationsBatch::Update(TimePoint update_time, size_t begin_index, size_t end_index)
+{
+    META_FUNCTION_TASK();
+    for(size_t index = begin_index; index < end_index; ++index)
+    {
+        double elapsed_seconds = 0.0;
+        double delta_seconds   = 0.0;
+        const bool is_running  = GetElapsedSeconds(index, update_time, elapsed_seconds, delta_seconds) &&
+                                 m_update_functions[index](elapsed_seconds, delta_seconds);
+        SetUpdated(index, elapsed_seconds, is_running);
+    }
+}
+
+void TimeAnimationsBatch::DryUpdate()
+{
+    META_FUNCTION_TASK();
+    for(size_t index = 0U; index < m_update_functions.size(); ++index)
+    {
+        m_update_functions[index](GetPrevElapsedSeconds(index), 0.0);
+    }
+}
+
+void TimeAnimationsBatch::MoveAnimation(size_t from_index, size_t to_index)
+{
+    m_update_functions[to_index] = std::move(m_update_functions[from_index]);
+}
+
+void TimeAnimationsBatch::PopAnimation()
+{
+    m_update_functions.pop_back();
+}
+
+void TimeAnimationsBatch::ClearAnimations()
+{
+    m_update_functions.clear();
+}
+
+} // namespace Methane::Data
@@ -24,15 +24,20 @@ Pool of animations for centralized updating, adding and removing in application.
 #include <Methane/Data/AnimationsPool.h>
 #include <Methane/Instrumentation.h>
 
-#include <vector>
+#include <taskflow/taskflow.hpp>
+#include <taskflow/algorithm/for_each.hpp>
+
+#include <algorithm>
 
 namespace Methane::Data
 {
 
+static constexpr size_t g_parallel_update_chunk_size = 1024U;
+
 void AnimationsPool::Update()
 {
     META_FUNCTION_TASK();
-    if (empty())
+    if (empty() && m_batches.empty())
         return;
 
     if (m_is_paused)
@@ -42,22 +47,8 @@ void AnimationsPool::Update()
         return;
     }
 
-    std::vector<size_t> completed_animation_indices;
-    for (size_t animation_index = 0; animation_index < size(); ++animation_index)
-    {
-        if (const Ptr<Animation>& animation_ptr = (*this)[animation_index];
-            !animation_ptr || !animation_ptr->Update())
-        {
-            completed_animation_indices.push_back(animation_index);
-        }
-    }
-
-    for (auto animation_index_it = completed_animation_indices.rbegin();
-              animation_index_it != completed_animation_indices.rend(); 
-            ++animation_index_it)
-    {
-        erase(begin() + *animation_index_it);
-    }
+    UpdateAnimations();
+    UpdateBatches();
 }
 
 void AnimationsPool::DryUpdate() const
@@ -70,6 +61,11 @@ void AnimationsPool::DryUpdate() const
 
         animation_ptr->DryUpdate();
     }
+
+    for(const UniquePtr<AnimationsBatch>& batch_ptr : m_batches)
+    {
+        batch_ptr->DryUpdate();
+    }
 }
 
 void AnimationsPool::Pause()
@@ -84,6 +80,7 @@ void AnimationsPool::Pause()
             animation_ptr->Pause();
     }
 
+    m_pause_time = Timer::Clock::now();
     m_is_paused = true;
 }
 
@@ -99,7 +96,152 @@ void AnimationsPool::Resume()
             animation_ptr->Resume();
     }
 
+    // Batched animations are resumed by delaying their start time by the paused duration
+    const Timer::TimeDuration paused_duration = Timer::Clock::now() - m_pause_time;
+    for(const UniquePtr<AnimationsBatch>& batch_ptr : m_batches)
+    {
+        batch_ptr->DelayStartTime(paused_duration);
+    }
+
     m_is_paused = false;
 }
 
+void AnimationsPool::AddTimeAnimation(const TimeAnimation::FunctionType& update_function, double duration_sec)
+{
+    META_FUNCTION_TASK();
+    if (m_is_updating_batches)
+    {
+        m_deferred_batch_additions.emplace_back([this, update_function, duration_sec]()
+        {
+            GetBatch<TimeAnimationsBatch>().Add(update_function, duration_sec);
+        });
+        return;
+    }
+    GetBatch<TimeAnimationsBatch>().Add(update_function, duration_sec);
+}
+
+size_t AnimationsPool::GetBatchedAnimationsCount() const noexcept
+{
+    META_FUNCTION_TASK();
+    size_t animations_count = 0U;
+    for(const UniquePtr<AnimationsBatch>& batch_ptr : m_batches)
+    {
+        animations_count += batch_ptr->GetCount();
+    }
+    return animations_count;
+}
+
+void AnimationsPool::ClearBatchedAnimations()
+{
+    META_FUNCTION_TASK();
+    for(const UniquePtr<AnimationsBatch>& batch_ptr : m_batches)
+    {
+        batch_ptr->Clear();
+    }
+}
+
+void AnimationsPool::SetParallelExecutor(tf::Executor* parallel_executor_ptr, size_t parallel_update_threshold) noexcept
+{
+    META_FUNCTION_TASK();
+    m_parallel_executor_ptr     = parallel_executor_ptr;
+    m_parallel_update_threshold = std::max(parallel_update_threshold, g_parallel_update_chunk_size);
+}
+
+void AnimationsPool::UpdateAnimations()
+{
+    META_FUNCTION_TASK();
+    if (empty())
+        return;
+
+    // Animations may be added to pool during update, so they are accessed by index
+    bool has_completed_animations = false;
+    for (size_t animation_index = 0; animation_index < size(); ++animation_index)
+    {
+        if (Ptr<Animation>& animation_ptr = (*this)[animation_index];
+            animation_ptr && !animation_ptr->Update())
+        {
+            animation_ptr.reset();
+        }
+        has_completed_animations |= !(*this)[animation_index];
+    }
+
+    // Completed animations are removed in one pass preserving order of the remaining animations
+    if (has_completed_animations)
+    {
+        erase(std::remove(begin(), end(), nullptr), end());
+    }
+}
+
+void AnimationsPool::UpdateBatches()
+{
+    META_FUNCTION_TASK();
+    if (m_batches.empty())
+        return;
+
+    // Batches update state is reset and deferred animations are added on scope exit, so that exception
+    // thrown from animation update function does not leave the pool deferring all further additions
+    class BatchesUpdateScope
+    {
+    public:
+        explicit BatchesUpdateScope(AnimationsPool& animations_pool) noexcept
+            : m_animations_pool(animations_pool)
+        {
+            m_animations_pool.m_is_updating_batches = true;
+        }
+
+        ~BatchesUpdateScope()
+        {
+            m_animations_pool.m_is_updating_batches = false;
+            for(const std::function<void()>& add_animation : m_animations_pool.m_deferred_batch_additions)
+            {
+                add_animation();
+            }
+            m_animations_pool.m_deferred_batch_additions.clear();
+        }
+
+        BatchesUpdateScope(const BatchesUpdateScope&) = delete;
+        BatchesUpdateScope(BatchesUpdateScope&&) = delete;
+        BatchesUpdateScope& operator=(const BatchesUpdateScope&) = delete;
+        BatchesUpdateScope& operator=(BatchesUpdateScope&&) = delete;
+
+    private:
+        AnimationsPool& m_animations_pool;
+    };
+
+    // All batched animations are updated to the same point in time
+    const Timer::TimePoint update_time = Timer::Clock::now();
+
+    const BatchesUpdateScope batches_update_scope(*this);
+    tf::Taskflow update_task_flow;
+    bool has_parallel_updates = false;
+    for(const UniquePtr<AnimationsBatch>& batch_ptr : m_batches)
+    {
+        AnimationsBatch& batch = *batch_ptr;
+        const size_t animations_count = batch.GetCount();
+        if (!m_parallel_executor_ptr || animations_count < m_parallel_update_threshold)
+        {
+            batch.Update(update_time, 0U, animations_count);
+            continue;
+        }
+
+        update_task_flow.for_each_index(size_t(0U), animations_count, g_parallel_update_chunk_size,
+            [&batch, update_time, animations_count](size_t begin_index)
+            {
+                batch.Update(update_time, begin_index, std::min(begin_index + g_parallel_update_chunk_size, animations_count));
+            }
+        );
+        has_parallel_updates = true;
+    }
+
+    if (has_parallel_updates)
+    {
+        m_parallel_executor_ptr->run(update_task_flow).get();
+    }
+
+    for(const UniquePtr<AnimationsBatch>& batch_ptr : m_batches)
+    {
+        batch_ptr->RemoveCompleted();
+    }
+}
+
 } // namespace Methane::Data
@@ -19,15 +19,32 @@ limitations under the License.
 FILE: Methane/Data/Emitter.hpp
 Event emitter base template class implementation.
 
+Connected receivers are stored in copy-on-write list of receiver slots:
+Connect/Disconnect publish new list under mutex, while Emit reads currently
+published list without locking and memory allocations. Emits are registered
+in one of two reader counters selected by parity of the emitter epoch.
+Old lists are retired with the current epoch and released by the next modification
+when all emits which could observe them have finished, so that neither reclamation
+nor disconnection waits for emits started after the modification.
+Disconnection from emitted call can not advance the epoch blocked by the emit
+cycle of this thread, so it waits for calls of the disconnected receiver
+in progress on other threads, excluding the calls nested on this thread.
+
 ******************************************************************************/
 
 #pragma once
 
 #include "Receiver.hpp"
 
+#include <Methane/Memory.hpp>
 #include <Methane/Instrumentation.h>
 
-#include <set>
+#include <array>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <limits>
+#include <algorithm>
 
 namespace Methane::Data
 {
@@ -39,17 +56,15 @@ class Emitter // NOSONAR - custom destructor is required, rule of zero is not ap
 public:
     Emitter() = default;
     Emitter(const Emitter& other) noexcept
-        : m_connected_receivers(other.m_connected_receivers)
     {
         META_FUNCTION_TASK();
-        ConnectReceivers();
+        ConnectReceivers(other.GetConnectedReceivers());
     }
 
     Emitter(Emitter&& other) noexcept
-        : m_connected_receivers(other.DisconnectReceivers())
     {
         META_FUNCTION_TASK();
-        ConnectReceivers();
+        ConnectReceivers(other.DisconnectReceivers());
     }
 
     ~Emitter() override
@@ -65,8 +80,7 @@ public:
             return *this;
 
         DisconnectReceivers();
-        m_connected_receivers = other.m_connected_receivers;
-        ConnectReceivers();
+        ConnectReceivers(other.GetConnectedReceivers());
         return *this;
     }
 
@@ -77,8 +91,7 @@ public:
             return *this;
 
         DisconnectReceivers();
-        m_connected_receivers = std::move(other.m_connected_receivers);
-        ConnectReceivers();
+        ConnectReceivers(other.DisconnectReceivers());
         return *this;
     }
 
@@ -86,167 +99,386 @@ public:
     {
         META_FUNCTION_TASK();
         std::lock_guard lock(m_connected_receivers_mutex);
-        if (FindConnectedReceiver(receiver) != m_connected_receivers.end())
+        if (FindReceiverSlot(receiver))
             return;
 
-        if (m_is_emitting)
+        // Receivers connected during emit cycle are not called by this cycle, but are called by the nested emits
+        RawPtrs<ReceiverSlot> receiver_slots = GetCurrentReceiverSlots();
+        receiver_slots.emplace_back(m_receiver_slots.emplace_back(std::make_unique<ReceiverSlot>(&receiver)).get());
+        PublishReceiverSlots(std::move(receiver_slots));
+        receiver.OnConnected(*this);
+    }
+
+    void Disconnect(Receiver<EventType>& receiver) noexcept final
+    {
+        META_FUNCTION_TASK();
+        uint32_t      retired_epoch = 0U;
+        ReceiverSlot* receiver_slot_ptr = nullptr;
         {
-            // Modification of connected receivers collection is prohibited during emit cycle, so we add them to separate collection and merge later
-            m_additional_connected_receivers.insert(&receiver);
+            std::lock_guard lock(m_connected_receivers_mutex);
+            receiver_slot_ptr = FindReceiverSlot(receiver);
+            if (!receiver_slot_ptr)
+                return;
+
+            // Cleared receiver slot is skipped by emit cycles in progress, which iterate over the retired list
+            receiver_slot_ptr->receiver_ptr.store(nullptr);
+
+            RawPtrs<ReceiverSlot> receiver_slots = GetCurrentReceiverSlots();
+            receiver_slots.erase(std::find(receiver_slots.begin(), receiver_slots.end(), receiver_slot_ptr));
+            RetireReceiverSlot(*receiver_slot_ptr);
+            retired_epoch = PublishReceiverSlots(std::move(receiver_slots));
+            receiver.OnDisconnected(*this);
         }
-        else
+        WaitForConcurrentEmits(retired_epoch, *receiver_slot_ptr);
+    }
+
+protected:
+    template<typename FuncType, typename... ArgTypes>
+    void Emit(FuncType&& func_ptr, ArgTypes&&... args)
+    {
+        META_FUNCTION_TASK();
+        const EmitScope emit_scope(*this);
+
+        // Published receiver slots list is loaded after emit scope registration in the current epoch,
+        // so it can not be released by concurrent Connect/Disconnect until the end of emit cycle
+        const RawPtrs<ReceiverSlot>* const receiver_slots_ptr = m_published_receiver_slots_ptr.load();
+        if (!receiver_slots_ptr)
+            return;
+
+        for(ReceiverSlot* receiver_slot_ptr : *receiver_slots_ptr)
         {
-            m_connected_receivers.emplace_back(&receiver);
+            // Receiver call is registered before loading the receiver, so that disconnection from emitted call
+            // on other thread can not miss it, while waiting for the calls of disconnected receiver
+            const ReceiverCallScope receiver_call_scope(*receiver_slot_ptr);
+
+            // Receiver may be disconnected or destroyed during previous emitted event calls
+            Receiver<EventType>* const p_receiver = receiver_slot_ptr->receiver_ptr.load();
+            if (!p_receiver)
+                continue;
+
+            // Call the emitted event function in receiver
+            (p_receiver->*std::forward<FuncType>(func_ptr))(std::forward<ArgTypes>(args)...);
         }
-        receiver.OnConnected(*this);
     }
 
-    void Disconnect(Receiver<EventType>& receiver) noexcept final
+    size_t GetConnectedReceiversCount() const noexcept
     {
-        META_FUNCTION_TASK();
         std::lock_guard lock(m_connected_receivers_mutex);
+        return m_current_receiver_slots_ptr ? m_current_receiver_slots_ptr->size() : 0U;
+    }
+
+private:
+    struct ReceiverSlot
+    {
+        explicit ReceiverSlot(Receiver<EventType>* p_receiver) noexcept : receiver_ptr(p_receiver) { }
 
-        const auto connected_receiver_it = FindConnectedReceiver(receiver);
-        if (connected_receiver_it == m_connected_receivers.end())
+        std::atomic<Receiver<EventType>*> receiver_ptr;
+        std::atomic<uint32_t>             calls_count{ 0U };
+    };
+
+    // Counts calls of the receiver slot in progress and tracks receiver slots called on the current thread
+    class ReceiverCallScope
+    {
+    public:
+        explicit ReceiverCallScope(ReceiverSlot& receiver_slot) noexcept
+            : m_receiver_slot(receiver_slot)
         {
-            if (m_is_emitting)
-            {
-                m_additional_connected_receivers.erase(&receiver);
-            }
-            return;
+            m_receiver_slot.calls_count.fetch_add(1U);
+            if (s_thread_receiver_slots_count < s_thread_receiver_slots.size())
+                s_thread_receiver_slots[s_thread_receiver_slots_count] = &m_receiver_slot;
+            s_thread_receiver_slots_count++;
         }
 
-        if (m_is_emitting)
+        ~ReceiverCallScope() noexcept
         {
-            // Modification of connected receivers collection is prohibited during emit cycle, so we just clear the reference instead of erasing from collection
-            *connected_receiver_it = nullptr;
+            s_thread_receiver_slots_count--;
+            m_receiver_slot.calls_count.fetch_sub(1U);
         }
-        else
+
+        ReceiverCallScope(const ReceiverCallScope&) = delete;
+        ReceiverCallScope(ReceiverCallScope&&) = delete;
+        ReceiverCallScope& operator=(const ReceiverCallScope&) = delete;
+        ReceiverCallScope& operator=(ReceiverCallScope&&) = delete;
+
+        [[nodiscard]] static uint32_t GetCallsCountOnThisThread(const ReceiverSlot& receiver_slot) noexcept
         {
-            m_connected_receivers.erase(connected_receiver_it);
+            const size_t tracked_slots_count = std::min(s_thread_receiver_slots_count, s_thread_receiver_slots.size());
+            const auto   thread_slots_end    = s_thread_receiver_slots.begin() + tracked_slots_count;
+            const auto   calls_count         = std::count(s_thread_receiver_slots.begin(), thread_slots_end, &receiver_slot);
+
+            // Calls nested too deep to be tracked are assumed to be the calls of given receiver slot to exclude deadlock
+            return static_cast<uint32_t>(calls_count) + static_cast<uint32_t>(s_thread_receiver_slots_count - tracked_slots_count);
         }
-        receiver.OnDisconnected(*this);
-    }
 
-protected:
-    template<typename FuncType, typename... ArgTypes>
-    void Emit(FuncType&& func_ptr, ArgTypes&&... args)
+    private:
+        inline static thread_local std::array<const ReceiverSlot*, 32> s_thread_receiver_slots{};
+        inline static thread_local size_t                              s_thread_receiver_slots_count = 0U;
+
+        ReceiverSlot& m_receiver_slot;
+    };
+
+    // Counts emits in progress and tracks emitters emitting on the current thread to detect re-entrant calls
+    class EmitScope
     {
-        META_FUNCTION_TASK();
-        std::lock_guard lock(m_connected_receivers_mutex);
+    public:
+        explicit EmitScope(const Emitter& emitter) noexcept
+            : m_emitter(emitter)
+            , m_epoch(RegisterEmit(emitter))
+        {
+            if (s_thread_emitters_count < s_thread_emitters.size())
+                s_thread_emitters[s_thread_emitters_count] = &m_emitter;
+            s_thread_emitters_count++;
+        }
 
-        // Additional receivers may be non-empty before emitting connected receiver calls
-        // only in case when current emit is called during another emitted callback for the same emitter
-        if (m_is_emitting && !m_additional_connected_receivers.empty())
+        ~EmitScope() noexcept
         {
-            // Create copy of the additional connected receivers to iterate over,
-            // because original set of additional receivers may change during emitted calls
-            auto additional_connected_receivers = m_additional_connected_receivers;
-            EmitFuncOfReceivers(additional_connected_receivers, std::forward<FuncType>(func_ptr), std::forward<ArgTypes>(args)...);
+            s_thread_emitters_count--;
+            m_emitter.GetActiveEmitsCount(m_epoch).fetch_sub(1U);
         }
 
-        // Emit function of connected receivers
-        bool was_emitting = m_is_emitting;
-        m_is_emitting = true;
-        if (EmitFuncOfReceivers(m_connected_receivers, std::forward<FuncType>(func_ptr), std::forward<ArgTypes>(args)...))
+        EmitScope(const EmitScope&) = delete;
+        EmitScope(EmitScope&&) = delete;
+        EmitScope& operator=(const EmitScope&) = delete;
+        EmitScope& operator=(EmitScope&&) = delete;
+
+        [[nodiscard]] static bool IsEmittingOnThisThread(const Emitter& emitter) noexcept
         {
-            CleanupConnectedReceivers();
+            if (s_thread_emitters_count > s_thread_emitters.size())
+                return true; // emits nesting is too deep to be tracked, so assume re-entrant call
+
+            const auto thread_emitters_end = s_thread_emitters.begin() + s_thread_emitters_count;
+            return std::find(s_thread_emitters.begin(), thread_emitters_end, &emitter) != thread_emitters_end;
         }
-        m_is_emitting = was_emitting;
 
-        // Add additional receivers connected during emit cycle to the connected receivers
-        if (!was_emitting && !m_additional_connected_receivers.empty())
+    private:
+        // Emit is counted in the epoch which has not changed after the counter increment,
+        // so that modification advancing the epoch can not miss it while waiting for the counter to drain
+        static uint32_t RegisterEmit(const Emitter& emitter) noexcept
         {
-            m_connected_receivers.insert(m_connected_receivers.end(), m_additional_connected_receivers.begin(), m_additional_connected_receivers.end());
-            m_additional_connected_receivers.clear();
+            while(true)
+            {
+                const uint32_t epoch = emitter.m_epoch.load();
+                emitter.GetActiveEmitsCount(epoch).fetch_add(1U);
+                if (emitter.m_epoch.load() == epoch)
+                    return epoch;
+
+                emitter.GetActiveEmitsCount(epoch).fetch_sub(1U);
+            }
         }
-    }
 
-    size_t GetConnectedReceiversCount() const noexcept { return m_connected_receivers.size() + m_additional_connected_receivers.size(); }
+        inline static thread_local std::array<const Emitter*, 32> s_thread_emitters{};
+        inline static thread_local size_t                         s_thread_emitters_count = 0U;
+
+        const Emitter& m_emitter;
+        const uint32_t m_epoch;
+    };
+
+    template<typename RetiredType>
+    struct Retired
+    {
+        UniquePtr<RetiredType> ptr;
+        uint32_t               epoch;
+    };
 
-private:
     [[nodiscard]]
-    inline decltype(auto) FindConnectedReceiver(Receiver<EventType>& receiver) noexcept
+    ReceiverSlot* FindReceiverSlot(const Receiver<EventType>& receiver) const noexcept
     {
-        return std::find_if(m_connected_receivers.begin(), m_connected_receivers.end(),
-            [&receiver](Receiver<EventType>* p_connected_receiver)
+        if (!m_current_receiver_slots_ptr)
+            return nullptr;
+
+        const auto receiver_slot_it = std::find_if(m_current_receiver_slots_ptr->begin(), m_current_receiver_slots_ptr->end(),
+            [&receiver](const ReceiverSlot* receiver_slot_ptr)
             {
-                return p_connected_receiver && p_connected_receiver == std::addressof(receiver);
+                return receiver_slot_ptr->receiver_ptr.load() == std::addressof(receiver);
             }
         );
+        return receiver_slot_it == m_current_receiver_slots_ptr->end() ? nullptr : *receiver_slot_it;
     }
 
-    template<typename ReceiversContainerType, typename FuncType, typename... ArgTypes>
-    bool EmitFuncOfReceivers(ReceiversContainerType& receivers, FuncType&& func_ptr, ArgTypes&&... args)
+    [[nodiscard]]
+    RawPtrs<ReceiverSlot> GetCurrentReceiverSlots() const
     {
-        bool is_cleanup_required = false;
-        for(Receiver<EventType>* const& p_receiver : receivers)
+        return m_current_receiver_slots_ptr ? *m_current_receiver_slots_ptr : RawPtrs<ReceiverSlot>();
+    }
+
+    [[nodiscard]]
+    RawPtrs<Receiver<EventType>> GetConnectedReceivers() const
+    {
+        std::lock_guard lock(m_connected_receivers_mutex);
+        RawPtrs<Receiver<EventType>> receivers;
+        if (!m_current_receiver_slots_ptr)
+            return receivers;
+
+        receivers.reserve(m_current_receiver_slots_ptr->size());
+        for(const ReceiverSlot* receiver_slot_ptr : *m_current_receiver_slots_ptr)
         {
-            if (!p_receiver)
-            {
-                is_cleanup_required = true;
-                continue;
-            }
+            receivers.emplace_back(receiver_slot_ptr->receiver_ptr.load());
+        }
+        return receivers;
+    }
 
-            // Call the emitted event function in receiver
-            (p_receiver->*std::forward<FuncType>(func_ptr))(std::forward<ArgTypes>(args)...);
+    // Returns epoch of the retired receiver slots list
+    uint32_t PublishReceiverSlots(RawPtrs<ReceiverSlot>&& receiver_slots)
+    {
+        UniquePtr<const RawPtrs<ReceiverSlot>> new_receiver_slots_ptr;
+        if (!receiver_slots.empty())
+            new_receiver_slots_ptr = std::make_unique<const RawPtrs<ReceiverSlot>>(std::move(receiver_slots));
 
-            if (!p_receiver)
-            {
-                // Receiver may be disconnected or destroyed during emitted event and it will be cleaned up after full emit cycle
-                is_cleanup_required = true;
-            }
+        m_published_receiver_slots_ptr.store(new_receiver_slots_ptr.get());
+
+        // Epoch is loaded after publishing, so emits registered in the later epochs can observe only the new list
+        const uint32_t retired_epoch = m_epoch.load();
+        if (m_current_receiver_slots_ptr)
+            m_retired_receiver_slot_lists.push_back({ std::move(m_current_receiver_slots_ptr), retired_epoch });
+
+        for(auto retired_slot_it = m_retired_receiver_slots.rbegin();
+            retired_slot_it != m_retired_receiver_slots.rend() && retired_slot_it->epoch == s_unretired_epoch; ++retired_slot_it)
+        {
+            retired_slot_it->epoch = retired_epoch;
         }
-        return is_cleanup_required;
+
+        m_current_receiver_slots_ptr = std::move(new_receiver_slots_ptr);
+        ReleaseRetiredReceiverSlots();
+        return retired_epoch;
     }
 
-    inline void CleanupConnectedReceivers() noexcept
+    void RetireReceiverSlot(const ReceiverSlot& receiver_slot)
     {
-        // Erase receivers disconnected during emit cycle from the connected receivers
-        std::lock_guard lock(m_connected_receivers_mutex);
-        for(auto connected_receiver_it  = m_connected_receivers.begin(); connected_receiver_it != m_connected_receivers.end();)
+        const auto receiver_slot_it = std::find_if(m_receiver_slots.begin(), m_receiver_slots.end(),
+            [&receiver_slot](const UniquePtr<ReceiverSlot>& receiver_slot_ptr)
+            { return receiver_slot_ptr.get() == std::addressof(receiver_slot); }
+        );
+        m_retired_receiver_slots.push_back({ std::move(*receiver_slot_it), s_unretired_epoch });
+        m_receiver_slots.erase(receiver_slot_it);
+    }
+
+    [[nodiscard]] std::atomic<uint32_t>& GetActiveEmitsCount(uint32_t epoch) const noexcept
+    {
+        return m_active_emits_counts[epoch % m_active_emits_counts.size()];
+    }
+
+    // Retired object can not be observed by emits when they all have finished in its epoch and the epoch has advanced
+    [[nodiscard]] bool IsReleasable(uint32_t retired_epoch, uint32_t current_epoch) const noexcept
+    {
+        return retired_epoch != s_unretired_epoch && current_epoch != retired_epoch &&
+               (current_epoch != retired_epoch + 1U || GetActiveEmitsCount(retired_epoch).load() == 0U);
+    }
+
+    // Advances epoch without waiting, when emits of the previous epoch sharing the same counter have finished
+    bool TryAdvanceEpoch(uint32_t epoch) const noexcept
+    {
+        if (GetActiveEmitsCount(epoch + 1U).load() > 0U)
+            return false;
+
+        uint32_t expected_epoch = epoch;
+        return m_epoch.compare_exchange_strong(expected_epoch, epoch + 1U) || expected_epoch != epoch;
+    }
+
+    void ReleaseRetiredReceiverSlots() noexcept
+    {
+        TryAdvanceEpoch(m_epoch.load());
+
+        // Retired lists may be still iterated by emits in progress, including the nested emit cycles on this thread
+        const uint32_t current_epoch = m_epoch.load();
+        const auto is_releasable = [this, current_epoch](const auto& retired) { return IsReleasable(retired.epoch, current_epoch); };
+        m_retired_receiver_slot_lists.erase(std::remove_if(m_retired_receiver_slot_lists.begin(), m_retired_receiver_slot_lists.end(), is_releasable),
+                                            m_retired_receiver_slot_lists.end());
+        m_retired_receiver_slots.erase(std::remove_if(m_retired_receiver_slots.begin(), m_retired_receiver_slots.end(), is_releasable),
+                                       m_retired_receiver_slots.end());
+    }
+
+    void WaitForConcurrentEmits(uint32_t retired_epoch, const ReceiverSlot& retired_receiver_slot) const noexcept
+    {
+        // Disconnected receiver may still be called by emits in progress on other threads, so we wait for their completion
+        // before receiver can be destroyed. Only emits registered in the epoch of disconnection are waited for,
+        // so continuous emits do not block the waiting, and waiting is done without holding any locks.
+        if (EmitScope::IsEmittingOnThisThread(*this))
+        {
+            // Emit cycle of this thread blocks the epoch advance, but it also keeps the retired receiver slot from release,
+            // so disconnection from emitted call waits for the calls of disconnected receiver on other threads only.
+            // Calls started after disconnection load the cleared receiver pointer and finish without calling it.
+            const uint32_t thread_calls_count = ReceiverCallScope::GetCallsCountOnThisThread(retired_receiver_slot);
+            while (retired_receiver_slot.calls_count.load() > thread_calls_count)
+            {
+                std::this_thread::yield();
+            }
+            return;
+        }
+
+        // Emits registered in the previous epoch have started before disconnection and will finish in a finite time
+        while (m_epoch.load() == retired_epoch && !TryAdvanceEpoch(retired_epoch))
         {
-            if (*connected_receiver_it)
-                connected_receiver_it++;
-            else
-                connected_receiver_it = m_connected_receivers.erase(connected_receiver_it);
+            std::this_thread::yield();
+        }
+
+        // Epoch can not advance twice until emits of the disconnection epoch have finished
+        while (m_epoch.load() == retired_epoch + 1U && GetActiveEmitsCount(retired_epoch).load() > 0U)
+        {
+            std::this_thread::yield();
         }
     }
 
-    inline void ConnectReceivers() noexcept
+    void ConnectReceivers(const RawPtrs<Receiver<EventType>>& receivers) noexcept
     {
+        if (receivers.empty())
+            return;
+
         std::lock_guard lock(m_connected_receivers_mutex);
-        for(Receiver<EventType>* p_connected_receiver : m_connected_receivers)
+        RawPtrs<ReceiverSlot> receiver_slots = GetCurrentReceiverSlots();
+        for(Receiver<EventType>* p_receiver : receivers)
+        {
+            receiver_slots.emplace_back(m_receiver_slots.emplace_back(std::make_unique<ReceiverSlot>(p_receiver)).get());
+        }
+        PublishReceiverSlots(std::move(receiver_slots));
+
+        for(Receiver<EventType>* p_receiver : receivers)
         {
-            if (p_connected_receiver)
-                p_connected_receiver->OnConnected(*this);
+            p_receiver->OnConnected(*this);
         }
     }
 
-    inline auto DisconnectReceivers() noexcept
+    RawPtrs<Receiver<EventType>> DisconnectReceivers() noexcept
     {
-        // Move connected receivers so that OnDisconnected callbacks are not processed (m_connected_receivers would be empty)
         std::lock_guard lock(m_connected_receivers_mutex);
-        const auto connected_receivers = std::move(m_connected_receivers);
-        for(Receiver<EventType>* p_receiver : connected_receivers)
+        if (!m_current_receiver_slots_ptr)
+            return {};
+
+        RawPtrs<Receiver<EventType>> connected_receivers;
+        connected_receivers.reserve(m_current_receiver_slots_ptr->size());
+        for(const UniquePtr<ReceiverSlot>& receiver_slot_ptr : m_receiver_slots)
         {
-            if (!p_receiver)
-                continue;
+            connected_receivers.emplace_back(receiver_slot_ptr->receiver_ptr.exchange(nullptr));
+        }
+
+        for(UniquePtr<ReceiverSlot>& receiver_slot_ptr : m_receiver_slots)
+        {
+            m_retired_receiver_slots.push_back({ std::move(receiver_slot_ptr), s_unretired_epoch });
+        }
+        m_receiver_slots.clear();
+        PublishReceiverSlots({});
 
+        for(Receiver<EventType>* p_receiver : connected_receivers)
+        {
             p_receiver->OnDisconnected(*this);
         }
         return connected_receivers;
     }
 
-    bool                                m_is_emitting = false;
-    std::vector<Receiver<EventType>*>   m_connected_receivers;
-    std::set<Receiver<EventType>*>      m_additional_connected_receivers;
+    static constexpr uint32_t s_unretired_epoch = std::numeric_limits<uint32_t>::max();
+
+    std::atomic<const RawPtrs<ReceiverSlot>*>          m_published_receiver_slots_ptr{ nullptr };
+    mutable std::atomic<uint32_t>                      m_epoch{ 0U };
+    mutable std::array<std::atomic<uint32_t>, 2>       m_active_emits_counts{ };
+    UniquePtr<const RawPtrs<ReceiverSlot>>             m_current_receiver_slots_ptr;
+    UniquePtrs<ReceiverSlot>                           m_receiver_slots;
+    std::vector<Retired<const RawPtrs<ReceiverSlot>>>  m_retired_receiver_slot_lists;
+    std::vector<Retired<ReceiverSlot>>                 m_retired_receiver_slots;
 #if defined(__GNUG__) && !defined(__clang__)
     // GCC fails with internal compiler error: Segmentation fault
-    std::recursive_mutex                m_connected_receivers_mutex;
+    mutable std::recursive_mutex              m_connected_receivers_mutex;
 #else
-    TracyLockable(std::recursive_mutex, m_connected_receivers_mutex);
+    mutable TracyLockable(std::recursive_mutex, m_connected_receivers_mutex);
 #endif
 };
 
-} // namespace Methane::Data
\ No newline at end of file
+} // namespace Methane::Data
@@ -59,7 +59,6 @@ public:
     ~Receiver() override // NOSONAR
     {
         META_FUNCTION_TASK();
-        std::lock_guard lock(m_connected_emitter_refs_mutex);
         DisconnectEmitters();
     }
 
@@ -69,8 +68,8 @@ public:
         if (this == std::addressof(other))
             return *this;
 
-        std::lock_guard lock(m_connected_emitter_refs_mutex);
         DisconnectEmitters();
+        std::lock_guard lock(m_connected_emitter_refs_mutex);
         m_connected_emitter_refs = other.m_connected_emitter_refs;
         ConnectEmitters();
         return *this;
@@ -82,8 +81,8 @@ public:
         if (this == std::addressof(other))
             return *this;
 
-        std::lock_guard lock(m_connected_emitter_refs_mutex);
         DisconnectEmitters();
+        std::lock_guard lock(m_connected_emitter_refs_mutex);
         m_connected_emitter_refs = std::move(other.m_connected_emitter_refs);
         ConnectEmitters();
         return *this;
@@ -138,8 +137,15 @@ private:
 
     inline auto DisconnectEmitters() noexcept
     {
-        // Move connected emitters so that OnDisconnected callbacks are not processed (m_connected_emitter_refs would be empty)
-        const auto connected_emitter_refs = std::move(m_connected_emitter_refs);
+        // Move connected emitters so that OnDisconnected callbacks are not processed (m_connected_emitter_refs would be empty).
+        // Emitters are disconnected without holding the lock, because disconnection waits for emitted calls in progress,
+        // which may use this receiver and would deadlock on its lock otherwise.
+        Refs<IEmitter<EventType>> connected_emitter_refs;
+        {
+            std::lock_guard lock(m_connected_emitter_refs_mutex);
+            connected_emitter_refs = std::move(m_connected_emitter_refs);
+            m_connected_emitter_refs.clear();
+        }
         for(const Ref<IEmitter<EventType>>& connected_emitter_ref : connected_emitter_refs)
         {
             connected_emitter_ref.get().Disconnect(*this);
@@ -0,0 +1,95 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: PackTool.cpp
+Command line tool building resource pack file from all files of the directory.
+
+******************************************************************************/
+
+#include <Methane/Data/PackWriter.h>
+
+#include <CLI/CLI.hpp>
+#include <fmt/format.h>
+
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <exception>
+
+namespace fs = std::filesystem;
+using namespace Methane::Data;
+
+static Bytes ReadFileData(const fs::path& file_path)
+{
+    std::ifstream file_stream(file_path, std::ios::binary);
+    if (!file_stream)
+        throw std::runtime_error(fmt::format("Failed to open file '{}'.", file_path.string()));
+
+    Bytes data(static_cast<size_t>(fs::file_size(file_path)));
+    file_stream.read(reinterpret_cast<char*>(data.data()), static_cast<std::streamsize>(data.size())); // NOSONAR
+    return data;
+}
+
+int main(int argc, char* argv[])
+{
+    std::string input_dir;
+    std::string output_pack_path;
+    PackWriter::Settings pack_settings;
+    bool no_compression = false;
+    bool is_verbose     = false;
+
+    CLI::App app("Methane resource pack tool builds pack file from all files of the input directory", "MethanePackTool");
+    app.add_option("-i,--input", input_dir, "Input directory with resource files")->required()->check(CLI::ExistingDirectory);
+    app.add_option("-o,--output", output_pack_path, "Output resource pack file path")->required();
+    app.add_option("-r,--ratio", pack_settings.max_compression_ratio, "Maximum compressed to original size ratio to store data compressed")->capture_default_str();
+    app.add_flag("-n,--no-compression", no_compression, "Store all resources uncompressed");
+    app.add_flag("-v,--verbose", is_verbose, "Print added resource files");
+    CLI11_PARSE(app, argc, argv);
+
+    pack_settings.compression_enabled = !no_compression;
+
+    try
+    {
+        PackWriter pack_writer(pack_settings);
+        const fs::path input_dir_path(input_dir);
+        for(const fs::directory_entry& dir_entry : fs::recursive_directory_iterator(input_dir_path))
+        {
+            if (!dir_entry.is_regular_file())
+                continue;
+
+            // Resource paths are relative to the input directory with forward slash separators on all platforms
+            const std::string resource_path = dir_entry.path().lexically_relative(input_dir_path).generic_string();
+            if (is_verbose)
+                std::cout << resource_path << std::endl;
+
+            pack_writer.AddFile(resource_path, ReadFileData(dir_entry.path()));
+        }
+
+        const PackWriter::Statistics statistics = pack_writer.Write(output_pack_path);
+        std::cout << fmt::format("Resource pack '{}' was written with {} files ({} compressed): {} bytes of data stored in {} bytes, pack size is {} bytes.",
+                                 output_pack_path, statistics.files_count, statistics.compressed_count,
+                                 statistics.data_size, statistics.stored_size, statistics.pack_size) << std::endl;
+    }
+    catch(const std::exception& e)
+    {
+        std::cerr << "ERROR: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
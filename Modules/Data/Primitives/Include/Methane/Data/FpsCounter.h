@@ -24,10 +24,12 @@ FPS counter interface.
 #pragma once
 
 #include <Methane/Data/IFpsCounter.h>
+#include <Methane/Data/TimeHistogram.h>
 
 #include <Methane/Timer.hpp>
 
-#include <queue>
+#include <array>
+#include <atomic>
 
 namespace Methane::Data
 {
@@ -36,13 +38,32 @@ class FpsCounter
     : public IFpsCounter
 {
 public:
+    static constexpr uint32_t max_averaged_timings_count = 1024U;
+    static constexpr double   default_stutter_threshold_sec = 1.0 / 30.0;
+
     FpsCounter() = default;
     explicit FpsCounter(uint32_t averaged_timings_count) noexcept;
 
+    // IFpsCounter interface
     void Reset(uint32_t averaged_timings_count) noexcept override;
     [[nodiscard]] uint32_t GetAveragedTimingsCount() const noexcept override;
     [[nodiscard]] Timing   GetAverageFrameTiming() const noexcept override;
     [[nodiscard]] uint32_t GetFramesPerSecond() const noexcept override;
+    [[nodiscard]] double   GetPercentileFrameTimeSec(double percentile, FrameTimeType type = FrameTimeType::Total) const noexcept override;
+    [[nodiscard]] double   GetMinFrameTimeSec(FrameTimeType type = FrameTimeType::Total) const noexcept override;
+    [[nodiscard]] double   GetMaxFrameTimeSec(FrameTimeType type = FrameTimeType::Total) const noexcept override;
+    [[nodiscard]] uint32_t GetStutterFramesCount() const noexcept override { return m_stutter_frames_count; }
+    [[nodiscard]] double   GetStutterThresholdSec() const noexcept override  { return m_stutter_threshold_sec; }
+    void SetStutterThresholdSec(double stutter_threshold_sec) noexcept override;
+    [[nodiscard]] uint32_t GetHitchFramesCount() const noexcept override { return m_hitch_frames_count; }
+    [[nodiscard]] double   GetMaxHitchTimeSec() const noexcept override;
+    [[nodiscard]] double   GetLastFrameHitchTimeSec() const noexcept override;
+
+    void AddFrameTiming(const Timing& frame_timing, double hitch_time_sec = 0.0) noexcept;
+
+    // Hitch is a CPU stall in the current frame, like waiting for pipeline compilation on draw,
+    // it can be added from any thread encoding the frame commands
+    void AddFrameHitchTime(double hitch_time_sec) noexcept;
 
     void OnGpuFramePresentWait() noexcept;
     void OnCpuFrameReadyToPresent() noexcept;
@@ -50,12 +71,31 @@ public:
     void OnCpuFramePresented() noexcept;
 
 private:
-    Timer              m_frame_timer;
-    Timer              m_present_timer;
-    double             m_present_on_gpu_wait_time_sec = 0.0;
-    uint32_t           m_averaged_timings_count = 100;
-    Timing             m_frame_timings_sum;
-    std::queue<Timing> m_frame_timings;
+    static constexpr size_t frame_time_types_count = 4U;
+
+    using FrameTimings   = std::array<Timing, max_averaged_timings_count>;
+    using HitchTimes     = std::array<double, max_averaged_timings_count>;
+    using TimeHistograms = std::array<TimeHistogram, frame_time_types_count>;
+
+    [[nodiscard]] const Timing& GetFrameTiming(uint32_t index) const noexcept;
+    [[nodiscard]] double        GetFrameHitchTime(uint32_t index) const noexcept;
+    void AddFrameTimingStatistics(const Timing& frame_timing) noexcept;
+    void RemoveFrameTimingStatistics(const Timing& frame_timing) noexcept;
+
+    Timer          m_frame_timer;
+    Timer          m_present_timer;
+    double         m_present_on_gpu_wait_time_sec = 0.0;
+    uint32_t       m_averaged_timings_count = 100;
+    Timing         m_frame_timings_sum;
+    FrameTimings   m_frame_timings;           // ring buffer of timings in the averaging window
+    uint32_t       m_first_timing_index = 0U;
+    uint32_t       m_frame_timings_count = 0U;
+    TimeHistograms m_frame_time_histograms;   // indexed by FrameTimeType
+    double         m_stutter_threshold_sec = default_stutter_threshold_sec;
+    uint32_t       m_stutter_frames_count = 0U;
+    HitchTimes     m_frame_hitch_times{};     // ring buffer of hitch times with the same indices as frame timings
+    uint32_t       m_hitch_frames_count = 0U;
+    std::atomic<uint64_t> m_current_frame_hitch_time_ns{ 0U };
 };
 
 } // namespace Methane::Graphics::Base
\ No newline at end of file
@@ -28,6 +28,14 @@ FPS counter interface.
 namespace Methane::Data
 {
 
+enum class FrameTimeType
+{
+    Total,
+    Cpu,
+    GpuWait,
+    Present
+};
+
 class FrameTiming
 {
 public:
@@ -46,6 +54,7 @@ public:
     [[nodiscard]] double GetCpuTimeMSec() const noexcept    { return GetCpuTimeSec() * 1000.0; }
 
     [[nodiscard]] double GetCpuTimePercent() const noexcept { return 100.0 * GetCpuTimeSec() / GetTotalTimeSec(); }
+    [[nodiscard]] double GetTimeSec(FrameTimeType type) const noexcept;
 
     FrameTiming& operator=(const FrameTiming& other) noexcept = default;
     FrameTiming& operator+=(const FrameTiming& other) noexcept;
@@ -68,6 +77,15 @@ public:
     [[nodiscard]] virtual uint32_t GetAveragedTimingsCount() const noexcept = 0;
     [[nodiscard]] virtual Timing   GetAverageFrameTiming() const noexcept = 0;
     [[nodiscard]] virtual uint32_t GetFramesPerSecond() const noexcept = 0;
+    [[nodiscard]] virtual double   GetPercentileFrameTimeSec(double percentile, FrameTimeType type = FrameTimeType::Total) const noexcept = 0;
+    [[nodiscard]] virtual double   GetMinFrameTimeSec(FrameTimeType type = FrameTimeType::Total) const noexcept = 0;
+    [[nodiscard]] virtual double   GetMaxFrameTimeSec(FrameTimeType type = FrameTimeType::Total) const noexcept = 0;
+    [[nodiscard]] virtual uint32_t GetStutterFramesCount() const noexcept = 0;
+    [[nodiscard]] virtual double   GetStutterThresholdSec() const noexcept = 0;
+    virtual void SetStutterThresholdSec(double stutter_threshold_sec) noexcept = 0;
+    [[nodiscard]] virtual uint32_t GetHitchFramesCount() const noexcept = 0;
+    [[nodiscard]] virtual double   GetMaxHitchTimeSec() const noexcept = 0;
+    [[nodiscard]] virtual double   GetLastFrameHitchTimeSec() const noexcept = 0;
 
     virtual ~IFpsCounter() = default;
 };
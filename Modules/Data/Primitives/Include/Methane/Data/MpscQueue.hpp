@@ -0,0 +1,105 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Data/MpscQueue.hpp
+Lock-free unbounded queue with multiple producers and single consumer.
+
+******************************************************************************/
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <optional>
+#include <utility>
+
+namespace Methane::Data
+{
+
+// Linked list queue with a dummy node, where producers only exchange the head pointer
+// and the consumer only moves the tail pointer, so neither of them ever blocks
+template<typename T>
+class MpscQueue
+{
+public:
+    MpscQueue()
+        : m_head_ptr(new Node())
+        , m_tail_ptr(m_head_ptr.load(std::memory_order_relaxed))
+    { }
+
+    ~MpscQueue()
+    {
+        while (m_tail_ptr)
+        {
+            Node* next_ptr = m_tail_ptr->next_ptr.load(std::memory_order_relaxed);
+            delete m_tail_ptr;
+            m_tail_ptr = next_ptr;
+        }
+    }
+
+    MpscQueue(const MpscQueue&) = delete;
+    MpscQueue(MpscQueue&&) = delete;
+    MpscQueue& operator=(const MpscQueue&) = delete;
+    MpscQueue& operator=(MpscQueue&&) = delete;
+
+    // Can be called from any number of threads simultaneously
+    void Push(T item)
+    {
+        auto* node_ptr = new Node(std::move(item));
+        Node* prev_head_ptr = m_head_ptr.exchange(node_ptr, std::memory_order_acq_rel);
+        prev_head_ptr->next_ptr.store(node_ptr, std::memory_order_release);
+    }
+
+    // Must be called from the single consumer thread only;
+    // item which push is still in progress may be not visible until the next call
+    [[nodiscard]] std::optional<T> TryPop()
+    {
+        Node* next_ptr = m_tail_ptr->next_ptr.load(std::memory_order_acquire);
+        if (!next_ptr)
+            return std::nullopt;
+
+        std::optional<T> item_opt(std::move(next_ptr->item_opt));
+        next_ptr->item_opt.reset();
+        delete m_tail_ptr;
+        m_tail_ptr = next_ptr;
+        return item_opt;
+    }
+
+    // Must be called from the single consumer thread only
+    [[nodiscard]] bool IsEmpty() const noexcept
+    {
+        return !m_tail_ptr->next_ptr.load(std::memory_order_acquire);
+    }
+
+private:
+    struct Node
+    {
+        Node() = default;
+        explicit Node(T&& item) : item_opt(std::move(item)) { }
+
+        std::optional<T>   item_opt;
+        std::atomic<Node*> next_ptr{ nullptr };
+    };
+
+    static constexpr size_t g_cache_line_size = 64U;
+
+    alignas(g_cache_line_size) std::atomic<Node*> m_head_ptr;
+    alignas(g_cache_line_size) Node*              m_tail_ptr;
+};
+
+} // namespace Methane::Data
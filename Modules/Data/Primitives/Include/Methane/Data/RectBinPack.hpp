@@ -17,18 +17,36 @@ limitations under the License.
 *******************************************************************************
 
 FILE: Methane/Graphics/RectBinPack.hpp
-Rectangle bin packing algorithm implementation.
+Rectangle bin packing algorithms implementation:
+  - Guillotine: binary tree of bins split by guillotine cuts with nodes from pooled array;
+  - MaxRects: list of maximal free rectangles with best short side fit placement;
+  - Skyline: bottom-left skyline with waste map of free rectangles under the skyline.
 
 ******************************************************************************/
 
+#pragma once
+
+#include <Methane/Data/Types.h>
 #include <Methane/Data/Rect.hpp>
 #include <Methane/Data/Point.hpp>
 #include <Methane/Memory.hpp>
+#include <Methane/Checks.hpp>
 #include <Methane/Instrumentation.h>
 
+#include <vector>
+#include <variant>
+#include <limits>
+#include <algorithm>
+
 namespace Methane::Data
 {
 
+enum class RectBinPackMethod
+{
+    Guillotine,
+    MaxRects,
+    Skyline
+};
 
 template<class TRect> // TRect is a template class "Rect<T,D>" defined in "Rect.hpp"
 class RectBinPack
@@ -36,100 +54,611 @@ class RectBinPack
 public:
     using TSize  = typename TRect::Size;
     using TPoint = typename TRect::Point;
+    using TCoord = typename TRect::CoordinateType;
+    using TDim   = typename TRect::DimensionType;
+    using Method = RectBinPackMethod;
 
-    explicit RectBinPack(TSize size, TSize char_margins = TSize())
-        : m_root_bin(TRect{ TPoint(), std::move(size) })
+    explicit RectBinPack(TSize size, TSize char_margins = TSize(), Method method = Method::Guillotine)
+        : m_size(std::move(size))
         , m_rect_margins(std::move(char_margins))
+        , m_method(method)
+        , m_packer(CreatePacker(TRect{ TPoint(), m_size }, method))
     { }
 
-    const TSize& GetSize() const { return m_root_bin.GetRect().size; }
+    const TSize& GetSize() const noexcept { return m_size; }
+    Method       GetMethod() const noexcept { return m_method; }
+
+    // Returns ratio of packed rectangles area (without margins) to the bin area
+    float GetOccupancy() const noexcept
+    {
+        const auto bin_area = static_cast<double>(m_size.GetPixelsCount());
+        return bin_area > 0.0 ? static_cast<float>(m_packed_area / bin_area) : 0.F;
+    }
 
     // Tries to pack rectangle in free space of rectangular bin
     // returns true is rect is packed and updates rect.origin with coordinates in rectangular bin
     bool TryPack(TRect& rect)
     {
         META_FUNCTION_TASK();
-        if (!m_root_bin.TryPack(rect, m_rect_margins))
+        if (!rect.size)
+            return true;
+
+        const TSize packed_size = rect.size + m_rect_margins;
+        if (!std::visit([&rect, &packed_size](auto& packer) { return packer.TryPack(rect, packed_size); }, m_packer))
             return false;
 
+        m_packed_area += static_cast<double>(rect.size.GetPixelsCount());
+
         META_CHECK_ARG_GREATER_OR_EQUAL(rect.GetLeft(), 0);
         META_CHECK_ARG_GREATER_OR_EQUAL(rect.GetTop(), 0);
-        META_CHECK_ARG_LESS(rect.GetRight(), m_root_bin.GetRect().size.GetWidth() + 1);
-        META_CHECK_ARG_LESS(rect.GetBottom(), m_root_bin.GetRect().size.GetHeight() + 1);
+        META_CHECK_ARG_LESS(rect.GetRight(), m_size.GetWidth() + 1);
+        META_CHECK_ARG_LESS(rect.GetBottom(), m_size.GetHeight() + 1);
+        return true;
+    }
+
+    // Tries to pack all rectangles in the order of decreasing area, which gives denser packing
+    // returns true if all rectangles were packed, or false on first rectangle which does not fit
+    bool TryPackAll(const Refs<TRect>& rects)
+    {
+        META_FUNCTION_TASK();
+        Refs<TRect> sorted_rects(rects);
+        std::stable_sort(sorted_rects.begin(), sorted_rects.end(),
+            [](const Ref<TRect>& left, const Ref<TRect>& right)
+            { return left.get().size.GetPixelsCount() > right.get().size.GetPixelsCount(); }
+        );
+        return std::all_of(sorted_rects.begin(), sorted_rects.end(),
+                           [this](const Ref<TRect>& rect) { return TryPack(rect.get()); });
+    }
+
+    // Releases space of the rectangle previously packed in this bin, so that it can be reused by next packed rectangles
+    bool Remove(const TRect& rect)
+    {
+        META_FUNCTION_TASK();
+        if (!rect.size)
+            return false;
+
+        const TRect packed_rect{ rect.origin, rect.size + m_rect_margins };
+        if (!std::visit([&packed_rect](auto& packer) { return packer.Remove(packed_rect); }, m_packer))
+            return false;
+
+        m_packed_area -= static_cast<double>(rect.size.GetPixelsCount());
         return true;
     }
 
 private:
-    class Bin
+    [[nodiscard]] static bool IsIntersecting(const TRect& left, const TRect& right) noexcept
     {
-    public:
-        explicit Bin(TRect rect) : m_rect(std::move(rect)) { META_FUNCTION_TASK(); }
+        return left.GetLeft() < right.GetRight() && right.GetLeft() < left.GetRight() &&
+               left.GetTop() < right.GetBottom() && right.GetTop() < left.GetBottom();
+    }
 
-        [[nodiscard]] bool         IsEmpty() const noexcept { return !m_small_bin_ptr && !m_large_bin_ptr; }
-        [[nodiscard]] const TRect& GetRect() const noexcept { return m_rect; }
+    [[nodiscard]] static bool IsContaining(const TRect& outer, const TRect& inner) noexcept
+    {
+        return outer.GetLeft() <= inner.GetLeft() && inner.GetRight()  <= outer.GetRight() &&
+               outer.GetTop()  <= inner.GetTop()  && inner.GetBottom() <= outer.GetBottom();
+    }
 
-        bool TryPack(TRect& rect, const TSize& char_margins)
+    [[nodiscard]] static bool IsContaining(const TRect& rect, const TPoint& point) noexcept
+    {
+        return rect.GetLeft() <= point.GetX() && point.GetX() < rect.GetRight() &&
+               rect.GetTop()  <= point.GetY() && point.GetY() < rect.GetBottom();
+    }
+
+    [[nodiscard]] static TDim GetDistance(TCoord from, TCoord to) noexcept
+    {
+        return static_cast<TDim>(to - from);
+    }
+
+    [[nodiscard]] static TCoord GetOffset(TCoord coord, TDim offset) noexcept
+    {
+        return coord + static_cast<TCoord>(offset);
+    }
+
+    // Free rectangle selection by best short side fit, which is used by MaxRects and Skyline waste map
+    [[nodiscard]] static size_t FindBestShortSideFit(const std::vector<TRect>& free_rects, const TSize& packed_size) noexcept
+    {
+        size_t best_index      = free_rects.size();
+        TDim   best_short_side = std::numeric_limits<TDim>::max();
+        TDim   best_long_side  = std::numeric_limits<TDim>::max();
+        for(size_t index = 0; index < free_rects.size(); ++index)
+        {
+            const TSize& free_size = free_rects[index].size;
+            if (!(packed_size <= free_size))
+                continue;
+
+            const TDim leftover_width  = free_size.GetWidth()  - packed_size.GetWidth();
+            const TDim leftover_height = free_size.GetHeight() - packed_size.GetHeight();
+            const TDim short_side      = std::min(leftover_width, leftover_height);
+            const TDim long_side       = std::max(leftover_width, leftover_height);
+            if (short_side < best_short_side || (short_side == best_short_side && long_side < best_long_side))
+            {
+                best_index      = index;
+                best_short_side = short_side;
+                best_long_side  = long_side;
+            }
+        }
+        return best_index;
+    }
+
+    class GuillotinePacker
+    {
+    public:
+        explicit GuillotinePacker(const TRect& rect)
         {
             META_FUNCTION_TASK();
-            if (!rect.size)
-                return true;
+            m_nodes.reserve(64U);
+            m_nodes.emplace_back(rect);
+        }
+
+        bool TryPack(TRect& rect, const TSize& packed_size) { return TryPackToNode(0U, rect, packed_size); }
+        bool Remove(const TRect& packed_rect)               { return RemoveFromNode(0U, packed_rect); }
 
-            if (IsEmpty())
+    private:
+        static constexpr Index g_no_index = std::numeric_limits<Index>::max();
+
+        struct Node
+        {
+            explicit Node(const TRect& rect) : rect(rect) { }
+
+            [[nodiscard]] bool IsSplit() const noexcept { return small_node_index != g_no_index; }
+
+            TRect rect;
+            TSize reserved_size;  // size reserved for packed rectangle in the top-left corner of split node
+            bool  is_packed        = false;
+            Index small_node_index = g_no_index;
+            Index large_node_index = g_no_index;
+        };
+
+        Index AddNode(const TRect& rect)
+        {
+            if (m_free_node_indices.empty())
+            {
+                m_nodes.emplace_back(rect);
+                return static_cast<Index>(m_nodes.size() - 1U);
+            }
+
+            const Index node_index = m_free_node_indices.back();
+            m_free_node_indices.pop_back();
+            m_nodes[node_index] = Node(rect);
+            return node_index;
+        }
+
+        void SplitNode(Index node_index, const TSize& rect_size, const TSize& packed_size)
+        {
+            // Node reference is not used after adding new nodes, because nodes array may be reallocated
+            const TRect node_rect = m_nodes[node_index].rect;
+            TRect small_rect;
+            TRect large_rect;
+
+            // Split node rectangle either vertically or horizontally,
+            // by creating small rectangle and one big rectangle representing free area not taken by glyph
+            if (const TSize delta = node_rect.size - rect_size;
+                delta.GetWidth() < delta.GetHeight())
+            {
+                // Small top rectangle, to the right of character glyph
+                small_rect = TRect{
+                    TPoint(GetOffset(node_rect.origin.GetX(), packed_size.GetWidth()), node_rect.origin.GetY()),
+                    TSize(node_rect.size.GetWidth() - packed_size.GetWidth(), packed_size.GetHeight())
+                };
+                // Big bottom rectangle, under and to the right of character glyph
+                large_rect = TRect{
+                    TPoint(node_rect.origin.GetX(), GetOffset(node_rect.origin.GetY(), packed_size.GetHeight())),
+                    TSize(node_rect.size.GetWidth(), node_rect.size.GetHeight() - packed_size.GetHeight())
+                };
+            }
+            else
             {
-                const TSize char_size_with_margins = rect.size + char_margins;
-                if (!(char_size_with_margins <= m_rect.size))
+                // Small left rectangle, under the character glyph
+                small_rect = TRect{
+                    TPoint(node_rect.origin.GetX(), GetOffset(node_rect.origin.GetY(), packed_size.GetHeight())),
+                    TSize(packed_size.GetWidth(), node_rect.size.GetHeight() - packed_size.GetHeight())
+                };
+                // Big right rectangle, to the right and under character glyph
+                large_rect = TRect{
+                    TPoint(GetOffset(node_rect.origin.GetX(), packed_size.GetWidth()), node_rect.origin.GetY()),
+                    TSize(node_rect.size.GetWidth() - packed_size.GetWidth(), node_rect.size.GetHeight())
+                };
+            }
+
+            const Index small_node_index = AddNode(small_rect);
+            const Index large_node_index = AddNode(large_rect);
+
+            Node& node = m_nodes[node_index];
+            node.small_node_index = small_node_index;
+            node.large_node_index = large_node_index;
+            node.reserved_size    = packed_size;
+            node.is_packed        = true;
+        }
+
+        bool TryPackToNode(Index node_index, TRect& rect, const TSize& packed_size)
+        {
+            if (const Node& node = m_nodes[node_index];
+                !node.IsSplit())
+            {
+                if (!(packed_size <= node.rect.size))
                     return false;
 
-                // Split node rectangle either vertically or horizontally,
-                // by creating small rectangle and one big rectangle representing free area not taken by glyph
-                if (const TSize delta = m_rect.size - rect.size;
-                    delta.GetWidth() < delta.GetHeight())
+                rect.origin = node.rect.origin;
+                SplitNode(node_index, rect.size, packed_size);
+                return true;
+            }
+
+            if (Node& node = m_nodes[node_index];
+                !node.is_packed && packed_size <= node.reserved_size)
+            {
+                // Reuse space of the removed rectangle
+                rect.origin    = node.rect.origin;
+                node.is_packed = true;
+                return true;
+            }
+
+            const Index large_node_index = m_nodes[node_index].large_node_index;
+            return TryPackToNode(m_nodes[node_index].small_node_index, rect, packed_size) ||
+                   TryPackToNode(large_node_index, rect, packed_size);
+        }
+
+        bool RemoveFromNode(Index node_index, const TRect& packed_rect)
+        {
+            Node& node = m_nodes[node_index];
+            if (!node.IsSplit())
+                return false;
+
+            bool is_removed = false;
+            if (node.is_packed && node.rect.origin == packed_rect.origin)
+            {
+                node.is_packed = false;
+                is_removed = true;
+            }
+            else if (IsContaining(m_nodes[node.small_node_index].rect, packed_rect.origin))
+            {
+                is_removed = RemoveFromNode(node.small_node_index, packed_rect);
+            }
+            else if (IsContaining(m_nodes[node.large_node_index].rect, packed_rect.origin))
+            {
+                is_removed = RemoveFromNode(node.large_node_index, packed_rect);
+            }
+
+            if (is_removed)
+            {
+                TryMergeNode(node_index);
+            }
+            return is_removed;
+        }
+
+        void TryMergeNode(Index node_index)
+        {
+            // Node with removed rectangle and empty child nodes is merged back to the single free node,
+            // child nodes are returned to the pool for reuse
+            Node& node = m_nodes[node_index];
+            if (node.is_packed || m_nodes[node.small_node_index].IsSplit() || m_nodes[node.large_node_index].IsSplit())
+                return;
+
+            m_free_node_indices.emplace_back(node.small_node_index);
+            m_free_node_indices.emplace_back(node.large_node_index);
+            node.small_node_index = g_no_index;
+            node.large_node_index = g_no_index;
+            node.reserved_size    = TSize();
+        }
+
+        std::vector<Node>  m_nodes;
+        std::vector<Index> m_free_node_indices;
+    };
+
+    class MaxRectsPacker
+    {
+    public:
+        explicit MaxRectsPacker(const TRect& rect)
+            : m_bin_rect(rect)
+        {
+            META_FUNCTION_TASK();
+            m_free_rects.emplace_back(rect);
+        }
+
+        bool TryPack(TRect& rect, const TSize& packed_size)
+        {
+            size_t free_rect_index = FindBestShortSideFit(m_free_rects, packed_size);
+            if (free_rect_index >= m_free_rects.size() && m_is_fragmented)
+            {
+                RebuildFreeRects();
+                free_rect_index = FindBestShortSideFit(m_free_rects, packed_size);
+            }
+            if (free_rect_index >= m_free_rects.size())
+                return false;
+
+            const TRect packed_rect{ m_free_rects[free_rect_index].origin, packed_size };
+            SplitFreeRects(packed_rect);
+            m_used_rects.emplace_back(packed_rect);
+            rect.origin = packed_rect.origin;
+            return true;
+        }
+
+        bool Remove(const TRect& packed_rect)
+        {
+            const auto used_rect_it = std::find(m_used_rects.begin(), m_used_rects.end(), packed_rect);
+            if (used_rect_it == m_used_rects.end())
+                return false;
+
+            *used_rect_it = m_used_rects.back();
+            m_used_rects.pop_back();
+
+            // Space of removed rectangle is added to the free rectangles as is, while maximal free rectangles
+            // are rebuilt lazily, only when fragmented free space can not fit the next packed rectangle
+            m_free_rects.emplace_back(packed_rect);
+            m_is_fragmented = true;
+            return true;
+        }
+
+    private:
+        void SplitFreeRects(const TRect& used_rect)
+        {
+            // Every free rectangle intersecting with used rectangle is replaced by up to 4 maximal rectangles around it
+            m_split_rects.clear();
+            for(size_t index = 0; index < m_free_rects.size();)
+            {
+                const TRect free_rect = m_free_rects[index];
+                if (!IsIntersecting(free_rect, used_rect))
                 {
-                    // Small top rectangle, to the right of character glyph
-                    m_small_bin_ptr = std::make_unique<Bin>(TRect{
-                        TPoint(m_rect.origin.GetX() + char_size_with_margins.GetWidth(), m_rect.origin.GetY()),
-                        TSize(m_rect.size.GetWidth() - char_size_with_margins.GetWidth(), char_size_with_margins.GetHeight())
-                    });
-                    // Big bottom rectangle, under and to the right of character glyph
-                    m_large_bin_ptr = std::make_unique<Bin>(TRect{
-                        TPoint(m_rect.origin.GetX(), m_rect.origin.GetY() + char_size_with_margins.GetHeight()),
-                        TSize(m_rect.size.GetWidth(), m_rect.size.GetHeight() - char_size_with_margins.GetHeight())
-                    });
+                    ++index;
+                    continue;
                 }
-                else
+
+                if (free_rect.GetLeft() < used_rect.GetLeft())
+                    m_split_rects.emplace_back(free_rect.origin,
+                        TSize(GetDistance(free_rect.GetLeft(), used_rect.GetLeft()), free_rect.size.GetHeight()));
+                if (used_rect.GetRight() < free_rect.GetRight())
+                    m_split_rects.emplace_back(TPoint(used_rect.GetRight(), free_rect.GetTop()),
+                        TSize(GetDistance(used_rect.GetRight(), free_rect.GetRight()), free_rect.size.GetHeight()));
+                if (free_rect.GetTop() < used_rect.GetTop())
+                    m_split_rects.emplace_back(free_rect.origin,
+                        TSize(free_rect.size.GetWidth(), GetDistance(free_rect.GetTop(), used_rect.GetTop())));
+                if (used_rect.GetBottom() < free_rect.GetBottom())
+                    m_split_rects.emplace_back(TPoint(free_rect.GetLeft(), used_rect.GetBottom()),
+                        TSize(free_rect.size.GetWidth(), GetDistance(used_rect.GetBottom(), free_rect.GetBottom())));
+
+                m_free_rects[index] = m_free_rects.back();
+                m_free_rects.pop_back();
+            }
+
+            // Only split rectangles may be contained in other free rectangles, since they are parts of
+            // the replaced free rectangles, which were not contained in the remaining free rectangles
+            const size_t remaining_rects_count = m_free_rects.size();
+            for(const TRect& split_rect : m_split_rects)
+            {
+                if (std::any_of(m_free_rects.begin(), m_free_rects.end(),
+                                [&split_rect](const TRect& free_rect) { return IsContaining(free_rect, split_rect); }))
+                    continue;
+
+                m_free_rects.erase(std::remove_if(m_free_rects.begin() + static_cast<std::ptrdiff_t>(remaining_rects_count), m_free_rects.end(),
+                                                  [&split_rect](const TRect& free_rect) { return IsContaining(split_rect, free_rect); }),
+                                   m_free_rects.end());
+                m_free_rects.emplace_back(split_rect);
+            }
+        }
+
+        void RebuildFreeRects()
+        {
+            META_FUNCTION_TASK();
+            m_free_rects.clear();
+            m_free_rects.emplace_back(m_bin_rect);
+            for(const TRect& used_rect : m_used_rects)
+            {
+                SplitFreeRects(used_rect);
+            }
+            m_is_fragmented = false;
+        }
+
+        TRect              m_bin_rect;
+        std::vector<TRect> m_used_rects;
+        std::vector<TRect> m_free_rects;
+        std::vector<TRect> m_split_rects;
+        bool               m_is_fragmented = false;
+    };
+
+    class SkylinePacker
+    {
+    public:
+        explicit SkylinePacker(const TRect& rect)
+            : m_bin_rect(rect)
+        {
+            META_FUNCTION_TASK();
+            m_segments.push_back(Segment{ 0U, 0U, rect.size.GetWidth() });
+        }
+
+        bool TryPack(TRect& rect, const TSize& packed_size)
+        {
+            if (!TryPackToFreeSpace(rect, packed_size))
+                return false;
+
+            m_used_rects.emplace_back(rect.origin, packed_size);
+            return true;
+        }
+
+        bool Remove(const TRect& packed_rect)
+        {
+            const auto used_rect_it = std::find(m_used_rects.begin(), m_used_rects.end(), packed_rect);
+            if (used_rect_it == m_used_rects.end())
+                return false;
+
+            *used_rect_it = m_used_rects.back();
+            m_used_rects.pop_back();
+
+            // Skyline can not be lowered, so space of removed rectangle is added to the waste map for reuse
+            m_waste_rects.emplace_back(packed_rect);
+            return true;
+        }
+
+    private:
+        struct Segment
+        {
+            TDim x;     // offset from the left side of the bin
+            TDim y;     // offset of skyline from the top side of the bin
+            TDim width;
+        };
+
+        bool TryPackToFreeSpace(TRect& rect, const TSize& packed_size)
+        {
+            if (TryPackToWasteRects(rect, packed_size))
+                return true;
+
+            // Bottom-left placement: choose position with the lowest top edge, then with the leftmost position
+            size_t best_index  = m_segments.size();
+            TDim   best_y      = 0U;
+            TDim   best_bottom = std::numeric_limits<TDim>::max();
+            for(size_t index = 0; index < m_segments.size(); ++index)
+            {
+                TDim y = 0U;
+                if (!TryFitToSegments(index, packed_size, y))
+                    continue;
+
+                if (const TDim bottom = y + packed_size.GetHeight();
+                    bottom < best_bottom)
                 {
-                    // Small left rectangle, under the character glyph
-                    m_small_bin_ptr = std::make_unique<Bin>(TRect{
-                        TPoint(m_rect.origin.GetX(), m_rect.origin.GetY() + char_size_with_margins.GetHeight()),
-                        TSize(char_size_with_margins.GetWidth(), m_rect.size.GetHeight() - char_size_with_margins.GetHeight())
-                    });
-                    // Big right rectangle, to the right and under character glyph
-                    m_large_bin_ptr = std::make_unique<Bin>(TRect{
-                        TPoint(m_rect.origin.GetX() + char_size_with_margins.GetWidth(), m_rect.origin.GetY()),
-                        TSize(m_rect.size.GetWidth() - char_size_with_margins.GetWidth(), m_rect.size.GetHeight())
-                    });
+                    best_index  = index;
+                    best_y      = y;
+                    best_bottom = bottom;
                 }
+            }
 
-                rect.origin.SetX(m_rect.origin.GetX());
-                rect.origin.SetY(m_rect.origin.GetY());
+            if (best_index >= m_segments.size())
+                return false;
 
-                return true;
+            const TDim x = m_segments[best_index].x;
+            AddWasteRectsUnder(best_index, x, best_y, packed_size.GetWidth());
+            AddSegment(best_index, Segment{ x, best_bottom, packed_size.GetWidth() });
+            rect.origin = TPoint(GetOffset(m_bin_rect.GetLeft(), x), GetOffset(m_bin_rect.GetTop(), best_y));
+            return true;
+        }
+
+        bool TryFitToSegments(size_t index, const TSize& packed_size, TDim& y) const noexcept
+        {
+            const TDim x = m_segments[index].x;
+            if (x + packed_size.GetWidth() > m_bin_rect.size.GetWidth())
+                return false;
+
+            TDim width_left = packed_size.GetWidth();
+            y = 0U;
+            for(; width_left > 0U && index < m_segments.size(); ++index)
+            {
+                const Segment& segment = m_segments[index];
+                y = std::max(y, segment.y);
+                if (y + packed_size.GetHeight() > m_bin_rect.size.GetHeight())
+                    return false;
+
+                width_left -= std::min(width_left, segment.width);
             }
+            return true;
+        }
 
-            if (m_small_bin_ptr->TryPack(rect, char_margins))
-                return true;
+        bool TryPackToWasteRects(TRect& rect, const TSize& packed_size)
+        {
+            const size_t waste_rect_index = FindBestShortSideFit(m_waste_rects, packed_size);
+            if (waste_rect_index >= m_waste_rects.size())
+                return false;
+
+            // Split remaining waste rectangle space with guillotine cut along the shorter leftover axis
+            const TRect waste_rect = m_waste_rects[waste_rect_index];
+            m_waste_rects[waste_rect_index] = m_waste_rects.back();
+            m_waste_rects.pop_back();
+
+            const TDim leftover_width  = waste_rect.size.GetWidth()  - packed_size.GetWidth();
+            const TDim leftover_height = waste_rect.size.GetHeight() - packed_size.GetHeight();
+            const bool is_horizontal_cut = leftover_width < leftover_height;
+            const TRect right_rect{
+                TPoint(GetOffset(waste_rect.GetLeft(), packed_size.GetWidth()), waste_rect.GetTop()),
+                TSize(leftover_width, is_horizontal_cut ? packed_size.GetHeight() : waste_rect.size.GetHeight())
+            };
+            const TRect bottom_rect{
+                TPoint(waste_rect.GetLeft(), GetOffset(waste_rect.GetTop(), packed_size.GetHeight())),
+                TSize(is_horizontal_cut ? waste_rect.size.GetWidth() : packed_size.GetWidth(), leftover_height)
+            };
+            if (right_rect.size)
+                m_waste_rects.emplace_back(right_rect);
+            if (bottom_rect.size)
+                m_waste_rects.emplace_back(bottom_rect);
 
-            return m_large_bin_ptr->TryPack(rect, char_margins);
+            rect.origin = waste_rect.origin;
+            return true;
         }
 
-    private:
-        const TRect    m_rect;
-        UniquePtr<Bin> m_small_bin_ptr;
-        UniquePtr<Bin> m_large_bin_ptr;
+        void AddWasteRectsUnder(size_t index, TDim x, TDim y, TDim width)
+        {
+            // Gaps between skyline segments and the bottom of placed rectangle are added to the waste map
+            const TDim right = x + width;
+            for(; index < m_segments.size() && m_segments[index].x < right; ++index)
+            {
+                const Segment& segment = m_segments[index];
+                if (segment.y >= y)
+                    continue;
+
+                const TDim waste_left  = std::max(segment.x, x);
+                const TDim waste_right = std::min(segment.x + segment.width, right);
+                m_waste_rects.emplace_back(
+                    TPoint(GetOffset(m_bin_rect.GetLeft(), waste_left), GetOffset(m_bin_rect.GetTop(), segment.y)),
+                    TSize(waste_right - waste_left, y - segment.y)
+                );
+            }
+        }
+
+        void AddSegment(size_t index, const Segment& new_segment)
+        {
+            m_segments.insert(m_segments.begin() + static_cast<std::ptrdiff_t>(index), new_segment);
+
+            // Shrink or remove following segments covered by the new segment
+            const TDim right = new_segment.x + new_segment.width;
+            for(size_t next_index = index + 1; next_index < m_segments.size();)
+            {
+                Segment& segment = m_segments[next_index];
+                if (segment.x >= right)
+                    break;
+
+                if (const TDim shrink = right - segment.x;
+                    shrink < segment.width)
+                {
+                    segment.x     += shrink;
+                    segment.width -= shrink;
+                    break;
+                }
+                m_segments.erase(m_segments.begin() + static_cast<std::ptrdiff_t>(next_index));
+            }
+
+            // Merge adjacent segments of the same height
+            for(size_t merge_index = 0; merge_index + 1 < m_segments.size();)
+            {
+                if (m_segments[merge_index].y == m_segments[merge_index + 1].y)
+                {
+                    m_segments[merge_index].width += m_segments[merge_index + 1].width;
+                    m_segments.erase(m_segments.begin() + static_cast<std::ptrdiff_t>(merge_index + 1));
+                    continue;
+                }
+                ++merge_index;
+            }
+        }
+
+        const TRect          m_bin_rect;
+        std::vector<Segment> m_segments;
+        std::vector<TRect>   m_waste_rects;
+        std::vector<TRect>   m_used_rects;
     };
 
-    Bin         m_root_bin;
-    const TSize m_rect_margins;
+    using Packer = std::variant<GuillotinePacker, MaxRectsPacker, SkylinePacker>;
+
+    static Packer CreatePacker(const TRect& rect, Method method)
+    {
+        META_FUNCTION_TASK();
+        switch(method)
+        {
+        case Method::Guillotine: return Packer(std::in_place_type<GuillotinePacker>, rect);
+        case Method::MaxRects:   return Packer(std::in_place_type<MaxRectsPacker>, rect);
+        case Method::Skyline:    return Packer(std::in_place_type<SkylinePacker>, rect);
+        default:                 META_UNEXPECTED_ARG_RETURN(method, Packer(std::in_place_type<GuillotinePacker>, rect));
+        }
+    }
+
+    const TSize  m_size;
+    const TSize  m_rect_margins;
+    const Method m_method;
+    Packer       m_packer;
+    double       m_packed_area = 0.0;
 };
 
 } // namespace Methane::Data
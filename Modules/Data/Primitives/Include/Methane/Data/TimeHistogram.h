@@ -0,0 +1,60 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Data/TimeHistogram.h
+Histogram of time durations with logarithmic buckets and fixed memory footprint,
+supporting removal of samples for use with moving window algorithms.
+
+******************************************************************************/
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+namespace Methane::Data
+{
+
+class TimeHistogram
+{
+public:
+    // Buckets cover time range from 10 us to ~12 sec with 4% relative width,
+    // first and last buckets collect all samples below and above this range
+    static constexpr double   min_time_sec   = 0.00001;
+    static constexpr double   bucket_ratio   = 1.04;
+    static constexpr uint32_t buckets_count  = 360U;
+
+    void Add(double time_sec) noexcept;
+    void Remove(double time_sec) noexcept;
+    void Clear() noexcept;
+
+    [[nodiscard]] uint32_t GetCount() const noexcept { return m_samples_count; }
+    [[nodiscard]] uint32_t GetBucketCount(uint32_t bucket_index) const noexcept { return m_bucket_counts[bucket_index]; }
+
+    // Returns geometric middle of the bucket containing given percentile of samples, percentile is in range [0, 100]
+    [[nodiscard]] double GetPercentile(double percentile) const noexcept;
+
+    [[nodiscard]] static uint32_t GetBucketIndex(double time_sec) noexcept;
+    [[nodiscard]] static double   GetBucketMiddleTimeSec(uint32_t bucket_index) noexcept;
+
+private:
+    std::array<uint32_t, buckets_count> m_bucket_counts{ };
+    uint32_t                            m_samples_count = 0U;
+};
+
+} // namespace Methane::Data
@@ -17,7 +17,8 @@ limitations under the License.
 *******************************************************************************
 
 FILE: Methane/Graphics/FpsCounter.cpp
-FPS counter calculates frame time duration with moving average window algorithm.
+FPS counter calculates frame time duration with moving average window algorithm
+and frame time percentiles with histograms of timings in the same window.
 
 ******************************************************************************/
 
@@ -25,24 +26,37 @@ FPS counter calculates frame time duration with moving average window algorithm.
 
 #include <Methane/Instrumentation.h>
 
+#include <algorithm>
 #include <cmath>
 
 namespace Methane::Data
 {
 
+static constexpr std::array<FrameTimeType, 4> g_frame_time_types{
+    FrameTimeType::Total,
+    FrameTimeType::Cpu,
+    FrameTimeType::GpuWait,
+    FrameTimeType::Present
+};
+
 FpsCounter::FpsCounter(uint32_t averaged_timings_count) noexcept
-    : m_averaged_timings_count(averaged_timings_count)
+    : m_averaged_timings_count(std::clamp(averaged_timings_count, 1U, max_averaged_timings_count))
 { }
 
 void FpsCounter::Reset(uint32_t averaged_timings_count) noexcept
 {
     META_FUNCTION_TASK();
-    m_averaged_timings_count = averaged_timings_count;
-    while (!m_frame_timings.empty())
+    m_averaged_timings_count = std::clamp(averaged_timings_count, 1U, max_averaged_timings_count);
+    m_first_timing_index  = 0U;
+    m_frame_timings_count = 0U;
+    m_frame_timings_sum = Timing();
+    for(TimeHistogram& frame_time_histogram : m_frame_time_histograms)
     {
-        m_frame_timings.pop();
+        frame_time_histogram.Clear();
     }
-    m_frame_timings_sum = Timing();
+    m_stutter_frames_count = 0U;
+    m_hitch_frames_count   = 0U;
+    m_current_frame_hitch_time_ns = 0U;
     m_present_on_gpu_wait_time_sec = 0.0;
     m_frame_timer.Reset();
     m_present_timer.Reset();
@@ -69,7 +83,7 @@ void FpsCounter::OnGpuFramePresented() noexcept
 uint32_t FpsCounter::GetAveragedTimingsCount() const noexcept
 {
     META_FUNCTION_TASK();
-    return static_cast<uint32_t>(m_frame_timings.size());
+    return m_frame_timings_count;
 }
 
 FpsCounter::Timing FpsCounter::GetAverageFrameTiming() const noexcept
@@ -86,22 +100,155 @@ uint32_t FpsCounter::GetFramesPerSecond() const noexcept
     return average_frame_time_sec > 0.0 ? static_cast<uint32_t>(std::round(1.0 / average_frame_time_sec)) : 0U;
 }
 
-void FpsCounter::OnCpuFramePresented() noexcept
+double FpsCounter::GetPercentileFrameTimeSec(double percentile, FrameTimeType type) const noexcept
+{
+    META_FUNCTION_TASK();
+    if (!m_frame_timings_count)
+        return 0.0;
+
+    if (percentile <= 0.0)
+        return GetMinFrameTimeSec(type);
+
+    if (percentile >= 100.0)
+        return GetMaxFrameTimeSec(type);
+
+    // Histogram bucket precision is limited, so percentile is clamped to the exact range of frame times
+    const double percentile_time_sec = m_frame_time_histograms[static_cast<size_t>(type)].GetPercentile(percentile);
+    return std::clamp(percentile_time_sec, GetMinFrameTimeSec(type), GetMaxFrameTimeSec(type));
+}
+
+double FpsCounter::GetMinFrameTimeSec(FrameTimeType type) const noexcept
 {
     META_FUNCTION_TASK();
-    if (m_frame_timings.size() >= m_averaged_timings_count)
+    if (!m_frame_timings_count)
+        return 0.0;
+
+    double min_time_sec = GetFrameTiming(0U).GetTimeSec(type);
+    for(uint32_t index = 1U; index < m_frame_timings_count; ++index)
     {
-        m_frame_timings_sum -= m_frame_timings.front();
-        m_frame_timings.pop();
+        min_time_sec = std::min(min_time_sec, GetFrameTiming(index).GetTimeSec(type));
     }
+    return min_time_sec;
+}
 
-    const Timing frame_timing(m_frame_timer.GetElapsedSecondsD(),
-                              m_present_timer.GetElapsedSecondsD(),
-                              m_present_on_gpu_wait_time_sec);
+double FpsCounter::GetMaxFrameTimeSec(FrameTimeType type) const noexcept
+{
+    META_FUNCTION_TASK();
+    if (!m_frame_timings_count)
+        return 0.0;
 
-    m_frame_timings_sum += frame_timing;
-    m_frame_timings.push(frame_timing);
+    double max_time_sec = GetFrameTiming(0U).GetTimeSec(type);
+    for(uint32_t index = 1U; index < m_frame_timings_count; ++index)
+    {
+        max_time_sec = std::max(max_time_sec, GetFrameTiming(index).GetTimeSec(type));
+    }
+    return max_time_sec;
+}
+
+void FpsCounter::SetStutterThresholdSec(double stutter_threshold_sec) noexcept
+{
+    META_FUNCTION_TASK();
+    m_stutter_threshold_sec = stutter_threshold_sec;
+    m_stutter_frames_count  = 0U;
+    for(uint32_t index = 0U; index < m_frame_timings_count; ++index)
+    {
+        if (GetFrameTiming(index).GetTotalTimeSec() > m_stutter_threshold_sec)
+            m_stutter_frames_count++;
+    }
+}
+
+double FpsCounter::GetMaxHitchTimeSec() const noexcept
+{
+    META_FUNCTION_TASK();
+    double max_hitch_time_sec = 0.0;
+    for(uint32_t index = 0U; index < m_frame_timings_count; ++index)
+    {
+        max_hitch_time_sec = std::max(max_hitch_time_sec, GetFrameHitchTime(index));
+    }
+    return max_hitch_time_sec;
+}
+
+double FpsCounter::GetLastFrameHitchTimeSec() const noexcept
+{
+    META_FUNCTION_TASK();
+    return m_frame_timings_count ? GetFrameHitchTime(m_frame_timings_count - 1U) : 0.0;
+}
+
+void FpsCounter::AddFrameTiming(const Timing& frame_timing, double hitch_time_sec) noexcept
+{
+    META_FUNCTION_TASK();
+    // Ring buffer is drained to the averaged timings count, which could be reduced on reset
+    while (m_frame_timings_count >= m_averaged_timings_count)
+    {
+        RemoveFrameTimingStatistics(m_frame_timings[m_first_timing_index]);
+        if (m_frame_hitch_times[m_first_timing_index] > 0.0)
+            m_hitch_frames_count--;
+
+        m_first_timing_index = (m_first_timing_index + 1U) % max_averaged_timings_count;
+        m_frame_timings_count--;
+    }
+
+    const uint32_t timing_index = (m_first_timing_index + m_frame_timings_count) % max_averaged_timings_count;
+    m_frame_timings[timing_index]     = frame_timing;
+    m_frame_hitch_times[timing_index] = hitch_time_sec;
+    m_frame_timings_count++;
+    AddFrameTimingStatistics(frame_timing);
+    if (hitch_time_sec > 0.0)
+        m_hitch_frames_count++;
+}
+
+void FpsCounter::AddFrameHitchTime(double hitch_time_sec) noexcept
+{
+    META_FUNCTION_TASK();
+    if (hitch_time_sec <= 0.0)
+        return;
+
+    m_current_frame_hitch_time_ns.fetch_add(static_cast<uint64_t>(hitch_time_sec * 1E9), std::memory_order_relaxed);
+}
+
+void FpsCounter::OnCpuFramePresented() noexcept
+{
+    META_FUNCTION_TASK();
+    const uint64_t frame_hitch_time_ns = m_current_frame_hitch_time_ns.exchange(0U, std::memory_order_relaxed);
+    AddFrameTiming(Timing(m_frame_timer.GetElapsedSecondsD(),
+                          m_present_timer.GetElapsedSecondsD(),
+                          m_present_on_gpu_wait_time_sec),
+                   static_cast<double>(frame_hitch_time_ns) / 1E9);
     m_frame_timer.Reset();
 }
 
+const FpsCounter::Timing& FpsCounter::GetFrameTiming(uint32_t index) const noexcept
+{
+    return m_frame_timings[(m_first_timing_index + index) % max_averaged_timings_count];
+}
+
+double FpsCounter::GetFrameHitchTime(uint32_t index) const noexcept
+{
+    return m_frame_hitch_times[(m_first_timing_index + index) % max_averaged_timings_count];
+}
+
+void FpsCounter::AddFrameTimingStatistics(const Timing& frame_timing) noexcept
+{
+    META_FUNCTION_TASK();
+    m_frame_timings_sum += frame_timing;
+    for(FrameTimeType type : g_frame_time_types)
+    {
+        m_frame_time_histograms[static_cast<size_t>(type)].Add(frame_timing.GetTimeSec(type));
+    }
+    if (frame_timing.GetTotalTimeSec() > m_stutter_threshold_sec)
+        m_stutter_frames_count++;
+}
+
+void FpsCounter::RemoveFrameTimingStatistics(const Timing& frame_timing) noexcept
+{
+    META_FUNCTION_TASK();
+    m_frame_timings_sum -= frame_timing;
+    for(FrameTimeType type : g_frame_time_types)
+    {
+        m_frame_time_histograms[static_cast<size_t>(type)].Remove(frame_timing.GetTimeSec(type));
+    }
+    if (frame_timing.GetTotalTimeSec() > m_stutter_threshold_sec)
+        m_stutter_frames_count--;
+}
+
 } // namespace Methane::Graphics::Base
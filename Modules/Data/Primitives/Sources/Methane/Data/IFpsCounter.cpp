@@ -34,6 +34,19 @@ FrameTiming::FrameTiming(double total_time_sec, double present_time_sec, double
     , m_gpu_wait_time_sec(gpu_wait_time_sec)
 { }
 
+double FrameTiming::GetTimeSec(FrameTimeType type) const noexcept
+{
+    META_FUNCTION_TASK();
+    switch(type)
+    {
+    case FrameTimeType::Total:   return m_total_time_sec;
+    case FrameTimeType::Cpu:     return GetCpuTimeSec();
+    case FrameTimeType::GpuWait: return m_gpu_wait_time_sec;
+    case FrameTimeType::Present: return m_present_time_sec;
+    default:                     return 0.0;
+    }
+}
+
 FrameTiming& FrameTiming::operator+=(const FrameTiming& other) noexcept
 {
     META_FUNCTION_TASK();
@@ -0,0 +1,105 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Data/TimeHistogram.cpp
+Histogram of time durations with logarithmic buckets and fixed memory footprint,
+supporting removal of samples for use with moving window algorithms.
+
+******************************************************************************/
+
+#include <Methane/Data/TimeHistogram.h>
+#include <Methane/Instrumentation.h>
+
+#include <algorithm>
+#include <cmath>
+
+namespace Methane::Data
+{
+
+void TimeHistogram::Add(double time_sec) noexcept
+{
+    META_FUNCTION_TASK();
+    m_bucket_counts[GetBucketIndex(time_sec)]++;
+    m_samples_count++;
+}
+
+void TimeHistogram::Remove(double time_sec) noexcept
+{
+    META_FUNCTION_TASK();
+    uint32_t& bucket_count = m_bucket_counts[GetBucketIndex(time_sec)];
+    if (!bucket_count)
+        return;
+
+    bucket_count--;
+    m_samples_count--;
+}
+
+void TimeHistogram::Clear() noexcept
+{
+    META_FUNCTION_TASK();
+    m_bucket_counts.fill(0U);
+    m_samples_count = 0U;
+}
+
+double TimeHistogram::GetPercentile(double percentile) const noexcept
+{
+    META_FUNCTION_TASK();
+    if (!m_samples_count)
+        return 0.0;
+
+    // Nearest-rank method: percentile value is the smallest sample with rank not less than P% of samples count
+    const double   clamped_percentile = std::clamp(percentile, 0.0, 100.0);
+    const uint32_t sample_rank = std::max(1U, static_cast<uint32_t>(std::ceil(clamped_percentile * m_samples_count / 100.0)));
+
+    uint32_t samples_count = 0U;
+    for(uint32_t bucket_index = 0U; bucket_index < buckets_count; ++bucket_index)
+    {
+        samples_count += m_bucket_counts[bucket_index];
+        if (samples_count >= sample_rank)
+            return GetBucketMiddleTimeSec(bucket_index);
+    }
+    return GetBucketMiddleTimeSec(buckets_count - 1U);
+}
+
+uint32_t TimeHistogram::GetBucketIndex(double time_sec) noexcept
+{
+    META_FUNCTION_TASK();
+    if (!(time_sec >= min_time_sec)) // also handles NaN
+        return 0U;
+
+    static const double s_log_bucket_ratio = std::log(bucket_ratio);
+    const double bucket_index = std::floor(std::log(time_sec / min_time_sec) / s_log_bucket_ratio) + 1.0;
+    return bucket_index < static_cast<double>(buckets_count - 1U)
+         ? static_cast<uint32_t>(bucket_index)
+         : buckets_count - 1U;
+}
+
+double TimeHistogram::GetBucketMiddleTimeSec(uint32_t bucket_index) noexcept
+{
+    META_FUNCTION_TASK();
+    // Under-range and over-range buckets are represented with the bounds of covered range
+    if (bucket_index == 0U)
+        return min_time_sec;
+
+    const double bucket_min_time_sec = min_time_sec * std::pow(bucket_ratio, static_cast<double>(std::min(bucket_index, buckets_count - 1U) - 1U));
+    return bucket_index < buckets_count - 1U
+         ? bucket_min_time_sec * std::sqrt(bucket_ratio)
+         : bucket_min_time_sec;
+}
+
+} // namespace Methane::Data
@@ -0,0 +1,104 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Data/AsyncProvider.h
+Asynchronous data provider decorator, which loads data of the wrapped provider
+in parallel executor tasks with bounded number of concurrent loads
+and keeps prefetched data until it is requested.
+
+******************************************************************************/
+
+#pragma once
+
+#include "IProvider.h"
+
+#include <Methane/Instrumentation.h>
+
+#include <deque>
+#include <map>
+#include <mutex>
+#include <condition_variable>
+
+namespace tf // NOSONAR
+{
+class Executor;
+}
+
+namespace Methane::Data
+{
+
+class AsyncProvider final : public IProvider
+{
+public:
+    static constexpr uint32_t default_max_concurrent_loads = 4U;
+
+    AsyncProvider(const IProvider& provider, tf::Executor& parallel_executor,
+                  uint32_t max_concurrent_loads = default_max_concurrent_loads);
+    ~AsyncProvider() override;
+
+    AsyncProvider(const AsyncProvider&) = delete;
+    AsyncProvider(AsyncProvider&&) = delete;
+
+    AsyncProvider& operator=(const AsyncProvider&) = delete;
+    AsyncProvider& operator=(AsyncProvider&&) = delete;
+
+    [[nodiscard]] const IProvider& GetProvider() const noexcept            { return m_provider; }
+    [[nodiscard]] uint32_t         GetMaxConcurrentLoads() const noexcept  { return m_max_concurrent_loads; }
+    [[nodiscard]] size_t           GetPrefetchedCount() const;
+
+    // IProvider interface
+    bool  HasData(const std::string& path) const noexcept override { return m_provider.HasData(path); }
+    Chunk GetData(const std::string& path) const override;
+    std::vector<std::string> GetFiles(const std::string& directory) const override { return m_provider.GetFiles(directory); }
+    std::future<Chunk> GetDataAsync(const std::string& path) const override;
+    void  Prefetch(const std::vector<std::string>& paths) const override;
+    std::vector<Chunk> GetDataMany(const std::vector<std::string>& paths) const override;
+
+private:
+    using RequestId = uint64_t;
+
+    struct LoadRequest
+    {
+        RequestId           id = 0U;
+        std::string         path;
+        std::promise<Chunk> data_promise;
+    };
+
+    struct PendingData
+    {
+        RequestId          request_id = 0U;
+        std::future<Chunk> data_future;
+    };
+
+    PendingData EnqueueLoad(const std::string& path) const;
+    Chunk       WaitData(PendingData&& pending_data) const;
+    void        ProcessPendingLoads() const;
+    void        ExecuteLoad(LoadRequest& request) const;
+
+    const IProvider&                    m_provider;
+    tf::Executor&                       m_parallel_executor;
+    const uint32_t                      m_max_concurrent_loads;
+    mutable TracyLockable(std::mutex,   m_mutex);
+    mutable std::condition_variable_any m_loads_condition_var;
+    mutable std::deque<LoadRequest>     m_pending_requests;
+    mutable std::map<std::string, PendingData, std::less<>> m_prefetched_data;
+    mutable RequestId                   m_next_request_id = 0U;
+    mutable uint32_t                    m_active_loads_count = 0U;
+};
+
+} // namespace Methane::Data
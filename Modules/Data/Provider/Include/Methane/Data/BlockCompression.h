@@ -1,6 +1,6 @@
 /******************************************************************************
 
-Copyright 2019-2020 Evgeny Gorodetskiy
+Copyright 2023 Evgeny Gorodetskiy
 
 Licensed under the Apache License, Version 2.0 (the "License"),
 you may not use this file except in compliance with the License.
@@ -16,17 +16,24 @@ limitations under the License.
 
 *******************************************************************************
 
-FILE: Methane/Data/IProvider.cpp
+FILE: Methane/Data/BlockCompression.h
+Fast lossless compression of data blocks in LZ4 block format,
+optimized for decompression speed rather than compression ratio.
 
 ******************************************************************************/
 
-namespace Methane::Data::IProvider
-{
+#pragma once
+
+#include <Methane/Data/Types.h>
 
-void Dummy()
+namespace Methane::Data
 {
-    // Prevents libtool warning for library: 
-    // the table of contents is empty (no object file members in the library define global symbols)
-}
 
-} // namespace Methane::Data::IProvider
\ No newline at end of file
+[[nodiscard]] Size  GetMaxCompressedBlockSize(Size data_size) noexcept;
+[[nodiscard]] Bytes CompressBlock(ConstRawPtr data_ptr, Size data_size);
+
+// Decompresses block to the buffer of exactly known decompressed size,
+// throws std::runtime_error when compressed data is corrupted
+void DecompressBlock(ConstRawPtr compressed_data_ptr, Size compressed_data_size, RawPtr data_ptr, Size data_size);
+
+} // namespace Methane::Data
@@ -0,0 +1,55 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Data/FileMapping.h
+Read-only memory mapping of the whole file, which is unmapped on destruction.
+File handles are closed right after mapping, since mapped view keeps file open.
+
+******************************************************************************/
+
+#pragma once
+
+#include <Methane/Data/Types.h>
+
+#include <string>
+
+namespace Methane::Data
+{
+
+class FileMapping
+{
+public:
+    [[nodiscard]] static bool IsFileExisting(const std::string& file_path) noexcept;
+
+    explicit FileMapping(const std::string& file_path);
+    FileMapping(const FileMapping&) = delete;
+    FileMapping(FileMapping&&) = delete;
+    ~FileMapping();
+
+    FileMapping& operator=(const FileMapping&) = delete;
+    FileMapping& operator=(FileMapping&&) = delete;
+
+    [[nodiscard]] ConstRawPtr GetDataPtr() const noexcept  { return m_data_ptr; }
+    [[nodiscard]] Size        GetDataSize() const noexcept { return m_data_size; }
+
+private:
+    ConstRawPtr m_data_ptr  = nullptr;
+    Size        m_data_size = 0U;
+};
+
+} // namespace Methane::Data
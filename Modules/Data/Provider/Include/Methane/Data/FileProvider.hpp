@@ -24,15 +24,18 @@ Singleton data provider of files on disk.
 #pragma once
 
 #include "IProvider.h"
+#include "FileMapping.h"
 
 #include <Methane/Platform/Utils.h>
 #include <Methane/Checks.hpp>
 #include <Methane/Instrumentation.h>
 
 #include <string>
+#include <string_view>
+#include <memory>
 #include <fstream>
 #include <stdexcept>
-#include <regex>
+#include <cctype>
 
 namespace Methane::Data
 {
@@ -40,6 +43,12 @@ namespace Methane::Data
 class FileProvider : public IProvider
 {
 public:
+    enum class LoadMode : uint32_t
+    {
+        Read = 0U, // file data is read to the chunk storage
+        Map,       // file is memory-mapped and chunk references mapped pages, keeping mapping alive
+    };
+
     [[nodiscard]] static IProvider& Get()
     {
         META_FUNCTION_TASK();
@@ -50,14 +59,22 @@ public:
     [[nodiscard]] bool HasData(const std::string& path) const noexcept override
     {
         META_FUNCTION_TASK();
-        return std::ifstream(GetFullFilePath(path)).good();
+        return FileMapping::IsFileExisting(GetFullFilePath(path));
     }
 
     [[nodiscard]] Data::Chunk GetData(const std::string& path) const override
     {
         META_FUNCTION_TASK();
-
         const std::string file_path = GetFullFilePath(path);
+        if (m_load_mode == LoadMode::Map)
+        {
+            META_CHECK_ARG_DESCR(path, FileMapping::IsFileExisting(file_path), "File path does not exist '{}'", file_path);
+            auto file_mapping_ptr = std::make_shared<const FileMapping>(file_path);
+            const ConstRawPtr data_ptr  = file_mapping_ptr->GetDataPtr();
+            const Size        data_size = file_mapping_ptr->GetDataSize();
+            return Data::Chunk(data_ptr, data_size, std::move(file_mapping_ptr));
+        }
+
         std::ifstream fs(file_path, std::ios::binary);
         META_CHECK_ARG_DESCR(path, fs.good(), "File path does not exist '{}'", file_path);
 
@@ -76,24 +93,45 @@ public:
         return { };
     }
 
+    [[nodiscard]] LoadMode GetLoadMode() const noexcept { return m_load_mode; }
+    void SetLoadMode(LoadMode load_mode) noexcept       { m_load_mode = load_mode; }
+
 protected:
-    FileProvider() = default;
+    explicit FileProvider(LoadMode load_mode = LoadMode::Map)
+        : m_load_mode(load_mode)
+    { }
+
+    [[nodiscard]] static bool IsRootPath(std::string_view path) noexcept
+    {
+#ifdef _WIN32
+        return path.size() > 2U && std::isalpha(static_cast<unsigned char>(path[0])) && path[1] == ':' &&
+               (path[2] == '\\' || path[2] == '/');
+#else
+        return !path.empty() && path[0] == '/';
+#endif
+    }
 
     [[nodiscard]] std::string GetFullFilePath(const std::string& path) const
     {
         META_FUNCTION_TASK();
 #ifdef _WIN32
-        static const std::string path_delimiter = "\\";
-        static const std::regex root_path_regex(R"(^[a-zA-Z]\:[\\|/].*)");
+        constexpr std::string_view path_delimiter = "\\";
 #else
-        static const std::string path_delimiter = "/";
-        const std::regex root_path_regex("^/.*");
+        constexpr std::string_view path_delimiter = "/";
 #endif
-        const bool is_root_path = std::regex_match(path, root_path_regex);
-        return is_root_path ? path : m_resources_dir + path_delimiter + path;
+        if (IsRootPath(path))
+            return path;
+
+        std::string full_path;
+        full_path.reserve(m_resources_dir.size() + path_delimiter.size() + path.size());
+        full_path.append(m_resources_dir).append(path_delimiter).append(path);
+        return full_path;
     }
 
     const std::string m_resources_dir = Platform::GetResourceDir();
+
+private:
+    LoadMode m_load_mode;
 };
 
 } // namespace Methane::Graphics
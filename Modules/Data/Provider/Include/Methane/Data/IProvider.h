@@ -27,6 +27,8 @@ Data provider interface used for loading application resources and resource file
 
 #include <string>
 #include <vector>
+#include <future>
+#include <exception>
 
 namespace Methane::Data
 {
@@ -37,6 +39,37 @@ struct IProvider
     virtual Chunk GetData(const std::string& path) const = 0;
     virtual std::vector<std::string> GetFiles(const std::string& directory) const = 0;
 
+    // Asynchronous loading interface with default synchronous implementation,
+    // which is overridden by providers loading data in background threads (see AsyncProvider)
+    virtual std::future<Chunk> GetDataAsync(const std::string& path) const
+    {
+        std::promise<Chunk> data_promise;
+        try
+        {
+            data_promise.set_value(GetData(path));
+        }
+        catch(...)
+        {
+            data_promise.set_exception(std::current_exception());
+        }
+        return data_promise.get_future();
+    }
+
+    // Hints provider to start loading of data which is going to be requested soon
+    virtual void Prefetch(const std::vector<std::string>&) const { /* no prefetching by default */ }
+
+    // Returns data chunks in the order of requested paths
+    virtual std::vector<Chunk> GetDataMany(const std::vector<std::string>& paths) const
+    {
+        std::vector<Chunk> data_chunks;
+        data_chunks.reserve(paths.size());
+        for(const std::string& path : paths)
+        {
+            data_chunks.emplace_back(GetData(path));
+        }
+        return data_chunks;
+    }
+
     virtual ~IProvider() = default;
 };
 
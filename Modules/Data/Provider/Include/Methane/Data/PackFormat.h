@@ -0,0 +1,90 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Data/PackFormat.h
+Binary layout of the resource pack file: header, entries table sorted by path hash,
+paths table and entry payloads. Uncompressed payloads are page-aligned to be used
+directly from the memory-mapped pack file. All values are stored in little-endian byte order.
+
+******************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+
+namespace Methane::Data::Pack
+{
+
+constexpr uint32_t g_magic          = 0x4B41504DU; // 'MPAK'
+constexpr uint16_t g_version        = 1U;
+constexpr uint32_t g_page_size      = 4096U;
+constexpr uint32_t g_payload_align  = 8U;
+
+struct Header
+{
+    uint32_t magic          = g_magic;
+    uint16_t version        = g_version;
+    uint16_t header_size    = static_cast<uint16_t>(sizeof(Header));
+    uint32_t entries_count  = 0U;
+    uint32_t page_size      = g_page_size;
+    uint64_t entries_offset = 0U;
+    uint64_t paths_offset   = 0U;
+    uint64_t paths_size     = 0U;
+};
+
+enum class EntryFlags : uint16_t
+{
+    None       = 0U,
+    Compressed = 1U << 0U, // payload is compressed with LZ4 block format
+};
+
+struct Entry
+{
+    uint64_t   path_hash   = 0U;
+    uint64_t   data_offset = 0U;
+    uint32_t   stored_size = 0U; // size of payload in pack file
+    uint32_t   data_size   = 0U; // size of data after decompression
+    uint32_t   path_offset = 0U; // offset of path string in paths table
+    uint16_t   path_length = 0U;
+    EntryFlags flags       = EntryFlags::None;
+
+    [[nodiscard]] bool IsCompressed() const noexcept
+    {
+        return static_cast<uint16_t>(flags) & static_cast<uint16_t>(EntryFlags::Compressed);
+    }
+};
+
+static_assert(sizeof(Header) == 40U, "pack header layout is expected to be 40 bytes");
+static_assert(sizeof(Entry)  == 32U, "pack entry layout is expected to be 32 bytes");
+static_assert(std::is_trivially_copyable_v<Header> && std::is_trivially_copyable_v<Entry>);
+
+// FNV-1a hash of the resource path, entries are sorted by this hash and then by path
+[[nodiscard]] constexpr uint64_t GetPathHash(std::string_view path) noexcept
+{
+    uint64_t hash = 0xCBF29CE484222325U;
+    for(const char c : path)
+    {
+        hash ^= static_cast<uint8_t>(c);
+        hash *= 0x100000001B3U;
+    }
+    return hash;
+}
+
+} // namespace Methane::Data::Pack
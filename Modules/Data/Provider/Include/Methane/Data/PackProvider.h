@@ -0,0 +1,62 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Data/PackProvider.h
+Data provider of the memory-mapped resource pack file: resources are found with
+binary search by path hash, uncompressed data is returned without copying.
+
+******************************************************************************/
+
+#pragma once
+
+#include "IProvider.h"
+#include "PackFormat.h"
+
+#include <memory>
+#include <string_view>
+
+namespace Methane::Data
+{
+
+class FileMapping;
+
+class PackProvider final : public IProvider
+{
+public:
+    explicit PackProvider(const std::string& pack_file_path);
+
+    [[nodiscard]] uint32_t GetEntriesCount() const noexcept { return m_entries_count; }
+
+    // IProvider interface
+    [[nodiscard]] bool  HasData(const std::string& path) const noexcept override;
+    [[nodiscard]] Chunk GetData(const std::string& path) const override;
+    [[nodiscard]] std::vector<std::string> GetFiles(const std::string& directory) const override;
+
+private:
+    [[nodiscard]] const Pack::Entry* FindEntry(std::string_view path) const noexcept;
+    [[nodiscard]] std::string_view   GetEntryPath(const Pack::Entry& entry) const noexcept;
+
+    std::string                        m_pack_file_path;
+    std::shared_ptr<const FileMapping> m_file_mapping_ptr;
+    const Pack::Entry*                 m_entries_ptr = nullptr;
+    uint32_t                           m_entries_count = 0U;
+    const char*                        m_paths_ptr = nullptr;
+    uint64_t                           m_paths_size = 0U;
+};
+
+} // namespace Methane::Data
@@ -0,0 +1,76 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Data/PackWriter.h
+Resource pack writer collects files data, compresses it when it pays off
+and writes pack file with entries table sorted by path hash.
+
+******************************************************************************/
+
+#pragma once
+
+#include "PackFormat.h"
+
+#include <Methane/Data/Types.h>
+
+#include <string>
+#include <vector>
+
+namespace Methane::Data
+{
+
+class PackWriter
+{
+public:
+    struct Settings
+    {
+        bool  compression_enabled = true;
+        float max_compression_ratio = 0.9F; // data is stored compressed only when compressed size ratio is less than this value
+    };
+
+    struct Statistics
+    {
+        uint32_t files_count      = 0U;
+        uint32_t compressed_count = 0U;
+        uint64_t data_size        = 0U;
+        uint64_t stored_size      = 0U;
+        uint64_t pack_size        = 0U;
+    };
+
+    PackWriter() = default;
+    explicit PackWriter(const Settings& settings);
+
+    // Path uses forward slash separators and is relative to the pack root
+    void AddFile(const std::string& path, Bytes&& data);
+
+    [[nodiscard]] size_t     GetFilesCount() const noexcept { return m_files.size(); }
+    [[nodiscard]] Bytes      Build(Statistics* statistics_ptr = nullptr) const;
+    Statistics               Write(const std::string& pack_file_path) const;
+
+private:
+    struct File
+    {
+        std::string path;
+        Bytes       data;
+    };
+
+    Settings          m_settings;
+    std::vector<File> m_files;
+};
+
+} // namespace Methane::Data
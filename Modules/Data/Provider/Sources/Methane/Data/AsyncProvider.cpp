@@ -0,0 +1,220 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Data/AsyncProvider.cpp
+Asynchronous data provider decorator, which loads data of the wrapped provider
+in parallel executor tasks with bounded number of concurrent loads
+and keeps prefetched data until it is requested.
+
+******************************************************************************/
+
+#include <Methane/Data/AsyncProvider.h>
+#include <Methane/Instrumentation.h>
+#include <Methane/Checks.hpp>
+
+#include <taskflow/taskflow.hpp>
+
+#include <algorithm>
+#include <optional>
+
+namespace Methane::Data
+{
+
+AsyncProvider::AsyncProvider(const IProvider& provider, tf::Executor& parallel_executor, uint32_t max_concurrent_loads)
+    : m_provider(provider)
+    , m_parallel_executor(parallel_executor)
+    , m_max_concurrent_loads(max_concurrent_loads)
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_NOT_ZERO_DESCR(max_concurrent_loads, "at least one concurrent load is required");
+}
+
+AsyncProvider::~AsyncProvider()
+{
+    META_FUNCTION_TASK();
+    std::unique_lock lock(m_mutex);
+
+    // Pending requests are dropped, so that their futures get broken promise errors
+    m_pending_requests.clear();
+    m_prefetched_data.clear();
+    m_loads_condition_var.wait(lock, [this] { return m_active_loads_count == 0U; });
+}
+
+size_t AsyncProvider::GetPrefetchedCount() const
+{
+    META_FUNCTION_TASK();
+    std::scoped_lock lock(m_mutex);
+    return m_prefetched_data.size();
+}
+
+Chunk AsyncProvider::GetData(const std::string& path) const
+{
+    META_FUNCTION_TASK();
+    std::optional<PendingData> prefetched_data_opt;
+    {
+        std::scoped_lock lock(m_mutex);
+        if (const auto prefetched_data_it = m_prefetched_data.find(path);
+            prefetched_data_it != m_prefetched_data.end())
+        {
+            prefetched_data_opt.emplace(std::move(prefetched_data_it->second));
+            m_prefetched_data.erase(prefetched_data_it);
+        }
+    }
+    return prefetched_data_opt
+         ? WaitData(std::move(*prefetched_data_opt))
+         : m_provider.GetData(path);
+}
+
+std::future<Chunk> AsyncProvider::GetDataAsync(const std::string& path) const
+{
+    META_FUNCTION_TASK();
+    {
+        std::scoped_lock lock(m_mutex);
+        if (const auto prefetched_data_it = m_prefetched_data.find(path);
+            prefetched_data_it != m_prefetched_data.end())
+        {
+            std::future<Chunk> data_future = std::move(prefetched_data_it->second.data_future);
+            m_prefetched_data.erase(prefetched_data_it);
+            return data_future;
+        }
+    }
+    return EnqueueLoad(path).data_future;
+}
+
+void AsyncProvider::Prefetch(const std::vector<std::string>& paths) const
+{
+    META_FUNCTION_TASK();
+    for(const std::string& path : paths)
+    {
+        {
+            std::scoped_lock lock(m_mutex);
+            if (m_prefetched_data.count(path))
+                continue;
+        }
+        PendingData pending_data = EnqueueLoad(path);
+
+        std::scoped_lock lock(m_mutex);
+        m_prefetched_data.try_emplace(path, std::move(pending_data));
+    }
+}
+
+std::vector<Chunk> AsyncProvider::GetDataMany(const std::vector<std::string>& paths) const
+{
+    META_FUNCTION_TASK();
+    std::vector<PendingData> pending_data;
+    pending_data.reserve(paths.size());
+    for(const std::string& path : paths)
+    {
+        std::unique_lock lock(m_mutex);
+        if (const auto prefetched_data_it = m_prefetched_data.find(path);
+            prefetched_data_it != m_prefetched_data.end())
+        {
+            pending_data.emplace_back(std::move(prefetched_data_it->second));
+            m_prefetched_data.erase(prefetched_data_it);
+            continue;
+        }
+        lock.unlock();
+        pending_data.emplace_back(EnqueueLoad(path));
+    }
+
+    std::vector<Chunk> data_chunks;
+    data_chunks.reserve(paths.size());
+    for(PendingData& data : pending_data)
+    {
+        data_chunks.emplace_back(WaitData(std::move(data)));
+    }
+    return data_chunks;
+}
+
+AsyncProvider::PendingData AsyncProvider::EnqueueLoad(const std::string& path) const
+{
+    META_FUNCTION_TASK();
+    std::scoped_lock lock(m_mutex);
+    LoadRequest& request = m_pending_requests.emplace_back();
+    request.id   = m_next_request_id++;
+    request.path = path;
+    PendingData pending_data{ request.id, request.data_promise.get_future() };
+
+    // Number of loading tasks is bounded, each task processes pending requests until the queue is empty
+    if (m_active_loads_count < m_max_concurrent_loads)
+    {
+        m_active_loads_count++;
+        m_parallel_executor.silent_async([this] { ProcessPendingLoads(); });
+    }
+    return pending_data;
+}
+
+Chunk AsyncProvider::WaitData(PendingData&& pending_data) const
+{
+    META_FUNCTION_TASK();
+    std::optional<LoadRequest> stolen_request_opt;
+    {
+        std::scoped_lock lock(m_mutex);
+        const auto request_it = std::find_if(m_pending_requests.begin(), m_pending_requests.end(),
+                                             [&pending_data](const LoadRequest& request)
+                                             { return request.id == pending_data.request_id; });
+        if (request_it != m_pending_requests.end())
+        {
+            // Load which has not started yet is executed in the calling thread instead of waiting for it,
+            // which also prevents dead-lock when waiting is done from the parallel executor worker thread
+            stolen_request_opt.emplace(std::move(*request_it));
+            m_pending_requests.erase(request_it);
+        }
+    }
+    if (stolen_request_opt)
+    {
+        ExecuteLoad(*stolen_request_opt);
+    }
+    return pending_data.data_future.get();
+}
+
+void AsyncProvider::ProcessPendingLoads() const
+{
+    META_FUNCTION_TASK();
+    while(true)
+    {
+        LoadRequest request;
+        {
+            std::scoped_lock lock(m_mutex);
+            if (m_pending_requests.empty())
+            {
+                m_active_loads_count--;
+                m_loads_condition_var.notify_all();
+                return;
+            }
+            request = std::move(m_pending_requests.front());
+            m_pending_requests.pop_front();
+        }
+        ExecuteLoad(request);
+    }
+}
+
+void AsyncProvider::ExecuteLoad(LoadRequest& request) const
+{
+    META_FUNCTION_TASK();
+    try
+    {
+        request.data_promise.set_value(m_provider.GetData(request.path));
+    }
+    catch(...)
+    {
+        request.data_promise.set_exception(std::current_exception());
+    }
+}
+
+} // namespace Methane::Data
@@ -0,0 +1,231 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Data/BlockCompression.cpp
+Fast lossless compression of data blocks in LZ4 block format,
+optimized for decompression speed rather than compression ratio.
+
+******************************************************************************/
+
+#include <Methane/Data/BlockCompression.h>
+#include <Methane/Instrumentation.h>
+
+#include <vector>
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+namespace Methane::Data
+{
+
+// Constants of LZ4 block format
+static constexpr size_t   g_min_match_length     = 4U;
+static constexpr size_t   g_last_literals_length = 5U;  // last bytes of block are always encoded as literals
+static constexpr size_t   g_match_find_limit     = 12U; // last match must start before this number of bytes till the block end
+static constexpr size_t   g_max_match_offset     = 65535U;
+static constexpr uint8_t  g_length_mask          = 15U;
+static constexpr uint32_t g_hash_log             = 12U;
+static constexpr uint32_t g_skip_trigger_log     = 6U;  // search step grows on incompressible data
+
+static uint32_t ReadUInt32(const uint8_t* data_ptr) noexcept
+{
+    uint32_t value = 0U;
+    std::memcpy(&value, data_ptr, sizeof(value));
+    return value;
+}
+
+static uint32_t GetSequenceHash(uint32_t sequence) noexcept
+{
+    return (sequence * 2654435761U) >> (32U - g_hash_log);
+}
+
+static uint8_t* WriteLengthExtension(uint8_t* out_ptr, size_t length) noexcept
+{
+    for(; length >= 255U; length -= 255U)
+        *out_ptr++ = 255U;
+    *out_ptr++ = static_cast<uint8_t>(length);
+    return out_ptr;
+}
+
+static uint8_t* WriteSequence(uint8_t* out_ptr, const uint8_t* literals_ptr, size_t literals_length, size_t match_offset, size_t match_length) noexcept
+{
+    uint8_t* token_ptr = out_ptr++;
+    *token_ptr = static_cast<uint8_t>(std::min<size_t>(literals_length, g_length_mask) << 4U);
+    if (literals_length >= g_length_mask)
+        out_ptr = WriteLengthExtension(out_ptr, literals_length - g_length_mask);
+
+    if (literals_length)
+        std::memcpy(out_ptr, literals_ptr, literals_length);
+    out_ptr += literals_length;
+
+    if (!match_offset)
+        return out_ptr; // last sequence contains literals only
+
+    *out_ptr++ = static_cast<uint8_t>(match_offset & 0xFFU);
+    *out_ptr++ = static_cast<uint8_t>(match_offset >> 8U);
+
+    const size_t match_length_code = match_length - g_min_match_length;
+    *token_ptr |= static_cast<uint8_t>(std::min<size_t>(match_length_code, g_length_mask));
+    if (match_length_code >= g_length_mask)
+        out_ptr = WriteLengthExtension(out_ptr, match_length_code - g_length_mask);
+
+    return out_ptr;
+}
+
+Size GetMaxCompressedBlockSize(Size data_size) noexcept
+{
+    return data_size + data_size / 255U + 16U;
+}
+
+Bytes CompressBlock(ConstRawPtr data_ptr, Size data_size)
+{
+    META_FUNCTION_TASK();
+    Bytes compressed_data(GetMaxCompressedBlockSize(data_size));
+    const auto* const in_begin_ptr = reinterpret_cast<const uint8_t*>(data_ptr); // NOSONAR
+    const uint8_t* const in_end_ptr = in_begin_ptr + data_size;
+    const uint8_t* anchor_ptr = in_begin_ptr;
+    auto* out_ptr = reinterpret_cast<uint8_t*>(compressed_data.data()); // NOSONAR
+
+    if (data_size > g_match_find_limit)
+    {
+        // Hash table keeps last positions of 4-byte sequences, offset by one to distinguish empty slots
+        std::vector<uint32_t> hash_table(size_t(1U) << g_hash_log, 0U);
+        const uint8_t* const match_find_end_ptr = in_end_ptr - g_match_find_limit;
+        const uint8_t* const match_end_limit_ptr = in_end_ptr - g_last_literals_length;
+        const uint8_t* in_ptr = in_begin_ptr;
+        uint32_t search_count = 0U;
+
+        while(in_ptr < match_find_end_ptr)
+        {
+            const uint32_t sequence = ReadUInt32(in_ptr);
+            uint32_t& hash_entry = hash_table[GetSequenceHash(sequence)];
+            const uint32_t ref_position = hash_entry;
+            hash_entry = static_cast<uint32_t>(in_ptr - in_begin_ptr) + 1U;
+
+            const uint8_t* ref_ptr = in_begin_ptr + (ref_position ? ref_position - 1U : 0U);
+            if (!ref_position || static_cast<size_t>(in_ptr - ref_ptr) > g_max_match_offset || ReadUInt32(ref_ptr) != sequence)
+            {
+                in_ptr += 1U + (search_count++ >> g_skip_trigger_log);
+                continue;
+            }
+
+            // Extend match backwards over pending literals and forwards up to the last literals
+            while(in_ptr > anchor_ptr && ref_ptr > in_begin_ptr && in_ptr[-1] == ref_ptr[-1])
+            {
+                --in_ptr;
+                --ref_ptr;
+            }
+            const uint8_t* match_end_ptr = in_ptr + g_min_match_length;
+            const uint8_t* ref_end_ptr   = ref_ptr + g_min_match_length;
+            while(match_end_ptr < match_end_limit_ptr && *match_end_ptr == *ref_end_ptr)
+            {
+                ++match_end_ptr;
+                ++ref_end_ptr;
+            }
+
+            out_ptr = WriteSequence(out_ptr, anchor_ptr, static_cast<size_t>(in_ptr - anchor_ptr),
+                                    static_cast<size_t>(in_ptr - ref_ptr), static_cast<size_t>(match_end_ptr - in_ptr));
+            in_ptr       = match_end_ptr;
+            anchor_ptr   = match_end_ptr;
+            search_count = 0U;
+        }
+    }
+
+    out_ptr = WriteSequence(out_ptr, anchor_ptr, static_cast<size_t>(in_end_ptr - anchor_ptr), 0U, 0U);
+    compressed_data.resize(static_cast<size_t>(out_ptr - reinterpret_cast<uint8_t*>(compressed_data.data()))); // NOSONAR
+    return compressed_data;
+}
+
+void DecompressBlock(ConstRawPtr compressed_data_ptr, Size compressed_data_size, RawPtr data_ptr, Size data_size)
+{
+    META_FUNCTION_TASK();
+    const auto* in_ptr = reinterpret_cast<const uint8_t*>(compressed_data_ptr); // NOSONAR
+    const uint8_t* const in_end_ptr = in_ptr + compressed_data_size;
+    auto* const out_begin_ptr = reinterpret_cast<uint8_t*>(data_ptr); // NOSONAR
+    uint8_t* const out_end_ptr = out_begin_ptr + data_size;
+    uint8_t* out_ptr = out_begin_ptr;
+
+    const auto read_length_extension = [&in_ptr, in_end_ptr](size_t& length)
+    {
+        uint8_t length_byte = 255U;
+        while(length_byte == 255U)
+        {
+            if (in_ptr >= in_end_ptr)
+                throw std::runtime_error("Compressed data block is truncated.");
+            length_byte = *in_ptr++;
+            length += length_byte;
+        }
+    };
+
+    while(true)
+    {
+        if (in_ptr >= in_end_ptr)
+            throw std::runtime_error("Compressed data block is truncated.");
+
+        const uint8_t token = *in_ptr++;
+        size_t literals_length = token >> 4U;
+        if (literals_length == g_length_mask)
+            read_length_extension(literals_length);
+
+        if (literals_length > static_cast<size_t>(in_end_ptr - in_ptr) ||
+            literals_length > static_cast<size_t>(out_end_ptr - out_ptr))
+            throw std::runtime_error("Compressed data block literals are out of bounds.");
+
+        if (literals_length)
+            std::memcpy(out_ptr, in_ptr, literals_length);
+        in_ptr  += literals_length;
+        out_ptr += literals_length;
+
+        if (in_ptr == in_end_ptr)
+            break; // last sequence contains literals only
+
+        if (in_end_ptr - in_ptr < 2)
+            throw std::runtime_error("Compressed data block is truncated.");
+
+        const size_t match_offset = static_cast<size_t>(in_ptr[0]) | (static_cast<size_t>(in_ptr[1]) << 8U);
+        in_ptr += 2;
+        if (!match_offset || match_offset > static_cast<size_t>(out_ptr - out_begin_ptr))
+            throw std::runtime_error("Compressed data block has invalid match offset.");
+
+        size_t match_length = token & g_length_mask;
+        if (match_length == g_length_mask)
+            read_length_extension(match_length);
+        match_length += g_min_match_length;
+
+        if (match_length > static_cast<size_t>(out_end_ptr - out_ptr))
+            throw std::runtime_error("Compressed data block match is out of bounds.");
+
+        const uint8_t* match_ptr = out_ptr - match_offset;
+        if (match_offset >= match_length)
+        {
+            std::memcpy(out_ptr, match_ptr, match_length);
+            out_ptr += match_length;
+        }
+        else
+        {
+            // Overlapping match repeats the last bytes
+            for(size_t i = 0U; i < match_length; ++i)
+                *out_ptr++ = *match_ptr++;
+        }
+    }
+
+    if (out_ptr != out_end_ptr)
+        throw std::runtime_error("Compressed data block size does not match the decompressed data size.");
+}
+
+} // namespace Methane::Data
@@ -0,0 +1,165 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Data/FileMapping.cpp
+Read-only memory mapping of the whole file, which is unmapped on destruction.
+File handles are closed right after mapping, since mapped view keeps file open.
+
+******************************************************************************/
+
+#include <Methane/Data/FileMapping.h>
+#include <Methane/Instrumentation.h>
+
+#ifdef _WIN32
+#include <Windows.h>
+#include <nowide/convert.hpp>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
+#endif
+
+#include <fmt/format.h>
+
+#include <limits>
+#include <stdexcept>
+
+namespace Methane::Data
+{
+
+#ifdef _WIN32
+
+bool FileMapping::IsFileExisting(const std::string& file_path) noexcept
+{
+    META_FUNCTION_TASK();
+    const DWORD file_attributes = GetFileAttributesW(nowide::widen(file_path).c_str());
+    return file_attributes != INVALID_FILE_ATTRIBUTES && !(file_attributes & FILE_ATTRIBUTE_DIRECTORY);
+}
+
+FileMapping::FileMapping(const std::string& file_path)
+{
+    META_FUNCTION_TASK();
+    const HANDLE file_handle = CreateFileW(nowide::widen(file_path).c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                                           OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (file_handle == INVALID_HANDLE_VALUE)
+        throw std::runtime_error(fmt::format("Failed to open file '{}', error code {}.", file_path, GetLastError()));
+
+    LARGE_INTEGER file_size{};
+    if (!GetFileSizeEx(file_handle, &file_size))
+    {
+        const DWORD error_code = GetLastError();
+        CloseHandle(file_handle);
+        throw std::runtime_error(fmt::format("Failed to get size of file '{}', error code {}.", file_path, error_code));
+    }
+    if (file_size.QuadPart > static_cast<LONGLONG>(std::numeric_limits<Size>::max()))
+    {
+        CloseHandle(file_handle);
+        throw std::length_error(fmt::format("File '{}' is too large to be mapped to data chunk.", file_path));
+    }
+    if (!file_size.QuadPart)
+    {
+        // Empty file can not be mapped
+        CloseHandle(file_handle);
+        return;
+    }
+
+    const HANDLE mapping_handle = CreateFileMappingW(file_handle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    const DWORD mapping_error_code = GetLastError();
+    CloseHandle(file_handle);
+    if (!mapping_handle)
+        throw std::runtime_error(fmt::format("Failed to create mapping of file '{}', error code {}.", file_path, mapping_error_code));
+
+    const void* mapped_view_ptr = MapViewOfFile(mapping_handle, FILE_MAP_READ, 0, 0, 0);
+    const DWORD view_error_code = GetLastError();
+    CloseHandle(mapping_handle);
+    if (!mapped_view_ptr)
+        throw std::runtime_error(fmt::format("Failed to map view of file '{}', error code {}.", file_path, view_error_code));
+
+    m_data_ptr  = static_cast<ConstRawPtr>(mapped_view_ptr);
+    m_data_size = static_cast<Size>(file_size.QuadPart);
+}
+
+FileMapping::~FileMapping()
+{
+    META_FUNCTION_TASK();
+    if (m_data_ptr)
+        UnmapViewOfFile(m_data_ptr);
+}
+
+#else // ifdef _WIN32
+
+bool FileMapping::IsFileExisting(const std::string& file_path) noexcept
+{
+    META_FUNCTION_TASK();
+    struct stat file_stat{};
+    return stat(file_path.c_str(), &file_stat) == 0 && S_ISREG(file_stat.st_mode);
+}
+
+FileMapping::FileMapping(const std::string& file_path)
+{
+    META_FUNCTION_TASK();
+    const int file_descriptor = open(file_path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (file_descriptor < 0)
+        throw std::runtime_error(fmt::format("Failed to open file '{}', error: {}.", file_path, std::strerror(errno)));
+
+    struct stat file_stat{};
+    if (fstat(file_descriptor, &file_stat) != 0)
+    {
+        const int stat_error = errno;
+        close(file_descriptor);
+        throw std::runtime_error(fmt::format("Failed to get size of file '{}', error: {}.", file_path, std::strerror(stat_error)));
+    }
+    if (static_cast<uint64_t>(file_stat.st_size) > std::numeric_limits<Size>::max())
+    {
+        close(file_descriptor);
+        throw std::length_error(fmt::format("File '{}' is too large to be mapped to data chunk.", file_path));
+    }
+    if (!file_stat.st_size)
+    {
+        // Empty file can not be mapped
+        close(file_descriptor);
+        return;
+    }
+
+    const auto file_size = static_cast<size_t>(file_stat.st_size);
+    void* mapped_ptr = mmap(nullptr, file_size, PROT_READ, MAP_PRIVATE, file_descriptor, 0);
+    const int map_error = errno;
+    close(file_descriptor);
+    if (mapped_ptr == MAP_FAILED)
+        throw std::runtime_error(fmt::format("Failed to map file '{}', error: {}.", file_path, std::strerror(map_error)));
+
+    // Resource files are usually read at once from start to end, so pages are requested to be read ahead
+    posix_madvise(mapped_ptr, file_size, POSIX_MADV_WILLNEED);
+
+    m_data_ptr  = static_cast<ConstRawPtr>(mapped_ptr);
+    m_data_size = static_cast<Size>(file_size);
+}
+
+FileMapping::~FileMapping()
+{
+    META_FUNCTION_TASK();
+    if (m_data_ptr)
+        munmap(const_cast<RawPtr>(m_data_ptr), m_data_size); // NOSONAR
+}
+
+#endif // ifdef _WIN32
+
+} // namespace Methane::Data
@@ -0,0 +1,139 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Data/PackProvider.cpp
+Data provider of the memory-mapped resource pack file: resources are found with
+binary search by path hash, uncompressed data is returned without copying.
+
+******************************************************************************/
+
+#include <Methane/Data/PackProvider.h>
+#include <Methane/Data/FileMapping.h>
+#include <Methane/Data/BlockCompression.h>
+#include <Methane/Instrumentation.h>
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+namespace Methane::Data
+{
+
+PackProvider::PackProvider(const std::string& pack_file_path)
+    : m_pack_file_path(pack_file_path)
+    , m_file_mapping_ptr(std::make_shared<const FileMapping>(pack_file_path))
+{
+    META_FUNCTION_TASK();
+    const ConstRawPtr pack_data_ptr  = m_file_mapping_ptr->GetDataPtr();
+    const uint64_t    pack_data_size = m_file_mapping_ptr->GetDataSize();
+    if (pack_data_size < sizeof(Pack::Header))
+        throw std::runtime_error(fmt::format("Resource pack file '{}' is too small.", pack_file_path));
+
+    Pack::Header header;
+    std::memcpy(&header, pack_data_ptr, sizeof(header));
+    if (header.magic != Pack::g_magic || header.version != Pack::g_version || header.header_size != sizeof(Pack::Header))
+        throw std::runtime_error(fmt::format("Resource pack file '{}' has unsupported format.", pack_file_path));
+
+    // Only tables bounds are validated on open to keep it cheap, entry payload bounds are validated on access
+    // Bounds are checked with subtraction from the file size to avoid overflow on corrupted offsets
+    if (header.entries_offset % alignof(Pack::Entry) ||
+        header.entries_offset > pack_data_size ||
+        uint64_t(header.entries_count) * sizeof(Pack::Entry) > pack_data_size - header.entries_offset ||
+        header.paths_offset > pack_data_size ||
+        header.paths_size > pack_data_size - header.paths_offset)
+        throw std::runtime_error(fmt::format("Resource pack file '{}' is corrupted.", pack_file_path));
+
+    m_entries_ptr   = reinterpret_cast<const Pack::Entry*>(pack_data_ptr + header.entries_offset); // NOSONAR
+    m_entries_count = header.entries_count;
+    m_paths_ptr     = reinterpret_cast<const char*>(pack_data_ptr + header.paths_offset); // NOSONAR
+    m_paths_size    = header.paths_size;
+}
+
+bool PackProvider::HasData(const std::string& path) const noexcept
+{
+    META_FUNCTION_TASK();
+    return FindEntry(path) != nullptr;
+}
+
+Chunk PackProvider::GetData(const std::string& path) const
+{
+    META_FUNCTION_TASK();
+    const Pack::Entry* entry_ptr = FindEntry(path);
+    if (!entry_ptr)
+        throw std::invalid_argument(fmt::format("Resource '{}' was not found in pack file '{}'.", path, m_pack_file_path));
+
+    const Pack::Entry& entry = *entry_ptr;
+    const uint64_t pack_data_size = m_file_mapping_ptr->GetDataSize();
+    if (entry.data_offset > pack_data_size || entry.stored_size > pack_data_size - entry.data_offset)
+        throw std::runtime_error(fmt::format("Resource '{}' data is out of pack file '{}' bounds.", path, m_pack_file_path));
+
+    if (!entry.IsCompressed() && entry.data_size != entry.stored_size)
+        throw std::runtime_error(fmt::format("Resource '{}' uncompressed data size does not match its stored size in pack file '{}'.", path, m_pack_file_path));
+
+    const ConstRawPtr stored_data_ptr = m_file_mapping_ptr->GetDataPtr() + entry.data_offset;
+    if (!entry.IsCompressed())
+        return Chunk(stored_data_ptr, entry.data_size, m_file_mapping_ptr);
+
+    Bytes data(entry.data_size);
+    DecompressBlock(stored_data_ptr, entry.stored_size, data.data(), entry.data_size);
+    return Chunk(std::move(data));
+}
+
+std::vector<std::string> PackProvider::GetFiles(const std::string& directory) const
+{
+    META_FUNCTION_TASK();
+    const std::string path_prefix = directory.empty() || directory.back() == '/' ? directory : directory + '/';
+    std::vector<std::string> file_paths;
+    for(uint32_t index = 0U; index < m_entries_count; ++index)
+    {
+        const std::string_view entry_path = GetEntryPath(m_entries_ptr[index]);
+        if (entry_path.substr(0U, path_prefix.size()) == path_prefix)
+            file_paths.emplace_back(entry_path);
+    }
+    std::sort(file_paths.begin(), file_paths.end());
+    return file_paths;
+}
+
+const Pack::Entry* PackProvider::FindEntry(std::string_view path) const noexcept
+{
+    META_FUNCTION_TASK();
+    const uint64_t path_hash = Pack::GetPathHash(path);
+    const Pack::Entry* const entries_end_ptr = m_entries_ptr + m_entries_count;
+    const Pack::Entry* entry_ptr = std::lower_bound(m_entries_ptr, entries_end_ptr, path_hash,
+                                                    [](const Pack::Entry& entry, uint64_t hash) { return entry.path_hash < hash; });
+
+    // Entries with colliding hashes are sorted by path, but collisions are rare, so linear scan is used
+    for(; entry_ptr != entries_end_ptr && entry_ptr->path_hash == path_hash; ++entry_ptr)
+    {
+        if (GetEntryPath(*entry_ptr) == path)
+            return entry_ptr;
+    }
+    return nullptr;
+}
+
+std::string_view PackProvider::GetEntryPath(const Pack::Entry& entry) const noexcept
+{
+    if (uint64_t(entry.path_offset) + entry.path_length > m_paths_size)
+        return {}; // corrupted entry path is never matched
+
+    return std::string_view(m_paths_ptr + entry.path_offset, entry.path_length);
+}
+
+} // namespace Methane::Data
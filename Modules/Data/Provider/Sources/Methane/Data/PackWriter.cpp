@@ -0,0 +1,181 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Data/PackWriter.cpp
+Resource pack writer collects files data, compresses it when it pays off
+and writes pack file with entries table sorted by path hash.
+
+******************************************************************************/
+
+#include <Methane/Data/PackWriter.h>
+#include <Methane/Data/BlockCompression.h>
+#include <Methane/Data/Math.hpp>
+#include <Methane/Instrumentation.h>
+#include <Methane/Checks.hpp>
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <fstream>
+#include <limits>
+#include <cstring>
+#include <stdexcept>
+
+namespace Methane::Data
+{
+
+template<typename T>
+static void WriteStruct(Bytes& pack_data, uint64_t offset, const T& value)
+{
+    std::memcpy(pack_data.data() + offset, &value, sizeof(T));
+}
+
+PackWriter::PackWriter(const Settings& settings)
+    : m_settings(settings)
+{ }
+
+void PackWriter::AddFile(const std::string& path, Bytes&& data)
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_NOT_EMPTY(path);
+    META_CHECK_ARG_LESS_DESCR(path.size(), std::numeric_limits<uint16_t>::max() + 1U, "resource path is too long");
+    META_CHECK_ARG_LESS_DESCR(data.size(), std::numeric_limits<Size>::max() + uint64_t(1U), "resource data is too large");
+    META_CHECK_ARG_DESCR(path, std::none_of(m_files.begin(), m_files.end(), [&path](const File& file) { return file.path == path; }),
+                         "resource with the same path was already added to the pack");
+    m_files.push_back({ path, std::move(data) });
+}
+
+Bytes PackWriter::Build(Statistics* statistics_ptr) const
+{
+    META_FUNCTION_TASK();
+
+    // Entries are sorted by path hash and then by path for the binary search in pack provider
+    std::vector<const File*> sorted_files;
+    sorted_files.reserve(m_files.size());
+    for(const File& file : m_files)
+        sorted_files.push_back(&file);
+
+    std::sort(sorted_files.begin(), sorted_files.end(),
+              [](const File* left_ptr, const File* right_ptr)
+              {
+                  const uint64_t left_hash  = Pack::GetPathHash(left_ptr->path);
+                  const uint64_t right_hash = Pack::GetPathHash(right_ptr->path);
+                  return left_hash != right_hash ? left_hash < right_hash : left_ptr->path < right_ptr->path;
+              });
+
+    Pack::Header header;
+    header.entries_count  = static_cast<uint32_t>(sorted_files.size());
+    header.entries_offset = sizeof(Pack::Header);
+    header.paths_offset   = header.entries_offset + sizeof(Pack::Entry) * sorted_files.size();
+
+    std::vector<Pack::Entry> entries(sorted_files.size());
+    std::vector<Bytes>       compressed_data(sorted_files.size());
+    for(size_t index = 0U; index < sorted_files.size(); ++index)
+    {
+        const File&  file  = *sorted_files[index];
+        Pack::Entry& entry = entries[index];
+        entry.path_hash   = Pack::GetPathHash(file.path);
+        entry.data_size   = static_cast<uint32_t>(file.data.size());
+        entry.stored_size = entry.data_size;
+        entry.path_offset = static_cast<uint32_t>(header.paths_size);
+        entry.path_length = static_cast<uint16_t>(file.path.size());
+        header.paths_size += file.path.size();
+
+        if (!m_settings.compression_enabled || file.data.empty())
+            continue;
+
+        Bytes compressed_file_data = CompressBlock(file.data.data(), entry.data_size);
+        if (static_cast<float>(compressed_file_data.size()) >= static_cast<float>(file.data.size()) * m_settings.max_compression_ratio)
+            continue;
+
+        entry.stored_size = static_cast<uint32_t>(compressed_file_data.size());
+        entry.flags       = Pack::EntryFlags::Compressed;
+        compressed_data[index] = std::move(compressed_file_data);
+    }
+
+    // Uncompressed payloads are aligned to page size to be used directly from the mapped memory,
+    // compressed payloads are decompressed to separate memory and are packed tightly after them
+    uint64_t data_offset = header.paths_offset + header.paths_size;
+    for(Pack::Entry& entry : entries)
+    {
+        if (entry.IsCompressed())
+            continue;
+
+        data_offset = AlignUp<uint64_t>(data_offset, header.page_size);
+        entry.data_offset = data_offset;
+        data_offset += entry.stored_size;
+    }
+    for(Pack::Entry& entry : entries)
+    {
+        if (!entry.IsCompressed())
+            continue;
+
+        data_offset = AlignUp<uint64_t>(data_offset, Pack::g_payload_align);
+        entry.data_offset = data_offset;
+        data_offset += entry.stored_size;
+    }
+
+    if (data_offset > std::numeric_limits<Size>::max())
+        throw std::length_error(fmt::format("Resource pack size {} exceeds maximum supported size.", data_offset));
+
+    Bytes pack_data(static_cast<size_t>(data_offset), Byte{});
+    WriteStruct(pack_data, 0U, header);
+
+    Statistics statistics;
+    statistics.files_count = header.entries_count;
+    statistics.pack_size   = data_offset;
+    for(size_t index = 0U; index < entries.size(); ++index)
+    {
+        const File&        file  = *sorted_files[index];
+        const Pack::Entry& entry = entries[index];
+        WriteStruct(pack_data, header.entries_offset + sizeof(Pack::Entry) * index, entry);
+        std::memcpy(pack_data.data() + header.paths_offset + entry.path_offset, file.path.data(), file.path.size());
+
+        const Bytes& stored_data = entry.IsCompressed() ? compressed_data[index] : file.data;
+        if (!stored_data.empty())
+            std::memcpy(pack_data.data() + entry.data_offset, stored_data.data(), stored_data.size());
+
+        statistics.compressed_count += entry.IsCompressed() ? 1U : 0U;
+        statistics.data_size        += entry.data_size;
+        statistics.stored_size      += entry.stored_size;
+    }
+
+    if (statistics_ptr)
+        *statistics_ptr = statistics;
+
+    return pack_data;
+}
+
+PackWriter::Statistics PackWriter::Write(const std::string& pack_file_path) const
+{
+    META_FUNCTION_TASK();
+    Statistics statistics;
+    const Bytes pack_data = Build(&statistics);
+
+    std::ofstream pack_file(pack_file_path, std::ios::binary | std::ios::trunc);
+    if (!pack_file)
+        throw std::runtime_error(fmt::format("Failed to open resource pack file '{}' for writing.", pack_file_path));
+
+    pack_file.write(reinterpret_cast<const char*>(pack_data.data()), static_cast<std::streamsize>(pack_data.size())); // NOSONAR
+    if (!pack_file)
+        throw std::runtime_error(fmt::format("Failed to write resource pack file '{}'.", pack_file_path));
+
+    return statistics;
+}
+
+} // namespace Methane::Data
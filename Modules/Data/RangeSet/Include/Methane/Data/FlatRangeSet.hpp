@@ -0,0 +1,293 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Data/FlatRangeSet.hpp
+
+Set of ranges with the same semantics as RangeSet, but stored in sorted contiguous
+array with inline buffer for small number of ranges, so that add and remove operations
+do not allocate memory until inline capacity is exceeded. Bulk operations of union,
+intersection and subtraction with other set are performed in one linear pass.
+
+******************************************************************************/
+
+#pragma once
+
+#include "Range.hpp"
+#include "RangeSetAlgorithms.hpp"
+
+#include <Methane/Instrumentation.h>
+
+#include <array>
+#include <memory>
+#include <algorithm>
+#include <type_traits>
+
+namespace Methane::Data
+{
+
+template<typename ScalarT, size_t inline_ranges_count = 8U>
+class FlatRangeSet
+{
+    static_assert(inline_ranges_count > 0U, "Flat range set inline ranges count must be greater than zero");
+    static_assert(std::is_trivially_copyable_v<Range<ScalarT>>, "Flat range set requires trivially copyable ranges");
+
+public:
+    using ConstIterator = const Range<ScalarT>*;
+
+    FlatRangeSet() = default;
+    FlatRangeSet(std::initializer_list<Range<ScalarT>> init) //NOSONAR - initializer list constructor is not explicit intentionally
+    {
+        META_FUNCTION_TASK();
+        for (const Range<ScalarT>& range : init)
+            Add(range);
+    }
+
+    FlatRangeSet(const FlatRangeSet& other)
+    {
+        META_FUNCTION_TASK();
+        Assign(other);
+    }
+
+    FlatRangeSet(FlatRangeSet&& other) noexcept
+    {
+        META_FUNCTION_TASK();
+        Swap(other);
+    }
+
+    ~FlatRangeSet() = default;
+
+    FlatRangeSet& operator=(const FlatRangeSet& other)
+    {
+        META_FUNCTION_TASK();
+        if (this != &other)
+            Assign(other);
+        return *this;
+    }
+
+    FlatRangeSet& operator=(FlatRangeSet&& other) noexcept
+    {
+        META_FUNCTION_TASK();
+        if (this != &other)
+        {
+            Clear();
+            Swap(other);
+        }
+        return *this;
+    }
+
+    FlatRangeSet& operator=(std::initializer_list<Range<ScalarT>> init)
+    {
+        META_FUNCTION_TASK();
+        Clear();
+        for (const Range<ScalarT>& range : init)
+            Add(range);
+        return *this;
+    }
+
+    [[nodiscard]] bool operator==(const FlatRangeSet& other) const noexcept
+    {
+        META_FUNCTION_TASK();
+        return m_size == other.m_size && std::equal(begin(), end(), other.begin());
+    }
+
+    [[nodiscard]] bool operator!=(const FlatRangeSet& other) const noexcept { return !operator==(other); }
+
+    [[nodiscard]] size_t Size() const noexcept                  { return m_size; }
+    [[nodiscard]] size_t GetCapacity() const noexcept           { return m_capacity; }
+    [[nodiscard]] bool   IsEmpty() const noexcept               { return m_size == 0U; }
+    [[nodiscard]] bool   IsInline() const noexcept              { return !m_heap_ranges; }
+    [[nodiscard]] const Range<ScalarT>& operator[](size_t index) const noexcept { return GetData()[index]; }
+    [[nodiscard]] ConstIterator begin() const noexcept          { return GetData(); }
+    [[nodiscard]] ConstIterator end() const noexcept            { return GetData() + m_size; }
+
+    void Clear() noexcept { m_size = 0U; }
+
+    void Reserve(size_t capacity)
+    {
+        META_FUNCTION_TASK();
+        if (capacity <= m_capacity)
+            return;
+
+        const size_t new_capacity = std::max(capacity, m_capacity * 2U);
+        std::unique_ptr<Range<ScalarT>[]> new_ranges = std::make_unique<Range<ScalarT>[]>(new_capacity);
+        std::copy(begin(), end(), new_ranges.get());
+        m_heap_ranges = std::move(new_ranges);
+        m_capacity    = new_capacity;
+    }
+
+    void Add(const Range<ScalarT>& range)
+    {
+        META_FUNCTION_TASK();
+        if (range.IsEmpty())
+            return;
+
+        // Mergeable ranges are the ones overlapping or adjacent to the added range
+        const ConstIterator first_it = std::lower_bound(begin(), end(), range.GetStart(),
+            [](const Range<ScalarT>& r, ScalarT start) { return r.GetEnd() < start; });
+        const ConstIterator last_it = std::upper_bound(first_it, end(), range.GetEnd(),
+            [](ScalarT end, const Range<ScalarT>& r) { return end < r.GetStart(); });
+
+        if (first_it == last_it)
+        {
+            Splice(first_it, last_it, &range, 1U);
+            return;
+        }
+
+        const Range<ScalarT> merged_range(std::min(first_it->GetStart(), range.GetStart()),
+                                          std::max((last_it - 1)->GetEnd(), range.GetEnd()));
+        Splice(first_it, last_it, &merged_range, 1U);
+    }
+
+    void Remove(const Range<ScalarT>& range)
+    {
+        META_FUNCTION_TASK();
+        if (range.IsEmpty())
+            return;
+
+        // Only strictly overlapping ranges are affected by removal, adjacent ranges are left intact
+        const ConstIterator first_it = std::upper_bound(begin(), end(), range.GetStart(),
+            [](ScalarT start, const Range<ScalarT>& r) { return start < r.GetEnd(); });
+        const ConstIterator last_it = std::lower_bound(first_it, end(), range.GetEnd(),
+            [](const Range<ScalarT>& r, ScalarT end) { return r.GetStart() < end; });
+
+        if (first_it == last_it)
+            return;
+
+        std::array<Range<ScalarT>, 2> remaining_ranges;
+        size_t remaining_ranges_count = 0U;
+        if (first_it->GetStart() < range.GetStart())
+        {
+            remaining_ranges[remaining_ranges_count++] = Range<ScalarT>(first_it->GetStart(), range.GetStart());
+        }
+        if (range.GetEnd() < (last_it - 1)->GetEnd())
+        {
+            remaining_ranges[remaining_ranges_count++] = Range<ScalarT>(range.GetEnd(), (last_it - 1)->GetEnd());
+        }
+        Splice(first_it, last_it, remaining_ranges.data(), remaining_ranges_count);
+    }
+
+    void AddRanges(const FlatRangeSet& other)
+    {
+        META_FUNCTION_TASK();
+        if (other.IsEmpty())
+            return;
+
+        FlatRangeSet united_set;
+        united_set.Reserve(m_size + other.m_size);
+        UniteRanges<ScalarT>(begin(), end(), other.begin(), other.end(), Appender{ united_set });
+        *this = std::move(united_set);
+    }
+
+    void RemoveRanges(const FlatRangeSet& other)
+    {
+        META_FUNCTION_TASK();
+        if (IsEmpty() || other.IsEmpty())
+            return;
+
+        // Each range of the other set can split at most one range of this set in two
+        FlatRangeSet subtracted_set;
+        subtracted_set.Reserve(m_size + other.m_size);
+        SubtractRanges<ScalarT>(begin(), end(), other.begin(), other.end(), Appender{ subtracted_set });
+        *this = std::move(subtracted_set);
+    }
+
+    [[nodiscard]]
+    FlatRangeSet Union(const FlatRangeSet& other) const
+    {
+        META_FUNCTION_TASK();
+        FlatRangeSet united_set;
+        united_set.Reserve(m_size + other.m_size);
+        UniteRanges<ScalarT>(begin(), end(), other.begin(), other.end(), Appender{ united_set });
+        return united_set;
+    }
+
+    [[nodiscard]]
+    FlatRangeSet Intersect(const FlatRangeSet& other) const
+    {
+        META_FUNCTION_TASK();
+        FlatRangeSet intersected_set;
+        intersected_set.Reserve(m_size + other.m_size);
+        IntersectRanges<ScalarT>(begin(), end(), other.begin(), other.end(), Appender{ intersected_set });
+        return intersected_set;
+    }
+
+private:
+    struct Appender
+    {
+        FlatRangeSet& range_set;
+
+        // Capacity is reserved by the caller for the maximum resulting ranges count
+        void operator()(const Range<ScalarT>& range) const { range_set.GetData()[range_set.m_size++] = range; }
+    };
+
+    [[nodiscard]] Range<ScalarT>*       GetData() noexcept       { return m_heap_ranges ? m_heap_ranges.get() : m_inline_ranges.data(); }
+    [[nodiscard]] const Range<ScalarT>* GetData() const noexcept { return m_heap_ranges ? m_heap_ranges.get() : m_inline_ranges.data(); }
+
+    void Assign(const FlatRangeSet& other)
+    {
+        Clear();
+        Reserve(other.m_size);
+        std::copy(other.begin(), other.end(), GetData());
+        m_size = other.m_size;
+    }
+
+    void Swap(FlatRangeSet& other) noexcept
+    {
+        std::swap(m_inline_ranges, other.m_inline_ranges);
+        std::swap(m_heap_ranges, other.m_heap_ranges);
+        std::swap(m_capacity, other.m_capacity);
+        std::swap(m_size, other.m_size);
+    }
+
+    // Replace ranges in [first_it, last_it) with new ranges, shifting the tail of the array
+    void Splice(ConstIterator first_it, ConstIterator last_it, const Range<ScalarT>* new_ranges, size_t new_ranges_count)
+    {
+        const auto first_index = static_cast<size_t>(first_it - begin());
+        const auto last_index  = static_cast<size_t>(last_it - begin());
+        const size_t old_ranges_count = last_index - first_index;
+        const size_t tail_count = m_size - last_index;
+
+        if (new_ranges_count > old_ranges_count)
+        {
+            // Copy new ranges before reallocation, since they may point to the old storage
+            std::array<Range<ScalarT>, 2> new_ranges_copy;
+            META_CHECK_ARG_LESS_OR_EQUAL(new_ranges_count, new_ranges_copy.size());
+            std::copy(new_ranges, new_ranges + new_ranges_count, new_ranges_copy.data());
+
+            Reserve(m_size + new_ranges_count - old_ranges_count);
+            Range<ScalarT>* data = GetData();
+            std::copy_backward(data + last_index, data + m_size, data + m_size + new_ranges_count - old_ranges_count);
+            std::copy(new_ranges_copy.data(), new_ranges_copy.data() + new_ranges_count, data + first_index);
+        }
+        else
+        {
+            Range<ScalarT>* data = GetData();
+            std::copy(new_ranges, new_ranges + new_ranges_count, data + first_index);
+            std::copy(data + last_index, data + m_size, data + first_index + new_ranges_count);
+        }
+
+        m_size = first_index + new_ranges_count + tail_count;
+    }
+
+    std::array<Range<ScalarT>, inline_ranges_count> m_inline_ranges;
+    std::unique_ptr<Range<ScalarT>[]>               m_heap_ranges;
+    size_t                                          m_capacity = inline_ranges_count;
+    size_t                                          m_size     = 0U;
+};
+
+} // namespace Methane::Data
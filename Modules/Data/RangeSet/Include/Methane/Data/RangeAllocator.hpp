@@ -0,0 +1,159 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Data/RangeAllocator.hpp
+
+Allocator of aligned sub-ranges in a linear address space of fixed capacity,
+used for placement of resources in large memory blocks. Free ranges are indexed
+both by offset and by length: allocation takes the best fitting free range in
+logarithmic time and freed ranges are merged with adjacent free neighbours.
+
+******************************************************************************/
+
+#pragma once
+
+#include "Range.hpp"
+
+#include <Methane/Memory.hpp>
+#include <Methane/Instrumentation.h>
+#include <Methane/Checks.hpp>
+
+#include <map>
+#include <set>
+#include <utility>
+#include <type_traits>
+
+namespace Methane::Data
+{
+
+template<typename ScalarT>
+class RangeAllocator
+{
+    static_assert(std::is_unsigned_v<ScalarT>, "Range allocator supports only unsigned scalar types");
+
+public:
+    explicit RangeAllocator(ScalarT capacity)
+        : m_capacity(capacity)
+    {
+        META_FUNCTION_TASK();
+        META_CHECK_ARG_NOT_ZERO(capacity);
+        AddFreeRange(0U, capacity);
+    }
+
+    [[nodiscard]] ScalarT GetCapacity() const noexcept         { return m_capacity; }
+    [[nodiscard]] ScalarT GetAllocatedSize() const noexcept    { return m_allocated_size; }
+    [[nodiscard]] ScalarT GetFreeSize() const noexcept         { return m_capacity - m_allocated_size; }
+    [[nodiscard]] size_t  GetAllocationsCount() const noexcept { return m_allocations_count; }
+    [[nodiscard]] size_t  GetFreeRangesCount() const noexcept  { return m_free_end_by_start.size(); }
+    [[nodiscard]] bool    IsEmpty() const noexcept             { return !m_allocations_count; }
+
+    [[nodiscard]] ScalarT GetLargestFreeLength() const noexcept
+    {
+        return m_free_by_length.empty() ? ScalarT{} : m_free_by_length.rbegin()->first;
+    }
+
+    // Returns allocated range with aligned start, or empty optional when no free range can fit the requested length
+    [[nodiscard]] Opt<Range<ScalarT>> Allocate(ScalarT length, ScalarT alignment = 1U)
+    {
+        META_FUNCTION_TASK();
+        META_CHECK_ARG_NOT_ZERO(length);
+        META_CHECK_ARG_DESCR(alignment, alignment && !(alignment & (alignment - 1U)), "alignment must be a power of two");
+
+        // Free ranges are visited from the best fitting length, alignment padding may require a longer range
+        for(auto free_it = m_free_by_length.lower_bound({ length, ScalarT{} }); free_it != m_free_by_length.end(); ++free_it)
+        {
+            const auto [free_length, free_start] = *free_it;
+            const ScalarT free_end      = free_start + free_length;
+            const ScalarT aligned_start = (free_start + alignment - 1U) & ~(alignment - 1U);
+            if (aligned_start < free_start || aligned_start > free_end || free_end - aligned_start < length)
+                continue;
+
+            RemoveFreeRange(free_start, free_end);
+            if (aligned_start > free_start)
+                AddFreeRange(free_start, aligned_start);
+            if (aligned_start + length < free_end)
+                AddFreeRange(aligned_start + length, free_end);
+
+            m_allocated_size += length;
+            m_allocations_count++;
+            return Range<ScalarT>(aligned_start, aligned_start + length);
+        }
+        return std::nullopt;
+    }
+
+    void Free(const Range<ScalarT>& range)
+    {
+        META_FUNCTION_TASK();
+        META_CHECK_ARG_NOT_ZERO_DESCR(range.GetLength(), "can not free empty range");
+        META_CHECK_ARG_LESS_OR_EQUAL_DESCR(range.GetEnd(), m_capacity, "range is out of allocator capacity");
+        META_CHECK_ARG_NOT_ZERO_DESCR(m_allocations_count, "allocator has no allocated ranges to free");
+
+        ScalarT free_start = range.GetStart();
+        ScalarT free_end   = range.GetEnd();
+
+        // Merge with adjacent free range on the right
+        if (const auto next_it = m_free_end_by_start.lower_bound(free_start);
+            next_it != m_free_end_by_start.end())
+        {
+            META_CHECK_ARG_DESCR(range, next_it->first >= free_end, "freed range overlaps with free range");
+            if (next_it->first == free_end)
+            {
+                free_end = next_it->second;
+                RemoveFreeRange(next_it->first, next_it->second);
+            }
+        }
+
+        // Merge with adjacent free range on the left
+        if (const auto next_it = m_free_end_by_start.lower_bound(free_start);
+            next_it != m_free_end_by_start.begin())
+        {
+            const auto prev_it = std::prev(next_it);
+            META_CHECK_ARG_DESCR(range, prev_it->second <= free_start, "freed range overlaps with free range");
+            if (prev_it->second == free_start)
+            {
+                free_start = prev_it->first;
+                RemoveFreeRange(prev_it->first, prev_it->second);
+            }
+        }
+
+        AddFreeRange(free_start, free_end);
+        m_allocated_size -= range.GetLength();
+        m_allocations_count--;
+    }
+
+private:
+    void AddFreeRange(ScalarT start, ScalarT end)
+    {
+        m_free_end_by_start.emplace(start, end);
+        m_free_by_length.emplace(end - start, start);
+    }
+
+    void RemoveFreeRange(ScalarT start, ScalarT end)
+    {
+        m_free_end_by_start.erase(start);
+        m_free_by_length.erase({ end - start, start });
+    }
+
+    ScalarT                               m_capacity;
+    ScalarT                               m_allocated_size = 0U;
+    size_t                                m_allocations_count = 0U;
+    std::map<ScalarT, ScalarT>            m_free_end_by_start;
+    std::set<std::pair<ScalarT, ScalarT>> m_free_by_length; // pairs of free range length and start
+};
+
+} // namespace Methane::Data
@@ -26,6 +26,7 @@ minimum number of continuous ranges by merging or splitting adjacent ranges in s
 #pragma once
 
 #include "Range.hpp"
+#include "RangeSetAlgorithms.hpp"
 
 #include <Methane/Instrumentation.h>
 
@@ -59,7 +60,7 @@ public:
 
     [[nodiscard]] size_t Size() const noexcept              { return m_container.size();  }
     [[nodiscard]] bool   IsEmpty() const noexcept           { return m_container.empty(); }
-    [[nodiscard]] const BaseSet& GetRanges() const noexcept { return *this; }
+    [[nodiscard]] const BaseSet& GetRanges() const noexcept { return m_container; }
     [[nodiscard]] ConstIterator begin() const noexcept      { return m_container.begin(); }
     [[nodiscard]] ConstIterator end() const noexcept        { return m_container.end(); }
 
@@ -82,7 +83,7 @@ public:
             remove_ranges.emplace_back(*range_it);
         }
 
-        RemoveRanges(remove_ranges);
+        EraseRanges(remove_ranges);
         m_container.insert(merged_range);
     }
 
@@ -123,8 +124,46 @@ public:
             }
         }
 
-        RemoveRanges(remove_ranges);
-        AddRanges(add_ranges);
+        EraseRanges(remove_ranges);
+        InsertRanges(add_ranges);
+    }
+
+    void AddRanges(const RangeSet<ScalarT>& other)
+    {
+        META_FUNCTION_TASK();
+        BaseSet united_container;
+        UniteRanges<ScalarT>(m_container.begin(), m_container.end(), other.begin(), other.end(),
+                             ContainerAppender{ united_container });
+        m_container.swap(united_container);
+    }
+
+    void RemoveRanges(const RangeSet<ScalarT>& other)
+    {
+        META_FUNCTION_TASK();
+        BaseSet subtracted_container;
+        SubtractRanges<ScalarT>(m_container.begin(), m_container.end(), other.begin(), other.end(),
+                                ContainerAppender{ subtracted_container });
+        m_container.swap(subtracted_container);
+    }
+
+    [[nodiscard]]
+    RangeSet<ScalarT> Union(const RangeSet<ScalarT>& other) const
+    {
+        META_FUNCTION_TASK();
+        RangeSet<ScalarT> united_set;
+        UniteRanges<ScalarT>(m_container.begin(), m_container.end(), other.begin(), other.end(),
+                             ContainerAppender{ united_set.m_container });
+        return united_set;
+    }
+
+    [[nodiscard]]
+    RangeSet<ScalarT> Intersect(const RangeSet<ScalarT>& other) const
+    {
+        META_FUNCTION_TASK();
+        RangeSet<ScalarT> intersected_set;
+        IntersectRanges<ScalarT>(m_container.begin(), m_container.end(), other.begin(), other.end(),
+                                 ContainerAppender{ intersected_set.m_container });
+        return intersected_set;
     }
 
 private:
@@ -163,8 +202,16 @@ private:
         return mergeable_ranges;
     }
 
+    struct ContainerAppender
+    {
+        BaseSet& container;
+
+        // Ranges are produced in sorted order, so insertion with end hint takes amortized constant time
+        void operator()(const Range<ScalarT>& range) const { container.emplace_hint(container.end(), range); }
+    };
+
     using Ranges = std::vector<Range<ScalarT>>;
-    inline void RemoveRanges(const Ranges& delete_ranges) noexcept
+    inline void EraseRanges(const Ranges& delete_ranges) noexcept
     {
         META_FUNCTION_TASK();
         for (const Range<ScalarT>& delete_range : delete_ranges)
@@ -173,7 +220,7 @@ private:
         }
     }
 
-    inline void AddRanges(const Ranges& add_ranges)
+    inline void InsertRanges(const Ranges& add_ranges)
     {
         META_FUNCTION_TASK();
         for(const Range<ScalarT>& add_range : add_ranges)
@@ -0,0 +1,134 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Data/RangeSetAlgorithms.hpp
+
+Single-pass algorithms of union, intersection and subtraction of two sorted
+sequences of non-mergeable ranges, used for bulk operations of range sets.
+Every algorithm passes resulting ranges in sorted non-mergeable order
+to the output functor, so that they can be appended to the end of container.
+
+******************************************************************************/
+
+#pragma once
+
+#include "Range.hpp"
+
+#include <algorithm>
+
+namespace Methane::Data
+{
+
+template<typename ScalarT, typename LeftIteratorT, typename RightIteratorT, typename OutputFuncT>
+void UniteRanges(LeftIteratorT left_it, LeftIteratorT left_end,
+                 RightIteratorT right_it, RightIteratorT right_end,
+                 OutputFuncT&& output)
+{
+    bool    has_range   = false;
+    ScalarT range_start = {};
+    ScalarT range_end   = {};
+
+    const auto append_range = [&](const Range<ScalarT>& range)
+    {
+        if (has_range && range.GetStart() <= range_end)
+        {
+            range_end = std::max(range_end, range.GetEnd());
+            return;
+        }
+        if (has_range)
+        {
+            output(Range<ScalarT>(range_start, range_end));
+        }
+        has_range   = true;
+        range_start = range.GetStart();
+        range_end   = range.GetEnd();
+    };
+
+    while (left_it != left_end && right_it != right_end)
+    {
+        if (left_it->GetStart() <= right_it->GetStart())
+            append_range(*left_it++);
+        else
+            append_range(*right_it++);
+    }
+    for (; left_it != left_end; ++left_it)
+        append_range(*left_it);
+    for (; right_it != right_end; ++right_it)
+        append_range(*right_it);
+
+    if (has_range)
+    {
+        output(Range<ScalarT>(range_start, range_end));
+    }
+}
+
+template<typename ScalarT, typename LeftIteratorT, typename RightIteratorT, typename OutputFuncT>
+void IntersectRanges(LeftIteratorT left_it, LeftIteratorT left_end,
+                     RightIteratorT right_it, RightIteratorT right_end,
+                     OutputFuncT&& output)
+{
+    while (left_it != left_end && right_it != right_end)
+    {
+        const ScalarT start = std::max(left_it->GetStart(), right_it->GetStart());
+        const ScalarT end   = std::min(left_it->GetEnd(), right_it->GetEnd());
+        if (start < end)
+        {
+            output(Range<ScalarT>(start, end));
+        }
+        if (left_it->GetEnd() < right_it->GetEnd())
+            ++left_it;
+        else
+            ++right_it;
+    }
+}
+
+template<typename ScalarT, typename LeftIteratorT, typename RightIteratorT, typename OutputFuncT>
+void SubtractRanges(LeftIteratorT left_it, LeftIteratorT left_end,
+                    RightIteratorT right_it, RightIteratorT right_end,
+                    OutputFuncT&& output)
+{
+    for (; left_it != left_end; ++left_it)
+    {
+        ScalarT       start = left_it->GetStart();
+        const ScalarT end   = left_it->GetEnd();
+
+        while (right_it != right_end && right_it->GetEnd() <= start)
+            ++right_it;
+
+        while (right_it != right_end && right_it->GetStart() < end)
+        {
+            if (start < right_it->GetStart())
+            {
+                output(Range<ScalarT>(start, right_it->GetStart()));
+            }
+
+            start = std::max(start, right_it->GetEnd());
+            if (right_it->GetEnd() >= end)
+                break; // right range may also overlap with the next left range
+
+            ++right_it;
+        }
+
+        if (start < end)
+        {
+            output(Range<ScalarT>(start, end));
+        }
+    }
+}
+
+} // namespace Methane::Data
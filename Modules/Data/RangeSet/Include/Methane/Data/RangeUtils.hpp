@@ -26,6 +26,7 @@ minimum number of continuous ranges by merging or splitting adjacent ranges in s
 #pragma once
 
 #include "RangeSet.hpp"
+#include "FlatRangeSet.hpp"
 
 #include <Methane/Instrumentation.h>
 
@@ -46,10 +47,10 @@ struct fmt::formatter<Methane::Data::Range<ScalarT>>
 namespace Methane::Data
 {
 
-template<typename ScalarT>
-Range<ScalarT> ReserveRange(RangeSet<ScalarT>& free_ranges, ScalarT reserved_length) noexcept
+template<typename RangeSetT, typename ScalarT>
+Range<ScalarT> ReserveRangeInSet(RangeSetT& free_ranges, ScalarT reserved_length) noexcept
 {
-    typename RangeSet<ScalarT>::ConstIterator free_range_it = std::find_if(
+    typename RangeSetT::ConstIterator free_range_it = std::find_if(
         free_ranges.begin(), free_ranges.end(),
         [reserved_length](const Range<ScalarT>& range)
         {
@@ -65,4 +66,16 @@ Range<ScalarT> ReserveRange(RangeSet<ScalarT>& free_ranges, ScalarT reserved_len
     return reserved_range;
 }
 
+template<typename ScalarT>
+Range<ScalarT> ReserveRange(RangeSet<ScalarT>& free_ranges, ScalarT reserved_length) noexcept
+{
+    return ReserveRangeInSet(free_ranges, reserved_length);
+}
+
+template<typename ScalarT, size_t inline_ranges_count>
+Range<ScalarT> ReserveRange(FlatRangeSet<ScalarT, inline_ranges_count>& free_ranges, ScalarT reserved_length) noexcept
+{
+    return ReserveRangeInSet(free_ranges, reserved_length);
+}
+
 } // namespace Methane::Data
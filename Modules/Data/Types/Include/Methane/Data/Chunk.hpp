@@ -25,6 +25,8 @@ Data chunk representing owning or non-owning memory container
 
 #include "Types.h"
 
+#include <memory>
+
 namespace Methane::Data
 {
 
@@ -37,6 +39,13 @@ public:
         , m_data_size(size)
     { }
 
+    // Chunk referencing external memory, which lifetime is managed by the shared data owner (file mapping, for example)
+    Chunk(ConstRawPtr data_ptr, Size size, std::shared_ptr<const void> data_owner_ptr) noexcept
+        : m_data_owner_ptr(std::move(data_owner_ptr))
+        , m_data_ptr(data_ptr)
+        , m_data_size(size)
+    { }
+
     explicit Chunk(Bytes&& data) noexcept
         : m_data_storage(std::move(data))
         , m_data_ptr(m_data_storage.empty() ? nullptr : m_data_storage.data())
@@ -45,19 +54,22 @@ public:
 
     explicit Chunk(const Chunk& other)
         : m_data_storage(other.m_data_storage)
+        , m_data_owner_ptr(other.m_data_owner_ptr)
         , m_data_ptr(m_data_storage.empty() ? other.m_data_ptr : m_data_storage.data())
         , m_data_size(m_data_storage.empty() ? other.m_data_size : static_cast<Size>(m_data_storage.size()))
     { }
 
-    explicit Chunk(Chunk&& other) noexcept
+    Chunk(Chunk&& other) noexcept
         : m_data_storage(std::move(other.m_data_storage))
+        , m_data_owner_ptr(std::move(other.m_data_owner_ptr))
         , m_data_ptr(m_data_storage.empty() ? other.m_data_ptr : m_data_storage.data())
         , m_data_size(m_data_storage.empty() ? other.m_data_size : static_cast<Size>(m_data_storage.size()))
     { }
 
     Chunk& operator=(const Chunk& other) noexcept
     {
-        m_data_storage = other.m_data_storage;
+        m_data_storage   = other.m_data_storage;
+        m_data_owner_ptr = other.m_data_owner_ptr;
         m_data_ptr     = m_data_storage.empty() ? other.m_data_ptr : m_data_storage.data();
         m_data_size    = m_data_storage.empty() ? other.m_data_size : static_cast<Size>(m_data_storage.size());
         return *this;
@@ -65,7 +77,8 @@ public:
 
     Chunk& operator=(Chunk&& other) noexcept
     {
-        m_data_storage = std::move(other.m_data_storage);
+        m_data_storage   = std::move(other.m_data_storage);
+        m_data_owner_ptr = std::move(other.m_data_owner_ptr);
         m_data_ptr     = m_data_storage.empty() ? other.m_data_ptr : m_data_storage.data();
         m_data_size    = m_data_storage.empty() ? other.m_data_size : static_cast<Size>(m_data_storage.size());
         return *this;
@@ -73,6 +86,7 @@ public:
 
     [[nodiscard]] bool IsEmptyOrNull() const noexcept { return !m_data_ptr || !m_data_size; }
     [[nodiscard]] bool IsDataStored() const noexcept  { return !m_data_storage.empty(); }
+    [[nodiscard]] bool HasDataOwner() const noexcept  { return static_cast<bool>(m_data_owner_ptr); }
 
     template<typename T = Byte>
     [[nodiscard]] Size GetDataSize() const noexcept
@@ -101,9 +115,10 @@ public:
 private:
     // Data storage is used only when m_data_storage is not managed by m_data_storage provider and
     // returned with chunk (when m_data_storage is loaded from file, for example)
-    Bytes       m_data_storage;
-    ConstRawPtr m_data_ptr  = nullptr;
-    Size        m_data_size = 0U;
+    Bytes                       m_data_storage;
+    std::shared_ptr<const void> m_data_owner_ptr;
+    ConstRawPtr                 m_data_ptr  = nullptr;
+    Size                        m_data_size = 0U;
 };
 
 } // namespace Methane::Data
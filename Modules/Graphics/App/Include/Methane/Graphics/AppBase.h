@@ -27,6 +27,7 @@ Base implementation of the Methane graphics application.
 #include "CombinedAppSettings.h"
 
 #include <Methane/Data/IProvider.h>
+#include <Methane/Data/AsyncProvider.h>
 #include <Methane/Data/AnimationsPool.h>
 #include <Methane/Data/Receiver.hpp>
 #include <Methane/Platform/App.h>
@@ -117,6 +118,7 @@ private:
     Rhi::RenderContextSettings m_initial_context_settings;
     Rhi::RenderPatternSettings m_screen_pass_pattern_settings;
     Timer                      m_title_update_timer;
+    Data::AsyncProvider        m_textures_provider;
     ImageLoader                m_image_loader;
     Data::AnimationsPool       m_animations;
     Rhi::RenderContext         m_context;
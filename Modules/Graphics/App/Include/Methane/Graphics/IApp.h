@@ -27,6 +27,7 @@ Interface of the graphics application base template class defined in App.hpp
 #include <Methane/Graphics/RHI/IDevice.h>
 
 #include <stdint.h>
+#include <string>
 
 namespace Methane::Graphics
 {
@@ -38,12 +39,14 @@ struct AppSettings
     bool                      show_hud_in_window_title = true;
     int32_t                   default_device_index     = 0;    // 0 - default h/w GPU, 1 - second h/w GPU, -1 - emulated WARP device
     Rhi::DeviceCaps           device_capabilities;
+    std::string               pipeline_cache_path;         // empty path disables pipeline cache persistence
 
     AppSettings& SetScreenPassAccess(Rhi::RenderPassAccessMask new_screen_pass_access) noexcept;
     AppSettings& SetAnimationsEnabled(bool new_animations_enabled) noexcept;
     AppSettings& SetShowHudInWindowTitle(bool new_show_hud_in_window_title) noexcept;
     AppSettings& SetDefaultDeviceIndex(int32_t new_default_device_index) noexcept;
     AppSettings& SetDeviceCapabilities(Rhi::DeviceCaps&& new_device_capabilities) noexcept;
+    AppSettings& SetPipelineCachePath(std::string&& new_pipeline_cache_path) noexcept;
 };
 
 struct IApp
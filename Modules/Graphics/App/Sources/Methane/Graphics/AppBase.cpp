@@ -48,7 +48,8 @@ AppBase::AppBase(const CombinedAppSettings& settings, Data::IProvider& textures_
     : Platform::App(settings.platform_app)
     , m_settings(settings.graphics_app)
     , m_initial_context_settings(settings.render_context)
-    , m_image_loader(textures_provider)
+    , m_textures_provider(textures_provider, GetParallelExecutor())
+    , m_image_loader(m_textures_provider)
 {
     META_FUNCTION_TASK();
 
@@ -56,6 +57,7 @@ AppBase::AppBase(const CombinedAppSettings& settings, Data::IProvider& textures_
     add_option("-d,--device", m_settings.default_device_index, "Render at adapter index, use -1 for software adapter");
     add_option("-v,--vsync", m_initial_context_settings.vsync_enabled, "Vertical synchronization");
     add_option("-b,--frame-buffers", m_initial_context_settings.frame_buffers_count, "Frame buffers count in swap-chain");
+    add_option("--pipeline-cache", m_settings.pipeline_cache_path, "Pipeline cache file path, empty path disables pipeline cache");
 
 #ifdef _WIN32
     add_flag("-e,--emulated-render-pass",
@@ -98,13 +100,20 @@ void AppBase::InitContext(const Platform::AppEnvironment& env, const FrameSize&
     META_LOG("\n====================== CONTEXT INITIALIZATION ======================");
 
     // Get default device for rendering
-    Rhi::System::Get().UpdateGpuDevices(env, m_settings.device_capabilities);
+    const Rhi::Devices& devices = Rhi::System::Get().UpdateGpuDevices(env, m_settings.device_capabilities);
     const Rhi::Device device = GetDefaultDevice();
     META_CHECK_ARG_TRUE(device.IsInitialized());
 
+    // Pipeline cache path is set for all devices, so that it is used after switching context to another device
+    for(const Rhi::Device& gpu_device : devices)
+    {
+        gpu_device.SetPipelineCachePath(m_settings.pipeline_cache_path);
+    }
+
     // Create render context of the current window size
     m_initial_context_settings.frame_size = frame_size;
     m_context = device.CreateRenderContext(env, GetParallelExecutor(), m_initial_context_settings);
+    m_animations.SetParallelExecutor(&GetParallelExecutor());
     m_context.SetName("Graphics Context");
     m_context.Connect(*this);
 
@@ -61,4 +61,11 @@ AppSettings& AppSettings::SetDeviceCapabilities(Rhi::DeviceCaps&& new_device_cap
     return *this;
 }
 
+AppSettings& AppSettings::SetPipelineCachePath(std::string&& new_pipeline_cache_path) noexcept
+{
+    META_FUNCTION_TASK();
+    pipeline_cache_path = std::move(new_pipeline_cache_path);
+    return *this;
+}
+
 } // namespace Methane::Graphics
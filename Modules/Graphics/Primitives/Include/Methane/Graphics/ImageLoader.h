@@ -31,6 +31,7 @@ by decoding them from popular image formats.
 
 #include <string>
 #include <array>
+#include <vector>
 
 namespace Methane::Graphics
 {
@@ -84,6 +85,9 @@ public:
 
     explicit ImageLoader(Data::IProvider& data_provider);
 
+    // Starts asynchronous loading of image files, which are going to be loaded to textures soon
+    void Prefetch(const std::vector<std::string>& image_paths) const;
+
     [[nodiscard]] ImageData    LoadImageData(const std::string& image_path, Data::Size channels_count, bool create_copy) const;
     [[nodiscard]] Rhi::Texture LoadImageToTexture2D(const Rhi::CommandQueue& target_cmd_queue, const std::string& image_path, ImageOptionMask options = {}, const std::string& texture_name = "") const;
     [[nodiscard]] Rhi::Texture LoadImagesToTextureCube(const Rhi::CommandQueue& target_cmd_queue, const CubeFaceResources& image_paths, ImageOptionMask options = {}, const std::string& texture_name = "") const;
@@ -34,6 +34,8 @@ Mesh buffers with texture extension structure.
 
 #include <fmt/format.h>
 
+#include <cstring>
+
 namespace Methane::Graphics
 {
 
@@ -88,6 +90,21 @@ public:
         m_final_pass_instance_uniforms[instance_index] = std::move(uniforms);
     }
 
+    // Writes instance uniforms straight to the persistently mapped memory of uniforms buffer,
+    // so that upload with buffer SetData is bypassed, while CPU-side uniforms storage is kept in sync
+    void SetFinalPassUniforms(const UniformsType& uniforms, Data::Index instance_index, const Rhi::BufferMappedSpan& uniforms_buffer_span)
+    {
+        META_FUNCTION_TASK();
+        META_CHECK_ARG_LESS(instance_index, m_final_pass_instance_uniforms.size());
+        META_CHECK_ARG_FALSE_DESCR(uniforms_buffer_span.IsEmpty(), "uniforms buffer memory is not mapped");
+
+        const Data::Size uniforms_offset = GetUniformsBufferOffset(instance_index);
+        META_CHECK_ARG_LESS_OR_EQUAL_DESCR(uniforms_offset + GetUniformSize(), uniforms_buffer_span.data_size,
+                                           "instance uniforms are out of uniforms buffer bounds");
+        std::memcpy(uniforms_buffer_span.data_ptr + uniforms_offset, &uniforms, sizeof(UniformsType));
+        m_final_pass_instance_uniforms[instance_index] = uniforms;
+    }
+
     [[nodiscard]]
     static constexpr Data::Size GetUniformSize() noexcept
     {
@@ -85,6 +85,12 @@ ImageLoader::ImageLoader(Data::IProvider& data_provider)
     : m_data_provider(data_provider)
 { }
 
+void ImageLoader::Prefetch(const std::vector<std::string>& image_paths) const
+{
+    META_FUNCTION_TASK();
+    m_data_provider.Prefetch(image_paths);
+}
+
 ImageData ImageLoader::LoadImageData(const std::string& image_path, Data::Size channels_count, bool create_copy) const
 {
     META_FUNCTION_TASK();
@@ -180,6 +186,9 @@ Rhi::Texture ImageLoader::LoadImagesToTextureCube(const Rhi::CommandQueue& targe
 {
     META_FUNCTION_TASK();
 
+    // Start reading all face image files before decoding to overlap file I/O with decoding of the first faces
+    m_data_provider.Prefetch(std::vector<std::string>(image_paths.begin(), image_paths.end()));
+
     // Load face image data in parallel
     TracyLockable(std::mutex, data_mutex);
     std::vector<std::pair<Data::Index, ImageData>> face_images_data;
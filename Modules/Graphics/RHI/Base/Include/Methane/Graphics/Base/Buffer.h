@@ -45,6 +45,7 @@ public:
     // IBuffer interface
     const Settings& GetSettings() const noexcept final { return m_settings; }
     uint32_t        GetFormattedItemsCount() const noexcept final;
+    MappedSpan      GetMappedSpan() const noexcept override { return {}; }
     void            SetData(Rhi::ICommandQueue&, const SubResource& sub_resource) override;
 
 private:
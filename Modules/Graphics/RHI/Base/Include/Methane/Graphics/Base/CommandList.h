@@ -38,9 +38,17 @@ Base implementation of the command list interface.
 #endif
 
 #include <stack>
+#include <vector>
 #include <mutex>
 #include <condition_variable>
 
+namespace Methane::Graphics::Rhi
+{
+
+struct IBuffer;
+
+} // namespace Methane::Graphics::Rhi
+
 namespace Methane::Graphics::Base
 {
 
@@ -63,6 +71,9 @@ public:
         // Raw pointer is used for program bindings instead of smart pointer for performance reasons
         // to get rid of shared_from_this() overhead required to acquire smart pointer from reference
         const ProgramBindings* program_bindings_ptr = nullptr;
+        // Objects used by encoded commands are retained from encoding with one reference per run of commands using the same object,
+        // duplicates are removed on commit and the rest are kept alive until command list execution is completed on GPU
+        Ptrs<Object>           tracked_resources;
         Ptrs<Object>           retained_resources;
     };
 
@@ -80,6 +91,7 @@ public:
     void  Commit() override;
     void  WaitUntilCompleted(uint32_t timeout_ms = 0U) override;
     Data::TimeRange GetGpuTimeRange(bool in_cpu_nanoseconds) const override;
+    Statistics GetStatistics() const noexcept override              { return m_statistics; }
     Rhi::ICommandQueue& GetCommandQueue() final;
 
     // CommandList interface
@@ -95,9 +107,12 @@ public:
     const ProgramBindings* GetProgramBindingsPtr() const noexcept { return GetCommandState().program_bindings_ptr; }
     Ptr<CommandList>       GetCommandListPtr()                    { return GetPtr<CommandList>(); }
 
+    inline void CountResourceBarriers(size_t barriers_count) noexcept    { m_statistics.resource_barriers_count += static_cast<uint32_t>(barriers_count); }
+    inline void CountDescriptorSetBinds(uint32_t binds_count) noexcept  { m_statistics.descriptor_set_binds_count += binds_count; }
+
     inline void RetainResource(const Ptr<Object>& resource_ptr)   { if (resource_ptr) m_command_state.retained_resources.emplace_back(resource_ptr); }
     inline void RetainResource(Object& resource)                  { m_command_state.retained_resources.emplace_back(resource.GetBasePtr()); }
-    inline void ReleaseRetainedResources()                        { m_command_state.retained_resources.clear(); }
+    inline void ReleaseRetainedResources()                        { m_command_state.tracked_resources.clear(); m_command_state.retained_resources.clear(); }
 
     template<typename T, typename = std::enable_if_t<std::is_base_of_v<Object, T>>>
     inline void RetainResources(const Ptrs<T>& resource_ptrs)
@@ -106,10 +121,27 @@ public:
             RetainResource(std::static_pointer_cast<Object>(resource_ptr));
     }
 
+    // Tracked resource is retained from encoding until command list execution is completed,
+    // consecutive commands often use the same object, so it is tracked only once
+    inline void TrackResource(Object& resource)
+    {
+        Ptrs<Object>& tracked_resources = m_command_state.tracked_resources;
+        if (tracked_resources.empty() || tracked_resources.back().get() != std::addressof(resource))
+            tracked_resources.emplace_back(resource.GetBasePtr());
+    }
+
+    inline void TrackResource(Ptr<Object> resource_ptr)
+    {
+        Ptrs<Object>& tracked_resources = m_command_state.tracked_resources;
+        if (resource_ptr && (tracked_resources.empty() || tracked_resources.back() != resource_ptr))
+            tracked_resources.emplace_back(std::move(resource_ptr));
+    }
+
 protected:
     virtual void ResetCommandState();
     virtual void ApplyProgramBindings(ProgramBindings& program_bindings, Rhi::ProgramBindingsApplyBehaviorMask apply_behavior);
 
+    Statistics&         GetStatisticsRef() noexcept { return m_statistics; }
     CommandState&       GetCommandState()        { return m_command_state; }
     const CommandState& GetCommandState() const  { return m_command_state; }
 
@@ -125,15 +157,19 @@ protected:
     void EndGpuZone();
 
     void VerifyEncodingState() const;
+    void ValidateIndirectArguments(const Rhi::IBuffer& args_buffer, Data::Size args_offset, Data::Size args_size, uint32_t args_count,
+                                   const Rhi::IBuffer* count_buffer_ptr = nullptr, Data::Size count_offset = 0U) const;
 
 private:
     using DebugGroupStack  = std::stack<Ptr<DebugGroup>>;
 
     void CompleteInternal();
+    void RetainTrackedResources();
 
     const Type        m_type;
     Ptr<CommandQueue> m_command_queue_ptr;
     CommandState      m_command_state;
+    Statistics        m_statistics;
     DebugGroupStack   m_open_debug_groups;
     CompletedCallback m_completed_callback;
     State             m_state = State::Pending;
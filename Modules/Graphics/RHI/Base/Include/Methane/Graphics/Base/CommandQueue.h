@@ -28,10 +28,13 @@ Base implementation of the command queue interface.
 
 #include <Methane/Graphics/RHI/ICommandQueue.h>
 #include <Methane/TracyGpu.hpp>
+#include <Methane/FrameArena.hpp>
 
 #include <list>
 #include <set>
+#include <vector>
 #include <mutex>
+#include <atomic>
 
 namespace Methane::Graphics::Base
 {
@@ -39,6 +42,7 @@ namespace Methane::Graphics::Base
 class Context;
 class RenderContext;
 class Device;
+class CommandListSet;
 
 class CommandQueue
     : public Object
@@ -56,7 +60,11 @@ public:
     [[nodiscard]] Ptr<Rhi::ICommandKit> CreateCommandKit() final;
     [[nodiscard]] const Rhi::IContext& GetContext() const noexcept final;
     Rhi::CommandListType GetCommandListType() const noexcept final { return m_command_lists_type; }
-    void Execute(Rhi::ICommandListSet& command_lists, const Rhi::ICommandList::CompletedCallback& completed_callback = {}) override;
+    void Execute(Rhi::ICommandListSet& command_lists, const Rhi::ICommandList::CompletedCallback& completed_callback = {}) final;
+    void ExecuteBatch(const Refs<Rhi::ICommandListSet>& command_list_sets, const Rhi::ICommandList::CompletedCallback& completed_callback = {}) final;
+    void SetDeferredExecution(bool is_deferred_execution) final;
+    bool IsDeferredExecution() const noexcept final { return m_is_deferred_execution; }
+    void ExecuteDeferred() final;
 
     const Context&     GetBaseContext() const noexcept     { return m_context; }
     Device&            GetBaseDevice() const noexcept      { return *m_device_ptr; }
@@ -65,6 +73,37 @@ public:
     Tracy::GpuContext& GetTracyContext() const;
 
 protected:
+    struct CommandListSetExecution
+    {
+        Ptr<CommandListSet>                 command_list_set_ptr;
+        Rhi::ICommandList::CompletedCallback completed_callback;
+    };
+
+    using CommandListSetExecutions = FrameVector<CommandListSetExecution>;
+
+    // Temporary data of command list sets execution is allocated in the thread-local frame arena,
+    // which is reset on exit from the outermost scope, so that steady-state executions do not allocate from heap
+    class ExecutionArenaScope
+    {
+    public:
+        ExecutionArenaScope();
+        ~ExecutionArenaScope();
+
+        ExecutionArenaScope(const ExecutionArenaScope&) = delete;
+        ExecutionArenaScope(ExecutionArenaScope&&) = delete;
+        ExecutionArenaScope& operator=(const ExecutionArenaScope&) = delete;
+        ExecutionArenaScope& operator=(ExecutionArenaScope&&) = delete;
+
+        template<typename T>
+        [[nodiscard]] FrameArenaAllocator<T> GetAllocator() const noexcept { return FrameArenaAllocator<T>(m_arena); }
+
+    private:
+        FrameArena& m_arena;
+    };
+
+    // CommandQueue interface
+    virtual void ExecuteCommandListSets(const CommandListSetExecutions& command_list_set_executions);
+
     void InitializeTracyGpuContext(const Tracy::GpuContext::Settings& tracy_settings);
 
 private:
@@ -72,6 +111,9 @@ private:
     const Ptr<Device>            m_device_ptr;
     const Rhi::CommandListType   m_command_lists_type;
     UniquePtr<Tracy::GpuContext> m_tracy_gpu_context_ptr;
+    std::atomic<bool>            m_is_deferred_execution{ false };
+    std::vector<CommandListSetExecution> m_deferred_executions;
+    TracyLockable(std::mutex,            m_deferred_executions_mutex);
 };
 
 } // namespace Methane::Graphics::Base
@@ -24,16 +24,13 @@ Base implementation of the command queue with execution tracking.
 #pragma once
 
 #include "CommandQueue.h"
+#include "ExecutionCompletionService.h"
 
 #include <Methane/Instrumentation.h>
 
 #include <optional>
 #include <queue>
-#include <thread>
 #include <mutex>
-#include <atomic>
-#include <condition_variable>
-#include <exception>
 
 namespace Methane::Graphics::Rhi
 {
@@ -49,17 +46,12 @@ class CommandListSet;
 
 class CommandQueueTracking // NOSONAR - destructor is required
     : public CommandQueue
+    , protected IExecutionCompletionClient
 {
 public:
     CommandQueueTracking(const Context& context, Rhi::CommandListType command_lists_type);
     ~CommandQueueTracking() override;
 
-    // ICommandQueue interface
-    void Execute(Rhi::ICommandListSet& command_lists, const Rhi::ICommandList::CompletedCallback& completed_callback = {}) override;
-
-    // IObject interface
-    bool SetName(std::string_view name) override;
-
     virtual void CompleteExecution(const Opt<Data::Index>& frame_index = { });
 
     Ptr<CommandListSet> GetLastExecutingCommandListSet() const;
@@ -90,25 +82,26 @@ protected:
         return CommandListSetsQueueGuard<true, decltype(m_executing_command_lists_mutex)>(m_executing_command_lists, m_executing_command_lists_mutex);
     }
 
+    // CommandQueue overrides
+    void ExecuteCommandListSets(const CommandListSetExecutions& command_list_set_executions) override;
+
     virtual void CompleteCommandListSetExecution(CommandListSet& executing_command_list_set);
 
+    void TrackExecutingCommandListSets(const CommandListSetExecutions& command_list_set_executions);
+
     void ShutdownQueueExecution();
 
+    // IExecutionCompletionClient interface
+    void OnCommandListSetExecutionCompleted(CommandListSet& command_list_set) override;
+
 private:
     void InitializeTimestampQueryPool();
     void CompleteExecutionSafely();
-    void WaitForExecution() noexcept;
-
-    const Ptr<CommandListSet>& GetNextExecutingCommandListSet() const;
 
+    ExecutionCompletionService&           m_execution_completion_service;
     CommandListSetsQueue                  m_executing_command_lists;
     mutable TracyLockable(std::mutex,     m_executing_command_lists_mutex);
-    TracyLockable(std::mutex,             m_execution_waiting_mutex);
-    std::condition_variable_any           m_execution_waiting_condition_var;
-    std::atomic<bool>                     m_execution_waiting{ true };
-    std::thread                           m_execution_waiting_thread;
-    std::exception_ptr                    m_execution_waiting_exception_ptr;
-    std::atomic<bool>                     m_name_changed{ true };
+    bool                                  m_is_execution_tracked = true;
     mutable Ptr<Rhi::ITimestampQueryPool> m_timestamp_query_pool_ptr;
 };
 
@@ -46,9 +46,14 @@ public:
     void ResetWithStateOnce(Rhi::IComputeState& compute_state, IDebugGroup* debug_group_ptr = nullptr) final;
     void SetComputeState(Rhi::IComputeState& compute_state) final;
     void Dispatch(const Rhi::ThreadGroupsCount& thread_groups_count) override;
+    void DispatchIndirect(Rhi::IBuffer& args_buffer, Data::Size args_offset) override;
 
     ComputeState& GetComputeState();
 
+protected:
+    // CommandList overrides
+    void ResetCommandState() override;
+
 private:
     Ptr<ComputeState> m_compute_state_ptr;
 };
@@ -26,6 +26,9 @@ Base implementation of the compute context interface.
 #include "Context.h"
 
 #include <Methane/Graphics/RHI/IComputeContext.h>
+#include <Methane/Instrumentation.h>
+
+#include <mutex>
 
 namespace Methane::Graphics::Base
 {
@@ -43,17 +46,22 @@ public:
     void WaitForGpu(WaitFor wait_for) override;
     [[nodiscard]] OptionMask GetOptions() const noexcept final { return m_settings.options; }
     bool UploadResources() const override;
+    void AddCommandListStatistics(const Rhi::CommandListStatistics& statistics) const override;
 
     // IComputeContext interface
     [[nodiscard]] const Settings& GetSettings() const noexcept override { return m_settings; }
+    [[nodiscard]] Rhi::CommandListStatistics GetComputeStatistics() const final;
 
 protected:
     Rhi::IFence& GetComputeFence() const;
 
 private:
-    void WaitForGpuComputeComplete() const;
+    void WaitForGpuComputeComplete();
 
-    Settings m_settings;
+    Settings                           m_settings;
+    mutable Rhi::CommandListStatistics m_encoding_statistics;
+    Rhi::CommandListStatistics         m_completed_statistics;
+    mutable TracyLockable(std::mutex,  m_statistics_mutex);
 };
 
 } // namespace Methane::Graphics::Base
@@ -27,6 +27,7 @@ Base implementation of the context interface.
 
 #include <Methane/Graphics/RHI/IFence.h>
 #include <Methane/Graphics/RHI/IContext.h>
+#include <Methane/Graphics/RHI/ICommandList.h>
 #include <Methane/Graphics/RHI/ICommandKit.h>
 #include <Methane/Data/Emitter.hpp>
 
@@ -81,12 +82,16 @@ public:
     Rhi::ICommandKit&           GetDefaultCommandKit(Rhi::CommandListType type) const final;
     Rhi::ICommandKit&           GetDefaultCommandKit(Rhi::ICommandQueue& cmd_queue) const final;
     const Rhi::IDevice&         GetDevice() const final;
+    Rhi::DescriptorStatistics   GetDescriptorStatistics() const final;
     bool                        UploadResources() const override;
 
     // Context interface
     virtual void Initialize(Device& device, bool is_callback_emitted = true);
     virtual void Release();
 
+    // Called on command list commit with statistics of its encoded commands, thread-safe
+    virtual void AddCommandListStatistics(const Rhi::CommandListStatistics& statistics) const;
+
     // IObject interface
     bool SetName(std::string_view name) override;
 
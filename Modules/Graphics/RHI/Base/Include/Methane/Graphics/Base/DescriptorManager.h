@@ -28,6 +28,7 @@ Base descriptor manager implementation.
 #include <Methane/Instrumentation.h>
 
 #include <mutex>
+#include <set>
 
 namespace Methane::Graphics::Rhi
 {
@@ -49,13 +50,18 @@ public:
 
     // IDescriptorManager interface
     void AddProgramBindings(Rhi::IProgramBindings& program_bindings) final;
+    void UpdateProgramBindings(Rhi::IProgramBindings& program_bindings) final;
     void CompleteInitialization() override;
     void Release() override;
+    Rhi::DescriptorStatistics GetStatistics() const override { return {}; }
 
 protected:
     Context&       GetContext()       { return m_context; }
     const Context& GetContext() const { return m_context; }
 
+    // Makes next CompleteInitialization process all program bindings, not only pending ones added or updated since last call
+    void RequestAllProgramBindingsInitialization();
+
     template<typename BindingsFuncType>
     void ForEachProgramBinding(const BindingsFuncType& bindings_functor)
     {
@@ -69,9 +75,17 @@ protected:
     }
 
 private:
+    using ProgramBindingsSet = std::set<WeakPtr<Rhi::IProgramBindings>, std::owner_less<WeakPtr<Rhi::IProgramBindings>>>;
+
+    void RemoveExpiredProgramBindings();
+    void CompleteProgramBindingsInitialization(const WeakPtrs<Rhi::IProgramBindings>& program_bindings) const;
+
     Context&                        m_context;
     const bool                      m_is_parallel_bindings_processing_enabled;
     WeakPtrs<Rhi::IProgramBindings> m_program_bindings;
+    ProgramBindingsSet              m_pending_program_bindings;
+    size_t                          m_compacted_program_bindings_count = 0U;
+    bool                            m_is_all_program_bindings_initialization_requested = false;
     TracyLockable(std::mutex,       m_program_bindings_mutex);
 };
 
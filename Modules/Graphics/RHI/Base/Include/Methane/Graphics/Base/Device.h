@@ -27,11 +27,15 @@ Base implementation of the device interface.
 
 #include <Methane/Graphics/RHI/IDevice.h>
 #include <Methane/Data/Emitter.hpp>
+#include <Methane/Instrumentation.h>
+
+#include <mutex>
 
 namespace Methane::Graphics::Base
 {
 
 class System;
+class ExecutionCompletionService;
 
 class Device
     : public Rhi::IDevice
@@ -40,18 +44,30 @@ class Device
 {
 public:
     Device(const std::string& adapter_name, bool is_software_adapter, const Capabilities& capabilities);
+    ~Device() override;
 
     // IDevice interface
     const std::string&  GetAdapterName() const noexcept override    { return m_adapter_name; }
     bool                IsSoftwareAdapter() const noexcept override { return m_is_software_adapter; }
     const Capabilities& GetCapabilities() const noexcept override   { return m_capabilities; }
+    MemoryStatistics    GetMemoryStatistics() const override        { return {}; }
     std::string         ToString() const override;
+    const std::string&  GetPipelineCachePath() const noexcept override { return m_pipeline_cache_path; }
+    void                SetPipelineCachePath(const std::string& pipeline_cache_path) override;
+    bool                FlushPipelineCache() override               { return false; }
+
+    // Execution completion service is shared by all command queues of the device and is created on first use
+    ExecutionCompletionService& GetExecutionCompletionService();
     
 protected:
     friend class System;
 
+    // Device interface
+    [[nodiscard]] virtual UniquePtr<ExecutionCompletionService> CreateExecutionCompletionService() const;
+
     void OnRemovalRequested();
     void OnRemoved();
+    void ReleaseExecutionCompletionService();
 
 private:
     // ISystem should be released only after all its devices, so devices hold it's shared pointer
@@ -59,6 +75,9 @@ private:
     const std::string m_adapter_name;
     const bool        m_is_software_adapter;
     Capabilities      m_capabilities;
+    std::string       m_pipeline_cache_path;
+    UniquePtr<ExecutionCompletionService> m_execution_completion_service_ptr;
+    TracyLockable(std::mutex,             m_execution_completion_service_mutex);
 };
 
 } // namespace Methane::Graphics::Base
@@ -0,0 +1,132 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/Base/ExecutionCompletionService.h
+Base implementation of the command list sets execution completion service,
+shared by all command queues of the device.
+
+******************************************************************************/
+
+#pragma once
+
+#include <Methane/Data/MpscQueue.hpp>
+#include <Methane/Memory.hpp>
+#include <Methane/Instrumentation.h>
+
+#include <deque>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+
+namespace Methane::Graphics::Base
+{
+
+class CommandListSet;
+
+struct IExecutionCompletionClient
+{
+    // Called from the completion service thread for every completed command list set in order of execution
+    virtual void OnCommandListSetExecutionCompleted(CommandListSet& command_list_set) = 0;
+
+    virtual ~IExecutionCompletionClient() = default;
+};
+
+class ExecutionCompletionService // NOSONAR - destructor is required
+{
+public:
+    ExecutionCompletionService() = default;
+    virtual ~ExecutionCompletionService();
+
+    ExecutionCompletionService(const ExecutionCompletionService&) = delete;
+    ExecutionCompletionService(ExecutionCompletionService&&) = delete;
+    ExecutionCompletionService& operator=(const ExecutionCompletionService&) = delete;
+    ExecutionCompletionService& operator=(ExecutionCompletionService&&) = delete;
+
+    // Lock-free submission of the executing command list set, which can be called from any thread
+    void AddExecutingCommandListSet(IExecutionCompletionClient& client, const Ptr<CommandListSet>& command_list_set_ptr);
+
+    // Blocks until completion service stops tracking command list sets of the client,
+    // but does not block when called from the completion callback on the service thread
+    void RemoveClient(IExecutionCompletionClient& client);
+
+protected:
+    // Blocks until execution of any command list set is completed or waiting is interrupted.
+    // Default implementation blocks in WaitUntilCompleted of every waited command list set on a separate waiter thread,
+    // so that command list sets of all clients are waited at once without native multi-wait support
+    virtual void WaitForAnyCompleted(const Ptrs<CommandListSet>& command_list_sets);
+    [[nodiscard]] virtual bool IsCompleted(const CommandListSet& command_list_set) const;
+
+    // Called before processing of new submissions, so that interrupt requested after that is not missed
+    virtual void ResetWaitingInterrupt();
+    virtual void InterruptWaiting();
+
+    // Shall be called from the destructor of derived class using native objects in waiting
+    void Shutdown();
+
+private:
+    struct Submission
+    {
+        IExecutionCompletionClient* client_ptr;
+        Ptr<CommandListSet>         command_list_set_ptr;
+    };
+
+    struct ClientExecution
+    {
+        IExecutionCompletionClient*     client_ptr;
+        std::deque<Ptr<CommandListSet>> command_list_sets;
+    };
+
+    void Run() noexcept;
+    void RunCompletionWaiter() noexcept;
+    void StopCompletionWaiters();
+    void Notify();
+    void ProcessSubmissions();
+    void ProcessRemovedClients();
+    void DispatchCompletedCommandListSets();
+    Ptrs<CommandListSet> GetWaitingCommandListSets() const;
+
+    Data::MpscQueue<Submission>               m_submissions;
+    std::vector<ClientExecution>              m_client_executions; // accessed only from the completion thread
+    std::vector<IExecutionCompletionClient*>  m_removed_clients;
+    TracyLockable(std::mutex,                 m_mutex);
+    std::condition_variable_any               m_idle_condition_var;
+    std::condition_variable_any               m_removed_condition_var;
+    std::atomic<bool>                         m_is_idle{ false };
+    std::atomic<bool>                         m_is_running{ true };
+    std::exception_ptr                        m_exception_ptr;
+    std::once_flag                            m_thread_start_flag;
+    std::thread                               m_thread;
+
+    // Completion waiter threads are started on demand by default implementation of WaitForAnyCompleted,
+    // one thread per command list set waited at the same time, which is one per client at most
+    TracyLockable(std::mutex,                 m_waiters_mutex);
+    std::condition_variable_any               m_waiter_request_condition_var;
+    std::condition_variable_any               m_waiter_completed_condition_var;
+    std::vector<std::thread>                  m_waiter_threads;
+    std::deque<Ptr<CommandListSet>>           m_waiter_requests;
+    Ptrs<CommandListSet>                      m_waited_command_list_sets; // requested or being waited by waiter threads
+    size_t                                    m_busy_waiters_count = 0U;
+    bool                                      m_is_waiting_interrupted = false;
+    bool                                      m_is_waiters_stopped = false;
+    std::exception_ptr                        m_waiter_exception_ptr;
+};
+
+} // namespace Methane::Graphics::Base
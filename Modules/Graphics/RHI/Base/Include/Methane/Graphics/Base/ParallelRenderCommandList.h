@@ -69,6 +69,7 @@ public:
     void PushDebugGroup(IDebugGroup&) override  { META_FUNCTION_NOT_IMPLEMENTED_DESCR("Can not use debug groups on parallel render command list."); }
     void PopDebugGroup() override               { META_FUNCTION_NOT_IMPLEMENTED_DESCR("Can not use debug groups on parallel render command list."); }
     void Commit() override;
+    Statistics GetStatistics() const noexcept override;
 
     // IObject interface
     bool SetName(std::string_view name) override;
@@ -82,6 +83,7 @@ protected:
 
     // ParallelRenderCommandListBase interface
     [[nodiscard]] virtual Ptr<Rhi::IRenderCommandList> CreateCommandList(bool is_beginning_list) = 0;
+    [[nodiscard]] virtual bool IsParallelResetSupported() const noexcept { return true; }
 
 private:
     template<typename ResetCommandListFn>
@@ -57,15 +57,18 @@ public:
     bool                     HasShader(Rhi::ShaderType shader_type) const       { return !!GetShader(shader_type); }
     Data::Size               GetBindingsCount() const noexcept final            { return m_bindings_count; }
 
-    const Context& GetContext() const { return m_context; }
+    const Context&   GetContext() const noexcept   { return m_context; }
+    const Arguments& GetArguments() const noexcept { return m_arguments; }
+    Data::Index      GetArgumentIndex(const Argument& argument) const;
 
 protected:
     using ArgumentBinding       = ProgramBindings::ArgumentBinding;
     using ArgumentBindings      = ProgramBindings::ArgumentBindings;
+    using ArgumentIndices       = std::unordered_map<IProgram::Argument, Data::Index, IProgram::Argument::Hash>;
     using FrameArgumentBindings = std::unordered_map<IProgram::Argument, Ptrs<ArgumentBinding>, IProgram::Argument::Hash>;
 
     void InitArgumentBindings(const ArgumentAccessors& argument_accessors);
-    const ArgumentBindings&         GetArgumentBindings() const noexcept      { return m_binding_by_argument; }
+    const ArgumentBindings&         GetArgumentBindings() const noexcept      { return m_argument_bindings; }
     const FrameArgumentBindings&    GetFrameArgumentBindings() const noexcept { return m_frame_bindings_by_argument; }
     const Ptr<ArgumentBinding>&     GetFrameArgumentBinding(Data::Index frame_index, const Rhi::ProgramArgumentAccessor& argument_accessor) const;
     Ptr<ArgumentBinding>            CreateArgumentBindingInstance(const Ptr<ArgumentBinding>& argument_binding_ptr, Data::Index frame_index) const;
@@ -83,7 +86,9 @@ private:
     const Settings         m_settings;
     const ShadersByType    m_shaders_by_type;
     const Rhi::ShaderTypes m_shader_types;
-    ArgumentBindings       m_binding_by_argument;
+    Arguments              m_arguments;
+    ArgumentBindings       m_argument_bindings;
+    ArgumentIndices        m_argument_index_by_argument;
     FrameArgumentBindings  m_frame_bindings_by_argument;
     Data::Size             m_bindings_count = 0u;
 };
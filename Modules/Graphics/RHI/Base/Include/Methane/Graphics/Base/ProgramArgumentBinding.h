@@ -53,6 +53,10 @@ public:
 
     Ptr<ProgramArgumentBinding> GetPtr() { return shared_from_this(); }
 
+    // Index of the argument in program, which is the same for all instances of argument binding
+    Data::Index GetArgumentIndex() const noexcept                     { return m_argument_index; }
+    void        SetArgumentIndex(Data::Index argument_index) noexcept { m_argument_index = argument_index; }
+
     bool IsAlreadyApplied(const Rhi::IProgram& program,
                           const ProgramBindings& applied_program_bindings,
                           bool check_binding_value_changes = true) const;
@@ -64,6 +68,7 @@ private:
     const Context&     m_context;
     const Settings     m_settings;
     Rhi::ResourceViews m_resource_views;
+    Data::Index        m_argument_index = 0U;
 };
 
 } // namespace Methane::Graphics::Base
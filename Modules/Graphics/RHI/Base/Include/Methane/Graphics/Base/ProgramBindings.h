@@ -32,6 +32,9 @@ Base implementation of the program bindings interface.
 
 #include <magic_enum.hpp>
 
+#include <vector>
+#include <utility>
+
 namespace Methane::Graphics::Base
 {
 
@@ -46,7 +49,7 @@ class ProgramBindings
 {
 public:
     using ArgumentBinding  = ProgramArgumentBinding;
-    using ArgumentBindings = std::unordered_map<Rhi::IProgram::Argument, Ptr<ArgumentBinding>, Rhi::IProgram::Argument::Hash>;
+    using ArgumentBindings = std::vector<std::pair<Rhi::IProgram::Argument, Ptr<ArgumentBinding>>>; // indexed by program argument index
 
     ProgramBindings(Program& program, Data::Index frame_index);
     ProgramBindings(Program& program, const ResourceViewsByArgument& resource_views_by_argument, Data::Index frame_index);
@@ -58,8 +61,9 @@ public:
     ProgramBindings& operator=(ProgramBindings&& other) = delete;
 
     // IProgramBindings interface
+    Ptr<Rhi::IProgramBindings>      CreateTransientCopy(const ResourceViewsByArgument& replace_resource_views_by_argument, const Opt<Data::Index>& frame_index) override;
     Rhi::IProgram&                  GetProgram() const final;
-    const Rhi::IProgram::Arguments& GetArguments() const noexcept final     { return m_arguments; }
+    const Rhi::IProgram::Arguments& GetArguments() const noexcept final;
     Data::Index                     GetFrameIndex() const noexcept final    { return m_frame_index; }
     Data::Index                     GetBindingsIndex() const noexcept final { return m_bindings_index; }
     IArgumentBinding&               Get(const Rhi::IProgram::Argument& shader_argument) const final;
@@ -70,6 +74,7 @@ public:
     virtual void Apply(CommandList& command_list, ApplyBehaviorMask apply_behavior = ApplyBehaviorMask(~0U)) const = 0;
 
     Rhi::IProgram::Arguments GetUnboundArguments() const;
+    const ArgumentBinding&   GetArgumentBinding(Data::Index argument_index) const;
 
     template<typename CommandListType>
     void ApplyResourceTransitionBarriers(CommandListType& command_list,
@@ -93,7 +98,7 @@ protected:
     ResourceViewsByArgument ReplaceResourceViews(const ArgumentBindings& argument_bindings,
                                                  const ResourceViewsByArgument& replace_resource_views) const;
     void VerifyAllArgumentsAreBoundToResources() const;
-    const ArgumentBindings& GetArgumentBindings() const { return m_binding_by_argument; }
+    const ArgumentBindings& GetArgumentBindings() const { return m_argument_bindings; }
     const Refs<Rhi::IResource>& GetResourceRefsByAccess(Rhi::ProgramArgumentAccessType access_type) const;
 
     void ClearTransitionResourceStates();
@@ -119,8 +124,7 @@ private:
 
     const Ptr<Rhi::IProgram>             m_program_ptr;
     Data::Index                          m_frame_index;
-    Rhi::IProgram::Arguments             m_arguments;
-    ArgumentBindings                     m_binding_by_argument;
+    ArgumentBindings                     m_argument_bindings;
     ResourceStatesByAccess               m_transition_resource_states_by_access;
     ResourceRefsByAccess                 m_resource_refs_by_access;
     mutable Ptr<Rhi::IResourceBarriers>  m_resource_state_transition_barriers_ptr;
@@ -65,7 +65,8 @@ struct RenderDrawingState
     Ptr<Buffer>               index_buffer_ptr;
     Opt<Rhi::RenderPrimitive> primitive_type_opt;
     ViewState*                view_state_ptr      = nullptr;
-    Rhi::RenderStateGroupMask render_state_groups;
+    Rhi::RenderStateGroupMask render_state_groups;          // groups of render state set up in command list
+    Rhi::RenderStateGroupMask deferred_render_state_groups; // groups of deferred render state pending to be applied on next draw
     ChangeMask                changes;
 };
 
@@ -99,6 +100,10 @@ public:
                      uint32_t instance_count, uint32_t start_instance) override;
     void Draw(Primitive primitive_type, uint32_t vertex_count, uint32_t start_vertex,
               uint32_t instance_count, uint32_t start_instance) override;
+    void DrawIndexedIndirect(Primitive primitive_type, Rhi::IBuffer& args_buffer, Data::Size args_offset, uint32_t draw_count,
+                             Rhi::IBuffer* count_buffer_ptr, Data::Size count_offset) override;
+    void DrawIndirect(Primitive primitive_type, Rhi::IBuffer& args_buffer, Data::Size args_offset, uint32_t draw_count,
+                      Rhi::IBuffer* count_buffer_ptr, Data::Size count_offset) override;
 
     RenderPass&         GetPass();
     RenderPass*         GetPassPtr() const noexcept      { return m_render_pass_ptr.get(); }
@@ -114,6 +119,8 @@ protected:
 
     inline void UpdateDrawingState(Primitive primitive_type);
     inline void ValidateDrawVertexBuffers(uint32_t draw_start_vertex, uint32_t draw_vertex_count = 0) const;
+    void ValidateDrawInputBuffers() const;
+    void TrackIndirectArgumentBuffers(Rhi::IBuffer& args_buffer, Rhi::IBuffer* count_buffer_ptr);
 
 private:
     const bool            m_is_parallel = false;
@@ -28,6 +28,9 @@ Base implementation of the render context interface.
 
 #include <Methane/Graphics/RHI/IRenderContext.h>
 #include <Methane/Data/FpsCounter.h>
+#include <Methane/Instrumentation.h>
+
+#include <mutex>
 
 namespace Methane::Graphics::Base
 {
@@ -51,6 +54,7 @@ public:
     uint32_t                 GetFrameBufferIndex() const noexcept final    { return m_frame_buffer_index;  }
     uint32_t                 GetFrameIndex() const noexcept final          { return m_frame_index; }
     const Data::IFpsCounter& GetFpsCounter() const noexcept final          { return m_fps_counter; }
+    Rhi::CommandListStatistics GetFrameStatistics() const final;
     bool                     SetVSyncEnabled(bool vsync_enabled) override;
     bool                     SetFrameBuffersCount(uint32_t frame_buffers_count) override;
     bool                     SetFullScreen(bool is_full_screen) override;
@@ -58,6 +62,10 @@ public:
 
     // Context interface
     void Initialize(Device& device, bool is_callback_emitted = true) override;
+    void AddCommandListStatistics(const Rhi::CommandListStatistics& statistics) const override;
+
+    // Reports CPU stall of the current frame encoding, thread-safe
+    void AddFrameHitchTime(double hitch_time_sec) const noexcept { m_fps_counter.AddFrameHitchTime(hitch_time_sec); }
 
 protected:
     void ResetWithSettings(const Settings& settings);
@@ -83,10 +91,16 @@ private:
     void WaitForGpuRenderComplete();
     void WaitForGpuFramePresented();
 
-    Settings         m_settings;
-    uint32_t         m_frame_buffer_index = 0U;
-    uint32_t         m_frame_index = 0U;
-    Data::FpsCounter m_fps_counter;
+    Settings                 m_settings;
+    uint32_t                 m_frame_buffer_index = 0U;
+    uint32_t                 m_frame_index = 0U;
+    mutable Data::FpsCounter m_fps_counter;
+
+    // Statistics of command lists committed in the current frame are accumulated separately
+    // from the statistics of the last presented frame, which is available for reading
+    mutable Rhi::CommandListStatistics m_encoding_frame_statistics;
+    Rhi::CommandListStatistics         m_presented_frame_statistics;
+    mutable TracyLockable(std::mutex,  m_frame_statistics_mutex);
 };
 
 } // namespace Methane::Graphics::Base
@@ -43,6 +43,7 @@ public:
     // IRenderState overrides
     const Settings& GetSettings() const noexcept override { return m_settings; }
     void Reset(const Settings& settings) override;
+    void PrewarmPipelines(const Refs<Rhi::IViewState>& view_states, const std::vector<Rhi::RenderPrimitive>& primitives) override;
 
     // RenderState interface
     virtual void Apply(RenderCommandList& command_list, Groups apply_groups) = 0;
@@ -45,6 +45,8 @@ public:
     [[nodiscard]] Data::Size         GetSubResourceDataSize(const SubResource::Index& subresource_index) const final;
     void SetData(Rhi::ICommandQueue&, const SubResources& sub_resources) override;
 
+    [[nodiscard]] Data::FrameSize GetMipLevelFrameSize(Data::Index mip_level) const;
+
     static Data::Size GetRequiredMipLevelsCount(const Dimensions& dimensions);
 
 protected:
@@ -0,0 +1,58 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/Base/TransferCommandList.h
+Base implementation of the transfer command list interface.
+
+******************************************************************************/
+
+#pragma once
+
+#include "CommandList.h"
+
+#include <Methane/Graphics/RHI/ITransferCommandList.h>
+
+namespace Methane::Graphics::Base
+{
+
+class Resource;
+class Texture;
+
+class TransferCommandList
+    : public Rhi::ITransferCommandList
+    , public CommandList
+{
+public:
+    explicit TransferCommandList(CommandQueue& command_queue);
+
+    // ITransferCommandList interface
+    void CopyBuffer(Rhi::IBuffer& src_buffer, Rhi::IBuffer& dst_buffer, const Rhi::BufferCopyRegion& copy_region) override;
+    void CopyBufferToTexture(Rhi::IBuffer& src_buffer, Data::Size src_offset, Rhi::ITexture& dst_texture, const Rhi::TextureCopyRegion& dst_region) override;
+    void CopyTextureToBuffer(Rhi::ITexture& src_texture, const Rhi::TextureCopyRegion& src_region, Rhi::IBuffer& dst_buffer, Data::Size dst_offset) override;
+    void CopyTexture(Rhi::ITexture& src_texture, const Rhi::TextureCopyRegion& src_region, Rhi::ITexture& dst_texture, const Rhi::TextureCopyRegion& dst_region) override;
+    void GenerateMipmaps(Rhi::ITexture& texture) override;
+
+    // Extends empty rectangle of copy region to the bottom-right corner of texture sub-resource
+    [[nodiscard]] static Rhi::TextureCopyRegion GetResolvedCopyRegion(const Texture& texture, const Rhi::TextureCopyRegion& copy_region);
+
+private:
+    void SetCopyResourceState(Resource& resource, Rhi::ResourceState copy_state);
+    Rhi::TextureCopyRegion ValidateTextureCopyRegion(const Texture& texture, const Rhi::TextureCopyRegion& copy_region) const;
+};
+
+} // namespace Methane::Graphics::Base
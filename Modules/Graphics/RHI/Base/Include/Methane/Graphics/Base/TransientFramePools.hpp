@@ -0,0 +1,128 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/Base/TransientFramePools.hpp
+Pools of native allocations made for frames in flight, which are reset wholesale
+on completion of the frame they were used in.
+
+******************************************************************************/
+
+#pragma once
+
+#include <Methane/Data/Types.h>
+#include <Methane/Instrumentation.h>
+#include <Methane/Checks.hpp>
+
+#include <deque>
+#include <vector>
+
+namespace Methane::Graphics::Base
+{
+
+// Frame index is a monotonic index of frames presented by the render context,
+// so pools of all frames up to the completed frame index are reset, when completion of a frame is signalled by its fence
+template<typename PoolType>
+class TransientFramePools
+{
+public:
+    // Allocation is done from the last pool of the frame, the new pool is acquired for the frame when allocation has failed;
+    // functor try_alloc_func(PoolType&) returns allocation convertible to false on failure, acquire_pool_func() returns PoolType
+    template<typename TryAllocFuncType, typename AcquirePoolFuncType>
+    [[nodiscard]] auto Allocate(Data::Index frame_index, const TryAllocFuncType& try_alloc_func, const AcquirePoolFuncType& acquire_pool_func)
+    {
+        META_FUNCTION_TASK();
+        if (m_frame_pools.empty() || m_frame_pools.back().frame_index != frame_index)
+        {
+            META_CHECK_ARG_DESCR(frame_index, m_frame_pools.empty() || m_frame_pools.back().frame_index < frame_index,
+                                 "transient allocations are expected in order of frames");
+            m_frame_pools.push_back(FramePools{ frame_index, {}, 0U });
+        }
+
+        FramePools& frame_pools = m_frame_pools.back();
+        using AllocationType = decltype(try_alloc_func(frame_pools.pools.back()));
+        AllocationType allocation = frame_pools.pools.empty() ? AllocationType() : try_alloc_func(frame_pools.pools.back());
+        if (!allocation)
+        {
+            frame_pools.pools.emplace_back(acquire_pool_func());
+            allocation = try_alloc_func(frame_pools.pools.back());
+            META_CHECK_ARG_TRUE_DESCR(static_cast<bool>(allocation), "failed to make transient allocation from the new pool");
+        }
+
+        frame_pools.allocations_count++;
+        m_allocations_count++;
+        return allocation;
+    }
+
+    // Functor reset_pool_func(PoolType&) resets pool and returns it for reuse
+    template<typename ResetPoolFuncType>
+    void CompleteFrames(Data::Index completed_frame_index, const ResetPoolFuncType& reset_pool_func)
+    {
+        META_FUNCTION_TASK();
+        while (!m_frame_pools.empty() && m_frame_pools.front().frame_index <= completed_frame_index)
+        {
+            FramePools& frame_pools = m_frame_pools.front();
+            for(PoolType& pool : frame_pools.pools)
+            {
+                reset_pool_func(pool);
+            }
+            m_allocations_count -= frame_pools.allocations_count;
+            m_frame_pools.pop_front();
+        }
+    }
+
+    // Pools of all frames are passed to functor release_pool_func(PoolType&) on release without resetting
+    template<typename ReleasePoolFuncType>
+    void Release(const ReleasePoolFuncType& release_pool_func)
+    {
+        META_FUNCTION_TASK();
+        for(FramePools& frame_pools : m_frame_pools)
+        {
+            for(PoolType& pool : frame_pools.pools)
+            {
+                release_pool_func(pool);
+            }
+        }
+        m_frame_pools.clear();
+        m_allocations_count = 0U;
+    }
+
+    [[nodiscard]] uint32_t GetFramesCount() const noexcept      { return static_cast<uint32_t>(m_frame_pools.size()); }
+    [[nodiscard]] uint32_t GetAllocationsCount() const noexcept { return m_allocations_count; }
+    [[nodiscard]] uint32_t GetPoolsCount() const noexcept
+    {
+        uint32_t pools_count = 0U;
+        for(const FramePools& frame_pools : m_frame_pools)
+        {
+            pools_count += static_cast<uint32_t>(frame_pools.pools.size());
+        }
+        return pools_count;
+    }
+
+private:
+    struct FramePools
+    {
+        Data::Index           frame_index;
+        std::vector<PoolType> pools;
+        uint32_t              allocations_count = 0U;
+    };
+
+    std::deque<FramePools> m_frame_pools; // ordered by frame index
+    uint32_t               m_allocations_count = 0U;
+};
+
+} // namespace Methane::Graphics::Base
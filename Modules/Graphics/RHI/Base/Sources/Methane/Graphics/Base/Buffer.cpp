@@ -27,6 +27,8 @@ Base implementation of the buffer interface.
 #include <Methane/Checks.hpp>
 #include <Methane/Instrumentation.h>
 
+#include <algorithm>
+
 namespace Methane::Graphics::Base
 {
 
@@ -57,10 +59,21 @@ void Buffer::SetData(Rhi::ICommandQueue&, const SubResource& sub_resource)
     META_CHECK_ARG_NAME_DESCR("sub_resource", !sub_resource.IsEmptyOrNull(), "can not set empty subresource data to buffer");
     META_CHECK_ARG_EQUAL(sub_resource.GetIndex(), SubResource::Index());
 
-    const Data::Size reserved_data_size = GetDataSize(Data::MemoryState::Reserved);
-    META_UNUSED(reserved_data_size);
-    META_CHECK_ARG_LESS_OR_EQUAL_DESCR(sub_resource.GetDataSize(), reserved_data_size, "can not set more data than allocated buffer size");
-    SetInitializedDataSize(sub_resource.GetDataSize());
+    if (!sub_resource.HasDataRange())
+    {
+        META_CHECK_ARG_LESS_OR_EQUAL_DESCR(sub_resource.GetDataSize(), GetDataSize(Data::MemoryState::Reserved),
+                                           "can not set more data than allocated buffer size");
+        SetInitializedDataSize(sub_resource.GetDataSize());
+        return;
+    }
+
+    // Sub-range write keeps the rest of buffer data initialized before
+    const BytesRange& data_range = sub_resource.GetDataRange();
+    META_CHECK_ARG_EQUAL_DESCR(sub_resource.GetDataSize(), data_range.GetLength(),
+                               "buffer subresource data size should be equal to the length of data range");
+    META_CHECK_ARG_LESS_OR_EQUAL_DESCR(data_range.GetEnd(), GetDataSize(Data::MemoryState::Reserved),
+                                       "buffer subresource data range is out of allocated buffer size");
+    SetInitializedDataSize(std::max(GetInitializedDataSize(), data_range.GetEnd()));
 }
 
 } // namespace Methane::Graphics::Base
\ No newline at end of file
@@ -24,14 +24,18 @@ Base implementation of the command list interface.
 #include <Methane/Graphics/Base/CommandList.h>
 #include <Methane/Graphics/Base/CommandListDebugGroup.h>
 #include <Methane/Graphics/Base/Device.h>
+#include <Methane/Graphics/Base/Context.h>
 #include <Methane/Graphics/Base/CommandQueue.h>
 #include <Methane/Graphics/Base/ProgramBindings.h>
 #include <Methane/Graphics/Base/Resource.h>
+#include <Methane/Graphics/RHI/IBuffer.h>
 
 #include <Methane/Instrumentation.h>
 #include <Methane/Checks.hpp>
 
 #include <magic_enum.hpp>
+#include <algorithm>
+#include <iterator>
 
 // Disable debug groups instrumentation with discontinuous CPU frames in Tracy,
 // because it is not working for parallel render command lists by some reason
@@ -103,6 +107,7 @@ void CommandList::Reset(IDebugGroup* debug_group_ptr)
              debug_group_ptr ? fmt::format("with debug group '{}'", debug_group_ptr->GetName()) : "");
 
     ResetCommandState();
+    m_statistics = {};
     SetCommandListStateNoLock(State::Encoding);
 
     const bool debug_group_changed = GetTopOpenDebugGroup() != debug_group_ptr;
@@ -135,7 +140,10 @@ void CommandList::SetProgramBindings(Rhi::IProgramBindings& program_bindings, Rh
 {
     META_FUNCTION_TASK();
     if (m_command_state.program_bindings_ptr == std::addressof(program_bindings))
+    {
+        m_statistics.skipped_state_changes_count++;
         return;
+    }
 
     META_LOG("{} Command list '{}' SET PROGRAM BINDINGS for program '{}':\n{}",
              magic_enum::enum_name(GetType()), GetName(), program_bindings.GetProgram().GetName(),
@@ -143,6 +151,7 @@ void CommandList::SetProgramBindings(Rhi::IProgramBindings& program_bindings, Rh
 
     auto& program_bindings_base = static_cast<ProgramBindings&>(program_bindings);
     ApplyProgramBindings(program_bindings_base, apply_behavior);
+    m_statistics.applied_bindings_count++;
 
     if (constexpr Rhi::ProgramBindingsApplyBehaviorMask constant_once_and_changes_only({
             Rhi::ProgramBindingsApplyBehavior::ConstantOnce,
@@ -155,7 +164,7 @@ void CommandList::SetProgramBindings(Rhi::IProgramBindings& program_bindings, Rh
 
     if (apply_behavior.HasAnyBit(Rhi::ProgramBindingsApplyBehavior::RetainResources))
     {
-        RetainResource(program_bindings_base.GetBasePtr());
+        TrackResource(program_bindings_base);
     }
 }
 
@@ -171,6 +180,8 @@ void CommandList::Commit()
     TRACY_GPU_SCOPE_END(m_tracy_gpu_scope);
     META_LOG("{} Command list '{}' COMMIT", magic_enum::enum_name(m_type), GetName());
 
+    RetainTrackedResources();
+    GetBaseCommandQueue().GetBaseContext().AddCommandListStatistics(m_statistics);
     SetCommandListStateNoLock(State::Committed);
     
     while (!m_open_debug_groups.empty())
@@ -241,6 +252,24 @@ void CommandList::CompleteInternal()
     META_LOG("{} Command list '{}' was COMPLETED with GPU timings {}", magic_enum::enum_name(m_type), GetName(), static_cast<std::string>(GetGpuTimeRange(true)));
 }
 
+void CommandList::RetainTrackedResources()
+{
+    META_FUNCTION_TASK();
+    Ptrs<Object>& tracked_resources = m_command_state.tracked_resources;
+    if (tracked_resources.empty())
+        return;
+
+    // Tracked resources are already retained, so only duplicates are removed before moving them to retained resources
+    std::sort(tracked_resources.begin(), tracked_resources.end(),
+              [](const Ptr<Object>& left_ptr, const Ptr<Object>& right_ptr) { return left_ptr.get() < right_ptr.get(); });
+    const auto tracked_resources_end_it = std::unique(tracked_resources.begin(), tracked_resources.end());
+
+    Ptrs<Object>& retained_resources = m_command_state.retained_resources;
+    retained_resources.reserve(retained_resources.size() + static_cast<size_t>(std::distance(tracked_resources.begin(), tracked_resources_end_it)));
+    std::move(tracked_resources.begin(), tracked_resources_end_it, std::back_inserter(retained_resources));
+    tracked_resources.clear();
+}
+
 CommandListDebugGroup* CommandList::GetTopOpenDebugGroup() const
 {
     META_FUNCTION_TASK();
@@ -291,6 +320,34 @@ void CommandList::VerifyEncodingState() const
                                magic_enum::enum_name(m_type), GetName(), magic_enum::enum_name(m_state));
 }
 
+void CommandList::ValidateIndirectArguments(const Rhi::IBuffer& args_buffer, Data::Size args_offset, Data::Size args_size, uint32_t args_count,
+                                            const Rhi::IBuffer* count_buffer_ptr, Data::Size count_offset) const
+{
+    META_FUNCTION_TASK();
+    // Indirect arguments and count are read by GPU as 4-byte words, so offsets in buffers must be aligned accordingly
+    constexpr Data::Size word_size = sizeof(uint32_t);
+    META_CHECK_ARG_NAME_DESCR("args_buffer", args_buffer.GetSettings().type == Rhi::BufferType::IndirectArgument,
+                              "indirect arguments can not be read from buffer of '{}' type where 'IndirectArgument' buffer is required",
+                              magic_enum::enum_name(args_buffer.GetSettings().type));
+    META_CHECK_ARG_NOT_ZERO_DESCR(args_count, "indirect commands count can not be zero");
+    META_CHECK_ARG_DESCR(args_offset, args_offset % word_size == 0U, "indirect arguments offset must be aligned to {} bytes", word_size);
+    META_CHECK_ARG_LESS_OR_EQUAL_DESCR(args_offset + args_size * args_count, args_buffer.GetSettings().size,
+                                       "{} indirect arguments from offset {} are out of buffer '{}' bounds",
+                                       args_count, args_offset, args_buffer.GetName());
+    if (!count_buffer_ptr)
+        return;
+
+    META_CHECK_ARG_TRUE_DESCR(GetBaseCommandQueue().GetBaseDevice().GetCapabilities().features.HasBit(Rhi::DeviceFeature::IndirectDrawCount),
+                              "indirect commands count buffer can not be used without 'IndirectDrawCount' device feature enabled");
+    META_CHECK_ARG_NAME_DESCR("count_buffer", count_buffer_ptr->GetSettings().type == Rhi::BufferType::IndirectArgument,
+                              "indirect commands count can not be read from buffer of '{}' type where 'IndirectArgument' buffer is required",
+                              magic_enum::enum_name(count_buffer_ptr->GetSettings().type));
+    META_CHECK_ARG_DESCR(count_offset, count_offset % word_size == 0U, "indirect commands count offset must be aligned to {} bytes", word_size);
+    META_CHECK_ARG_LESS_OR_EQUAL_DESCR(count_offset + word_size, count_buffer_ptr->GetSettings().size,
+                                       "indirect commands count at offset {} is out of buffer '{}' bounds",
+                                       count_offset, count_buffer_ptr->GetName());
+}
+
 void CommandList::InitializeTimestampQueries() // NOSONAR - function is not const when instrumentation enabled
 {
 #ifdef METHANE_GPU_INSTRUMENTATION_ENABLED
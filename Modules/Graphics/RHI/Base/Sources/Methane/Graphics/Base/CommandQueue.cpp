@@ -29,9 +29,30 @@ Base implementation of the command queue interface.
 
 #include <Methane/Instrumentation.h>
 
+#include <iterator>
+
 namespace Methane::Graphics::Base
 {
 
+static constexpr size_t g_execution_arena_block_size = 4096U;
+
+static thread_local FrameArena t_execution_arena(g_execution_arena_block_size);
+static thread_local uint32_t   t_execution_arena_scopes_count = 0U;
+
+CommandQueue::ExecutionArenaScope::ExecutionArenaScope()
+    : m_arena(t_execution_arena)
+{
+    t_execution_arena_scopes_count++;
+}
+
+CommandQueue::ExecutionArenaScope::~ExecutionArenaScope()
+{
+    if (!--t_execution_arena_scopes_count)
+    {
+        m_arena.Reset();
+    }
+}
+
 CommandQueue::CommandQueue(const Context& context, Rhi::CommandListType command_lists_type)
     : m_context(context)
     , m_device_ptr(context.GetBaseDevicePtr())
@@ -74,8 +95,88 @@ const Rhi::IContext& CommandQueue::GetContext() const noexcept
 void CommandQueue::Execute(Rhi::ICommandListSet& command_lists, const Rhi::ICommandList::CompletedCallback& completed_callback)
 {
     META_FUNCTION_TASK();
-    META_LOG("Command queue '{}' is executing", GetName());
-    static_cast<CommandListSet&>(command_lists).Execute(completed_callback);
+    CommandListSetExecution command_list_set_execution{ static_cast<CommandListSet&>(command_lists).GetBasePtr(), completed_callback };
+    if (m_is_deferred_execution)
+    {
+        META_LOG("Command queue '{}' is deferring execution of {}", GetName(), command_list_set_execution.command_list_set_ptr->GetCombinedName());
+        std::scoped_lock lock_guard(m_deferred_executions_mutex);
+        m_deferred_executions.emplace_back(std::move(command_list_set_execution));
+        return;
+    }
+
+    const ExecutionArenaScope arena_scope;
+    CommandListSetExecutions command_list_set_executions(arena_scope.GetAllocator<CommandListSetExecution>());
+    command_list_set_executions.emplace_back(std::move(command_list_set_execution));
+    ExecuteCommandListSets(command_list_set_executions);
+}
+
+void CommandQueue::ExecuteBatch(const Refs<Rhi::ICommandListSet>& command_list_sets, const Rhi::ICommandList::CompletedCallback& completed_callback)
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_NOT_EMPTY_DESCR(command_list_sets, "can not execute empty batch of command list sets");
+
+    const ExecutionArenaScope arena_scope;
+    CommandListSetExecutions command_list_set_executions(arena_scope.GetAllocator<CommandListSetExecution>());
+    command_list_set_executions.reserve(command_list_sets.size());
+    for(const Ref<Rhi::ICommandListSet>& command_list_set_ref : command_list_sets)
+    {
+        command_list_set_executions.push_back({ static_cast<CommandListSet&>(command_list_set_ref.get()).GetBasePtr(), completed_callback });
+    }
+
+    if (m_is_deferred_execution)
+    {
+        META_LOG("Command queue '{}' is deferring execution of {} command list sets batch", GetName(), command_list_sets.size());
+        std::scoped_lock lock_guard(m_deferred_executions_mutex);
+        m_deferred_executions.insert(m_deferred_executions.end(),
+                                     std::make_move_iterator(command_list_set_executions.begin()),
+                                     std::make_move_iterator(command_list_set_executions.end()));
+        return;
+    }
+
+    ExecuteCommandListSets(command_list_set_executions);
+}
+
+void CommandQueue::SetDeferredExecution(bool is_deferred_execution)
+{
+    META_FUNCTION_TASK();
+    if (m_is_deferred_execution == is_deferred_execution)
+        return;
+
+    META_LOG("Command queue '{}' deferred execution is {}", GetName(), is_deferred_execution ? "enabled" : "disabled");
+    m_is_deferred_execution = is_deferred_execution;
+    if (!is_deferred_execution)
+    {
+        ExecuteDeferred();
+    }
+}
+
+void CommandQueue::ExecuteDeferred()
+{
+    META_FUNCTION_TASK();
+    const ExecutionArenaScope arena_scope;
+    CommandListSetExecutions deferred_executions(arena_scope.GetAllocator<CommandListSetExecution>());
+    {
+        std::scoped_lock lock_guard(m_deferred_executions_mutex);
+        if (m_deferred_executions.empty())
+            return;
+
+        // Deferred executions are moved out to keep the capacity of deferred queue for the next frames
+        deferred_executions.assign(std::make_move_iterator(m_deferred_executions.begin()),
+                                   std::make_move_iterator(m_deferred_executions.end()));
+        m_deferred_executions.clear();
+    }
+
+    ExecuteCommandListSets(deferred_executions);
+}
+
+void CommandQueue::ExecuteCommandListSets(const CommandListSetExecutions& command_list_set_executions)
+{
+    META_FUNCTION_TASK();
+    for(const CommandListSetExecution& command_list_set_execution : command_list_set_executions)
+    {
+        META_LOG("Command queue '{}' is executing {}", GetName(), command_list_set_execution.command_list_set_ptr->GetCombinedName());
+        command_list_set_execution.command_list_set_ptr->Execute(command_list_set_execution.completed_callback);
+    }
 }
 
 Tracy::GpuContext& CommandQueue::GetTracyContext() const
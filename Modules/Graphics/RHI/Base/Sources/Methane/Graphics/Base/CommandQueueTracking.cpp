@@ -24,6 +24,7 @@ Base implementation of the command queue with execution tracking.
 #include <Methane/Graphics/Base/CommandQueueTracking.h>
 #include <Methane/Graphics/Base/CommandListSet.h>
 #include <Methane/Graphics/Base/Context.h>
+#include <Methane/Graphics/Base/Device.h>
 
 #include <Methane/Graphics/RHI/IQueryPool.h>
 #include <Methane/Graphics/RHI/ISystem.h>
@@ -54,7 +55,7 @@ static Tracy::GpuContext::Type ConvertSystemGraphicsApiToTracyGpuContextType(Rhi
 
 CommandQueueTracking::CommandQueueTracking(const Context& context, Rhi::CommandListType command_lists_type)
     : CommandQueue(context, command_lists_type)
-    , m_execution_waiting_thread(&CommandQueueTracking::WaitForExecution, this)
+    , m_execution_completion_service(GetBaseDevice().GetExecutionCompletionService())
 { }
 
 CommandQueueTracking::~CommandQueueTracking()
@@ -82,33 +83,28 @@ void CommandQueueTracking::InitializeTimestampQueryPool()
     );
 }
 
-void CommandQueueTracking::Execute(Rhi::ICommandListSet& command_lists, const Rhi::ICommandList::CompletedCallback& completed_callback)
+void CommandQueueTracking::ExecuteCommandListSets(const CommandListSetExecutions& command_list_set_executions)
 {
     META_FUNCTION_TASK();
-    CommandQueue::Execute(command_lists, completed_callback);
-
-    if (!m_execution_waiting)
-    {
-        m_execution_waiting_thread.join();
-        META_CHECK_ARG_NOT_NULL_DESCR(m_execution_waiting_exception_ptr, "Command queue '{}' execution waiting thread has unexpectedly finished", GetName());
-        if (m_execution_waiting_exception_ptr)
-            std::rethrow_exception(m_execution_waiting_exception_ptr);
-    }
-
-    auto& command_lists_base = static_cast<CommandListSet&>(command_lists);
-    std::scoped_lock lock_guard(m_executing_command_lists_mutex);
-    m_executing_command_lists.push(command_lists_base.GetBasePtr());
-    m_execution_waiting_condition_var.notify_one();
+    CommandQueue::ExecuteCommandListSets(command_list_set_executions);
+    TrackExecutingCommandListSets(command_list_set_executions);
 }
 
-bool CommandQueueTracking::SetName(std::string_view name)
+void CommandQueueTracking::TrackExecutingCommandListSets(const CommandListSetExecutions& command_list_set_executions)
 {
     META_FUNCTION_TASK();
-    if (!CommandQueue::SetName(name))
-        return false;
+    {
+        std::scoped_lock lock_guard(m_executing_command_lists_mutex);
+        for(const CommandListSetExecution& command_list_set_execution : command_list_set_executions)
+        {
+            m_executing_command_lists.push(command_list_set_execution.command_list_set_ptr);
+        }
+    }
 
-    m_name_changed = true;
-    return true;
+    for(const CommandListSetExecution& command_list_set_execution : command_list_set_executions)
+    {
+        m_execution_completion_service.AddExecutingCommandListSet(*this, command_list_set_execution.command_list_set_ptr);
+    }
 }
 
 void CommandQueueTracking::CompleteExecution(const Opt<Data::Index>& frame_index)
@@ -121,50 +117,6 @@ void CommandQueueTracking::CompleteExecution(const Opt<Data::Index>& frame_index
         m_executing_command_lists.front()->Complete();
         m_executing_command_lists.pop();
     }
-    m_execution_waiting_condition_var.notify_one();
-}
-
-void CommandQueueTracking::WaitForExecution() noexcept
-{
-    try
-    {
-        do
-        {
-            std::unique_lock lock(m_execution_waiting_mutex);
-            m_execution_waiting_condition_var.wait_for(lock, std::chrono::milliseconds(32),
-                [this] { return !m_execution_waiting || !m_executing_command_lists.empty(); }
-            );
-
-            if (m_name_changed)
-            {
-                const std::string thread_name = fmt::format("{} Wait for Execution", GetName());
-                META_THREAD_NAME(thread_name.c_str());
-                m_name_changed = false;
-            }
-
-            while (!m_executing_command_lists.empty())
-            {
-                Ptr<CommandListSet> command_list_set_ptr = GetNextExecutingCommandListSet();
-                if (!command_list_set_ptr)
-                    break;
-
-                command_list_set_ptr->WaitUntilCompleted();
-                CompleteCommandListSetExecution(*command_list_set_ptr);
-            }
-
-            if (m_timestamp_query_pool_ptr)
-            {
-                const Rhi::ITimestampQueryPool::CalibratedTimestamps calibrated_timestamps = m_timestamp_query_pool_ptr->Calibrate();
-                GetTracyContext().Calibrate(calibrated_timestamps.cpu_ts, calibrated_timestamps.gpu_ts);
-            }
-        }
-        while (m_execution_waiting);
-    }
-    catch (...)
-    {
-        m_execution_waiting_exception_ptr = std::current_exception();
-        m_execution_waiting = false;
-    }
 }
 
 Ptr<CommandListSet> CommandQueueTracking::GetLastExecutingCommandListSet() const
@@ -183,46 +135,43 @@ const Ptr<Rhi::ITimestampQueryPool>& CommandQueueTracking::GetTimestampQueryPool
     return m_timestamp_query_pool_ptr;
 }
 
-const Ptr<CommandListSet>& CommandQueueTracking::GetNextExecutingCommandListSet() const
+void CommandQueueTracking::CompleteCommandListSetExecution(CommandListSet& executing_command_list_set)
 {
     META_FUNCTION_TASK();
-    std::scoped_lock lock_guard(m_executing_command_lists_mutex);
-
-    static const Ptr<CommandListSet> s_empty_command_list_set_ptr;
-    if (m_executing_command_lists.empty())
-        return s_empty_command_list_set_ptr;
+    std::unique_lock lock_guard(m_executing_command_lists_mutex);
 
-    META_CHECK_ARG_NOT_NULL(m_executing_command_lists.front());
-    return m_executing_command_lists.front();
+    if (!m_executing_command_lists.empty() && m_executing_command_lists.front().get() == std::addressof(executing_command_list_set))
+    {
+        m_executing_command_lists.pop();
+    }
 }
 
-void CommandQueueTracking::CompleteCommandListSetExecution(CommandListSet& executing_command_list_set)
+void CommandQueueTracking::OnCommandListSetExecutionCompleted(CommandListSet& command_list_set)
 {
     META_FUNCTION_TASK();
-    std::unique_lock lock_guard(m_executing_command_lists_mutex);
+    CompleteCommandListSetExecution(command_list_set);
 
-    if (!m_executing_command_lists.empty() && m_executing_command_lists.front().get() == std::addressof(executing_command_list_set))
+    if (m_timestamp_query_pool_ptr)
     {
-        m_executing_command_lists.pop();
+        const Rhi::ITimestampQueryPool::CalibratedTimestamps calibrated_timestamps = m_timestamp_query_pool_ptr->Calibrate();
+        GetTracyContext().Calibrate(calibrated_timestamps.cpu_ts, calibrated_timestamps.gpu_ts);
     }
 }
 
 void CommandQueueTracking::ShutdownQueueExecution()
 {
     META_FUNCTION_TASK();
-    if (!m_execution_waiting)
+    if (!m_is_execution_tracked)
         return;
 
+    // Completion service does not access this queue after its removal
+    m_execution_completion_service.RemoveClient(*this);
     CompleteExecutionSafely();
-
-    m_execution_waiting_condition_var.notify_one();
-    m_execution_waiting_thread.join();
 }
 
 void CommandQueueTracking::CompleteExecutionSafely()
 {
     META_FUNCTION_TASK();
-    std::unique_lock lock(m_execution_waiting_mutex);
     m_timestamp_query_pool_ptr.reset();
 
     try
@@ -237,7 +186,7 @@ void CommandQueueTracking::CompleteExecutionSafely()
         assert(false);
     }
 
-    m_execution_waiting = false;
+    m_is_execution_tracked = false;
 }
 
 } // namespace Methane::Graphics::Base
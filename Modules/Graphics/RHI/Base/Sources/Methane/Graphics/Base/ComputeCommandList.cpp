@@ -25,6 +25,7 @@ Base implementation of the compute command list interface.
 #include <Methane/Graphics/Base/ComputeState.h>
 #include <Methane/Graphics/Base/CommandQueue.h>
 #include <Methane/Graphics/Base/Program.h>
+#include <Methane/Graphics/Base/Buffer.h>
 #include <Methane/Graphics/TypeFormatters.hpp>
 
 #include <Methane/Instrumentation.h>
@@ -61,17 +62,26 @@ void ComputeCommandList::SetComputeState(Rhi::IComputeState& compute_state)
 
     VerifyEncodingState();
 
-    const bool render_state_changed = m_compute_state_ptr.get() != std::addressof(compute_state);
+    if (m_compute_state_ptr.get() == std::addressof(compute_state))
+    {
+        META_LOG("{} Command list '{}' compute state '{}' is already set up", magic_enum::enum_name(GetType()), GetName(), compute_state.GetName());
+        GetStatisticsRef().skipped_state_changes_count++;
+        return;
+    }
+
     auto& compute_state_base = static_cast<ComputeState&>(compute_state);
     compute_state_base.Apply(*this);
 
-    Ptr<Object> compute_state_object_ptr = compute_state_base.GetBasePtr();
-    m_compute_state_ptr = std::static_pointer_cast<ComputeState>(compute_state_object_ptr);
+    m_compute_state_ptr = compute_state_base.GetPtr<ComputeState>();
+    TrackResource(compute_state_base);
+    GetStatisticsRef().applied_state_changes_count++;
+}
 
-    if (render_state_changed)
-    {
-        RetainResource(compute_state_object_ptr);
-    }
+void ComputeCommandList::ResetCommandState()
+{
+    META_FUNCTION_TASK();
+    CommandList::ResetCommandState();
+    m_compute_state_ptr.reset();
 }
 
 ComputeState& ComputeCommandList::GetComputeState()
@@ -86,6 +96,22 @@ void ComputeCommandList::Dispatch([[maybe_unused]] const Rhi::ThreadGroupsCount&
     META_FUNCTION_TASK();
     META_LOG("{} Command list '{}' DISPATCH {} thread groups count.",
              magic_enum::enum_name(GetType()), GetName(), thread_groups_count);
+    GetStatisticsRef().dispatches_count++;
+}
+
+void ComputeCommandList::DispatchIndirect(Rhi::IBuffer& args_buffer, Data::Size args_offset)
+{
+    META_FUNCTION_TASK();
+    META_LOG("{} Command list '{}' DISPATCH INDIRECT with arguments from buffer '{}' at offset {}.",
+             magic_enum::enum_name(GetType()), GetName(), args_buffer.GetName(), args_offset);
+
+    VerifyEncodingState();
+    ValidateIndirectArguments(args_buffer, args_offset, static_cast<Data::Size>(sizeof(Rhi::DispatchIndirectArguments)), 1U);
+    META_CHECK_ARG_NOT_NULL_DESCR(m_compute_state_ptr, "compute state must be set before indirect dispatch");
+
+    TrackResource(static_cast<Buffer&>(args_buffer));
+    GetStatisticsRef().dispatches_count++;
+    GetStatisticsRef().indirect_commands_count++;
 }
 
 } // namespace Methane::Graphics::Base
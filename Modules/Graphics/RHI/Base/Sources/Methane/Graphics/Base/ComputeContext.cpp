@@ -55,12 +55,30 @@ void ComputeContext::WaitForGpu(WaitFor wait_for)
     }
 }
 
-void ComputeContext::WaitForGpuComputeComplete() const
+void ComputeContext::WaitForGpuComputeComplete()
 {
     META_FUNCTION_TASK();
     META_SCOPE_TIMER("ComputeContextDX::WaitForGpu::ComputeComplete");
     GetComputeFence().FlushOnCpu();
     META_CPU_FRAME_DELIMITER(0, 0);
+
+    std::scoped_lock lock_guard(m_statistics_mutex);
+    m_completed_statistics = m_encoding_statistics;
+    m_encoding_statistics  = {};
+}
+
+void ComputeContext::AddCommandListStatistics(const Rhi::CommandListStatistics& statistics) const
+{
+    META_FUNCTION_TASK();
+    std::scoped_lock lock_guard(m_statistics_mutex);
+    m_encoding_statistics += statistics;
+}
+
+Rhi::CommandListStatistics ComputeContext::GetComputeStatistics() const
+{
+    META_FUNCTION_TASK();
+    std::scoped_lock lock_guard(m_statistics_mutex);
+    return m_completed_statistics;
 }
 
 Rhi::IFence& ComputeContext::GetComputeFence() const
@@ -140,6 +140,11 @@ void Context::OnGpuWaitComplete(WaitFor wait_for)
     }
 }
 
+void Context::AddCommandListStatistics(const Rhi::CommandListStatistics&) const
+{
+    // Intentionally unimplemented
+}
+
 void Context::Release()
 {
     META_FUNCTION_TASK();
@@ -204,6 +209,12 @@ const Rhi::IDevice& Context::GetDevice() const
     return *m_device_ptr;
 }
 
+Rhi::DescriptorStatistics Context::GetDescriptorStatistics() const
+{
+    META_FUNCTION_TASK();
+    return GetDescriptorManager().GetStatistics();
+}
+
 Device& Context::GetBaseDevice()
 {
     META_FUNCTION_TASK();
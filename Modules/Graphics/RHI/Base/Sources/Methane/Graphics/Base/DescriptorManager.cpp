@@ -29,9 +29,14 @@ Base descriptor manager implementation.
 
 #include <taskflow/algorithm/for_each.hpp>
 
+#include <algorithm>
+
 namespace Methane::Graphics::Base
 {
 
+static constexpr size_t g_min_parallel_program_bindings_count  = 256U;
+static constexpr size_t g_min_compacted_program_bindings_count = 1024U;
+
 DescriptorManager::DescriptorManager(Context& context, bool is_parallel_bindings_processing_enabled)
     : m_context(context)
     , m_is_parallel_bindings_processing_enabled(is_parallel_bindings_processing_enabled)
@@ -42,41 +47,29 @@ void DescriptorManager::CompleteInitialization()
     META_FUNCTION_TASK();
     std::scoped_lock lock_guard(m_program_bindings_mutex);
 
-    const auto program_bindings_end_it = std::remove_if(m_program_bindings.begin(), m_program_bindings.end(),
-        [](const WeakPtr<Rhi::IProgramBindings>& program_bindings_wptr)
-        { return program_bindings_wptr.expired(); }
-    );
-
-    m_program_bindings.erase(program_bindings_end_it, m_program_bindings.end());
-
-    constexpr auto binding_initialization_completer = [](const WeakPtr<Rhi::IProgramBindings>& program_bindings_wptr)
+    // Only program bindings added or updated since last call are processed, unless all program bindings were requested
+    if (m_is_all_program_bindings_initialization_requested)
     {
-        META_FUNCTION_TASK();
-        // Some binding pointers may become expired here due to command list retained resources cleanup on execution completion
-        Ptr<Rhi::IProgramBindings> program_bindings_ptr = program_bindings_wptr.lock();
-        if (!program_bindings_ptr)
-            return;
-
-        static_cast<ProgramBindings&>(*program_bindings_ptr).CompleteInitialization();
-    };
-
-    if (m_is_parallel_bindings_processing_enabled)
-    {
-        tf::Taskflow task_flow;
-        task_flow.for_each(m_program_bindings.begin(), m_program_bindings.end(), binding_initialization_completer);
-        m_context.GetParallelExecutor().run(task_flow).get();
+        RemoveExpiredProgramBindings();
+        CompleteProgramBindingsInitialization(m_program_bindings);
     }
-    else
+    else if (!m_pending_program_bindings.empty())
     {
-        for (const WeakPtr<Rhi::IProgramBindings>& program_bindings_wptr : m_program_bindings)
-            binding_initialization_completer(program_bindings_wptr);
+        CompleteProgramBindingsInitialization(WeakPtrs<Rhi::IProgramBindings>(m_pending_program_bindings.begin(), m_pending_program_bindings.end()));
     }
+
+    m_pending_program_bindings.clear();
+    m_is_all_program_bindings_initialization_requested = false;
 }
 
 void DescriptorManager::Release()
 {
     META_FUNCTION_TASK();
+    std::scoped_lock lock_guard(m_program_bindings_mutex);
     m_program_bindings.clear();
+    m_pending_program_bindings.clear();
+    m_compacted_program_bindings_count = 0U;
+    m_is_all_program_bindings_initialization_requested = false;
 }
 
 void DescriptorManager::AddProgramBindings(Rhi::IProgramBindings& program_bindings)
@@ -95,7 +88,76 @@ void DescriptorManager::AddProgramBindings(Rhi::IProgramBindings& program_bindin
         "program bindings instance was already added to resource manager");
 #endif
 
-    m_program_bindings.push_back(static_cast<ProgramBindings&>(program_bindings).GetPtr<ProgramBindings>());
+    // Expired program bindings are removed when their count has doubled since last removal,
+    // so that removal cost is amortized by the added program bindings
+    if (m_program_bindings.size() >= std::max(m_compacted_program_bindings_count * 2U, g_min_compacted_program_bindings_count))
+        RemoveExpiredProgramBindings();
+
+    const Ptr<ProgramBindings> program_bindings_ptr = static_cast<ProgramBindings&>(program_bindings).GetPtr<ProgramBindings>();
+    m_program_bindings.push_back(program_bindings_ptr);
+    m_pending_program_bindings.insert(program_bindings_ptr);
+}
+
+void DescriptorManager::UpdateProgramBindings(Rhi::IProgramBindings& program_bindings)
+{
+    META_FUNCTION_TASK();
+    std::scoped_lock lock_guard(m_program_bindings_mutex);
+    m_pending_program_bindings.insert(static_cast<ProgramBindings&>(program_bindings).GetPtr<ProgramBindings>());
+}
+
+void DescriptorManager::RequestAllProgramBindingsInitialization()
+{
+    META_FUNCTION_TASK();
+    std::scoped_lock lock_guard(m_program_bindings_mutex);
+    m_is_all_program_bindings_initialization_requested = true;
+}
+
+void DescriptorManager::RemoveExpiredProgramBindings()
+{
+    META_FUNCTION_TASK();
+    const auto program_bindings_end_it = std::remove_if(m_program_bindings.begin(), m_program_bindings.end(),
+        [](const WeakPtr<Rhi::IProgramBindings>& program_bindings_wptr)
+        { return program_bindings_wptr.expired(); }
+    );
+
+    m_program_bindings.erase(program_bindings_end_it, m_program_bindings.end());
+    m_compacted_program_bindings_count = m_program_bindings.size();
+
+    for(auto pending_program_bindings_it = m_pending_program_bindings.begin(); pending_program_bindings_it != m_pending_program_bindings.end();)
+    {
+        if (pending_program_bindings_it->expired())
+            pending_program_bindings_it = m_pending_program_bindings.erase(pending_program_bindings_it);
+        else
+            ++pending_program_bindings_it;
+    }
+}
+
+void DescriptorManager::CompleteProgramBindingsInitialization(const WeakPtrs<Rhi::IProgramBindings>& program_bindings) const
+{
+    META_FUNCTION_TASK();
+    constexpr auto binding_initialization_completer = [](const WeakPtr<Rhi::IProgramBindings>& program_bindings_wptr)
+    {
+        META_FUNCTION_TASK();
+        // Some binding pointers may become expired here due to command list retained resources cleanup on execution completion
+        Ptr<Rhi::IProgramBindings> program_bindings_ptr = program_bindings_wptr.lock();
+        if (!program_bindings_ptr)
+            return;
+
+        static_cast<ProgramBindings&>(*program_bindings_ptr).CompleteInitialization();
+    };
+
+    // Parallel processing pays off only for large batches of program bindings
+    if (m_is_parallel_bindings_processing_enabled && program_bindings.size() >= g_min_parallel_program_bindings_count)
+    {
+        tf::Taskflow task_flow;
+        task_flow.for_each(program_bindings.begin(), program_bindings.end(), binding_initialization_completer);
+        m_context.GetParallelExecutor().run(task_flow).get();
+    }
+    else
+    {
+        for (const WeakPtr<Rhi::IProgramBindings>& program_bindings_wptr : program_bindings)
+            binding_initialization_completer(program_bindings_wptr);
+    }
 }
 
 } // namespace Methane::Graphics::Base
@@ -23,6 +23,7 @@ Base implementation of the device interface.
 
 #include <Methane/Graphics/Base/Device.h>
 #include <Methane/Graphics/Base/System.h>
+#include <Methane/Graphics/Base/ExecutionCompletionService.h>
 
 #include <Methane/Instrumentation.h>
 #include <Methane/Checks.hpp>
@@ -39,12 +40,45 @@ Device::Device(const std::string& adapter_name, bool is_software_adapter, const
     , m_capabilities(capabilities)
 { }
 
+Device::~Device() = default;
+
 std::string Device::ToString() const
 {
     META_FUNCTION_TASK();
     return fmt::format("GPU \"{}\"", GetAdapterName());
 }
 
+void Device::SetPipelineCachePath(const std::string& pipeline_cache_path)
+{
+    META_FUNCTION_TASK();
+    m_pipeline_cache_path = pipeline_cache_path;
+}
+
+ExecutionCompletionService& Device::GetExecutionCompletionService()
+{
+    META_FUNCTION_TASK();
+    std::scoped_lock lock_guard(m_execution_completion_service_mutex);
+    if (!m_execution_completion_service_ptr)
+    {
+        m_execution_completion_service_ptr = CreateExecutionCompletionService();
+        META_CHECK_ARG_NOT_NULL(m_execution_completion_service_ptr);
+    }
+    return *m_execution_completion_service_ptr;
+}
+
+UniquePtr<ExecutionCompletionService> Device::CreateExecutionCompletionService() const
+{
+    META_FUNCTION_TASK();
+    return std::make_unique<ExecutionCompletionService>();
+}
+
+void Device::ReleaseExecutionCompletionService()
+{
+    META_FUNCTION_TASK();
+    std::scoped_lock lock_guard(m_execution_completion_service_mutex);
+    m_execution_completion_service_ptr.reset();
+}
+
 void Device::OnRemovalRequested()
 {
     META_FUNCTION_TASK();
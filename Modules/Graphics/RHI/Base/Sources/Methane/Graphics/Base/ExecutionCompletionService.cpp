@@ -0,0 +1,346 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/Base/ExecutionCompletionService.cpp
+Base implementation of the command list sets execution completion service,
+shared by all command queues of the device.
+
+******************************************************************************/
+
+#include <Methane/Graphics/Base/ExecutionCompletionService.h>
+#include <Methane/Graphics/Base/CommandListSet.h>
+
+#include <Methane/Instrumentation.h>
+#include <Methane/Checks.hpp>
+
+#include <algorithm>
+
+namespace Methane::Graphics::Base
+{
+
+ExecutionCompletionService::~ExecutionCompletionService()
+{
+    META_FUNCTION_TASK();
+    Shutdown();
+}
+
+void ExecutionCompletionService::AddExecutingCommandListSet(IExecutionCompletionClient& client, const Ptr<CommandListSet>& command_list_set_ptr)
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_NOT_NULL(command_list_set_ptr);
+    if (!m_is_running)
+    {
+        META_CHECK_ARG_NOT_NULL_DESCR(m_exception_ptr, "command list sets execution completion thread has unexpectedly finished");
+        std::rethrow_exception(m_exception_ptr);
+    }
+
+    std::call_once(m_thread_start_flag, [this]
+    {
+        std::scoped_lock lock_guard(m_mutex);
+        m_thread = std::thread(&ExecutionCompletionService::Run, this);
+    });
+
+    m_submissions.Push(Submission{ &client, command_list_set_ptr });
+    Notify();
+}
+
+void ExecutionCompletionService::RemoveClient(IExecutionCompletionClient& client)
+{
+    META_FUNCTION_TASK();
+    std::unique_lock lock(m_mutex);
+    if (!m_is_running || !m_thread.joinable())
+        return;
+
+    m_removed_clients.push_back(&client);
+    if (std::this_thread::get_id() == m_thread.get_id())
+    {
+        // Completion thread can not wait for itself, so the client removed from its completion callback
+        // is detached immediately and its command list sets are erased on the next iteration
+        for(ClientExecution& client_execution : m_client_executions)
+        {
+            if (client_execution.client_ptr == &client)
+                client_execution.client_ptr = nullptr;
+        }
+        return;
+    }
+
+    m_idle_condition_var.notify_one();
+    InterruptWaiting();
+
+    m_removed_condition_var.wait(lock, [this, &client]
+    {
+        return !m_is_running || std::find(m_removed_clients.begin(), m_removed_clients.end(), &client) == m_removed_clients.end();
+    });
+}
+
+void ExecutionCompletionService::WaitForAnyCompleted(const Ptrs<CommandListSet>& command_list_sets)
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_NOT_EMPTY(command_list_sets);
+    std::unique_lock lock(m_waiters_mutex);
+
+    // Command list sets which are not waited yet are requested to be waited by the idle or new waiter threads
+    for(const Ptr<CommandListSet>& command_list_set_ptr : command_list_sets)
+    {
+        if (IsCompleted(*command_list_set_ptr) ||
+            std::find(m_waited_command_list_sets.begin(), m_waited_command_list_sets.end(), command_list_set_ptr) != m_waited_command_list_sets.end())
+            continue;
+
+        m_waited_command_list_sets.push_back(command_list_set_ptr);
+        m_waiter_requests.push_back(command_list_set_ptr);
+        if (m_waiter_threads.size() < m_busy_waiters_count + m_waiter_requests.size())
+            m_waiter_threads.emplace_back(&ExecutionCompletionService::RunCompletionWaiter, this);
+    }
+    m_waiter_request_condition_var.notify_all();
+
+    m_waiter_completed_condition_var.wait(lock, [this, &command_list_sets]
+    {
+        return m_is_waiting_interrupted || m_waiter_exception_ptr ||
+               std::any_of(command_list_sets.begin(), command_list_sets.end(),
+                           [this](const Ptr<CommandListSet>& command_list_set_ptr) { return IsCompleted(*command_list_set_ptr); });
+    });
+
+    if (m_waiter_exception_ptr)
+        std::rethrow_exception(m_waiter_exception_ptr);
+}
+
+bool ExecutionCompletionService::IsCompleted(const CommandListSet& command_list_set) const
+{
+    META_FUNCTION_TASK();
+    return !command_list_set.IsExecuting();
+}
+
+void ExecutionCompletionService::ResetWaitingInterrupt()
+{
+    META_FUNCTION_TASK();
+    std::scoped_lock lock_guard(m_waiters_mutex);
+    m_is_waiting_interrupted = false;
+}
+
+void ExecutionCompletionService::InterruptWaiting()
+{
+    META_FUNCTION_TASK();
+    std::scoped_lock lock_guard(m_waiters_mutex);
+    m_is_waiting_interrupted = true;
+    m_waiter_completed_condition_var.notify_all();
+}
+
+void ExecutionCompletionService::Shutdown()
+{
+    META_FUNCTION_TASK();
+    {
+        std::scoped_lock lock_guard(m_mutex);
+        m_is_running = false;
+        m_idle_condition_var.notify_one();
+    }
+
+    InterruptWaiting();
+
+    if (m_thread.joinable())
+        m_thread.join();
+
+    StopCompletionWaiters();
+}
+
+void ExecutionCompletionService::Run() noexcept
+{
+    META_THREAD_NAME("Command Lists Execution Completion");
+    try
+    {
+        while (m_is_running)
+        {
+            ResetWaitingInterrupt();
+            ProcessSubmissions();
+            ProcessRemovedClients();
+
+            if (const Ptrs<CommandListSet> waiting_command_list_sets = GetWaitingCommandListSets();
+                !waiting_command_list_sets.empty())
+            {
+                WaitForAnyCompleted(waiting_command_list_sets);
+                DispatchCompletedCommandListSets();
+                continue;
+            }
+
+            // Sleep without timeout until new command list sets are submitted, the service is notified
+            // about idle state with sequentially consistent fences to exclude missed notifications
+            std::unique_lock lock(m_mutex);
+            m_is_idle.store(true, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            m_idle_condition_var.wait(lock, [this]
+            {
+                return !m_is_running || !m_submissions.IsEmpty() || !m_removed_clients.empty();
+            });
+            m_is_idle.store(false, std::memory_order_relaxed);
+        }
+    }
+    catch (...)
+    {
+        m_exception_ptr = std::current_exception();
+    }
+
+    std::scoped_lock lock_guard(m_mutex);
+    m_is_running = false;
+    m_removed_condition_var.notify_all();
+}
+
+void ExecutionCompletionService::RunCompletionWaiter() noexcept
+{
+    META_THREAD_NAME("Command List Set Completion Waiter");
+    std::unique_lock lock(m_waiters_mutex);
+    while (true)
+    {
+        m_waiter_request_condition_var.wait(lock, [this]
+        {
+            return m_is_waiters_stopped || !m_waiter_requests.empty();
+        });
+        if (m_is_waiters_stopped)
+            return;
+
+        Ptr<CommandListSet> command_list_set_ptr = std::move(m_waiter_requests.front());
+        m_waiter_requests.pop_front();
+        m_busy_waiters_count++;
+        lock.unlock();
+
+        std::exception_ptr exception_ptr;
+        try
+        {
+            command_list_set_ptr->WaitUntilCompleted();
+        }
+        catch (...)
+        {
+            exception_ptr = std::current_exception();
+        }
+
+        lock.lock();
+        m_busy_waiters_count--;
+        m_waited_command_list_sets.erase(std::find(m_waited_command_list_sets.begin(), m_waited_command_list_sets.end(), command_list_set_ptr));
+        if (exception_ptr && !m_waiter_exception_ptr)
+            m_waiter_exception_ptr = exception_ptr;
+        m_waiter_completed_condition_var.notify_all();
+    }
+}
+
+void ExecutionCompletionService::StopCompletionWaiters()
+{
+    META_FUNCTION_TASK();
+    {
+        std::scoped_lock lock_guard(m_waiters_mutex);
+        m_is_waiters_stopped = true;
+        m_waiter_request_condition_var.notify_all();
+    }
+
+    // Waiter threads blocked in command list set waiting are joined after execution completion on GPU
+    for(std::thread& waiter_thread : m_waiter_threads)
+    {
+        if (waiter_thread.joinable())
+            waiter_thread.join();
+    }
+    m_waiter_threads.clear();
+    m_waiter_requests.clear();
+    m_waited_command_list_sets.clear();
+}
+
+void ExecutionCompletionService::Notify()
+{
+    META_FUNCTION_TASK();
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (m_is_idle.load(std::memory_order_relaxed))
+    {
+        std::scoped_lock lock_guard(m_mutex);
+        m_idle_condition_var.notify_one();
+    }
+    else
+    {
+        InterruptWaiting();
+    }
+}
+
+void ExecutionCompletionService::ProcessSubmissions()
+{
+    META_FUNCTION_TASK();
+    while (std::optional<Submission> submission_opt = m_submissions.TryPop())
+    {
+        auto client_execution_it = std::find_if(m_client_executions.begin(), m_client_executions.end(),
+            [client_ptr = submission_opt->client_ptr](const ClientExecution& client_execution)
+            { return client_execution.client_ptr == client_ptr; });
+
+        if (client_execution_it == m_client_executions.end())
+            client_execution_it = m_client_executions.insert(m_client_executions.end(), ClientExecution{ submission_opt->client_ptr, {} });
+
+        client_execution_it->command_list_sets.emplace_back(std::move(submission_opt->command_list_set_ptr));
+    }
+}
+
+void ExecutionCompletionService::ProcessRemovedClients()
+{
+    META_FUNCTION_TASK();
+    std::scoped_lock lock_guard(m_mutex);
+    if (m_removed_clients.empty())
+        return;
+
+    // Command list sets of the removed clients are completed by the clients themselves
+    m_client_executions.erase(
+        std::remove_if(m_client_executions.begin(), m_client_executions.end(),
+            [this](const ClientExecution& client_execution)
+            {
+                return !client_execution.client_ptr ||
+                       std::find(m_removed_clients.begin(), m_removed_clients.end(), client_execution.client_ptr) != m_removed_clients.end();
+            }),
+        m_client_executions.end());
+
+    m_removed_clients.clear();
+    m_removed_condition_var.notify_all();
+}
+
+void ExecutionCompletionService::DispatchCompletedCommandListSets()
+{
+    META_FUNCTION_TASK();
+    for(ClientExecution& client_execution : m_client_executions)
+    {
+        // Command list sets of one client are completed in order of execution, until client is removed from callback
+        while (client_execution.client_ptr && !client_execution.command_list_sets.empty())
+        {
+            CommandListSet& command_list_set = *client_execution.command_list_sets.front();
+            if (command_list_set.IsExecuting())
+            {
+                if (!IsCompleted(command_list_set))
+                    break;
+
+                // Completes command lists without blocking, since execution is already finished
+                command_list_set.WaitUntilCompleted();
+            }
+
+            client_execution.client_ptr->OnCommandListSetExecutionCompleted(command_list_set);
+            client_execution.command_list_sets.pop_front();
+        }
+    }
+}
+
+Ptrs<CommandListSet> ExecutionCompletionService::GetWaitingCommandListSets() const
+{
+    META_FUNCTION_TASK();
+    Ptrs<CommandListSet> waiting_command_list_sets;
+    for(const ClientExecution& client_execution : m_client_executions)
+    {
+        if (!client_execution.command_list_sets.empty())
+            waiting_command_list_sets.push_back(client_execution.command_list_sets.front());
+    }
+    return waiting_command_list_sets;
+}
+
+} // namespace Methane::Graphics::Base
@@ -39,6 +39,8 @@ void Fence::Signal()
     META_FUNCTION_TASK();
     META_LOG("Fence '{}' SIGNAL from GPU with value {}", GetName(), m_value + 1);
 
+    // Deferred command lists are submitted to the queue before the fence signal to keep execution order
+    m_command_queue.ExecuteDeferred();
     m_value++;
 }
 
@@ -96,15 +96,17 @@ void ParallelRenderCommandList::ResetImpl(IDebugGroup* debug_group_ptr, const Re
         }
     }
 
-    // Per-thread render command lists can be reset in parallel only with DirectX 12 on Windows
-#ifdef _WIN32
-    tf::Taskflow reset_task_flow;
-    reset_task_flow.for_each_index(0U, static_cast<uint32_t>(m_parallel_command_lists.size()), 1U, reset_command_list_fn);
-    GetCommandQueue().GetContext().GetParallelExecutor().run(reset_task_flow).get();
-#else
+    // Per-thread render command lists are reset in parallel, unless native backend requires them to be reset in order
+    if (IsParallelResetSupported() && m_parallel_command_lists.size() > 1U)
+    {
+        tf::Taskflow reset_task_flow;
+        reset_task_flow.for_each_index(0U, static_cast<uint32_t>(m_parallel_command_lists.size()), 1U, reset_command_list_fn);
+        GetCommandQueue().GetContext().GetParallelExecutor().run(reset_task_flow).get();
+        return;
+    }
+
     for(Data::Index command_list_index = 0U; command_list_index < static_cast<Data::Index>(m_parallel_command_lists.size()); ++command_list_index)
         reset_command_list_fn(command_list_index);
-#endif
 }
 
 void ParallelRenderCommandList::Commit()
@@ -122,6 +124,18 @@ void ParallelRenderCommandList::Commit()
     CommandList::Commit();
 }
 
+ParallelRenderCommandList::Statistics ParallelRenderCommandList::GetStatistics() const noexcept
+{
+    META_FUNCTION_TASK();
+    Statistics statistics = CommandList::GetStatistics();
+    for(const Ptr<RenderCommandList>& render_command_list_ptr : m_parallel_command_lists)
+    {
+        if (render_command_list_ptr)
+            statistics += render_command_list_ptr->GetStatistics();
+    }
+    return statistics;
+}
+
 void ParallelRenderCommandList::SetViewState(Rhi::IViewState& view_state)
 {
     META_FUNCTION_TASK();
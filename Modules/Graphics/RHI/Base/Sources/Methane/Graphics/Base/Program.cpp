@@ -73,8 +73,8 @@ void Program::InitArgumentBindings(const ArgumentAccessors& argument_accessors)
     META_FUNCTION_TASK();
     Rhi::ShaderTypes all_shader_types;
     std::map<std::string_view, Rhi::ShaderTypes, std::less<>> shader_types_by_argument_name_map;
-    
-    m_binding_by_argument.clear();
+    std::unordered_map<Argument, Ptr<ArgumentBinding>, Argument::Hash> binding_by_argument;
+
     for (const Ptr<Rhi::IShader>& shader_ptr : m_settings.shaders)
     {
         META_CHECK_ARG_NOT_NULL_DESCR(shader_ptr, "empty shader pointer in program is not allowed");
@@ -86,7 +86,7 @@ void Program::InitArgumentBindings(const ArgumentAccessors& argument_accessors)
         {
             META_CHECK_ARG_NOT_NULL_DESCR(argument_binging_ptr, "empty resource binding provided by shader");
             const Argument& shader_argument = argument_binging_ptr->GetSettings().argument;
-            if (const auto [it, added] = m_binding_by_argument.try_emplace(shader_argument, argument_binging_ptr);
+            if (const auto [it, added] = binding_by_argument.try_emplace(shader_argument, argument_binging_ptr);
                 !added)
             {
                 it->second->MergeSettings(*argument_binging_ptr);
@@ -107,8 +107,8 @@ void Program::InitArgumentBindings(const ArgumentAccessors& argument_accessors)
             for (Rhi::ShaderType shader_type: all_shader_types)
             {
                 const Argument argument{ shader_type, argument_name };
-                auto binding_by_argument_it = m_binding_by_argument.find(argument);
-                META_CHECK_ARG_DESCR(argument, binding_by_argument_it != m_binding_by_argument.end(), "Resource binding was not initialized for for argument");
+                auto binding_by_argument_it = binding_by_argument.find(argument);
+                META_CHECK_ARG_DESCR(argument, binding_by_argument_it != binding_by_argument.end(), "Resource binding was not initialized for for argument");
                 if (argument_binding_ptr)
                 {
                     argument_binding_ptr->MergeSettings(*binding_by_argument_it->second);
@@ -117,14 +117,28 @@ void Program::InitArgumentBindings(const ArgumentAccessors& argument_accessors)
                 {
                     argument_binding_ptr = binding_by_argument_it->second;
                 }
-                m_binding_by_argument.erase(binding_by_argument_it);
+                binding_by_argument.erase(binding_by_argument_it);
             }
 
             META_CHECK_ARG_NOT_NULL_DESCR(argument_binding_ptr, "failed to create resource binding for argument '{}'", argument_name);
-            m_binding_by_argument.try_emplace(Argument{ Rhi::ShaderType::All, argument_name }, argument_binding_ptr);
+            binding_by_argument.try_emplace(Argument{ Rhi::ShaderType::All, argument_name }, argument_binding_ptr);
         }
     }
 
+    // Program arguments are indexed, so that argument bindings of every program bindings instance are stored in array by argument index
+    m_arguments.clear();
+    m_argument_bindings.clear();
+    m_argument_index_by_argument.clear();
+    m_argument_bindings.reserve(binding_by_argument.size());
+    for (const auto& [program_argument, argument_binding_ptr] : binding_by_argument)
+    {
+        const auto argument_index = static_cast<Data::Index>(m_argument_bindings.size());
+        argument_binding_ptr->SetArgumentIndex(argument_index);
+        m_arguments.insert(program_argument);
+        m_argument_index_by_argument.try_emplace(program_argument, argument_index);
+        m_argument_bindings.emplace_back(program_argument, argument_binding_ptr);
+    }
+
     if (m_context.GetType() != Rhi::IContext::Type::Render)
         return;
 
@@ -134,7 +148,7 @@ void Program::InitArgumentBindings(const ArgumentAccessors& argument_accessors)
     const uint32_t frame_buffers_count = render_context.GetSettings().frame_buffers_count;
     META_CHECK_ARG_GREATER_OR_EQUAL(frame_buffers_count, 2);
 
-    for (const auto& [program_argument, argument_binding_ptr] : m_binding_by_argument)
+    for (const auto& [program_argument, argument_binding_ptr] : m_argument_bindings)
     {
         if (!argument_binding_ptr->GetSettings().argument.IsFrameConstant())
             continue;
@@ -149,6 +163,16 @@ void Program::InitArgumentBindings(const ArgumentAccessors& argument_accessors)
     }
 }
 
+Data::Index Program::GetArgumentIndex(const Argument& argument) const
+{
+    META_FUNCTION_TASK();
+    const auto argument_index_it = m_argument_index_by_argument.find(argument);
+    if (argument_index_it == m_argument_index_by_argument.end())
+        throw Argument::NotFoundException(*this, argument);
+
+    return argument_index_it->second;
+}
+
 const Ptr<ProgramBindings::ArgumentBinding>& Program::GetFrameArgumentBinding(Data::Index frame_index, const Rhi::ProgramArgumentAccessor& argument_accessor) const
 {
     META_FUNCTION_TASK();
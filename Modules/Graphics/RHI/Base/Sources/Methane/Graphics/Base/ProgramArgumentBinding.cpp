@@ -139,7 +139,7 @@ bool ProgramArgumentBinding::IsAlreadyApplied(const Rhi::IProgram& program,
 
     // 2) No need in setting resource binding to the same location
     //    as a previous resource binding set in the same command list for the same program
-    if (const Rhi::IProgramBindings::IArgumentBinding& previous_argument_argument_binding = applied_program_bindings.Get(m_settings.argument);
+    if (const ProgramArgumentBinding& previous_argument_argument_binding = applied_program_bindings.GetArgumentBinding(m_argument_index);
         previous_argument_argument_binding.GetResourceViews() == m_resource_views)
         return true;
 
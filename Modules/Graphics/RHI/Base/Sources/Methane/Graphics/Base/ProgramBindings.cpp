@@ -23,6 +23,7 @@ Base implementation of the program bindings interface.
 
 #include <Methane/Graphics/Base/ProgramBindings.h>
 #include <Methane/Graphics/Base/Program.h>
+#include <Methane/Graphics/Base/Context.h>
 #include <Methane/Graphics/Base/Resource.h>
 #include <Methane/Graphics/Base/CommandList.h>
 
@@ -116,6 +117,13 @@ ProgramBindings::ProgramBindings(const ProgramBindings& other_program_bindings,
     InitializeArgumentBindings(&other_program_bindings);
 }
 
+Ptr<Rhi::IProgramBindings> ProgramBindings::CreateTransientCopy(const ResourceViewsByArgument& replace_resource_views_by_argument, const Opt<Data::Index>& frame_index)
+{
+    META_FUNCTION_TASK();
+    // Graphics backends without per-frame descriptor pools create regular copy of program bindings
+    return CreateCopy(replace_resource_views_by_argument, frame_index);
+}
+
 Rhi::IProgram& ProgramBindings::GetProgram() const
 {
     META_FUNCTION_TASK();
@@ -128,6 +136,13 @@ void ProgramBindings::OnProgramArgumentBindingResourceViewsChanged(const IArgume
                                                                        const Rhi::IResource::Views& new_resource_views)
 {
     META_FUNCTION_TASK();
+    // Program bindings constructed with resource views are added to descriptor manager on initialization,
+    // so only bindings changed later are scheduled for initialization completion again
+    if (!weak_from_this().expired())
+    {
+        static_cast<Program&>(*m_program_ptr).GetContext().GetDescriptorManager().UpdateProgramBindings(*this);
+    }
+
     if (!m_resource_state_transition_barriers_ptr)
         return;
 
@@ -168,18 +183,17 @@ void ProgramBindings::InitializeArgumentBindings(const ProgramBindings* other_pr
     const ArgumentBindings& argument_bindings = other_program_bindings_ptr
                                               ? other_program_bindings_ptr->GetArgumentBindings()
                                               : program.GetArgumentBindings();
+    // Argument bindings are stored in the same order as in program, so that they can be accessed by program argument index
+    m_argument_bindings.clear();
+    m_argument_bindings.reserve(argument_bindings.size());
     for (const auto& [program_argument, argument_binding_ptr] : argument_bindings)
     {
         META_CHECK_ARG_NOT_NULL_DESCR(argument_binding_ptr, "no resource binding is set for program argument '{}'", program_argument.GetName());
-        m_arguments.insert(program_argument);
-        if (m_binding_by_argument.count(program_argument))
-            continue;
-
         Ptr<ProgramBindings::ArgumentBinding> argument_binding_instance_ptr = program.CreateArgumentBindingInstance(argument_binding_ptr, m_frame_index);
         if (argument_binding_ptr->GetSettings().argument.GetAccessorType() == Rhi::ProgramArgumentAccessType::Mutable)
             argument_binding_instance_ptr->Connect(*this);
 
-        m_binding_by_argument.try_emplace(program_argument, std::move(argument_binding_instance_ptr));
+        m_argument_bindings.emplace_back(program_argument, std::move(argument_binding_instance_ptr));
     }
 }
 
@@ -216,23 +230,32 @@ void ProgramBindings::SetResourcesForArguments(const ResourceViewsByArgument& re
     InitResourceRefsByAccess();
 }
 
+const Rhi::IProgram::Arguments& ProgramBindings::GetArguments() const noexcept
+{
+    return static_cast<const Program&>(*m_program_ptr).GetArguments();
+}
+
 Rhi::IProgramBindings::IArgumentBinding& ProgramBindings::Get(const Rhi::IProgram::Argument& shader_argument) const
 {
     META_FUNCTION_TASK();
-    const auto binding_by_argument_it = m_binding_by_argument.find(shader_argument);
-    if (binding_by_argument_it == m_binding_by_argument.end())
-        throw Rhi::IProgram::Argument::NotFoundException(*m_program_ptr, shader_argument);
+    const Data::Index argument_index = static_cast<const Program&>(*m_program_ptr).GetArgumentIndex(shader_argument);
+    return *m_argument_bindings[argument_index].second;
+}
 
-    return *binding_by_argument_it->second;
+const ProgramBindings::ArgumentBinding& ProgramBindings::GetArgumentBinding(Data::Index argument_index) const
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_LESS(argument_index, m_argument_bindings.size());
+    return *m_argument_bindings[argument_index].second;
 }
 
 ProgramBindings::operator std::string() const
 {
     META_FUNCTION_TASK();
     std::vector<std::string> argument_binding_strings;
-    argument_binding_strings.reserve(m_binding_by_argument.size());
+    argument_binding_strings.reserve(m_argument_bindings.size());
 
-    for (const auto& [program_argument, argument_binding_ptr] : m_binding_by_argument)
+    for (const auto& [program_argument, argument_binding_ptr] : m_argument_bindings)
     {
         META_CHECK_ARG_NOT_NULL(argument_binding_ptr);
         argument_binding_strings.push_back(static_cast<std::string>(*argument_binding_ptr));
@@ -257,7 +280,7 @@ Rhi::IProgram::Arguments ProgramBindings::GetUnboundArguments() const
 {
     META_FUNCTION_TASK();
     Rhi::IProgram::Arguments unbound_arguments;
-    for (const auto& [program_argument, argument_binding_ptr] : m_binding_by_argument)
+    for (const auto& [program_argument, argument_binding_ptr] : m_argument_bindings)
     {
         META_CHECK_ARG_NOT_NULL_DESCR(argument_binding_ptr, "no resource binding is set for program argument '{}'", program_argument.GetName());
 
@@ -110,6 +110,13 @@ void RenderCommandList::SetRenderState(Rhi::IRenderState& render_state, Rhi::Ren
     }
     changed_states |= ~m_drawing_state.render_state_groups;
 
+    if (!render_state_changed && !static_cast<bool>(changed_states & state_groups))
+    {
+        META_LOG("{} Command list '{}' render state '{}' is already set up", magic_enum::enum_name(GetType()), GetName(), render_state.GetName());
+        GetStatisticsRef().skipped_state_changes_count++;
+        return;
+    }
+
     auto& render_state_base = static_cast<RenderState&>(render_state);
     if (!render_state_base.IsDeferred())
     {
@@ -119,10 +126,15 @@ void RenderCommandList::SetRenderState(Rhi::IRenderState& render_state, Rhi::Ren
     Ptr<Object> render_state_object_ptr = render_state_base.GetBasePtr();
     m_drawing_state.render_state_ptr = std::static_pointer_cast<RenderState>(render_state_object_ptr);
     m_drawing_state.render_state_groups |= state_groups;
+    if (render_state_base.IsDeferred())
+    {
+        m_drawing_state.deferred_render_state_groups |= state_groups;
+    }
+    GetStatisticsRef().applied_state_changes_count++;
 
     if (render_state_changed && !render_state_base.IsDeferred())
     {
-        RetainResource(render_state_object_ptr);
+        TrackResource(std::move(render_state_object_ptr));
     }
 }
 
@@ -135,6 +147,7 @@ void RenderCommandList::SetViewState(Rhi::IViewState& view_state)
     if (drawing_state.view_state_ptr && drawing_state.view_state_ptr->GetSettings() == view_state.GetSettings())
     {
         META_LOG("{} Command list '{}' view state is already set up", magic_enum::enum_name(GetType()), GetName());
+        GetStatisticsRef().skipped_state_changes_count++;
         return;
     }
 
@@ -144,6 +157,7 @@ void RenderCommandList::SetViewState(Rhi::IViewState& view_state)
     drawing_state.view_state_ptr = static_cast<ViewState*>(&view_state);
     drawing_state.view_state_ptr->Apply(*this);
     drawing_state.changes |= DrawingState::Change::ViewState;
+    GetStatisticsRef().applied_state_changes_count++;
 }
 
 bool RenderCommandList::SetVertexBuffers(Rhi::IBufferSet& vertex_buffers, bool set_resource_barriers)
@@ -165,6 +179,7 @@ bool RenderCommandList::SetVertexBuffers(Rhi::IBufferSet& vertex_buffers, bool s
     {
         META_LOG("{} Command list '{}' vertex buffers {} are already set up",
                  magic_enum::enum_name(GetType()), GetName(), vertex_buffers.GetNames());
+        GetStatisticsRef().skipped_state_changes_count++;
         return false;
     }
 
@@ -172,7 +187,8 @@ bool RenderCommandList::SetVertexBuffers(Rhi::IBufferSet& vertex_buffers, bool s
 
     Ptr<Object> vertex_buffer_set_object_ptr = static_cast<BufferSet&>(vertex_buffers).GetBasePtr();
     drawing_state.vertex_buffer_set_ptr = std::static_pointer_cast<BufferSet>(vertex_buffer_set_object_ptr);
-    RetainResource(vertex_buffer_set_object_ptr);
+    TrackResource(std::move(vertex_buffer_set_object_ptr));
+    GetStatisticsRef().applied_state_changes_count++;
     return true;
 }
 
@@ -195,12 +211,14 @@ bool RenderCommandList::SetIndexBuffer(Rhi::IBuffer& index_buffer, bool set_reso
     {
         META_LOG("{} Command list '{}' index buffer {} is already set up",
                  magic_enum::enum_name(GetType()), GetName(), index_buffer.GetName());
+        GetStatisticsRef().skipped_state_changes_count++;
         return false;
     }
 
     Ptr<Object> index_buffer_object_ptr = static_cast<Buffer&>(index_buffer).GetBasePtr();
     drawing_state.index_buffer_ptr = std::static_pointer_cast<Buffer>(index_buffer_object_ptr);
-    RetainResource(index_buffer_object_ptr);
+    TrackResource(std::move(index_buffer_object_ptr));
+    GetStatisticsRef().applied_state_changes_count++;
     return true;
 }
 
@@ -231,6 +249,7 @@ void RenderCommandList::DrawIndexed(Primitive primitive_type, uint32_t index_cou
     META_UNUSED(start_instance);
 
     UpdateDrawingState(primitive_type);
+    GetStatisticsRef().draws_count++;
 }
 
 void RenderCommandList::Draw(Primitive primitive_type, uint32_t vertex_count, uint32_t start_vertex,
@@ -241,13 +260,7 @@ void RenderCommandList::Draw(Primitive primitive_type, uint32_t vertex_count, ui
 
     if (m_is_validation_enabled)
     {
-        const DrawingState& drawing_state = GetDrawingState();
-        META_CHECK_ARG_NOT_NULL_DESCR(drawing_state.render_state_ptr, "render state must be set before draw call");
-        const size_t input_buffers_count = drawing_state.render_state_ptr->GetSettings().program_ptr->GetSettings().input_buffer_layouts.size();
-        META_CHECK_ARG_TRUE_DESCR(!input_buffers_count || drawing_state.vertex_buffer_set_ptr,
-                                 "vertex buffers must be set when program has non empty input buffer layouts");
-        META_CHECK_ARG_TRUE_DESCR(!drawing_state.vertex_buffer_set_ptr || drawing_state.vertex_buffer_set_ptr->GetCount() == input_buffers_count,
-                                  "vertex buffers count must be equal to the program input buffer layouts count");
+        ValidateDrawInputBuffers();
         META_CHECK_ARG_NOT_ZERO_DESCR(vertex_count, "can not draw zero vertices");
         META_CHECK_ARG_NOT_ZERO_DESCR(instance_count, "can not draw zero instances");
 
@@ -261,6 +274,59 @@ void RenderCommandList::Draw(Primitive primitive_type, uint32_t vertex_count, ui
     META_UNUSED(start_instance);
 
     UpdateDrawingState(primitive_type);
+    GetStatisticsRef().draws_count++;
+}
+
+void RenderCommandList::DrawIndexedIndirect(Primitive primitive_type, Rhi::IBuffer& args_buffer, Data::Size args_offset, uint32_t draw_count,
+                                            Rhi::IBuffer* count_buffer_ptr, Data::Size count_offset)
+{
+    META_FUNCTION_TASK();
+    VerifyEncodingState();
+
+    if (m_is_validation_enabled)
+    {
+        META_CHECK_ARG_NOT_NULL_DESCR(GetDrawingState().index_buffer_ptr, "index buffer must be set before indexed draw call");
+        ValidateDrawInputBuffers();
+        ValidateIndirectArguments(args_buffer, args_offset, static_cast<Data::Size>(sizeof(Rhi::DrawIndexedIndirectArguments)), draw_count,
+                                  count_buffer_ptr, count_offset);
+    }
+
+    META_LOG("{} Command list '{}' DRAW INDEXED INDIRECT with vertex buffers {} and index buffer '{}' using {} primitive type, up to {} draws with arguments from buffer '{}' at offset {}{}",
+             magic_enum::enum_name(GetType()), GetName(),
+             GetDrawingState().vertex_buffer_set_ptr ? GetDrawingState().vertex_buffer_set_ptr->GetNames() : "None",
+             GetDrawingState().index_buffer_ptr ? GetDrawingState().index_buffer_ptr->GetName() : "None",
+             magic_enum::enum_name(primitive_type), draw_count, args_buffer.GetName(), args_offset,
+             count_buffer_ptr ? fmt::format(" and count from buffer '{}' at offset {}", count_buffer_ptr->GetName(), count_offset) : "");
+
+    TrackIndirectArgumentBuffers(args_buffer, count_buffer_ptr);
+    UpdateDrawingState(primitive_type);
+    GetStatisticsRef().draws_count += draw_count;
+    GetStatisticsRef().indirect_commands_count++;
+}
+
+void RenderCommandList::DrawIndirect(Primitive primitive_type, Rhi::IBuffer& args_buffer, Data::Size args_offset, uint32_t draw_count,
+                                     Rhi::IBuffer* count_buffer_ptr, Data::Size count_offset)
+{
+    META_FUNCTION_TASK();
+    VerifyEncodingState();
+
+    if (m_is_validation_enabled)
+    {
+        ValidateDrawInputBuffers();
+        ValidateIndirectArguments(args_buffer, args_offset, static_cast<Data::Size>(sizeof(Rhi::DrawIndirectArguments)), draw_count,
+                                  count_buffer_ptr, count_offset);
+    }
+
+    META_LOG("{} Command list '{}' DRAW INDIRECT with vertex buffers {} using {} primitive type, up to {} draws with arguments from buffer '{}' at offset {}{}",
+             magic_enum::enum_name(GetType()), GetName(),
+             GetDrawingState().vertex_buffer_set_ptr ? GetDrawingState().vertex_buffer_set_ptr->GetNames() : "None",
+             magic_enum::enum_name(primitive_type), draw_count, args_buffer.GetName(), args_offset,
+             count_buffer_ptr ? fmt::format(" and count from buffer '{}' at offset {}", count_buffer_ptr->GetName(), count_offset) : "");
+
+    TrackIndirectArgumentBuffers(args_buffer, count_buffer_ptr);
+    UpdateDrawingState(primitive_type);
+    GetStatisticsRef().draws_count += draw_count;
+    GetStatisticsRef().indirect_commands_count++;
 }
 
 void RenderCommandList::ResetCommandState()
@@ -277,6 +343,7 @@ void RenderCommandList::ResetCommandState()
     m_drawing_state.primitive_type_opt.reset();
     m_drawing_state.view_state_ptr = nullptr;
     m_drawing_state.render_state_groups = {};
+    m_drawing_state.deferred_render_state_groups = {};
     m_drawing_state.changes = DrawingState::ChangeMask{};
 }
 
@@ -292,16 +359,17 @@ void RenderCommandList::UpdateDrawingState(Primitive primitive_type)
 
     if (m_drawing_state.render_state_ptr &&
         m_drawing_state.render_state_ptr->IsDeferred() &&
-        (static_cast<bool>(m_drawing_state.render_state_groups) ||
+        (static_cast<bool>(m_drawing_state.deferred_render_state_groups) ||
          drawing_state.changes.HasAnyBit(DrawingState::Change::PrimitiveType) ||
          drawing_state.changes.HasAnyBit(DrawingState::Change::ViewState)))
     {
         // Apply render state in deferred mode right before the Draw call,
         // only in case when any render state groups or view state or primitive type has changed
-        m_drawing_state.render_state_ptr->Apply(*this, m_drawing_state.render_state_groups);
-        RetainResource(m_drawing_state.render_state_ptr);
+        m_drawing_state.render_state_ptr->Apply(*this, m_drawing_state.deferred_render_state_groups);
+        TrackResource(m_drawing_state.render_state_ptr);
 
-        m_drawing_state.render_state_groups = {};
+        // Only pending groups are cleared, while set up groups are kept to skip redundant setup of the same render state after draw
+        m_drawing_state.deferred_render_state_groups = {};
         drawing_state.changes.SetBitOff(DrawingState::Change::PrimitiveType);
         drawing_state.changes.SetBitOff(DrawingState::Change::ViewState);
     }
@@ -327,6 +395,28 @@ void RenderCommandList::ValidateDrawVertexBuffers(uint32_t draw_start_vertex, ui
     }
 }
 
+void RenderCommandList::ValidateDrawInputBuffers() const
+{
+    META_FUNCTION_TASK();
+    const DrawingState& drawing_state = GetDrawingState();
+    META_CHECK_ARG_NOT_NULL_DESCR(drawing_state.render_state_ptr, "render state must be set before draw call");
+    const size_t input_buffers_count = drawing_state.render_state_ptr->GetSettings().program_ptr->GetSettings().input_buffer_layouts.size();
+    META_CHECK_ARG_TRUE_DESCR(!input_buffers_count || drawing_state.vertex_buffer_set_ptr,
+                             "vertex buffers must be set when program has non empty input buffer layouts");
+    META_CHECK_ARG_TRUE_DESCR(!drawing_state.vertex_buffer_set_ptr || drawing_state.vertex_buffer_set_ptr->GetCount() == input_buffers_count,
+                              "vertex buffers count must be equal to the program input buffer layouts count");
+}
+
+void RenderCommandList::TrackIndirectArgumentBuffers(Rhi::IBuffer& args_buffer, Rhi::IBuffer* count_buffer_ptr)
+{
+    META_FUNCTION_TASK();
+    TrackResource(static_cast<Buffer&>(args_buffer));
+    if (count_buffer_ptr)
+    {
+        TrackResource(static_cast<Buffer&>(*count_buffer_ptr));
+    }
+}
+
 RenderPass& RenderCommandList::GetPass()
 {
     META_FUNCTION_TASK();
@@ -26,6 +26,7 @@ Base implementation of the render context interface.
 
 #include <Methane/Graphics/TypeFormatters.hpp>
 #include <Methane/Graphics/RHI/ICommandKit.h>
+#include <Methane/Graphics/RHI/ICommandQueue.h>
 #include <Methane/Checks.hpp>
 #include <Methane/Instrumentation.h>
 
@@ -90,6 +91,8 @@ void RenderContext::Present()
     META_FUNCTION_TASK();
     META_LOG("Render context '{}' PRESENT frame {}", GetName(), m_frame_buffer_index);
 
+    // Submit command lists deferred for execution in one batch during the frame
+    GetRenderCommandKit().GetQueue().ExecuteDeferred();
     m_fps_counter.OnCpuFrameReadyToPresent();
 }
 
@@ -107,6 +110,24 @@ void RenderContext::OnCpuPresentComplete(bool signal_frame_fence)
     META_LOG("Render context '{}' PRESENT COMPLETE frame {}", GetName(), m_frame_buffer_index);
 
     m_fps_counter.OnCpuFramePresented();
+
+    std::scoped_lock lock_guard(m_frame_statistics_mutex);
+    m_presented_frame_statistics = m_encoding_frame_statistics;
+    m_encoding_frame_statistics  = {};
+}
+
+Rhi::CommandListStatistics RenderContext::GetFrameStatistics() const
+{
+    META_FUNCTION_TASK();
+    std::scoped_lock lock_guard(m_frame_statistics_mutex);
+    return m_presented_frame_statistics;
+}
+
+void RenderContext::AddCommandListStatistics(const Rhi::CommandListStatistics& statistics) const
+{
+    META_FUNCTION_TASK();
+    std::scoped_lock lock_guard(m_frame_statistics_mutex);
+    m_encoding_frame_statistics += statistics;
 }
 
 Rhi::IFence& RenderContext::GetCurrentFrameFence() const
@@ -46,6 +46,12 @@ void RenderState::Reset(const Settings& settings)
     m_settings = settings;
 }
 
+void RenderState::PrewarmPipelines(const Refs<Rhi::IViewState>&, const std::vector<Rhi::RenderPrimitive>&)
+{
+    // Native pipeline state does not depend on view state and primitive type,
+    // so it is compiled on render state reset and there is nothing to prewarm
+}
+
 Rhi::IProgram& RenderState::GetProgram()
 {
     META_FUNCTION_TASK();
@@ -133,18 +133,20 @@ Data::Size Texture::CalculateSubResourceDataSize(const SubResource::Index& sub_r
     META_FUNCTION_TASK();
     ValidateSubResource(sub_resource_index, {});
 
-    const Data::Size pixel_size = GetPixelSize(m_settings.pixel_format);
-    if (sub_resource_index.GetMipLevel() == 0U)
-    {
-        return pixel_size * static_cast<const Data::FrameSize&>(m_settings.dimensions).GetPixelsCount();
-    }
+    return GetPixelSize(m_settings.pixel_format) * GetMipLevelFrameSize(sub_resource_index.GetMipLevel()).GetPixelsCount();
+}
+
+Data::FrameSize Texture::GetMipLevelFrameSize(Data::Index mip_level) const
+{
+    META_FUNCTION_TASK();
+    if (mip_level == 0U)
+        return static_cast<const Data::FrameSize&>(m_settings.dimensions);
 
-    const double mip_divider = std::pow(2.0, sub_resource_index.GetMipLevel());
-    const Data::FrameSize mip_frame_size(
+    const double mip_divider = std::pow(2.0, mip_level);
+    return Data::FrameSize(
         static_cast<uint32_t>(std::ceil(static_cast<double>(m_settings.dimensions.GetWidth()) / mip_divider)),
         static_cast<uint32_t>(std::ceil(static_cast<double>(m_settings.dimensions.GetHeight()) / mip_divider))
     );
-    return pixel_size * mip_frame_size.GetPixelsCount();
 }
 
 void Texture::ValidateSubResource(const Rhi::SubResource& sub_resource) const
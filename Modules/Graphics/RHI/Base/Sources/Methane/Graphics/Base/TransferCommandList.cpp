@@ -0,0 +1,182 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/Base/TransferCommandList.cpp
+Base implementation of the transfer command list interface.
+
+******************************************************************************/
+
+#include <Methane/Graphics/Base/TransferCommandList.h>
+#include <Methane/Graphics/Base/CommandQueue.h>
+#include <Methane/Graphics/Base/Buffer.h>
+#include <Methane/Graphics/Base/Texture.h>
+#include <Methane/Graphics/TypeFormatters.hpp>
+
+#include <Methane/Instrumentation.h>
+#include <Methane/Checks.hpp>
+
+namespace Methane::Graphics::Base
+{
+
+TransferCommandList::TransferCommandList(CommandQueue& command_queue)
+    : CommandList(command_queue, Type::Transfer)
+{ }
+
+void TransferCommandList::CopyBuffer(Rhi::IBuffer& src_buffer, Rhi::IBuffer& dst_buffer, const Rhi::BufferCopyRegion& copy_region)
+{
+    META_FUNCTION_TASK();
+    META_LOG("{} Command list '{}' COPY {} bytes from buffer '{}' at offset {} to buffer '{}' at offset {}",
+             magic_enum::enum_name(GetType()), GetName(), copy_region.size,
+             src_buffer.GetName(), copy_region.src_offset, dst_buffer.GetName(), copy_region.dst_offset);
+
+    VerifyEncodingState();
+    META_CHECK_ARG_NAME_DESCR("dst_buffer", std::addressof(src_buffer) != std::addressof(dst_buffer),
+                              "source and destination buffers of copy command must be different");
+    META_CHECK_ARG_NOT_ZERO_DESCR(copy_region.size, "can not copy empty buffer region");
+    META_CHECK_ARG_LESS_OR_EQUAL_DESCR(copy_region.src_offset + copy_region.size, src_buffer.GetDataSize(),
+                                       "copy region is out of source buffer '{}' bounds", src_buffer.GetName());
+    META_CHECK_ARG_LESS_OR_EQUAL_DESCR(copy_region.dst_offset + copy_region.size, dst_buffer.GetDataSize(),
+                                       "copy region is out of destination buffer '{}' bounds", dst_buffer.GetName());
+
+    SetCopyResourceState(static_cast<Buffer&>(src_buffer), Rhi::ResourceState::CopySource);
+    SetCopyResourceState(static_cast<Buffer&>(dst_buffer), Rhi::ResourceState::CopyDest);
+}
+
+void TransferCommandList::CopyBufferToTexture(Rhi::IBuffer& src_buffer, Data::Size src_offset, Rhi::ITexture& dst_texture, const Rhi::TextureCopyRegion& dst_region)
+{
+    META_FUNCTION_TASK();
+    META_LOG("{} Command list '{}' COPY buffer '{}' at offset {} to texture '{}' sub-resource {} rect {}",
+             magic_enum::enum_name(GetType()), GetName(), src_buffer.GetName(), src_offset,
+             dst_texture.GetName(), static_cast<std::string>(dst_region.subresource_index), dst_region.rect);
+
+    VerifyEncodingState();
+    auto& dst_texture_base = static_cast<Texture&>(dst_texture);
+    const Rhi::TextureCopyRegion resolved_dst_region = ValidateTextureCopyRegion(dst_texture_base, dst_region);
+    const Data::Size copy_data_size = GetPixelSize(dst_texture.GetSettings().pixel_format) * resolved_dst_region.rect.size.GetPixelsCount();
+    META_CHECK_ARG_LESS_OR_EQUAL_DESCR(src_offset + copy_data_size, src_buffer.GetDataSize(),
+                                       "texture copy region data is out of source buffer '{}' bounds", src_buffer.GetName());
+
+    SetCopyResourceState(static_cast<Buffer&>(src_buffer), Rhi::ResourceState::CopySource);
+    SetCopyResourceState(dst_texture_base, Rhi::ResourceState::CopyDest);
+}
+
+void TransferCommandList::CopyTextureToBuffer(Rhi::ITexture& src_texture, const Rhi::TextureCopyRegion& src_region, Rhi::IBuffer& dst_buffer, Data::Size dst_offset)
+{
+    META_FUNCTION_TASK();
+    META_LOG("{} Command list '{}' COPY texture '{}' sub-resource {} rect {} to buffer '{}' at offset {}",
+             magic_enum::enum_name(GetType()), GetName(), src_texture.GetName(), static_cast<std::string>(src_region.subresource_index),
+             src_region.rect, dst_buffer.GetName(), dst_offset);
+
+    VerifyEncodingState();
+    auto& src_texture_base = static_cast<Texture&>(src_texture);
+    const Rhi::TextureCopyRegion resolved_src_region = ValidateTextureCopyRegion(src_texture_base, src_region);
+    const Data::Size copy_data_size = GetPixelSize(src_texture.GetSettings().pixel_format) * resolved_src_region.rect.size.GetPixelsCount();
+    META_CHECK_ARG_LESS_OR_EQUAL_DESCR(dst_offset + copy_data_size, dst_buffer.GetDataSize(),
+                                       "texture copy region data is out of destination buffer '{}' bounds", dst_buffer.GetName());
+
+    SetCopyResourceState(src_texture_base, Rhi::ResourceState::CopySource);
+    SetCopyResourceState(static_cast<Buffer&>(dst_buffer), Rhi::ResourceState::CopyDest);
+}
+
+void TransferCommandList::CopyTexture(Rhi::ITexture& src_texture, const Rhi::TextureCopyRegion& src_region, Rhi::ITexture& dst_texture, const Rhi::TextureCopyRegion& dst_region)
+{
+    META_FUNCTION_TASK();
+    META_LOG("{} Command list '{}' COPY texture '{}' sub-resource {} rect {} to texture '{}' sub-resource {} rect {}",
+             magic_enum::enum_name(GetType()), GetName(), src_texture.GetName(), static_cast<std::string>(src_region.subresource_index), src_region.rect,
+             dst_texture.GetName(), static_cast<std::string>(dst_region.subresource_index), dst_region.rect);
+
+    VerifyEncodingState();
+    META_CHECK_ARG_NAME_DESCR("dst_texture", std::addressof(src_texture) != std::addressof(dst_texture),
+                              "source and destination textures of copy command must be different");
+    META_CHECK_ARG_EQUAL_DESCR(src_texture.GetSettings().pixel_format, dst_texture.GetSettings().pixel_format,
+                               "source and destination textures of copy command must have the same pixel format");
+
+    auto& src_texture_base = static_cast<Texture&>(src_texture);
+    auto& dst_texture_base = static_cast<Texture&>(dst_texture);
+    const Rhi::TextureCopyRegion resolved_src_region = ValidateTextureCopyRegion(src_texture_base, src_region);
+
+    Rhi::TextureCopyRegion dst_copy_region = dst_region;
+    if (!dst_copy_region.rect.size)
+        dst_copy_region.rect.size = resolved_src_region.rect.size;
+
+    META_CHECK_ARG_EQUAL_DESCR(dst_copy_region.rect.size, resolved_src_region.rect.size,
+                               "destination texture copy region size must be equal to the source region size");
+    ValidateTextureCopyRegion(dst_texture_base, dst_copy_region);
+
+    SetCopyResourceState(src_texture_base, Rhi::ResourceState::CopySource);
+    SetCopyResourceState(dst_texture_base, Rhi::ResourceState::CopyDest);
+}
+
+void TransferCommandList::GenerateMipmaps(Rhi::ITexture& texture)
+{
+    META_FUNCTION_TASK();
+    META_LOG("{} Command list '{}' GENERATE MIPMAPS of texture '{}'",
+             magic_enum::enum_name(GetType()), GetName(), texture.GetName());
+
+    VerifyEncodingState();
+    META_CHECK_ARG_TRUE_DESCR(texture.GetSettings().mipmapped, "can not generate mipmaps of texture '{}' created without mip levels", texture.GetName());
+
+    SetCopyResourceState(static_cast<Texture&>(texture), Rhi::ResourceState::CopyDest);
+}
+
+Rhi::TextureCopyRegion TransferCommandList::GetResolvedCopyRegion(const Texture& texture, const Rhi::TextureCopyRegion& copy_region)
+{
+    META_FUNCTION_TASK();
+    if (copy_region.rect.size)
+        return copy_region;
+
+    const Data::FrameSize mip_size = texture.GetMipLevelFrameSize(copy_region.subresource_index.GetMipLevel());
+    Rhi::TextureCopyRegion resolved_region = copy_region;
+    resolved_region.rect.size = Data::FrameSize(mip_size.GetWidth()  - copy_region.rect.origin.GetX(),
+                                                mip_size.GetHeight() - copy_region.rect.origin.GetY());
+    return resolved_region;
+}
+
+void TransferCommandList::SetCopyResourceState(Resource& resource, Rhi::ResourceState copy_state)
+{
+    META_FUNCTION_TASK();
+    TrackResource(resource);
+
+    if (Ptr<Rhi::IResourceBarriers>& copy_barriers_ptr = resource.GetSetupTransitionBarriers();
+        resource.SetState(copy_state, copy_barriers_ptr) && copy_barriers_ptr)
+    {
+        SetResourceBarriers(*copy_barriers_ptr);
+    }
+}
+
+Rhi::TextureCopyRegion TransferCommandList::ValidateTextureCopyRegion(const Texture& texture, const Rhi::TextureCopyRegion& copy_region) const
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_LESS_DESCR(copy_region.subresource_index, texture.GetSubresourceCount(),
+                              "copy region sub-resource is out of texture '{}' sub-resources range", texture.GetName());
+
+    const Data::FrameSize mip_size = texture.GetMipLevelFrameSize(copy_region.subresource_index.GetMipLevel());
+    META_CHECK_ARG_LESS_DESCR(copy_region.rect.origin.GetX(), mip_size.GetWidth(),
+                              "copy region origin is out of texture '{}' sub-resource bounds", texture.GetName());
+    META_CHECK_ARG_LESS_DESCR(copy_region.rect.origin.GetY(), mip_size.GetHeight(),
+                              "copy region origin is out of texture '{}' sub-resource bounds", texture.GetName());
+
+    const Rhi::TextureCopyRegion resolved_region = GetResolvedCopyRegion(texture, copy_region);
+    META_CHECK_ARG_LESS_OR_EQUAL_DESCR(resolved_region.rect.GetRight(), mip_size.GetWidth(),
+                                       "copy region is out of texture '{}' sub-resource bounds", texture.GetName());
+    META_CHECK_ARG_LESS_OR_EQUAL_DESCR(resolved_region.rect.GetBottom(), mip_size.GetHeight(),
+                                       "copy region is out of texture '{}' sub-resource bounds", texture.GetName());
+    return resolved_region;
+}
+
+} // namespace Methane::Graphics::Base
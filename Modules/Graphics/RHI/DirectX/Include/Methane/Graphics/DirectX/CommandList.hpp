@@ -121,6 +121,7 @@ public:
         const auto& dx_resource_barriers = static_cast<const IResource::Barriers&>(resource_barriers);
         const std::vector<D3D12_RESOURCE_BARRIER>& d3d12_resource_barriers = dx_resource_barriers.GetNativeResourceBarriers();
         m_cp_command_list->ResourceBarrier(static_cast<UINT>(d3d12_resource_barriers.size()), d3d12_resource_barriers.data());
+        Base::CommandList::CountResourceBarriers(d3d12_resource_barriers.size());
     }
 
     // Rhi::ICommandList interface
@@ -175,7 +176,9 @@ protected:
     void ApplyProgramBindings(Base::ProgramBindings& program_bindings, Rhi::ProgramBindingsApplyBehaviorMask apply_behavior) final
     {
         // Optimization to skip dynamic_cast required to call Apply method of the Base::ProgramBinding implementation
-        static_cast<ProgramBindings&>(program_bindings).Apply(*this, Base::CommandList::GetProgramBindingsPtr(), apply_behavior);
+        Base::CommandList::CountDescriptorSetBinds(
+            static_cast<ProgramBindings&>(program_bindings).Apply(*this, Base::CommandList::GetProgramBindingsPtr(), apply_behavior)
+        );
     }
 
     bool IsNativeCommitted() const             { return m_is_native_committed; }
@@ -49,6 +49,7 @@ public:
 
     using NativeCommandLists = std::vector<ID3D12CommandList*>;
     const NativeCommandLists& GetNativeCommandLists() const noexcept { return m_native_command_lists; }
+    const Fence&              GetExecutionCompletedFence() const noexcept { return m_execution_completed_fence; }
 
     CommandQueue&       GetDirectCommandQueue() noexcept;
     const CommandQueue& GetDirectCommandQueue() const noexcept;
@@ -41,6 +41,7 @@ public:
 
     // IComputeCommandList interface
     void Dispatch(const Rhi::ThreadGroupsCount& thread_groups_count) override;
+    void DispatchIndirect(Rhi::IBuffer& args_buffer, Data::Size args_offset) override;
 
 private:
     DescriptorHeap& m_gpu_shader_resources_descriptor_heap;
@@ -24,12 +24,15 @@ DirectX 12 implementation of the device interface.
 #pragma once
 
 #include <Methane/Graphics/Base/Device.h>
+#include <Methane/Instrumentation.h>
 
 #include <wrl.h>
 #include <dxgi1_6.h>
 #include <directx/d3d12.h>
 
 #include <optional>
+#include <map>
+#include <mutex>
 
 // NOTE: Adapters change handling breaks many frame capture tools, like VS or RenderDoc
 //#define ADAPTERS_CHANGE_HANDLING
@@ -57,13 +60,23 @@ public:
     const NativeFeatureOptions5&        GetNativeFeatureOptions5() const { return m_feature_options_5; }
     const wrl::ComPtr<IDXGIAdapter>&    GetNativeAdapter() const         { return m_cp_adapter; }
     const wrl::ComPtr<ID3D12Device>&    GetNativeDevice() const;
+    ID3D12CommandSignature&             GetNativeIndirectCommandSignature(D3D12_INDIRECT_ARGUMENT_TYPE argument_type) const;
     void ReleaseNativeDevice();
 
+protected:
+    // Base::Device overrides
+    [[nodiscard]] UniquePtr<Base::ExecutionCompletionService> CreateExecutionCompletionService() const override;
+
 private:
     const wrl::ComPtr<IDXGIAdapter>     m_cp_adapter;
     const D3D_FEATURE_LEVEL             m_feature_level;
     mutable NativeFeatureOptions5       m_feature_options_5;
     mutable wrl::ComPtr<ID3D12Device>   m_cp_device;
+
+    // Indirect command signatures are created on first use and shared by all command lists of the device
+    using CommandSignatureByArgumentType = std::map<D3D12_INDIRECT_ARGUMENT_TYPE, wrl::ComPtr<ID3D12CommandSignature>>;
+    mutable CommandSignatureByArgumentType m_cp_command_signature_by_argument_type;
+    mutable TracyLockable(std::mutex,      m_command_signatures_mutex);
 };
 
 bool IsSoftwareAdapterDxgi(IDXGIAdapter1& adapter);
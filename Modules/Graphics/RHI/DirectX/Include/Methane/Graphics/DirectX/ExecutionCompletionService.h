@@ -0,0 +1,52 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+FILE: Methane/Graphics/DirectX/ExecutionCompletionService.h
+DirectX 12 implementation of the command list sets execution completion service
+waiting for any of the command list set execution completed fences.
+
+******************************************************************************/
+
+#pragma once
+
+#include <Methane/Graphics/Base/ExecutionCompletionService.h>
+
+#include <windows.h>
+
+namespace Methane::Graphics::DirectX
+{
+
+class ExecutionCompletionService final // NOSONAR - destructor is required
+    : public Base::ExecutionCompletionService
+{
+public:
+    ExecutionCompletionService();
+    ~ExecutionCompletionService() override;
+
+protected:
+    // Base::ExecutionCompletionService overrides
+    void WaitForAnyCompleted(const Ptrs<Base::CommandListSet>& command_list_sets) override;
+    [[nodiscard]] bool IsCompleted(const Base::CommandListSet& command_list_set) const override;
+    void ResetWaitingInterrupt() override;
+    void InterruptWaiting() override;
+
+private:
+    HANDLE m_completed_event = nullptr; // auto-reset event signalled by any of the waited fences
+    HANDLE m_interrupt_event = nullptr; // manual-reset event signalled until waiting interrupt is reset
+};
+
+} // namespace Methane::Graphics::DirectX
@@ -55,6 +55,9 @@ public:
     // IObject override
     bool SetName(std::string_view name) override;
 
+    using Base::Fence::GetValue;
+    ID3D12Fence& GetNativeFence() const noexcept { return *m_cp_fence.Get(); }
+
 private:
     CommandQueue& GetDirectCommandQueue();
 
@@ -60,7 +60,8 @@ public:
     void CompleteInitialization() override;
     void Apply(Base::CommandList& command_list, ApplyBehaviorMask apply_behavior) const override;
 
-    void Apply(ICommandList& command_list, const Base::ProgramBindings* applied_program_bindings_ptr, ApplyBehaviorMask apply_behavior) const;
+    // Returns number of root parameters bound to the command list
+    uint32_t Apply(ICommandList& command_list, const Base::ProgramBindings* applied_program_bindings_ptr, ApplyBehaviorMask apply_behavior) const;
 
 private:
     struct RootParameterBinding
@@ -80,11 +81,11 @@ private:
     void AddRootParameterBinding(const Rhi::ProgramArgumentAccessor& argument_desc, const RootParameterBinding& root_parameter_binding);
     void UpdateRootParameterBindings();
     void AddRootParameterBindingsForArgument(ArgumentBinding& argument_binding, const DescriptorHeap::Reservation* p_heap_reservation);
-    void ApplyRootParameterBindings(Rhi::ProgramArgumentAccessMask access, const ICommandList& command_list,
-                                    const Base::ProgramBindings* applied_program_bindings_ptr, bool apply_changes_only) const;
+    uint32_t ApplyRootParameterBindings(Rhi::ProgramArgumentAccessMask access, const ICommandList& command_list,
+                                        const Base::ProgramBindings* applied_program_bindings_ptr, bool apply_changes_only) const;
     template<Rhi::CommandListType command_list_type>
-    void ApplyRootParameterBindings(Rhi::ProgramArgumentAccessMask access, ID3D12GraphicsCommandList& d3d12_command_list,
-                                    const Base::ProgramBindings* applied_program_bindings_ptr, bool apply_changes_only) const;
+    uint32_t ApplyRootParameterBindings(Rhi::ProgramArgumentAccessMask access, ID3D12GraphicsCommandList& d3d12_command_list,
+                                        const Base::ProgramBindings* applied_program_bindings_ptr, bool apply_changes_only) const;
 
     void CopyDescriptorsToGpu() const;
     void CopyDescriptorsToGpuForArgument(const wrl::ComPtr<ID3D12Device>& d3d12_device, ArgumentBinding& argument_binding,
@@ -25,17 +25,23 @@ DirectX 12 implementation of the transfer command list interface.
 
 #include "CommandList.hpp"
 
-#include <Methane/Graphics/RHI/ITransferCommandList.h>
+#include <Methane/Graphics/Base/TransferCommandList.h>
 
 namespace Methane::Graphics::DirectX
 {
 
-class TransferCommandList final
-    : public CommandList<Base::CommandList>
-    , public Rhi::ITransferCommandList
+class TransferCommandList final // NOSONAR - inheritance hierarchy depth is higher than 5
+    : public CommandList<Base::TransferCommandList>
 {
 public:
     explicit TransferCommandList(Base::CommandQueue& cmd_buffer);
+
+    // ITransferCommandList interface
+    void CopyBuffer(Rhi::IBuffer& src_buffer, Rhi::IBuffer& dst_buffer, const Rhi::BufferCopyRegion& copy_region) override;
+    void CopyBufferToTexture(Rhi::IBuffer& src_buffer, Data::Size src_offset, Rhi::ITexture& dst_texture, const Rhi::TextureCopyRegion& dst_region) override;
+    void CopyTextureToBuffer(Rhi::ITexture& src_texture, const Rhi::TextureCopyRegion& src_region, Rhi::IBuffer& dst_buffer, Data::Size dst_offset) override;
+    void CopyTexture(Rhi::ITexture& src_texture, const Rhi::TextureCopyRegion& src_region, Rhi::ITexture& dst_texture, const Rhi::TextureCopyRegion& dst_region) override;
+    void GenerateMipmaps(Rhi::ITexture&) override { META_FUNCTION_NOT_IMPLEMENTED_DESCR("GPU mipmaps generation is not supported by DirectX transfer command list."); }
 };
 
 } // namespace Methane::Graphics::DirectX
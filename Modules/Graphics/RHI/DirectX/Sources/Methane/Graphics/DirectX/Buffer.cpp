@@ -113,7 +113,8 @@ void Buffer::SetData(Rhi::ICommandQueue& target_cmd_queue, const SubResource& su
     );
 
     META_CHECK_ARG_NOT_NULL_DESCR(p_sub_resource_data, "failed to map buffer subresource");
-    stdext::checked_array_iterator target_data_it(p_sub_resource_data, sub_resource.GetDataSize());
+    const Data::Size data_offset = sub_resource.HasDataRange() ? sub_resource.GetDataRange().GetStart() : 0U;
+    stdext::checked_array_iterator target_data_it(p_sub_resource_data + data_offset, sub_resource.GetDataSize());
     std::copy(sub_resource.GetDataPtr(), sub_resource.GetDataEndPtr(), target_data_it);
 
     if (sub_resource.HasDataRange())
@@ -131,7 +132,7 @@ void Buffer::SetData(Rhi::ICommandQueue& target_cmd_queue, const SubResource& su
 
     // In case of private GPU storage, copy buffer data from intermediate upload resource to the private GPU resource
     const TransferCommandList& upload_cmd_list = PrepareResourceTransfer(TransferOperation::Upload, target_cmd_queue, State::CopyDest);
-    upload_cmd_list.GetNativeCommandList().CopyBufferRegion(GetNativeResource(), 0U, m_cp_upload_resource.Get(), 0U, settings.size);
+    upload_cmd_list.GetNativeCommandList().CopyBufferRegion(GetNativeResource(), data_offset, m_cp_upload_resource.Get(), data_offset, sub_resource.GetDataSize());
     GetContext().RequestDeferredAction(Rhi::IContext::DeferredAction::UploadResources);
 }
 
@@ -24,6 +24,8 @@ DirectX 12 implementation of the transfer command list interface.
 #include "Methane/Graphics/Base/ComputeCommandList.h"
 #include <Methane/Graphics/DirectX/ComputeCommandList.h>
 #include <Methane/Graphics/DirectX/DescriptorManager.h>
+#include <Methane/Graphics/DirectX/Device.h>
+#include <Methane/Graphics/DirectX/Buffer.h>
 
 #include <Methane/Graphics/Base/Context.h>
 #include <Methane/Graphics/Base/CommandQueue.h>
@@ -57,4 +59,21 @@ void ComputeCommandList::Dispatch(const Rhi::ThreadGroupsCount& thread_groups_co
     dx_command_list.Dispatch(thread_groups_count.GetWidth(), thread_groups_count.GetHeight(), thread_groups_count.GetDepth());
 }
 
+void ComputeCommandList::DispatchIndirect(Rhi::IBuffer& args_buffer, Data::Size args_offset)
+{
+    META_FUNCTION_TASK();
+    Base::ComputeCommandList::DispatchIndirect(args_buffer, args_offset);
+
+    auto& dx_args_buffer = static_cast<Buffer&>(args_buffer);
+    if (Ptr<Rhi::IResourceBarriers>& buffer_setup_barriers_ptr = dx_args_buffer.GetSetupTransitionBarriers();
+        dx_args_buffer.SetState(Rhi::ResourceState::IndirectArgument, buffer_setup_barriers_ptr) && buffer_setup_barriers_ptr)
+    {
+        SetResourceBarriers(*buffer_setup_barriers_ptr);
+    }
+
+    ID3D12CommandSignature& dx_command_signature = GetDirectCommandQueue().GetDirectContext().GetDirectDevice()
+                                                       .GetNativeIndirectCommandSignature(D3D12_INDIRECT_ARGUMENT_TYPE_DISPATCH);
+    GetNativeCommandListRef().ExecuteIndirect(&dx_command_signature, 1U, dx_args_buffer.GetNativeResource(), args_offset, nullptr, 0U);
+}
+
 } // namespace Methane::Graphics::DirectX
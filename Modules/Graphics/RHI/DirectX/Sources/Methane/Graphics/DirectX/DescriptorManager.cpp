@@ -77,15 +77,25 @@ void DescriptorManager::CompleteInitialization()
 
     GetContext().WaitForGpu(Rhi::IContext::WaitFor::RenderComplete);
 
+    bool is_shader_visible_heap_reallocated = false;
     for (const UniquePtrs<DescriptorHeap>& desc_heaps : m_descriptor_heap_types)
     {
         for (const UniquePtr<DescriptorHeap>& desc_heap_ptr : desc_heaps)
         {
             META_CHECK_ARG_NOT_NULL(desc_heap_ptr);
+            const Data::Size allocated_size = desc_heap_ptr->GetAllocatedSize();
             desc_heap_ptr->Allocate();
+            is_shader_visible_heap_reallocated |= desc_heap_ptr->GetSettings().shader_visible &&
+                                                  desc_heap_ptr->GetAllocatedSize() != allocated_size;
         }
     }
 
+    // Descriptors of all program bindings have to be copied again to the reallocated shader-visible heaps
+    if (is_shader_visible_heap_reallocated)
+    {
+        RequestAllProgramBindingsInitialization();
+    }
+
     Base::DescriptorManager::CompleteInitialization();
 
     // Enable deferred heap allocation in case if more resources will be created in runtime
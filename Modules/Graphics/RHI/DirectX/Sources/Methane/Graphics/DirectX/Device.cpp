@@ -26,6 +26,7 @@ DirectX 12 implementation of the device interface.
 #include <Methane/Graphics/DirectX/RenderContext.h>
 #include <Methane/Graphics/DirectX/ComputeContext.h>
 #include <Methane/Graphics/DirectX/ErrorHandling.h>
+#include <Methane/Graphics/DirectX/ExecutionCompletionService.h>
 
 #include <Methane/Platform/Windows/Utils.h>
 #include <Methane/Instrumentation.h>
@@ -99,6 +100,7 @@ Rhi::DeviceFeatureMask Device::GetSupportedFeatures(const wrl::ComPtr<IDXGIAdapt
     supported_features.SetBitOn(Rhi::DeviceFeature::PresentToWindow);
     supported_features.SetBitOn(Rhi::DeviceFeature::AnisotropicFiltering);
     supported_features.SetBitOn(Rhi::DeviceFeature::ImageCubeArray);
+    supported_features.SetBitOn(Rhi::DeviceFeature::IndirectDrawCount);
     return supported_features;
 }
 
@@ -177,9 +179,50 @@ const wrl::ComPtr<ID3D12Device>& Device::GetNativeDevice() const
     return m_cp_device;
 }
 
+ID3D12CommandSignature& Device::GetNativeIndirectCommandSignature(D3D12_INDIRECT_ARGUMENT_TYPE argument_type) const
+{
+    META_FUNCTION_TASK();
+    std::scoped_lock lock_guard(m_command_signatures_mutex);
+    wrl::ComPtr<ID3D12CommandSignature>& cp_command_signature = m_cp_command_signature_by_argument_type[argument_type];
+    if (cp_command_signature)
+        return *cp_command_signature.Get();
+
+    UINT arguments_stride = 0U;
+    switch(argument_type)
+    {
+    case D3D12_INDIRECT_ARGUMENT_TYPE_DRAW:         arguments_stride = sizeof(D3D12_DRAW_ARGUMENTS); break;
+    case D3D12_INDIRECT_ARGUMENT_TYPE_DRAW_INDEXED: arguments_stride = sizeof(D3D12_DRAW_INDEXED_ARGUMENTS); break;
+    case D3D12_INDIRECT_ARGUMENT_TYPE_DISPATCH:     arguments_stride = sizeof(D3D12_DISPATCH_ARGUMENTS); break;
+    default: META_UNEXPECTED_ARG_DESCR(argument_type, "unsupported indirect argument type");
+    }
+
+    D3D12_INDIRECT_ARGUMENT_DESC argument_desc{};
+    argument_desc.Type = argument_type;
+
+    D3D12_COMMAND_SIGNATURE_DESC command_signature_desc{};
+    command_signature_desc.ByteStride       = arguments_stride;
+    command_signature_desc.NumArgumentDescs = 1U;
+    command_signature_desc.pArgumentDescs   = &argument_desc;
+
+    // Root signature is not required for command signatures without root arguments changes
+    const wrl::ComPtr<ID3D12Device>& cp_device = GetNativeDevice();
+    ThrowIfFailed(cp_device->CreateCommandSignature(&command_signature_desc, nullptr, IID_PPV_ARGS(&cp_command_signature)), cp_device.Get());
+    return *cp_command_signature.Get();
+}
+
+UniquePtr<Base::ExecutionCompletionService> Device::CreateExecutionCompletionService() const
+{
+    META_FUNCTION_TASK();
+    return std::make_unique<ExecutionCompletionService>();
+}
+
 void Device::ReleaseNativeDevice()
 {
     META_FUNCTION_TASK();
+    {
+        std::scoped_lock lock_guard(m_command_signatures_mutex);
+        m_cp_command_signature_by_argument_type.clear();
+    }
     m_cp_device.Reset();
 }
 
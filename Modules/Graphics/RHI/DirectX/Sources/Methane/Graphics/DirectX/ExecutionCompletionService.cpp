@@ -0,0 +1,96 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+FILE: Methane/Graphics/DirectX/ExecutionCompletionService.cpp
+DirectX 12 implementation of the command list sets execution completion service
+waiting for any of the command list set execution completed fences.
+
+******************************************************************************/
+
+#include <Methane/Graphics/DirectX/ExecutionCompletionService.h>
+#include <Methane/Graphics/DirectX/CommandListSet.h>
+#include <Methane/Graphics/DirectX/ErrorHandling.h>
+
+#include <Methane/Instrumentation.h>
+#include <Methane/Checks.hpp>
+
+#include <array>
+
+namespace Methane::Graphics::DirectX
+{
+
+static HANDLE CreateWaitEvent(bool manual_reset)
+{
+    META_FUNCTION_TASK();
+    HANDLE event = CreateEvent(nullptr, manual_reset ? TRUE : FALSE, FALSE, nullptr);
+    if (!event)
+    {
+        ThrowIfFailed(HRESULT_FROM_WIN32(GetLastError()));
+    }
+    return event;
+}
+
+ExecutionCompletionService::ExecutionCompletionService()
+    : m_completed_event(CreateWaitEvent(false))
+    , m_interrupt_event(CreateWaitEvent(true))
+{ }
+
+ExecutionCompletionService::~ExecutionCompletionService()
+{
+    META_FUNCTION_TASK();
+    // Completion thread has to be stopped before the waited events are closed
+    Shutdown();
+    SafeCloseHandle(m_completed_event);
+    SafeCloseHandle(m_interrupt_event);
+}
+
+void ExecutionCompletionService::WaitForAnyCompleted(const Ptrs<Base::CommandListSet>& command_list_sets)
+{
+    META_FUNCTION_TASK();
+    // Completion event is signalled by the first completed fence, while the events left from
+    // previous waits may only wake up the service for one more check of the command list sets completion
+    for(const Ptr<Base::CommandListSet>& command_list_set_ptr : command_list_sets)
+    {
+        const Fence& execution_completed_fence = static_cast<const CommandListSet&>(*command_list_set_ptr).GetExecutionCompletedFence();
+        ThrowIfFailed(execution_completed_fence.GetNativeFence().SetEventOnCompletion(execution_completed_fence.GetValue(), m_completed_event));
+    }
+
+    const std::array<HANDLE, 2> wait_events{ m_completed_event, m_interrupt_event };
+    const DWORD wait_result = WaitForMultipleObjectsEx(static_cast<DWORD>(wait_events.size()), wait_events.data(), FALSE, INFINITE, FALSE);
+    META_CHECK_ARG_LESS_DESCR(wait_result, WAIT_OBJECT_0 + wait_events.size(), "failed to wait for any command list set execution completed");
+}
+
+bool ExecutionCompletionService::IsCompleted(const Base::CommandListSet& command_list_set) const
+{
+    META_FUNCTION_TASK();
+    const Fence& execution_completed_fence = static_cast<const CommandListSet&>(command_list_set).GetExecutionCompletedFence();
+    return execution_completed_fence.GetNativeFence().GetCompletedValue() >= execution_completed_fence.GetValue();
+}
+
+void ExecutionCompletionService::ResetWaitingInterrupt()
+{
+    META_FUNCTION_TASK();
+    ResetEvent(m_interrupt_event);
+}
+
+void ExecutionCompletionService::InterruptWaiting()
+{
+    META_FUNCTION_TASK();
+    SetEvent(m_interrupt_event);
+}
+
+} // namespace Methane::Graphics::DirectX
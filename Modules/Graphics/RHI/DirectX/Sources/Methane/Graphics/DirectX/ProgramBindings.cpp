@@ -125,10 +125,12 @@ Ptr<Rhi::IProgramBindings> ProgramBindings::CreateCopy(const ResourceViewsByArgu
 
 void ProgramBindings::Apply(Base::CommandList& command_list, ApplyBehaviorMask apply_behavior) const
 {
-    Apply(dynamic_cast<ICommandList&>(command_list), command_list.GetProgramBindingsPtr(), apply_behavior);
+    command_list.CountDescriptorSetBinds(
+        Apply(dynamic_cast<ICommandList&>(command_list), command_list.GetProgramBindingsPtr(), apply_behavior)
+    );
 }
 
-void ProgramBindings::Apply(ICommandList& command_list, const Base::ProgramBindings* applied_program_bindings_ptr, ApplyBehaviorMask apply_behavior) const
+uint32_t ProgramBindings::Apply(ICommandList& command_list, const Base::ProgramBindings* applied_program_bindings_ptr, ApplyBehaviorMask apply_behavior) const
 {
     META_FUNCTION_TASK();
     Rhi::ProgramArgumentAccessMask apply_access_mask;
@@ -147,8 +149,8 @@ void ProgramBindings::Apply(ICommandList& command_list, const Base::ProgramBindi
     }
 
     // Apply root parameter bindings after resource barriers
-    ApplyRootParameterBindings(apply_access_mask, command_list, applied_program_bindings_ptr,
-                               apply_behavior.HasAnyBit(ApplyBehavior::ChangesOnly));
+    return ApplyRootParameterBindings(apply_access_mask, command_list, applied_program_bindings_ptr,
+                                      apply_behavior.HasAnyBit(ApplyBehavior::ChangesOnly));
 }
 
 template<typename FuncType>
@@ -303,8 +305,8 @@ void ProgramBindings::AddRootParameterBindingsForArgument(ArgumentBinding& argum
     }
 }
 
-void ProgramBindings::ApplyRootParameterBindings(Rhi::ProgramArgumentAccessMask access, const ICommandList& command_list,
-                                                 const Base::ProgramBindings* applied_program_bindings_ptr, bool apply_changes_only) const
+uint32_t ProgramBindings::ApplyRootParameterBindings(Rhi::ProgramArgumentAccessMask access, const ICommandList& command_list,
+                                                     const Base::ProgramBindings* applied_program_bindings_ptr, bool apply_changes_only) const
 {
     META_FUNCTION_TASK();
     ID3D12GraphicsCommandList& d3d12_command_list = command_list.GetNativeCommandList();
@@ -312,25 +314,24 @@ void ProgramBindings::ApplyRootParameterBindings(Rhi::ProgramArgumentAccessMask
            command_list_type)
     {
     case Rhi::CommandListType::Render:
-        ApplyRootParameterBindings<Rhi::CommandListType::Render>(access, d3d12_command_list, applied_program_bindings_ptr, apply_changes_only);
-        break;
+        return ApplyRootParameterBindings<Rhi::CommandListType::Render>(access, d3d12_command_list, applied_program_bindings_ptr, apply_changes_only);
 
     case Rhi::CommandListType::Compute:
-        ApplyRootParameterBindings<Rhi::CommandListType::Compute>(access, d3d12_command_list, applied_program_bindings_ptr, apply_changes_only);
-        break;
+        return ApplyRootParameterBindings<Rhi::CommandListType::Compute>(access, d3d12_command_list, applied_program_bindings_ptr, apply_changes_only);
 
     default:
-        META_UNEXPECTED_ARG(command_list_type);
+        META_UNEXPECTED_ARG_RETURN(command_list_type, 0U);
     }
 }
 
 template<Rhi::CommandListType command_list_type>
-void ProgramBindings::ApplyRootParameterBindings(Rhi::ProgramArgumentAccessMask access, ID3D12GraphicsCommandList& d3d12_command_list,
-                                                 const Base::ProgramBindings* applied_program_bindings_ptr, bool apply_changes_only) const
+uint32_t ProgramBindings::ApplyRootParameterBindings(Rhi::ProgramArgumentAccessMask access, ID3D12GraphicsCommandList& d3d12_command_list,
+                                                     const Base::ProgramBindings* applied_program_bindings_ptr, bool apply_changes_only) const
 {
     META_FUNCTION_TASK();
+    uint32_t applied_root_parameters_count = 0U;
     Data::ForEachBitInEnumMask(access,
-        [this, &d3d12_command_list, applied_program_bindings_ptr, apply_changes_only](Rhi::ProgramArgumentAccessType access_type)
+        [this, &d3d12_command_list, applied_program_bindings_ptr, apply_changes_only, &applied_root_parameters_count](Rhi::ProgramArgumentAccessType access_type)
         {
            const bool do_program_bindings_comparing = access_type == Rhi::ProgramArgumentAccessType::Mutable && apply_changes_only && applied_program_bindings_ptr;
            const RootParameterBindings& root_parameter_bindings = m_root_parameter_bindings_by_access[magic_enum::enum_index(access_type).value()];
@@ -341,8 +342,10 @@ void ProgramBindings::ApplyRootParameterBindings(Rhi::ProgramArgumentAccessMask
                    continue;
 
                root_parameter_binding.Apply<command_list_type>(d3d12_command_list);
+               applied_root_parameters_count++;
            }
         });
+    return applied_root_parameters_count;
 }
 
 template<Rhi::CommandListType command_list_type>
@@ -193,15 +193,8 @@ void RenderCommandList::DrawIndexed(Primitive primitive, uint32_t index_count, u
 
     Base::RenderCommandList::DrawIndexed(primitive, index_count, start_index, start_vertex, instance_count, start_instance);
 
-    ID3D12GraphicsCommandList& dx_command_list = GetNativeCommandListRef();
-    if (drawing_state.changes.HasAnyBit(DrawingState::Change::PrimitiveType))
-    {
-        const D3D12_PRIMITIVE_TOPOLOGY primitive_topology = PrimitiveToDXTopology(primitive);
-        dx_command_list.IASetPrimitiveTopology(primitive_topology);
-        drawing_state.changes.SetBitOff(DrawingState::Change::PrimitiveType);
-    }
-
-    dx_command_list.DrawIndexedInstanced(index_count, instance_count, start_index, start_vertex, start_instance);
+    UpdatePrimitiveTopology(primitive);
+    GetNativeCommandListRef().DrawIndexedInstanced(index_count, instance_count, start_index, start_vertex, start_instance);
 }
 
 void RenderCommandList::Draw(Primitive primitive, uint32_t vertex_count, uint32_t start_vertex,
@@ -210,15 +203,28 @@ void RenderCommandList::Draw(Primitive primitive, uint32_t vertex_count, uint32_
     META_FUNCTION_TASK();
     Base::RenderCommandList::Draw(primitive, vertex_count, start_vertex, instance_count, start_instance);
 
-    ID3D12GraphicsCommandList& dx_command_list = GetNativeCommandListRef();
-    if (DrawingState& drawing_state = GetDrawingState();
-        drawing_state.changes.HasAnyBit(DrawingState::Change::PrimitiveType))
-    {
-        const D3D12_PRIMITIVE_TOPOLOGY primitive_topology = PrimitiveToDXTopology(primitive);
-        dx_command_list.IASetPrimitiveTopology(primitive_topology);
-        drawing_state.changes.SetBitOff(DrawingState::Change::PrimitiveType);
-    }
-    dx_command_list.DrawInstanced(vertex_count, instance_count, start_vertex, start_instance);
+    UpdatePrimitiveTopology(primitive);
+    GetNativeCommandListRef().DrawInstanced(vertex_count, instance_count, start_vertex, start_instance);
+}
+
+void RenderCommandList::DrawIndexedIndirect(Primitive primitive, Rhi::IBuffer& args_buffer, Data::Size args_offset, uint32_t draw_count,
+                                            Rhi::IBuffer* count_buffer_ptr, Data::Size count_offset)
+{
+    META_FUNCTION_TASK();
+    Base::RenderCommandList::DrawIndexedIndirect(primitive, args_buffer, args_offset, draw_count, count_buffer_ptr, count_offset);
+
+    UpdatePrimitiveTopology(primitive);
+    ExecuteIndirect(D3D12_INDIRECT_ARGUMENT_TYPE_DRAW_INDEXED, args_buffer, args_offset, draw_count, count_buffer_ptr, count_offset);
+}
+
+void RenderCommandList::DrawIndirect(Primitive primitive, Rhi::IBuffer& args_buffer, Data::Size args_offset, uint32_t draw_count,
+                                     Rhi::IBuffer* count_buffer_ptr, Data::Size count_offset)
+{
+    META_FUNCTION_TASK();
+    Base::RenderCommandList::DrawIndirect(primitive, args_buffer, args_offset, draw_count, count_buffer_ptr, count_offset);
+
+    UpdatePrimitiveTopology(primitive);
+    ExecuteIndirect(D3D12_INDIRECT_ARGUMENT_TYPE_DRAW, args_buffer, args_offset, draw_count, count_buffer_ptr, count_offset);
 }
 
 void RenderCommandList::Commit()
@@ -239,6 +245,42 @@ void RenderCommandList::Commit()
     CommandList<Base::RenderCommandList>::Commit();
 }
 
+void RenderCommandList::UpdatePrimitiveTopology(Primitive primitive)
+{
+    META_FUNCTION_TASK();
+    if (DrawingState& drawing_state = GetDrawingState();
+        drawing_state.changes.HasAnyBit(DrawingState::Change::PrimitiveType))
+    {
+        const D3D12_PRIMITIVE_TOPOLOGY primitive_topology = PrimitiveToDXTopology(primitive);
+        GetNativeCommandListRef().IASetPrimitiveTopology(primitive_topology);
+        drawing_state.changes.SetBitOff(DrawingState::Change::PrimitiveType);
+    }
+}
+
+void RenderCommandList::ExecuteIndirect(D3D12_INDIRECT_ARGUMENT_TYPE argument_type, Rhi::IBuffer& args_buffer, Data::Size args_offset, uint32_t draw_count,
+                                        Rhi::IBuffer* count_buffer_ptr, Data::Size count_offset)
+{
+    META_FUNCTION_TASK();
+    auto& dx_args_buffer      = static_cast<Buffer&>(args_buffer);
+    auto* dx_count_buffer_ptr = static_cast<Buffer*>(count_buffer_ptr);
+    for(Buffer* dx_buffer_ptr : { &dx_args_buffer, dx_count_buffer_ptr })
+    {
+        if (!dx_buffer_ptr)
+            continue;
+
+        if (Ptr<Rhi::IResourceBarriers>& buffer_setup_barriers_ptr = dx_buffer_ptr->GetSetupTransitionBarriers();
+            dx_buffer_ptr->SetState(Rhi::ResourceState::IndirectArgument, buffer_setup_barriers_ptr) && buffer_setup_barriers_ptr)
+        {
+            SetResourceBarriers(*buffer_setup_barriers_ptr);
+        }
+    }
+
+    ID3D12CommandSignature& dx_command_signature = GetDirectCommandQueue().GetDirectContext().GetDirectDevice().GetNativeIndirectCommandSignature(argument_type);
+    GetNativeCommandListRef().ExecuteIndirect(&dx_command_signature, draw_count,
+                                              dx_args_buffer.GetNativeResource(), args_offset,
+                                              dx_count_buffer_ptr ? dx_count_buffer_ptr->GetNativeResource() : nullptr, count_offset);
+}
+
 RenderPass& RenderCommandList::GetDirectPass()
 {
     META_FUNCTION_TASK();
@@ -22,10 +22,16 @@ DirectX 12 implementation of the transfer command list interface.
 ******************************************************************************/
 
 #include <Methane/Graphics/DirectX/TransferCommandList.h>
+#include <Methane/Graphics/DirectX/Buffer.h>
+#include <Methane/Graphics/DirectX/Texture.h>
+#include <Methane/Graphics/DirectX/Types.h>
 
 #include <Methane/Graphics/Base/Context.h>
 #include <Methane/Graphics/Base/CommandQueue.h>
 #include <Methane/Instrumentation.h>
+#include <Methane/Checks.hpp>
+
+#include <directx/d3dx12_core.h>
 
 namespace Methane::Graphics::DirectX
 {
@@ -38,8 +44,91 @@ static D3D12_COMMAND_LIST_TYPE GetTransferCommandListNativeType(Rhi::ContextOpti
          : D3D12_COMMAND_LIST_TYPE_COPY;
 }
 
+static CD3DX12_TEXTURE_COPY_LOCATION GetTextureCopyLocation(const Texture& texture, const Rhi::SubResource::Index& subresource_index)
+{
+    META_FUNCTION_TASK();
+    return CD3DX12_TEXTURE_COPY_LOCATION(texture.GetNativeResource(), subresource_index.GetRawIndex(texture.GetSubresourceCount()));
+}
+
+static CD3DX12_TEXTURE_COPY_LOCATION GetBufferCopyLocation(const Buffer& buffer, Data::Size buffer_offset,
+                                                           const Texture& texture, const Rhi::TextureCopyRegion& resolved_region)
+{
+    META_FUNCTION_TASK();
+    // Tightly packed texture data in buffer has to satisfy DirectX placed footprint alignment requirements
+    const uint32_t row_pitch = resolved_region.rect.size.GetWidth() * GetPixelSize(texture.GetSettings().pixel_format);
+    META_CHECK_ARG_DESCR(row_pitch, !(row_pitch % D3D12_TEXTURE_DATA_PITCH_ALIGNMENT),
+                         "texture copy region row size must be aligned to {} bytes in DirectX", D3D12_TEXTURE_DATA_PITCH_ALIGNMENT);
+    META_CHECK_ARG_DESCR(buffer_offset, !(buffer_offset % D3D12_TEXTURE_DATA_PLACEMENT_ALIGNMENT),
+                         "texture data offset in buffer must be aligned to {} bytes in DirectX", D3D12_TEXTURE_DATA_PLACEMENT_ALIGNMENT);
+
+    D3D12_PLACED_SUBRESOURCE_FOOTPRINT placed_footprint{};
+    placed_footprint.Offset    = buffer_offset;
+    placed_footprint.Footprint = CD3DX12_SUBRESOURCE_FOOTPRINT(
+        TypeConverter::PixelFormatToDxgi(texture.GetSettings().pixel_format),
+        resolved_region.rect.size.GetWidth(), resolved_region.rect.size.GetHeight(), 1U, row_pitch
+    );
+    return CD3DX12_TEXTURE_COPY_LOCATION(buffer.GetNativeResource(), placed_footprint);
+}
+
+static CD3DX12_BOX GetTextureCopyBox(const Rhi::TextureCopyRegion& resolved_region)
+{
+    return CD3DX12_BOX(
+        static_cast<LONG>(resolved_region.rect.GetLeft()), static_cast<LONG>(resolved_region.rect.GetTop()),
+        static_cast<LONG>(resolved_region.rect.GetRight()), static_cast<LONG>(resolved_region.rect.GetBottom())
+    );
+}
+
 TransferCommandList::TransferCommandList(Base::CommandQueue& cmd_queue)
-    : CommandList<Base::CommandList>(GetTransferCommandListNativeType(cmd_queue.GetContext().GetOptions()), cmd_queue, Type::Transfer)
+    : CommandList<Base::TransferCommandList>(GetTransferCommandListNativeType(cmd_queue.GetContext().GetOptions()), cmd_queue)
 { }
 
+void TransferCommandList::CopyBuffer(Rhi::IBuffer& src_buffer, Rhi::IBuffer& dst_buffer, const Rhi::BufferCopyRegion& copy_region)
+{
+    META_FUNCTION_TASK();
+    Base::TransferCommandList::CopyBuffer(src_buffer, dst_buffer, copy_region);
+
+    GetNativeCommandList().CopyBufferRegion(static_cast<const Buffer&>(dst_buffer).GetNativeResource(), copy_region.dst_offset,
+                                            static_cast<const Buffer&>(src_buffer).GetNativeResource(), copy_region.src_offset,
+                                            copy_region.size);
+}
+
+void TransferCommandList::CopyBufferToTexture(Rhi::IBuffer& src_buffer, Data::Size src_offset, Rhi::ITexture& dst_texture, const Rhi::TextureCopyRegion& dst_region)
+{
+    META_FUNCTION_TASK();
+    Base::TransferCommandList::CopyBufferToTexture(src_buffer, src_offset, dst_texture, dst_region);
+
+    const auto& dx_dst_texture = static_cast<const Texture&>(dst_texture);
+    const Rhi::TextureCopyRegion resolved_dst_region = GetResolvedCopyRegion(dx_dst_texture, dst_region);
+    const CD3DX12_TEXTURE_COPY_LOCATION dst_location = GetTextureCopyLocation(dx_dst_texture, resolved_dst_region.subresource_index);
+    const CD3DX12_TEXTURE_COPY_LOCATION src_location = GetBufferCopyLocation(static_cast<const Buffer&>(src_buffer), src_offset, dx_dst_texture, resolved_dst_region);
+    GetNativeCommandList().CopyTextureRegion(&dst_location, resolved_dst_region.rect.GetLeft(), resolved_dst_region.rect.GetTop(), 0U, &src_location, nullptr);
+}
+
+void TransferCommandList::CopyTextureToBuffer(Rhi::ITexture& src_texture, const Rhi::TextureCopyRegion& src_region, Rhi::IBuffer& dst_buffer, Data::Size dst_offset)
+{
+    META_FUNCTION_TASK();
+    Base::TransferCommandList::CopyTextureToBuffer(src_texture, src_region, dst_buffer, dst_offset);
+
+    const auto& dx_src_texture = static_cast<const Texture&>(src_texture);
+    const Rhi::TextureCopyRegion resolved_src_region = GetResolvedCopyRegion(dx_src_texture, src_region);
+    const CD3DX12_TEXTURE_COPY_LOCATION src_location = GetTextureCopyLocation(dx_src_texture, resolved_src_region.subresource_index);
+    const CD3DX12_TEXTURE_COPY_LOCATION dst_location = GetBufferCopyLocation(static_cast<const Buffer&>(dst_buffer), dst_offset, dx_src_texture, resolved_src_region);
+    const CD3DX12_BOX src_box = GetTextureCopyBox(resolved_src_region);
+    GetNativeCommandList().CopyTextureRegion(&dst_location, 0U, 0U, 0U, &src_location, &src_box);
+}
+
+void TransferCommandList::CopyTexture(Rhi::ITexture& src_texture, const Rhi::TextureCopyRegion& src_region, Rhi::ITexture& dst_texture, const Rhi::TextureCopyRegion& dst_region)
+{
+    META_FUNCTION_TASK();
+    Base::TransferCommandList::CopyTexture(src_texture, src_region, dst_texture, dst_region);
+
+    const auto& dx_src_texture = static_cast<const Texture&>(src_texture);
+    const auto& dx_dst_texture = static_cast<const Texture&>(dst_texture);
+    const Rhi::TextureCopyRegion resolved_src_region = GetResolvedCopyRegion(dx_src_texture, src_region);
+    const CD3DX12_TEXTURE_COPY_LOCATION src_location = GetTextureCopyLocation(dx_src_texture, resolved_src_region.subresource_index);
+    const CD3DX12_TEXTURE_COPY_LOCATION dst_location = GetTextureCopyLocation(dx_dst_texture, dst_region.subresource_index);
+    const CD3DX12_BOX src_box = GetTextureCopyBox(resolved_src_region);
+    GetNativeCommandList().CopyTextureRegion(&dst_location, dst_region.rect.GetLeft(), dst_region.rect.GetTop(), 0U, &src_location, &src_box);
+}
+
 } // namespace Methane::Graphics::DirectX
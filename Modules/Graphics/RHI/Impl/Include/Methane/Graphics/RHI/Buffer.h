@@ -54,6 +54,7 @@ public:
     using Type            = BufferType;
     using StorageMode     = BufferStorageMode;
     using Settings        = BufferSettings;
+    using MappedSpan      = BufferMappedSpan;
 
     using Descriptor         = DirectX::ResourceDescriptor;
     using DescriptorByViewId = std::map<ResourceView::Id, Descriptor>;
@@ -101,8 +102,10 @@ public:
     // IBuffer interface methods
     [[nodiscard]] META_PIMPL_API const Settings& GetSettings() const META_PIMPL_NOEXCEPT;
     [[nodiscard]] META_PIMPL_API uint32_t GetFormattedItemsCount() const META_PIMPL_NOEXCEPT;
+    [[nodiscard]] META_PIMPL_API MappedSpan GetMappedSpan() const META_PIMPL_NOEXCEPT;
     [[nodiscard]] META_PIMPL_API SubResource GetData(const Rhi::CommandQueue& target_cmd_queue, const BytesRangeOpt& data_range = {}) const;
     META_PIMPL_API void SetData(const CommandQueue& target_cmd_queue, const SubResource& sub_resource) const;
+    META_PIMPL_API void SetData(const CommandQueue& target_cmd_queue, Data::Size data_offset, const Data::Chunk& data) const;
     
 private:
     using Impl = Methane::Graphics::META_GFX_NAME::Buffer;
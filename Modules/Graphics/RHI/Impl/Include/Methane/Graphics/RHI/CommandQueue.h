@@ -27,6 +27,8 @@ Methane CommandQueue PIMPL wrappers for direct calls to final implementation.
 
 #include <Methane/Graphics/RHI/ICommandQueue.h>
 
+#include <vector>
+
 namespace Methane::Graphics::META_GFX_NAME
 {
 class CommandQueue;
@@ -81,6 +83,10 @@ public:
     [[nodiscard]] META_PIMPL_API uint32_t                        GetFamilyIndex() const META_PIMPL_NOEXCEPT;
     [[nodiscard]] META_PIMPL_API const Ptr<ITimestampQueryPool>& GetTimestampQueryPoolPtr();
     META_PIMPL_API void Execute(const CommandListSet& command_lists, const ICommandList::CompletedCallback& completed_callback = {}) const;
+    META_PIMPL_API void ExecuteBatch(const std::vector<CommandListSet>& command_list_sets, const ICommandList::CompletedCallback& completed_callback = {}) const;
+    META_PIMPL_API void SetDeferredExecution(bool is_deferred_execution) const;
+    META_PIMPL_API bool IsDeferredExecution() const META_PIMPL_NOEXCEPT;
+    META_PIMPL_API void ExecuteDeferred() const;
 
 private:
     using Impl = Methane::Graphics::META_GFX_NAME::CommandQueue;
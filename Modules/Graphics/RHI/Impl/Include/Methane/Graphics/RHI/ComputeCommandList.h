@@ -39,6 +39,7 @@ class CommandQueue;
 class CommandListDebugGroup;
 class ComputeState;
 class ProgramBindings;
+class Buffer;
 
 class ComputeCommandList // NOSONAR - constructors and assignment operators are required to use forward declared Impl and Ptr<Impl> in header
 {
@@ -78,6 +79,7 @@ public:
     META_PIMPL_API void  Commit() const;
     META_PIMPL_API void  WaitUntilCompleted(uint32_t timeout_ms = 0U) const;
     [[nodiscard]] META_PIMPL_API Data::TimeRange GetGpuTimeRange(bool in_cpu_nanoseconds) const;
+    [[nodiscard]] META_PIMPL_API CommandListStatistics GetStatistics() const META_PIMPL_NOEXCEPT;
     [[nodiscard]] META_PIMPL_API State GetState() const META_PIMPL_NOEXCEPT;
     [[nodiscard]] META_PIMPL_API CommandQueue GetCommandQueue() const;
 
@@ -90,6 +92,7 @@ public:
     META_PIMPL_API void ResetWithStateOnce(const ComputeState& compute_state, const DebugGroup* debug_group_ptr = nullptr) const;
     META_PIMPL_API void SetComputeState(const ComputeState& compute_state) const;
     META_PIMPL_API void Dispatch(const ThreadGroupsCount& thread_groups_count) const;
+    META_PIMPL_API void DispatchIndirect(const Buffer& args_buffer, Data::Size args_offset = 0U) const;
 
 private:
     using Impl = Methane::Graphics::META_GFX_NAME::ComputeCommandList;
@@ -109,6 +109,7 @@ public:
     [[nodiscard]] META_PIMPL_API CommandKit GetDefaultCommandKit(const CommandQueue& cmd_queue) const;
     [[nodiscard]] META_PIMPL_API CommandKit GetUploadCommandKit() const;
     [[nodiscard]] META_PIMPL_API CommandKit GetComputeCommandKit() const;
+    [[nodiscard]] META_PIMPL_API DescriptorStatistics GetDescriptorStatistics() const;
 
     // Data::IEmitter<IContextCallback> interface methods
     META_PIMPL_API void Connect(Data::Receiver<IContextCallback>& receiver) const;
@@ -116,6 +117,7 @@ public:
 
     // IComputeContext interface methods
     [[nodiscard]] META_PIMPL_API const Settings& GetSettings() const META_PIMPL_NOEXCEPT;
+    [[nodiscard]] META_PIMPL_API CommandListStatistics GetComputeStatistics() const;
 
 private:
     using Impl = Methane::Graphics::META_GFX_NAME::ComputeContext;
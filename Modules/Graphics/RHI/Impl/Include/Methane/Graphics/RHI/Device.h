@@ -45,7 +45,8 @@ class Device // NOSONAR - constructors and assignment operators are required to
 public:
     using FeatureMask  = DeviceFeatureMask;
     using Feature      = DeviceFeature;
-    using Capabilities = DeviceCaps;
+    using Capabilities     = DeviceCaps;
+    using MemoryStatistics = DeviceMemoryStatistics;
 
     META_PIMPL_METHODS_DECLARE(Device);
     META_PIMPL_METHODS_COMPARE_DECLARE(Device);
@@ -67,7 +68,11 @@ public:
     [[nodiscard]] META_PIMPL_API const std::string&  GetAdapterName() const META_PIMPL_NOEXCEPT;
     [[nodiscard]] META_PIMPL_API bool                IsSoftwareAdapter() const META_PIMPL_NOEXCEPT;
     [[nodiscard]] META_PIMPL_API const Capabilities& GetCapabilities() const META_PIMPL_NOEXCEPT;
+    [[nodiscard]] META_PIMPL_API MemoryStatistics    GetMemoryStatistics() const;
     [[nodiscard]] META_PIMPL_API std::string         ToString() const;
+    [[nodiscard]] META_PIMPL_API const std::string&  GetPipelineCachePath() const META_PIMPL_NOEXCEPT;
+    META_PIMPL_API void SetPipelineCachePath(const std::string& pipeline_cache_path) const;
+    META_PIMPL_API bool FlushPipelineCache() const;
 
     // Data::IEmitter<IDeviceCallback> interface methods
     META_PIMPL_API void Connect(Data::Receiver<IDeviceCallback>& receiver) const;
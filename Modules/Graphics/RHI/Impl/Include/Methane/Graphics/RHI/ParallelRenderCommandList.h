@@ -82,6 +82,7 @@ public:
     META_PIMPL_API void  Commit() const;
     META_PIMPL_API void  WaitUntilCompleted(uint32_t timeout_ms = 0U) const;
     [[nodiscard]] META_PIMPL_API Data::TimeRange GetGpuTimeRange(bool in_cpu_nanoseconds) const;
+    [[nodiscard]] META_PIMPL_API CommandListStatistics GetStatistics() const META_PIMPL_NOEXCEPT;
     [[nodiscard]] META_PIMPL_API State GetState() const META_PIMPL_NOEXCEPT;
     [[nodiscard]] META_PIMPL_API CommandQueue GetCommandQueue() const;
 
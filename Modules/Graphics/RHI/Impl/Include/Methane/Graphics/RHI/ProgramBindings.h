@@ -69,6 +69,8 @@ public:
     META_PIMPL_API void Disconnect(Data::Receiver<IObjectCallback>& receiver) const;
 
     // IProgramBindings interface methods
+    [[nodiscard]] META_PIMPL_API ProgramBindings         CreateTransientCopy(const ResourceViewsByArgument& replace_resource_views_by_argument = {},
+                                                                             const Opt<Data::Index>& frame_index = {}) const;
     [[nodiscard]] META_PIMPL_API Program                 GetProgram() const;
     [[nodiscard]] META_PIMPL_API IArgumentBinding&       Get(const ProgramArgument& shader_argument) const;
     [[nodiscard]] META_PIMPL_API const ProgramArguments& GetArguments() const META_PIMPL_NOEXCEPT;
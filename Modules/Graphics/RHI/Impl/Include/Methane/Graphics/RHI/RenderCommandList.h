@@ -84,6 +84,7 @@ public:
     META_PIMPL_API void  Commit() const;
     META_PIMPL_API void  WaitUntilCompleted(uint32_t timeout_ms = 0U) const;
     [[nodiscard]] META_PIMPL_API Data::TimeRange GetGpuTimeRange(bool in_cpu_nanoseconds) const;
+    [[nodiscard]] META_PIMPL_API CommandListStatistics GetStatistics() const META_PIMPL_NOEXCEPT;
     [[nodiscard]] META_PIMPL_API State GetState() const META_PIMPL_NOEXCEPT;
     [[nodiscard]] META_PIMPL_API CommandQueue GetCommandQueue() const;
 
@@ -105,6 +106,10 @@ public:
                                     uint32_t instance_count = 1U, uint32_t start_instance = 0U) const;
     META_PIMPL_API void Draw(Primitive primitive, uint32_t vertex_count, uint32_t start_vertex = 0U,
                              uint32_t instance_count = 1U, uint32_t start_instance = 0U) const;
+    META_PIMPL_API void DrawIndexedIndirect(Primitive primitive, const Buffer& args_buffer, Data::Size args_offset = 0U, uint32_t draw_count = 1U,
+                                            const Buffer* count_buffer_ptr = nullptr, Data::Size count_offset = 0U) const;
+    META_PIMPL_API void DrawIndirect(Primitive primitive, const Buffer& args_buffer, Data::Size args_offset = 0U, uint32_t draw_count = 1U,
+                                     const Buffer* count_buffer_ptr = nullptr, Data::Size count_offset = 0U) const;
 
 private:
     using Impl = Methane::Graphics::META_GFX_NAME::RenderCommandList;
@@ -115,6 +115,7 @@ public:
     [[nodiscard]] META_PIMPL_API CommandKit GetDefaultCommandKit(const CommandQueue& cmd_queue) const;
     [[nodiscard]] META_PIMPL_API CommandKit GetUploadCommandKit() const;
     [[nodiscard]] META_PIMPL_API CommandKit GetRenderCommandKit() const;
+    [[nodiscard]] META_PIMPL_API DescriptorStatistics GetDescriptorStatistics() const;
 
     // Data::IEmitter<IContextCallback> interface methods
     META_PIMPL_API void Connect(Data::Receiver<IContextCallback>& receiver) const;
@@ -129,6 +130,7 @@ public:
     [[nodiscard]] META_PIMPL_API uint32_t          GetFrameBufferIndex() const META_PIMPL_NOEXCEPT;
     [[nodiscard]] META_PIMPL_API uint32_t          GetFrameIndex() const META_PIMPL_NOEXCEPT;
     [[nodiscard]] META_PIMPL_API const Data::IFpsCounter& GetFpsCounter() const META_PIMPL_NOEXCEPT;
+    [[nodiscard]] META_PIMPL_API CommandListStatistics    GetFrameStatistics() const;
     META_PIMPL_API bool SetVSyncEnabled(bool vsync_enabled) const;
     META_PIMPL_API bool SetFrameBuffersCount(uint32_t frame_buffers_count) const;
     META_PIMPL_API bool SetFullScreen(bool is_full_screen) const;
@@ -27,6 +27,7 @@ Methane RenderState PIMPL wrappers for direct calls to final implementation.
 #include "Program.h"
 #include "RenderPass.h"
 #include "RenderPattern.h"
+#include "ViewState.h"
 
 #include <Methane/Graphics/RHI/IRenderState.h>
 
@@ -87,6 +88,7 @@ public:
     [[nodiscard]] META_PIMPL_API const RenderStateSettings& GetSettings() const META_PIMPL_NOEXCEPT;
     META_PIMPL_API void Reset(const Settings& settings) const;
     META_PIMPL_API void Reset(const IRenderState::Settings& settings) const;
+    META_PIMPL_API void PrewarmPipelines(const std::vector<ViewState>& view_states, const std::vector<RenderPrimitive>& primitives) const;
 
     META_PIMPL_API Program       GetProgram() const;
     META_PIMPL_API RenderPattern GetRenderPattern() const;
@@ -37,6 +37,8 @@ namespace Methane::Graphics::Rhi
 
 class CommandQueue;
 class CommandListDebugGroup;
+class Buffer;
+class Texture;
 
 class TransferCommandList // NOSONAR - constructors and assignment operators are required to use forward declared Impl and Ptr<Impl> in header
 {
@@ -74,6 +76,7 @@ public:
     META_PIMPL_API void  Commit() const;
     META_PIMPL_API void  WaitUntilCompleted(uint32_t timeout_ms = 0U) const;
     [[nodiscard]] META_PIMPL_API Data::TimeRange GetGpuTimeRange(bool in_cpu_nanoseconds) const;
+    [[nodiscard]] META_PIMPL_API CommandListStatistics GetStatistics() const META_PIMPL_NOEXCEPT;
     [[nodiscard]] META_PIMPL_API State GetState() const META_PIMPL_NOEXCEPT;
     [[nodiscard]] META_PIMPL_API CommandQueue GetCommandQueue() const;
 
@@ -81,6 +84,13 @@ public:
     META_PIMPL_API void Connect(Data::Receiver<ICommandListCallback>& receiver) const;
     META_PIMPL_API void Disconnect(Data::Receiver<ICommandListCallback>& receiver) const;
 
+    // ITransferCommandList interface methods
+    META_PIMPL_API void CopyBuffer(const Buffer& src_buffer, const Buffer& dst_buffer, const BufferCopyRegion& copy_region) const;
+    META_PIMPL_API void CopyBufferToTexture(const Buffer& src_buffer, Data::Size src_offset, const Texture& dst_texture, const TextureCopyRegion& dst_region) const;
+    META_PIMPL_API void CopyTextureToBuffer(const Texture& src_texture, const TextureCopyRegion& src_region, const Buffer& dst_buffer, Data::Size dst_offset) const;
+    META_PIMPL_API void CopyTexture(const Texture& src_texture, const TextureCopyRegion& src_region, const Texture& dst_texture, const TextureCopyRegion& dst_region) const;
+    META_PIMPL_API void GenerateMipmaps(const Texture& texture) const;
+
 private:
     using Impl = Methane::Graphics::META_GFX_NAME::TransferCommandList;
 
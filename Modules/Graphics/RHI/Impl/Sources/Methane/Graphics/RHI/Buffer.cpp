@@ -138,11 +138,23 @@ void Buffer::SetData(const CommandQueue& target_cmd_queue, const SubResource& su
     GetImpl(m_impl_ptr).SetData(target_cmd_queue.GetInterface(), sub_resource);
 }
 
+void Buffer::SetData(const CommandQueue& target_cmd_queue, Data::Size data_offset, const Data::Chunk& data) const
+{
+    GetImpl(m_impl_ptr).SetData(target_cmd_queue.GetInterface(),
+                                SubResource(data.GetDataPtr(), data.GetDataSize(), SubResource::Index(),
+                                            BytesRange(data_offset, data_offset + data.GetDataSize())));
+}
+
 void Buffer::RestoreDescriptorViews(const DescriptorByViewId& descriptor_by_view_id) const
 {
     GetImpl(m_impl_ptr).RestoreDescriptorViews(descriptor_by_view_id);
 }
 
+Buffer::MappedSpan Buffer::GetMappedSpan() const META_PIMPL_NOEXCEPT
+{
+    return GetImpl(m_impl_ptr).GetMappedSpan();
+}
+
 SubResource Buffer::GetData(const Rhi::CommandQueue& target_cmd_queue, const BytesRangeOpt& data_range) const
 {
     return GetImpl(m_impl_ptr).GetData(target_cmd_queue.GetInterface(), data_range);
@@ -157,4 +157,30 @@ void CommandQueue::Execute(const CommandListSet& command_lists, const ICommandLi
     return GetImpl(m_impl_ptr).Execute(command_lists.GetInterface(), completed_callback);
 }
 
+void CommandQueue::ExecuteBatch(const std::vector<CommandListSet>& command_list_sets, const ICommandList::CompletedCallback& completed_callback) const
+{
+    Refs<ICommandListSet> command_list_set_refs;
+    command_list_set_refs.reserve(command_list_sets.size());
+    for(const CommandListSet& command_list_set : command_list_sets)
+    {
+        command_list_set_refs.emplace_back(command_list_set.GetInterface());
+    }
+    GetImpl(m_impl_ptr).ExecuteBatch(command_list_set_refs, completed_callback);
+}
+
+void CommandQueue::SetDeferredExecution(bool is_deferred_execution) const
+{
+    GetImpl(m_impl_ptr).SetDeferredExecution(is_deferred_execution);
+}
+
+bool CommandQueue::IsDeferredExecution() const META_PIMPL_NOEXCEPT
+{
+    return GetImpl(m_impl_ptr).IsDeferredExecution();
+}
+
+void CommandQueue::ExecuteDeferred() const
+{
+    GetImpl(m_impl_ptr).ExecuteDeferred();
+}
+
 } // namespace Methane::Graphics::Rhi
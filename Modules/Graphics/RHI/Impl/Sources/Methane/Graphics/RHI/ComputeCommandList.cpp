@@ -26,6 +26,7 @@ Methane ComputeCommandList PIMPL wrappers for direct calls to final implementati
 #include <Methane/Graphics/RHI/CommandListDebugGroup.h>
 #include <Methane/Graphics/RHI/CommandQueue.h>
 #include <Methane/Graphics/RHI/ProgramBindings.h>
+#include <Methane/Graphics/RHI/Buffer.h>
 
 #include <Methane/Pimpl.hpp>
 
@@ -136,6 +137,11 @@ Data::TimeRange ComputeCommandList::GetGpuTimeRange(bool in_cpu_nanoseconds) con
     return GetImpl(m_impl_ptr).GetGpuTimeRange(in_cpu_nanoseconds);
 }
 
+CommandListStatistics ComputeCommandList::GetStatistics() const META_PIMPL_NOEXCEPT
+{
+    return GetImpl(m_impl_ptr).GetStatistics();
+}
+
 CommandListState ComputeCommandList::GetState() const META_PIMPL_NOEXCEPT
 {
     return GetImpl(m_impl_ptr).GetState();
@@ -178,4 +184,9 @@ void ComputeCommandList::Dispatch(const ThreadGroupsCount& thread_groups_count)
     GetImpl(m_impl_ptr).Dispatch(thread_groups_count);
 }
 
+void ComputeCommandList::DispatchIndirect(const Buffer& args_buffer, Data::Size args_offset) const
+{
+    GetImpl(m_impl_ptr).DispatchIndirect(args_buffer.GetInterface(), args_offset);
+}
+
 } // namespace Methane::Graphics::Rhi
@@ -211,6 +211,11 @@ CommandKit ComputeContext::GetComputeCommandKit() const
     return CommandKit(GetImpl(m_impl_ptr).GetComputeCommandKit());
 }
 
+DescriptorStatistics ComputeContext::GetDescriptorStatistics() const
+{
+    return GetImpl(m_impl_ptr).GetDescriptorStatistics();
+}
+
 void ComputeContext::Connect(Data::Receiver<IContextCallback>& receiver) const
 {
     GetImpl(m_impl_ptr).Data::Emitter<IContextCallback>::Connect(receiver);
@@ -226,4 +231,9 @@ const ComputeContextSettings& ComputeContext::GetSettings() const META_PIMPL_NOE
     return GetImpl(m_impl_ptr).GetSettings();
 }
 
+CommandListStatistics ComputeContext::GetComputeStatistics() const
+{
+    return GetImpl(m_impl_ptr).GetComputeStatistics();
+}
+
 } // namespace Methane::Graphics::Rhi
@@ -97,11 +97,31 @@ const DeviceCaps& Device::GetCapabilities() const META_PIMPL_NOEXCEPT
     return GetImpl(m_impl_ptr).GetCapabilities();
 }
 
+DeviceMemoryStatistics Device::GetMemoryStatistics() const
+{
+    return GetImpl(m_impl_ptr).GetMemoryStatistics();
+}
+
 std::string Device::ToString() const
 {
     return GetImpl(m_impl_ptr).ToString();
 }
 
+const std::string& Device::GetPipelineCachePath() const META_PIMPL_NOEXCEPT
+{
+    return GetImpl(m_impl_ptr).GetPipelineCachePath();
+}
+
+void Device::SetPipelineCachePath(const std::string& pipeline_cache_path) const
+{
+    GetImpl(m_impl_ptr).SetPipelineCachePath(pipeline_cache_path);
+}
+
+bool Device::FlushPipelineCache() const
+{
+    return GetImpl(m_impl_ptr).FlushPipelineCache();
+}
+
 void Device::Connect(Data::Receiver<IDeviceCallback>& receiver) const
 {
     GetImpl(m_impl_ptr).Data::Emitter<IDeviceCallback>::Connect(receiver);
@@ -139,6 +139,11 @@ Data::TimeRange ParallelRenderCommandList::GetGpuTimeRange(bool in_cpu_nanosecon
     return GetImpl(m_impl_ptr).GetGpuTimeRange(in_cpu_nanoseconds);
 }
 
+CommandListStatistics ParallelRenderCommandList::GetStatistics() const META_PIMPL_NOEXCEPT
+{
+    return GetImpl(m_impl_ptr).GetStatistics();
+}
+
 CommandListState ParallelRenderCommandList::GetState() const META_PIMPL_NOEXCEPT
 {
     return GetImpl(m_impl_ptr).GetState();
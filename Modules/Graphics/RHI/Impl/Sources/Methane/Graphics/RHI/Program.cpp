@@ -35,6 +35,11 @@ Methane Program PIMPL wrappers for direct calls to final implementation.
 #include <Program.h>
 #endif
 
+#ifndef META_GFX_METAL
+#include <taskflow/taskflow.hpp>
+#include <taskflow/algorithm/for_each.hpp>
+#endif
+
 #include <algorithm>
 
 namespace Methane::Graphics::Rhi
@@ -45,9 +50,32 @@ ProgramSettings ProgramSettingsImpl::Convert(const IContext& context, const Prog
     META_FUNCTION_TASK();
 
     IProgram::Shaders shader_ptrs;
+#ifdef META_GFX_METAL
+    // Metal shaders are created sequentially, because they share library cache of the context
     std::transform(settings.shader_set.begin(), settings.shader_set.end(), std::back_inserter(shader_ptrs),
                    [&context](const std::pair<ShaderType, ShaderSettings>& shader_type_settings)
                    { return IShader::Create(shader_type_settings.first, context, shader_type_settings.second); });
+#else
+    // Shaders are created in parallel to overlap loading (and compilation) of their byte code
+    shader_ptrs.resize(settings.shader_set.size());
+    tf::Taskflow create_task_flow;
+    create_task_flow.for_each_index(size_t(0U), shader_ptrs.size(), size_t(1U),
+        [&context, &settings, &shader_ptrs](const size_t shader_index)
+        {
+            META_FUNCTION_TASK();
+            const auto& [shader_type, shader_settings] = *std::next(settings.shader_set.begin(), static_cast<std::ptrdiff_t>(shader_index));
+            shader_ptrs[shader_index] = IShader::Create(shader_type, context, shader_settings);
+        }
+    );
+
+    // Program may be created from a task running on the same executor (e.g. from parallel resources loading),
+    // so the calling worker co-runs the task flow instead of blocking on it, which could starve the executor
+    tf::Executor& parallel_executor = context.GetParallelExecutor();
+    if (parallel_executor.this_worker_id() >= 0)
+        parallel_executor.corun(create_task_flow);
+    else
+        parallel_executor.run(create_task_flow).get();
+#endif
 
     return ProgramSettings
     {
@@ -94,6 +94,11 @@ void ProgramBindings::Disconnect(Data::Receiver<IObjectCallback>& receiver) cons
     GetImpl(m_impl_ptr).Data::Emitter<IObjectCallback>::Disconnect(receiver);
 }
 
+ProgramBindings ProgramBindings::CreateTransientCopy(const ResourceViewsByArgument& replace_resource_views_by_argument, const Opt<Data::Index>& frame_index) const
+{
+    return ProgramBindings(GetImpl(m_impl_ptr).CreateTransientCopy(replace_resource_views_by_argument, frame_index));
+}
+
 Program ProgramBindings::GetProgram() const
 {
     return Program(GetImpl(m_impl_ptr).GetProgram());
@@ -141,6 +141,11 @@ Data::TimeRange RenderCommandList::GetGpuTimeRange(bool in_cpu_nanoseconds) cons
     return GetImpl(m_impl_ptr).GetGpuTimeRange(in_cpu_nanoseconds);
 }
 
+CommandListStatistics RenderCommandList::GetStatistics() const META_PIMPL_NOEXCEPT
+{
+    return GetImpl(m_impl_ptr).GetStatistics();
+}
+
 CommandListState RenderCommandList::GetState() const META_PIMPL_NOEXCEPT
 {
     return GetImpl(m_impl_ptr).GetState();
@@ -220,4 +225,18 @@ void RenderCommandList::Draw(Primitive primitive,
     GetImpl(m_impl_ptr).Draw(primitive, vertex_count, start_vertex, instance_count, start_instance);
 }
 
+void RenderCommandList::DrawIndexedIndirect(Primitive primitive, const Buffer& args_buffer, Data::Size args_offset, uint32_t draw_count,
+                                            const Buffer* count_buffer_ptr, Data::Size count_offset) const
+{
+    GetImpl(m_impl_ptr).DrawIndexedIndirect(primitive, args_buffer.GetInterface(), args_offset, draw_count,
+                                            count_buffer_ptr ? &count_buffer_ptr->GetInterface() : nullptr, count_offset);
+}
+
+void RenderCommandList::DrawIndirect(Primitive primitive, const Buffer& args_buffer, Data::Size args_offset, uint32_t draw_count,
+                                     const Buffer* count_buffer_ptr, Data::Size count_offset) const
+{
+    GetImpl(m_impl_ptr).DrawIndirect(primitive, args_buffer.GetInterface(), args_offset, draw_count,
+                                     count_buffer_ptr ? &count_buffer_ptr->GetInterface() : nullptr, count_offset);
+}
+
 } // namespace Methane::Graphics::Rhi
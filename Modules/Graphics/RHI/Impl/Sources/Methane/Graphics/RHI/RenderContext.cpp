@@ -223,6 +223,11 @@ CommandKit RenderContext::GetRenderCommandKit() const
     return CommandKit(GetImpl(m_impl_ptr).GetRenderCommandKit());
 }
 
+DescriptorStatistics RenderContext::GetDescriptorStatistics() const
+{
+    return GetImpl(m_impl_ptr).GetDescriptorStatistics();
+}
+
 void RenderContext::Connect(Data::Receiver<IContextCallback>& receiver) const
 {
     GetImpl(m_impl_ptr).Data::Emitter<IContextCallback>::Connect(receiver);
@@ -273,6 +278,11 @@ const Data::IFpsCounter& RenderContext::GetFpsCounter() const META_PIMPL_NOEXCEP
     return GetImpl(m_impl_ptr).GetFpsCounter();
 }
 
+CommandListStatistics RenderContext::GetFrameStatistics() const
+{
+    return GetImpl(m_impl_ptr).GetFrameStatistics();
+}
+
 bool RenderContext::SetVSyncEnabled(bool vsync_enabled) const
 {
     return GetImpl(m_impl_ptr).SetVSyncEnabled(vsync_enabled);
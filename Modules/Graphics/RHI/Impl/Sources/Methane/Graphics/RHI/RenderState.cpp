@@ -117,6 +117,17 @@ void RenderState::Reset(const IRenderState::Settings& settings) const
     return GetImpl(m_impl_ptr).Reset(settings);
 }
 
+void RenderState::PrewarmPipelines(const std::vector<ViewState>& view_states, const std::vector<RenderPrimitive>& primitives) const
+{
+    Refs<IViewState> view_state_refs;
+    view_state_refs.reserve(view_states.size());
+    for(const ViewState& view_state : view_states)
+    {
+        view_state_refs.emplace_back(view_state.GetInterface());
+    }
+    GetImpl(m_impl_ptr).PrewarmPipelines(view_state_refs, primitives);
+}
+
 Program RenderState::GetProgram() const
 {
     return Program(GetSettings().program_ptr);
@@ -24,6 +24,8 @@ Methane TransferCommandList PIMPL wrappers for direct calls to final implementat
 #include <Methane/Graphics/RHI/TransferCommandList.h>
 #include <Methane/Graphics/RHI/CommandListDebugGroup.h>
 #include <Methane/Graphics/RHI/CommandQueue.h>
+#include <Methane/Graphics/RHI/Buffer.h>
+#include <Methane/Graphics/RHI/Texture.h>
 
 #include <Methane/Pimpl.hpp>
 
@@ -129,6 +131,11 @@ Data::TimeRange TransferCommandList::GetGpuTimeRange(bool in_cpu_nanoseconds) co
     return GetImpl(m_impl_ptr).GetGpuTimeRange(in_cpu_nanoseconds);
 }
 
+CommandListStatistics TransferCommandList::GetStatistics() const META_PIMPL_NOEXCEPT
+{
+    return GetImpl(m_impl_ptr).GetStatistics();
+}
+
 CommandListState TransferCommandList::GetState() const META_PIMPL_NOEXCEPT
 {
     return GetImpl(m_impl_ptr).GetState();
@@ -149,5 +156,29 @@ void TransferCommandList::Disconnect(Data::Receiver<ICommandListCallback>& recei
     GetImpl(m_impl_ptr).Data::Emitter<ICommandListCallback>::Disconnect(receiver);
 }
 
+void TransferCommandList::CopyBuffer(const Buffer& src_buffer, const Buffer& dst_buffer, const BufferCopyRegion& copy_region) const
+{
+    GetImpl(m_impl_ptr).CopyBuffer(src_buffer.GetInterface(), dst_buffer.GetInterface(), copy_region);
+}
+
+void TransferCommandList::CopyBufferToTexture(const Buffer& src_buffer, Data::Size src_offset, const Texture& dst_texture, const TextureCopyRegion& dst_region) const
+{
+    GetImpl(m_impl_ptr).CopyBufferToTexture(src_buffer.GetInterface(), src_offset, dst_texture.GetInterface(), dst_region);
+}
+
+void TransferCommandList::CopyTextureToBuffer(const Texture& src_texture, const TextureCopyRegion& src_region, const Buffer& dst_buffer, Data::Size dst_offset) const
+{
+    GetImpl(m_impl_ptr).CopyTextureToBuffer(src_texture.GetInterface(), src_region, dst_buffer.GetInterface(), dst_offset);
+}
+
+void TransferCommandList::CopyTexture(const Texture& src_texture, const TextureCopyRegion& src_region, const Texture& dst_texture, const TextureCopyRegion& dst_region) const
+{
+    GetImpl(m_impl_ptr).CopyTexture(src_texture.GetInterface(), src_region, dst_texture.GetInterface(), dst_region);
+}
+
+void TransferCommandList::GenerateMipmaps(const Texture& texture) const
+{
+    GetImpl(m_impl_ptr).GenerateMipmaps(texture.GetInterface());
+}
 
 } // namespace Methane::Graphics::Rhi
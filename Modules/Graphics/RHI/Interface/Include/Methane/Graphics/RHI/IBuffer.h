@@ -36,7 +36,8 @@ enum class BufferType
     Storage,
     Index,
     Vertex,
-    ReadBack
+    ReadBack,
+    IndirectArgument
 };
 
 enum class BufferStorageMode
@@ -58,17 +59,30 @@ struct BufferSettings
     [[nodiscard]] static BufferSettings ForIndexBuffer(Data::Size size, PixelFormat format, bool is_volatile = false);
     [[nodiscard]] static BufferSettings ForConstantBuffer(Data::Size size, bool addressable = false, bool is_volatile = false);
     [[nodiscard]] static BufferSettings ForReadBackBuffer(Data::Size size);
+    [[nodiscard]] static BufferSettings ForIndirectArgumentBuffer(Data::Size size, bool is_volatile = false);
 
     bool operator==(const BufferSettings& other) const;
     bool operator!=(const BufferSettings& other) const;
 };
 
+// Buffer memory persistently mapped to CPU address space for the whole buffer lifetime,
+// span is empty when buffer memory is not CPU visible or is mapped only for the time of data update
+struct BufferMappedSpan
+{
+    Data::RawPtr data_ptr  = nullptr;
+    Data::Size   data_size = 0U;
+
+    [[nodiscard]] bool IsEmpty() const noexcept { return !data_ptr || !data_size; }
+    [[nodiscard]] explicit operator bool() const noexcept { return !IsEmpty(); }
+};
+
 struct IBuffer
     : virtual IResource // NOSONAR
 {
     using Type        = BufferType;
     using StorageMode = BufferStorageMode;
     using Settings    = BufferSettings;
+    using MappedSpan  = BufferMappedSpan;
 
     // Create IBuffer instance
     [[nodiscard]] static Ptr<IBuffer> Create(const IContext& context, const Settings& settings);
@@ -76,7 +90,10 @@ struct IBuffer
     // IBuffer interface
     [[nodiscard]] virtual const Settings& GetSettings() const noexcept = 0;
     [[nodiscard]] virtual uint32_t        GetFormattedItemsCount() const noexcept = 0;
+    [[nodiscard]] virtual MappedSpan      GetMappedSpan() const noexcept = 0;
     [[nodiscard]] virtual SubResource     GetData(ICommandQueue& target_cmd_queue, const BytesRangeOpt& data_range = {}) = 0;
+
+    // Sub-resource data range start is used as the buffer offset of written data, when the range is set
     virtual void SetData(ICommandQueue& target_cmd_queue, const SubResource& sub_resource) = 0;
 };
 
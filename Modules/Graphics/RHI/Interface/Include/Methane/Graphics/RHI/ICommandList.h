@@ -55,6 +55,21 @@ enum class CommandListState
     Executing,
 };
 
+// Counters of commands encoded in command list, used to estimate encoding efficiency
+struct CommandListStatistics
+{
+    uint32_t draws_count                 = 0U; // indirect draws are counted with maximum draws count of the command
+    uint32_t dispatches_count            = 0U;
+    uint32_t indirect_commands_count     = 0U; // indirect draws and dispatches, which are also counted in draws and dispatches
+    uint32_t applied_state_changes_count = 0U;
+    uint32_t skipped_state_changes_count = 0U; // redundant state changes filtered out without encoding
+    uint32_t resource_barriers_count     = 0U;
+    uint32_t applied_bindings_count      = 0U;
+    uint32_t descriptor_set_binds_count  = 0U; // descriptor sets, tables or root views bound by the native API
+
+    CommandListStatistics& operator+=(const CommandListStatistics& other) noexcept;
+};
+
 struct ICommandList;
 
 struct ICommandListCallback
@@ -77,6 +92,7 @@ struct ICommandList
     using State       = CommandListState;
     using IDebugGroup = ICommandListDebugGroup;
     using ICallback   = ICommandListCallback;
+    using Statistics  = CommandListStatistics;
 
     using CompletedCallback = std::function<void(ICommandList& command_list)>;
 
@@ -93,6 +109,7 @@ struct ICommandList
     virtual void  Commit() = 0;
     virtual void  WaitUntilCompleted(uint32_t timeout_ms = 0U) = 0;
     [[nodiscard]] virtual Data::TimeRange GetGpuTimeRange(bool in_cpu_nanoseconds) const = 0;
+    [[nodiscard]] virtual Statistics GetStatistics() const noexcept = 0;
     [[nodiscard]] virtual ICommandQueue& GetCommandQueue() = 0;
 };
 
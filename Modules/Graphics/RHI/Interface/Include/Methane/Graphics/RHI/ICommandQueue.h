@@ -61,6 +61,13 @@ struct ICommandQueue
     [[nodiscard]] virtual uint32_t                        GetFamilyIndex() const noexcept = 0;
     [[nodiscard]] virtual const Ptr<ITimestampQueryPool>& GetTimestampQueryPoolPtr() = 0;
     virtual void Execute(ICommandListSet& command_lists, const ICommandList::CompletedCallback& completed_callback = {}) = 0;
+    virtual void ExecuteBatch(const Refs<ICommandListSet>& command_list_sets, const ICommandList::CompletedCallback& completed_callback = {}) = 0;
+
+    // In deferred execution mode command list sets are not submitted on execute, but queued
+    // and submitted in one batch on ExecuteDeferred call, fence signal or frame present
+    virtual void SetDeferredExecution(bool is_deferred_execution) = 0;
+    [[nodiscard]] virtual bool IsDeferredExecution() const noexcept = 0;
+    virtual void ExecuteDeferred() = 0;
 };
 
 } // namespace Methane::Graphics::Rhi
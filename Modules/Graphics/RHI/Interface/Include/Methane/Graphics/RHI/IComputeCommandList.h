@@ -26,15 +26,25 @@ Methane compute command list interface.
 #include "ICommandList.h"
 
 #include <Methane/Graphics/Volume.hpp>
+#include <Methane/Data/Types.h>
 #include <Methane/Memory.hpp>
 
 namespace Methane::Graphics::Rhi
 {
 
 struct IComputeState;
+struct IBuffer;
 
 using ThreadGroupsCount = VolumeSize<uint32_t>;
 
+// Indirect dispatch arguments layout in the indirect argument buffer is common for all graphics APIs
+struct DispatchIndirectArguments
+{
+    uint32_t thread_groups_count_x = 1U;
+    uint32_t thread_groups_count_y = 1U;
+    uint32_t thread_groups_count_z = 1U;
+};
+
 struct IComputeCommandList
     : virtual ICommandList // NOSONAR
 {
@@ -48,6 +58,7 @@ struct IComputeCommandList
     virtual void ResetWithStateOnce(IComputeState& compute_state, IDebugGroup* debug_group_ptr = nullptr) = 0;
     virtual void SetComputeState(IComputeState& compute_state) = 0;
     virtual void Dispatch(const ThreadGroupsCount& thread_groups_count) = 0;
+    virtual void DispatchIndirect(IBuffer& args_buffer, Data::Size args_offset = 0U) = 0;
 };
 
 } // namespace Methane::Graphics::Rhi
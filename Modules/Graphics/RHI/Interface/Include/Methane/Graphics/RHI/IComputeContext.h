@@ -25,6 +25,7 @@ provides basic multi-frame rendering synchronization and frame presenting APIs.
 #pragma once
 
 #include "IContext.h"
+#include "ICommandList.h"
 
 #include <Methane/Graphics/Types.h>
 #include <Methane/Graphics/Rect.hpp>
@@ -57,6 +58,9 @@ struct IComputeContext
     // IComputeContext interface
     [[nodiscard]] virtual const Settings& GetSettings() const noexcept = 0;
 
+    // Statistics of command lists committed before the last wait for compute completion
+    [[nodiscard]] virtual CommandListStatistics GetComputeStatistics() const = 0;
+
     [[nodiscard]] ICommandKit& GetComputeCommandKit() const;
 };
 
@@ -24,6 +24,7 @@ Methane base context interface: wraps graphics device used for GPU interaction.
 #pragma once
 
 #include "IObject.h"
+#include "IDescriptorManager.h"
 
 #include <Methane/Memory.hpp>
 #include <Methane/Graphics/Types.h>
@@ -144,6 +145,7 @@ struct IContext
     [[nodiscard]] virtual const IDevice& GetDevice() const = 0;
     [[nodiscard]] virtual ICommandKit& GetDefaultCommandKit(CommandListType type) const = 0;
     [[nodiscard]] virtual ICommandKit& GetDefaultCommandKit(ICommandQueue& cmd_queue) const = 0;
+    [[nodiscard]] virtual DescriptorStatistics GetDescriptorStatistics() const = 0;
 
     [[nodiscard]] ICommandKit& GetUploadCommandKit() const;
 };
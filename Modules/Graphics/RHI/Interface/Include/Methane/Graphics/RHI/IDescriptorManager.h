@@ -53,11 +53,25 @@ namespace Methane::Graphics::Rhi
 
 struct IProgramBindings;
 
+// Statistics of descriptors allocated for program bindings, values are zero when not tracked by graphics backend
+struct DescriptorStatistics
+{
+    uint32_t pools_count           = 0U; // native descriptor pools created by graphics backend
+    uint32_t free_pools_count      = 0U; // descriptor pools reset and available for reuse
+    uint32_t allocated_sets_count  = 0U; // descriptor sets allocated from pools
+    uint32_t recycled_sets_count   = 0U; // released descriptor sets ready to be reused with the same layout
+    uint32_t retired_sets_count    = 0U; // released descriptor sets waiting for completion of GPU work using them
+    uint32_t transient_pools_count = 0U; // descriptor pools used by transient program bindings of frames in flight
+    uint32_t transient_sets_count  = 0U; // descriptor sets allocated for transient program bindings of frames in flight
+};
+
 struct IDescriptorManager
 {
     virtual void AddProgramBindings(IProgramBindings& program_bindings) = 0;
+    virtual void UpdateProgramBindings(IProgramBindings& program_bindings) = 0;
     virtual void CompleteInitialization() = 0;
     virtual void Release() = 0;
+    [[nodiscard]] virtual DescriptorStatistics GetStatistics() const = 0;
 
     virtual ~IDescriptorManager() = default;
 };
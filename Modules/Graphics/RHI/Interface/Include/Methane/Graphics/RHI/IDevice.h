@@ -30,6 +30,7 @@ Methane device interface, used to create graphics context for rendering.
 #include <Methane/Memory.hpp>
 
 #include <functional>
+#include <string>
 
 namespace tf
 {
@@ -49,7 +50,8 @@ enum class DeviceFeature : uint32_t
 {
     PresentToWindow,
     AnisotropicFiltering,
-    ImageCubeArray
+    ImageCubeArray,
+    IndirectDrawCount // indirect draws count is read by GPU from buffer
 };
 
 using DeviceFeatureMask = Data::EnumMask<DeviceFeature>;
@@ -71,6 +73,19 @@ struct DeviceCaps
     DeviceCaps& SetComputeQueuesCount(uint32_t new_compute_queues_count) noexcept;
 };
 
+// Statistics of GPU memory allocated by device for resources, values are zero when not tracked by graphics backend
+struct DeviceMemoryStatistics
+{
+    uint32_t blocks_count           = 0U; // native memory objects allocated from graphics driver
+    uint32_t dedicated_blocks_count = 0U; // native memory objects allocated for single resource
+    uint32_t allocations_count      = 0U; // resource allocations placed in memory blocks
+    uint64_t reserved_size          = 0U; // total size of memory blocks
+    uint64_t used_size              = 0U; // total size of resource allocations in memory blocks
+    uint64_t budget_size            = 0U; // total size of device memory heaps available for allocation
+
+    [[nodiscard]] explicit operator std::string() const;
+};
+
 struct IDevice;
 
 struct IDeviceCallback
@@ -92,14 +107,21 @@ struct IDevice
 {
     using FeatureMask  = DeviceFeatureMask;
     using Feature      = DeviceFeature;
-    using Capabilities = DeviceCaps;
+    using Capabilities     = DeviceCaps;
+    using MemoryStatistics = DeviceMemoryStatistics;
 
     [[nodiscard]] virtual Ptr<IRenderContext>  CreateRenderContext(const Platform::AppEnvironment& env, tf::Executor& parallel_executor, const RenderContextSettings& settings) = 0;
     [[nodiscard]] virtual Ptr<IComputeContext> CreateComputeContext(tf::Executor& parallel_executor, const ComputeContextSettings& settings) = 0;
     [[nodiscard]] virtual const std::string&   GetAdapterName() const noexcept = 0;
     [[nodiscard]] virtual bool                 IsSoftwareAdapter() const noexcept = 0;
     [[nodiscard]] virtual const Capabilities&  GetCapabilities() const noexcept = 0;
+    [[nodiscard]] virtual MemoryStatistics     GetMemoryStatistics() const = 0;
     [[nodiscard]] virtual std::string          ToString() const = 0;
+
+    // Pipeline cache file is loaded on context creation and saved on flush, empty path disables pipeline cache persistence
+    [[nodiscard]] virtual const std::string&   GetPipelineCachePath() const noexcept = 0;
+    virtual void SetPipelineCachePath(const std::string& pipeline_cache_path) = 0;
+    virtual bool FlushPipelineCache() = 0;
 };
 
 } // namespace Methane::Graphics::Rhi
@@ -112,6 +112,9 @@ struct IProgramBindings
 
     // IProgramBindings interface
     [[nodiscard]] virtual Ptr<IProgramBindings>   CreateCopy(const IProgram::ResourceViewsByArgument& replace_resource_views_by_argument = {}, const Opt<Data::Index>& frame_index = {}) = 0;
+    // Transient copy can be used only in commands encoded for the current frame, so that graphics backend can allocate its descriptors
+    // from the per-frame pools, which are reset on frame completion; unlike regular copy, it must not be used in the next frames
+    [[nodiscard]] virtual Ptr<IProgramBindings>   CreateTransientCopy(const IProgram::ResourceViewsByArgument& replace_resource_views_by_argument = {}, const Opt<Data::Index>& frame_index = {}) = 0;
     [[nodiscard]] virtual IProgram&               GetProgram() const = 0;
     [[nodiscard]] virtual IArgumentBinding&       Get(const ProgramArgument& shader_argument) const = 0;
     [[nodiscard]] virtual const ProgramArguments& GetArguments() const noexcept = 0;
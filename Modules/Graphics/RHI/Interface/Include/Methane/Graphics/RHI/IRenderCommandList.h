@@ -26,6 +26,7 @@ Methane render command list interface.
 #include "ICommandList.h"
 #include "IRenderState.h"
 
+#include <Methane/Data/Types.h>
 #include <Methane/Memory.hpp>
 
 namespace Methane::Graphics::Rhi
@@ -46,6 +47,24 @@ enum class RenderPrimitive
     TriangleStrip
 };
 
+// Indirect draw arguments are tightly packed in the indirect argument buffer with layout common for all graphics APIs
+struct DrawIndirectArguments
+{
+    uint32_t vertex_count   = 0U;
+    uint32_t instance_count = 1U;
+    uint32_t start_vertex   = 0U;
+    uint32_t start_instance = 0U;
+};
+
+struct DrawIndexedIndirectArguments
+{
+    uint32_t index_count    = 0U;
+    uint32_t instance_count = 1U;
+    uint32_t start_index    = 0U;
+    int32_t  start_vertex   = 0;
+    uint32_t start_instance = 0U;
+};
+
 struct IRenderCommandList
     : virtual ICommandList // NOSONAR
 {
@@ -70,6 +89,13 @@ struct IRenderCommandList
                              uint32_t instance_count = 1, uint32_t start_instance = 0) = 0;
     virtual void Draw(Primitive primitive, uint32_t vertex_count, uint32_t start_vertex = 0,
                       uint32_t instance_count = 1, uint32_t start_instance = 0) = 0;
+
+    // Indirect draws encode up to draw_count draw commands with arguments read by GPU from the indirect argument buffer,
+    // actual draws count is read from count buffer when it is given, which requires DeviceFeature::IndirectDrawCount
+    virtual void DrawIndexedIndirect(Primitive primitive, IBuffer& args_buffer, Data::Size args_offset = 0U, uint32_t draw_count = 1U,
+                                     IBuffer* count_buffer_ptr = nullptr, Data::Size count_offset = 0U) = 0;
+    virtual void DrawIndirect(Primitive primitive, IBuffer& args_buffer, Data::Size args_offset = 0U, uint32_t draw_count = 1U,
+                              IBuffer* count_buffer_ptr = nullptr, Data::Size count_offset = 0U) = 0;
     
     using ICommandList::Reset;
 };
@@ -25,6 +25,7 @@ provides basic multi-frame rendering synchronization and frame presenting APIs.
 #pragma once
 
 #include "IContext.h"
+#include "ICommandList.h"
 
 #include <Methane/Data/IFpsCounter.h>
 #include <Methane/Graphics/Types.h>
@@ -90,6 +91,7 @@ struct IRenderContext
     [[nodiscard]] virtual uint32_t          GetFrameBufferIndex() const noexcept = 0;
     [[nodiscard]] virtual uint32_t          GetFrameIndex() const noexcept = 0;
     [[nodiscard]] virtual const Data::IFpsCounter& GetFpsCounter() const noexcept = 0;
+    [[nodiscard]] virtual CommandListStatistics    GetFrameStatistics() const = 0;
 
     virtual bool SetVSyncEnabled(bool vsync_enabled) = 0;
     virtual bool SetFrameBuffersCount(uint32_t frame_buffers_count) = 0;
@@ -210,6 +210,8 @@ using RenderStateGroupMask = Data::EnumMask<RenderStateGroup>;
 struct IRenderContext;
 struct IProgram;
 struct IRenderPattern;
+struct IViewState;
+enum class RenderPrimitive;
 
 struct RenderStateSettings
 {
@@ -251,6 +253,10 @@ public:
     // IRenderState interface
     [[nodiscard]] virtual const Settings& GetSettings() const noexcept = 0;
     virtual void Reset(const Settings& settings) = 0;
+
+    // Starts background compilation of native pipelines for all combinations of expected view states and primitives,
+    // when native pipeline depends on them; otherwise pipelines are compiled synchronously on first draw
+    virtual void PrewarmPipelines(const Refs<IViewState>& view_states, const std::vector<RenderPrimitive>& primitives) = 0;
 };
 
 } // namespace Methane::Graphics::Rhi
@@ -24,12 +24,35 @@ Methane data transfer command list interface.
 #pragma once
 
 #include "ICommandList.h"
+#include "ResourceView.h"
 
+#include <Methane/Graphics/Rect.hpp>
+#include <Methane/Data/Types.h>
 #include <Methane/Memory.hpp>
 
 namespace Methane::Graphics::Rhi
 {
 
+struct IBuffer;
+struct ITexture;
+
+// Bytes range copied between buffers, source and destination ranges of the same buffer should not overlap
+struct BufferCopyRegion
+{
+    Data::Size src_offset = 0U;
+    Data::Size dst_offset = 0U;
+    Data::Size size       = 0U;
+};
+
+// Pixels rectangle of the texture sub-resource (depth slice, array index and mip level) used in copy operations,
+// rectangle with empty size is extended to the bottom-right corner of the sub-resource.
+// Texture data in buffer is tightly packed by rows of the copied rectangle.
+struct TextureCopyRegion
+{
+    SubResourceIndex         subresource_index;
+    Rect<uint32_t, uint32_t> rect;
+};
+
 struct ITransferCommandList
     : virtual ICommandList // NOSONAR
 {
@@ -38,8 +61,14 @@ struct ITransferCommandList
     // Create ITransferCommandList instance
     [[nodiscard]] static Ptr<ITransferCommandList> Create(ICommandQueue& command_queue);
 
-    // No public functions here for now, transfer command lists are used internally only
-    // Later it will include memory copy operations and mip-map generation for textures on GPU
+    // ITransferCommandList interface
+    // Copy commands transition source resources to CopySource and destination resources to CopyDest state,
+    // mipmaps generation leaves texture in ShaderResource state
+    virtual void CopyBuffer(IBuffer& src_buffer, IBuffer& dst_buffer, const BufferCopyRegion& copy_region) = 0;
+    virtual void CopyBufferToTexture(IBuffer& src_buffer, Data::Size src_offset, ITexture& dst_texture, const TextureCopyRegion& dst_region) = 0;
+    virtual void CopyTextureToBuffer(ITexture& src_texture, const TextureCopyRegion& src_region, IBuffer& dst_buffer, Data::Size dst_offset) = 0;
+    virtual void CopyTexture(ITexture& src_texture, const TextureCopyRegion& src_region, ITexture& dst_texture, const TextureCopyRegion& dst_region) = 0;
+    virtual void GenerateMipmaps(ITexture& texture) = 0;
 };
 
 } // namespace Methane::Graphics::Rhi
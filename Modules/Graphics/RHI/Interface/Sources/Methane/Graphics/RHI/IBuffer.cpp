@@ -93,6 +93,21 @@ BufferSettings BufferSettings::ForReadBackBuffer(Data::Size size)
     };
 }
 
+BufferSettings BufferSettings::ForIndirectArgumentBuffer(Data::Size size, bool is_volatile)
+{
+    META_FUNCTION_TASK();
+    // Private indirect arguments buffer is writable in shaders to allow generating draw and dispatch commands on GPU,
+    // while volatile arguments are written on CPU
+    return Rhi::BufferSettings{
+        Rhi::BufferType::IndirectArgument,
+        Rhi::ResourceUsageMask(Rhi::ResourceUsage::ShaderRead).SetBit(Rhi::ResourceUsage::ShaderWrite, !is_volatile),
+        size,
+        0U,
+        PixelFormat::Unknown,
+        GetBufferStorageMode(is_volatile)
+    };
+}
+
 bool BufferSettings::operator==(const BufferSettings& other) const
 {
     return std::tie(type, usage_mask, size, item_stride_size, data_format, storage_mode)
@@ -0,0 +1,43 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/RHI/ICommandList.cpp
+Methane command list interface.
+
+******************************************************************************/
+
+#include <Methane/Graphics/RHI/ICommandList.h>
+
+
+namespace Methane::Graphics::Rhi
+{
+
+CommandListStatistics& CommandListStatistics::operator+=(const CommandListStatistics& other) noexcept
+{
+    draws_count                 += other.draws_count;
+    dispatches_count            += other.dispatches_count;
+    indirect_commands_count     += other.indirect_commands_count;
+    applied_state_changes_count += other.applied_state_changes_count;
+    skipped_state_changes_count += other.skipped_state_changes_count;
+    resource_barriers_count     += other.resource_barriers_count;
+    applied_bindings_count      += other.applied_bindings_count;
+    descriptor_set_binds_count  += other.descriptor_set_binds_count;
+    return *this;
+}
+
+} // namespace Methane::Graphics::Rhi
@@ -25,6 +25,8 @@ Methane device interface, used to create graphics context for rendering.
 
 #include <Methane/Instrumentation.h>
 
+#include <fmt/format.h>
+
 namespace Methane::Graphics::Rhi
 {
 
@@ -56,4 +58,11 @@ DeviceCaps& DeviceCaps::SetComputeQueuesCount(uint32_t new_compute_queues_count)
     return *this;
 }
 
+DeviceMemoryStatistics::operator std::string() const
+{
+    META_FUNCTION_TASK();
+    return fmt::format("{} of {} bytes used by {} allocations in {} memory blocks ({} dedicated) of {} bytes reserved",
+                       used_size, budget_size, allocations_count, blocks_count, dedicated_blocks_count, reserved_size);
+}
+
 } // namespace Methane::Graphics::Rhi
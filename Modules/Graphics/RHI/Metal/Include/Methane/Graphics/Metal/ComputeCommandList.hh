@@ -45,6 +45,7 @@ public:
 
     // IComputeCommandList interface
     void Dispatch(const Rhi::ThreadGroupsCount& thread_groups_count) override;
+    void DispatchIndirect(Rhi::IBuffer& args_buffer, Data::Size args_offset) override;
 };
 
 } // namespace Methane::Graphics::Metal
@@ -32,8 +32,10 @@ struct DescriptorManager final
     : Rhi::IDescriptorManager
 {
     void AddProgramBindings(Rhi::IProgramBindings&) override {}
+    void UpdateProgramBindings(Rhi::IProgramBindings&) override {}
     void CompleteInitialization() override {}
     void Release() override {}
+    Rhi::DescriptorStatistics GetStatistics() const override { return {}; }
 };
 
 } // namespace Methane::Graphics::Metal
@@ -52,6 +52,9 @@ protected:
     // ParallelRenderCommandListBase interface
     [[nodiscard]] Ptr<Rhi::IRenderCommandList> CreateCommandList(bool is_beginning_list) override;
 
+    // Thread render command encoders are executed in order of their creation from the parallel render command encoder
+    [[nodiscard]] bool IsParallelResetSupported() const noexcept override { return false; }
+
 private:
     RenderPass& GetMetalRenderPass();
     bool ResetCommandEncoder();
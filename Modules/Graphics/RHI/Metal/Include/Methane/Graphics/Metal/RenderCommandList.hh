@@ -52,6 +52,10 @@ public:
                      uint32_t instance_count, uint32_t start_instance) override;
     void Draw(Primitive primitive, uint32_t vertex_count, uint32_t start_vertex,
               uint32_t instance_count, uint32_t start_instance) override;
+    void DrawIndexedIndirect(Primitive primitive, Rhi::IBuffer& args_buffer, Data::Size args_offset, uint32_t draw_count,
+                             Rhi::IBuffer* count_buffer_ptr, Data::Size count_offset) override;
+    void DrawIndirect(Primitive primitive, Rhi::IBuffer& args_buffer, Data::Size args_offset, uint32_t draw_count,
+                      Rhi::IBuffer* count_buffer_ptr, Data::Size count_offset) override;
 
 private:
     RenderPass& GetMetalRenderPass();
@@ -54,6 +54,7 @@ public:
     void UpdateFrameBuffer();
 
     const id<MTLTexture>& GetNativeTexture() const { return m_mtl_texture; }
+    uint32_t              GetNativeSliceIndex(const SubResource::Index& sub_resource_index) const;
 
 private:
     void GenerateMipLevels(TransferCommandList& transfer_command_list);
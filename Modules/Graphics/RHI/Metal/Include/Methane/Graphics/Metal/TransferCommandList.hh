@@ -26,7 +26,7 @@ Metal implementation of the transfer command list interface.
 #include "CommandList.hpp"
 
 #include <Methane/Graphics/RHI/ITransferCommandList.h>
-#include <Methane/Graphics/Base/CommandList.h>
+#include <Methane/Graphics/Base/TransferCommandList.h>
 
 #import <Metal/Metal.h>
 
@@ -36,14 +36,20 @@ namespace Methane::Graphics::Metal
 class CommandQueue;
 
 class TransferCommandList final
-    : public CommandList<id<MTLBlitCommandEncoder>, Base::CommandList>
-    , public Rhi::ITransferCommandList
+    : public CommandList<id<MTLBlitCommandEncoder>, Base::TransferCommandList>
 {
 public:
     TransferCommandList(Base::CommandQueue& command_queue);
 
     // ICommandList interface
     void Reset(Rhi::ICommandListDebugGroup* debug_group_ptr = nullptr) override;
+
+    // ITransferCommandList interface
+    void CopyBuffer(Rhi::IBuffer& src_buffer, Rhi::IBuffer& dst_buffer, const Rhi::BufferCopyRegion& copy_region) override;
+    void CopyBufferToTexture(Rhi::IBuffer& src_buffer, Data::Size src_offset, Rhi::ITexture& dst_texture, const Rhi::TextureCopyRegion& dst_region) override;
+    void CopyTextureToBuffer(Rhi::ITexture& src_texture, const Rhi::TextureCopyRegion& src_region, Rhi::IBuffer& dst_buffer, Data::Size dst_offset) override;
+    void CopyTexture(Rhi::ITexture& src_texture, const Rhi::TextureCopyRegion& src_region, Rhi::ITexture& dst_texture, const Rhi::TextureCopyRegion& dst_region) override;
+    void GenerateMipmaps(Rhi::ITexture& texture) override;
 };
 
 } // namespace Methane::Graphics::Metal
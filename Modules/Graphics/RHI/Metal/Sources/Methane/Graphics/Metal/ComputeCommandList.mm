@@ -23,6 +23,7 @@ Metal implementation of the compute command list interface.
 
 #include <Methane/Graphics/Metal/ComputeCommandList.hh>
 #include <Methane/Graphics/Metal/ComputeState.hh>
+#include <Methane/Graphics/Metal/Buffer.hh>
 
 #include <Methane/Instrumentation.h>
 #include <Methane/Checks.hpp>
@@ -63,4 +64,19 @@ void ComputeCommandList::Dispatch(const Rhi::ThreadGroupsCount& thread_groups_co
                     threadsPerThreadgroup: mtl_threads_per_group];
 }
 
+void ComputeCommandList::DispatchIndirect(Rhi::IBuffer& args_buffer, Data::Size args_offset)
+{
+    META_FUNCTION_TASK();
+    Base::ComputeCommandList::DispatchIndirect(args_buffer, args_offset);
+
+    const auto& mtl_cmd_encoder = GetNativeCommandEncoder();
+    META_CHECK_ARG_NOT_NULL(mtl_cmd_encoder);
+
+    const Rhi::ThreadGroupSize& thread_group_size = GetComputeState().GetSettings().thread_group_size;
+    const MTLSize mtl_threads_per_group{ thread_group_size.GetWidth(), thread_group_size.GetHeight(), thread_group_size.GetDepth() };
+    [mtl_cmd_encoder dispatchThreadgroupsWithIndirectBuffer: static_cast<const Buffer&>(args_buffer).GetNativeBuffer()
+                                       indirectBufferOffset: args_offset
+                                      threadsPerThreadgroup: mtl_threads_per_group];
+}
+
 } // namespace Methane::Graphics::Metal
@@ -216,6 +216,52 @@ void RenderCommandList::Draw(Primitive primitive, uint32_t vertex_count, uint32_
     }
 }
 
+void RenderCommandList::DrawIndexedIndirect(Primitive primitive, Rhi::IBuffer& args_buffer, Data::Size args_offset, uint32_t draw_count,
+                                            Rhi::IBuffer* count_buffer_ptr, Data::Size count_offset)
+{
+    META_FUNCTION_TASK();
+    Base::RenderCommandList::DrawIndexedIndirect(primitive, args_buffer, args_offset, draw_count, count_buffer_ptr, count_offset);
+
+    const Buffer& metal_index_buffer = static_cast<const Buffer&>(*GetDrawingState().index_buffer_ptr);
+    const MTLPrimitiveType mtl_primitive_type = PrimitiveTypeToMetal(primitive);
+    const id<MTLBuffer>&   mtl_args_buffer    = static_cast<const Buffer&>(args_buffer).GetNativeBuffer();
+
+    const auto& mtl_cmd_encoder = GetNativeCommandEncoder();
+    META_CHECK_ARG_NOT_NULL(mtl_cmd_encoder);
+
+    // Metal has no multi-draw indirect command, so indirect draws are encoded one by one
+    for(uint32_t draw_index = 0U; draw_index < draw_count; ++draw_index)
+    {
+        [mtl_cmd_encoder drawIndexedPrimitives:mtl_primitive_type
+                                     indexType:metal_index_buffer.GetNativeIndexType()
+                                   indexBuffer:metal_index_buffer.GetNativeBuffer()
+                             indexBufferOffset:0U
+                                indirectBuffer:mtl_args_buffer
+                          indirectBufferOffset:args_offset + draw_index * sizeof(Rhi::DrawIndexedIndirectArguments)];
+    }
+}
+
+void RenderCommandList::DrawIndirect(Primitive primitive, Rhi::IBuffer& args_buffer, Data::Size args_offset, uint32_t draw_count,
+                                     Rhi::IBuffer* count_buffer_ptr, Data::Size count_offset)
+{
+    META_FUNCTION_TASK();
+    Base::RenderCommandList::DrawIndirect(primitive, args_buffer, args_offset, draw_count, count_buffer_ptr, count_offset);
+
+    const MTLPrimitiveType mtl_primitive_type = PrimitiveTypeToMetal(primitive);
+    const id<MTLBuffer>&   mtl_args_buffer    = static_cast<const Buffer&>(args_buffer).GetNativeBuffer();
+
+    const auto& mtl_cmd_encoder = GetNativeCommandEncoder();
+    META_CHECK_ARG_NOT_NULL(mtl_cmd_encoder);
+
+    // Metal has no multi-draw indirect command, so indirect draws are encoded one by one
+    for(uint32_t draw_index = 0U; draw_index < draw_count; ++draw_index)
+    {
+        [mtl_cmd_encoder drawPrimitives:mtl_primitive_type
+                         indirectBuffer:mtl_args_buffer
+                   indirectBufferOffset:args_offset + draw_index * sizeof(Rhi::DrawIndirectArguments)];
+    }
+}
+
 RenderPass& RenderCommandList::GetMetalRenderPass()
 {
     META_FUNCTION_TASK();
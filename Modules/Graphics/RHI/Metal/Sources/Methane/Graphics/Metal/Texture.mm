@@ -113,30 +113,13 @@ void Texture::SetData(Rhi::ICommandQueue& target_cmd_queue, const SubResources&
 
     for(const SubResource& sub_resource : sub_resources)
     {
-        uint32_t slice = 0;
-        switch(settings.dimension_type)
-        {
-            case Rhi::TextureDimensionType::Tex1DArray:
-            case Rhi::TextureDimensionType::Tex2DArray:
-                slice = sub_resource.GetIndex().GetArrayIndex();
-                break;
-            case Rhi::TextureDimensionType::Cube:
-                slice = sub_resource.GetIndex().GetDepthSlice();
-                break;
-            case Rhi::TextureDimensionType::CubeArray:
-                slice = sub_resource.GetIndex().GetDepthSlice() + sub_resource.GetIndex().GetArrayIndex() * 6;
-                break;
-            default:
-                slice = 0;
-        }
-
         [mtl_blit_encoder copyFromBuffer:GetUploadSubresourceBuffer(sub_resource, GetSubresourceCount())
                             sourceOffset:0
                        sourceBytesPerRow:bytes_per_row
                      sourceBytesPerImage:bytes_per_image
                               sourceSize:texture_region.size
                                toTexture:m_mtl_texture
-                        destinationSlice:slice
+                        destinationSlice:GetNativeSliceIndex(sub_resource.GetIndex())
                         destinationLevel:sub_resource.GetIndex().GetMipLevel()
                        destinationOrigin:texture_region.origin];
     }
@@ -193,6 +176,23 @@ Rhi::SubResource Texture::GetData(Rhi::ICommandQueue&, const SubResource::Index&
     return Rhi::SubResource(Data::Bytes(data_ptr, data_ptr + data_size), sub_resource_index, data_range);
 }
 
+uint32_t Texture::GetNativeSliceIndex(const SubResource::Index& sub_resource_index) const
+{
+    META_FUNCTION_TASK();
+    switch(GetSettings().dimension_type)
+    {
+        case Rhi::TextureDimensionType::Tex1DArray:
+        case Rhi::TextureDimensionType::Tex2DArray:
+            return sub_resource_index.GetArrayIndex();
+        case Rhi::TextureDimensionType::Cube:
+            return sub_resource_index.GetDepthSlice();
+        case Rhi::TextureDimensionType::CubeArray:
+            return sub_resource_index.GetDepthSlice() + sub_resource_index.GetArrayIndex() * 6;
+        default:
+            return 0U;
+    }
+}
+
 void Texture::UpdateFrameBuffer()
 {
     META_FUNCTION_TASK();
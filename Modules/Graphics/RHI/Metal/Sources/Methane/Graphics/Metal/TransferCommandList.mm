@@ -22,14 +22,26 @@ Metal implementation of the transfer command list interface.
 ******************************************************************************/
 
 #include <Methane/Graphics/Metal/TransferCommandList.hh>
+#include <Methane/Graphics/Metal/Buffer.hh>
+#include <Methane/Graphics/Metal/Texture.hh>
 
 #include <Methane/Instrumentation.h>
 
 namespace Methane::Graphics::Metal
 {
 
+static MTLOrigin GetNativeOrigin(const Rhi::TextureCopyRegion& copy_region)
+{
+    return MTLOriginMake(copy_region.rect.origin.GetX(), copy_region.rect.origin.GetY(), 0);
+}
+
+static MTLSize GetNativeSize(const Rhi::TextureCopyRegion& copy_region)
+{
+    return MTLSizeMake(copy_region.rect.size.GetWidth(), copy_region.rect.size.GetHeight(), 1);
+}
+
 TransferCommandList::TransferCommandList(Base::CommandQueue& command_queue)
-    : CommandList<id<MTLBlitCommandEncoder>, Base::CommandList>(true, command_queue, Rhi::CommandListType::Transfer)
+    : CommandList<id<MTLBlitCommandEncoder>, Base::TransferCommandList>(true, command_queue)
 { }
 
 void TransferCommandList::Reset(Rhi::ICommandListDebugGroup* debug_group_ptr)
@@ -46,4 +58,85 @@ void TransferCommandList::Reset(Rhi::ICommandListDebugGroup* debug_group_ptr)
     Base::CommandList::Reset(debug_group_ptr);
 }
 
+void TransferCommandList::CopyBuffer(Rhi::IBuffer& src_buffer, Rhi::IBuffer& dst_buffer, const Rhi::BufferCopyRegion& copy_region)
+{
+    META_FUNCTION_TASK();
+    Base::TransferCommandList::CopyBuffer(src_buffer, dst_buffer, copy_region);
+
+    [GetNativeCommandEncoder() copyFromBuffer:static_cast<const Buffer&>(src_buffer).GetNativeBuffer()
+                                 sourceOffset:copy_region.src_offset
+                                     toBuffer:static_cast<const Buffer&>(dst_buffer).GetNativeBuffer()
+                            destinationOffset:copy_region.dst_offset
+                                         size:copy_region.size];
+}
+
+void TransferCommandList::CopyBufferToTexture(Rhi::IBuffer& src_buffer, Data::Size src_offset, Rhi::ITexture& dst_texture, const Rhi::TextureCopyRegion& dst_region)
+{
+    META_FUNCTION_TASK();
+    Base::TransferCommandList::CopyBufferToTexture(src_buffer, src_offset, dst_texture, dst_region);
+
+    const auto& mtl_dst_texture = static_cast<const Texture&>(dst_texture);
+    const Rhi::TextureCopyRegion resolved_dst_region = GetResolvedCopyRegion(mtl_dst_texture, dst_region);
+    const uint32_t bytes_per_row = resolved_dst_region.rect.size.GetWidth() * GetPixelSize(dst_texture.GetSettings().pixel_format);
+
+    [GetNativeCommandEncoder() copyFromBuffer:static_cast<const Buffer&>(src_buffer).GetNativeBuffer()
+                                 sourceOffset:src_offset
+                            sourceBytesPerRow:bytes_per_row
+                          sourceBytesPerImage:bytes_per_row * resolved_dst_region.rect.size.GetHeight()
+                                   sourceSize:GetNativeSize(resolved_dst_region)
+                                    toTexture:mtl_dst_texture.GetNativeTexture()
+                             destinationSlice:mtl_dst_texture.GetNativeSliceIndex(resolved_dst_region.subresource_index)
+                             destinationLevel:resolved_dst_region.subresource_index.GetMipLevel()
+                            destinationOrigin:GetNativeOrigin(resolved_dst_region)];
+}
+
+void TransferCommandList::CopyTextureToBuffer(Rhi::ITexture& src_texture, const Rhi::TextureCopyRegion& src_region, Rhi::IBuffer& dst_buffer, Data::Size dst_offset)
+{
+    META_FUNCTION_TASK();
+    Base::TransferCommandList::CopyTextureToBuffer(src_texture, src_region, dst_buffer, dst_offset);
+
+    const auto& mtl_src_texture = static_cast<const Texture&>(src_texture);
+    const Rhi::TextureCopyRegion resolved_src_region = GetResolvedCopyRegion(mtl_src_texture, src_region);
+    const uint32_t bytes_per_row = resolved_src_region.rect.size.GetWidth() * GetPixelSize(src_texture.GetSettings().pixel_format);
+
+    [GetNativeCommandEncoder() copyFromTexture:mtl_src_texture.GetNativeTexture()
+                                   sourceSlice:mtl_src_texture.GetNativeSliceIndex(resolved_src_region.subresource_index)
+                                   sourceLevel:resolved_src_region.subresource_index.GetMipLevel()
+                                  sourceOrigin:GetNativeOrigin(resolved_src_region)
+                                    sourceSize:GetNativeSize(resolved_src_region)
+                                      toBuffer:static_cast<const Buffer&>(dst_buffer).GetNativeBuffer()
+                             destinationOffset:dst_offset
+                        destinationBytesPerRow:bytes_per_row
+                      destinationBytesPerImage:bytes_per_row * resolved_src_region.rect.size.GetHeight()];
+}
+
+void TransferCommandList::CopyTexture(Rhi::ITexture& src_texture, const Rhi::TextureCopyRegion& src_region, Rhi::ITexture& dst_texture, const Rhi::TextureCopyRegion& dst_region)
+{
+    META_FUNCTION_TASK();
+    Base::TransferCommandList::CopyTexture(src_texture, src_region, dst_texture, dst_region);
+
+    const auto& mtl_src_texture = static_cast<const Texture&>(src_texture);
+    const auto& mtl_dst_texture = static_cast<const Texture&>(dst_texture);
+    const Rhi::TextureCopyRegion resolved_src_region = GetResolvedCopyRegion(mtl_src_texture, src_region);
+
+    [GetNativeCommandEncoder() copyFromTexture:mtl_src_texture.GetNativeTexture()
+                                   sourceSlice:mtl_src_texture.GetNativeSliceIndex(resolved_src_region.subresource_index)
+                                   sourceLevel:resolved_src_region.subresource_index.GetMipLevel()
+                                  sourceOrigin:GetNativeOrigin(resolved_src_region)
+                                    sourceSize:GetNativeSize(resolved_src_region)
+                                     toTexture:mtl_dst_texture.GetNativeTexture()
+                              destinationSlice:mtl_dst_texture.GetNativeSliceIndex(dst_region.subresource_index)
+                              destinationLevel:dst_region.subresource_index.GetMipLevel()
+                             destinationOrigin:GetNativeOrigin(dst_region)];
+}
+
+void TransferCommandList::GenerateMipmaps(Rhi::ITexture& texture)
+{
+    META_FUNCTION_TASK();
+    Base::TransferCommandList::GenerateMipmaps(texture);
+
+    [GetNativeCommandEncoder() generateMipmapsForTexture:static_cast<const Texture&>(texture).GetNativeTexture()];
+    texture.SetState(Rhi::ResourceState::ShaderResource);
+}
+
 } // namespace Methane::Graphics::Metal
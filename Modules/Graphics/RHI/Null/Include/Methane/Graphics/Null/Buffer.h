@@ -36,7 +36,16 @@ class Buffer final // NOSONAR - inheritance hierarchy is greater than 5
 public:
     Buffer(const Base::Context& context, const Settings& settings);
 
-    SubResource GetData(Rhi::ICommandQueue&, const BytesRangeOpt&) override;
+    // IBuffer interface
+    SubResource GetData(Rhi::ICommandQueue&, const BytesRangeOpt& data_range) override;
+    void SetData(Rhi::ICommandQueue& target_cmd_queue, const SubResource& sub_resource) override;
+
+    // Buffer data is emulated in CPU memory to validate results of transfer commands
+    [[nodiscard]] Data::Bytes&       GetEmulatedData() noexcept       { return m_emulated_data; }
+    [[nodiscard]] const Data::Bytes& GetEmulatedData() const noexcept { return m_emulated_data; }
+
+private:
+    Data::Bytes m_emulated_data;
 };
 
 } // namespace Methane::Graphics::Null
@@ -24,6 +24,7 @@ Null base template implementation of the command list interface.
 #pragma once
 
 #include <Methane/Graphics/Base/CommandList.h>
+#include <Methane/Graphics/RHI/IResourceBarriers.h>
 
 namespace Methane::Graphics::Null
 {
@@ -35,9 +36,10 @@ class CommandList
 public:
     using CommandListBaseT::CommandListBaseT;
 
-    void SetResourceBarriers(const Rhi::IResourceBarriers&) final
+    void SetResourceBarriers(const Rhi::IResourceBarriers& resource_barriers) final
     {
         CommandListBaseT::VerifyEncodingState();
+        CommandListBaseT::CountResourceBarriers(resource_barriers.GetMap().size());
     }
 };
 
@@ -39,6 +39,10 @@ public:
     explicit ComputeCommandList(CommandQueue& command_queue);
 
     void Dispatch(const Rhi::ThreadGroupsCount& thread_groups_count) override;
+    void DispatchIndirect(Rhi::IBuffer& args_buffer, Data::Size args_offset) override;
+
+    // Indirect dispatch arguments are read from emulated buffer data at encoding time
+    const Rhi::ThreadGroupsCount& GetDispatchedThreadGroupsCount() const noexcept { return m_dispatched_thread_groups_count; }
 
 private:
     Rhi::ThreadGroupsCount m_dispatched_thread_groups_count;
@@ -39,6 +39,8 @@ public:
 
     using Base::ProgramBindings::ProgramBindings;
 
+    void Initialize();
+
     // IProgramBindings interface
     [[nodiscard]] Ptr<Rhi::IProgramBindings> CreateCopy(const ResourceViewsByArgument& replace_resource_views_by_argument, const Opt<Data::Index>& frame_index) override;
     void Apply(Base::CommandList&, ApplyBehaviorMask) const override { /* Intentionally unimplemented */ }
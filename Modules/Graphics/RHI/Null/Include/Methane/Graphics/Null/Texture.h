@@ -39,7 +39,16 @@ public:
     Texture(const Base::Context& context, const Settings& settings);
     Texture(const RenderContext& render_context, const Settings& settings, Data::Index frame_index);
 
-    SubResource GetData(Rhi::ICommandQueue&, const SubResource::Index&, const BytesRangeOpt&) override;
+    // ITexture interface
+    SubResource GetData(Rhi::ICommandQueue&, const SubResource::Index& sub_resource_index, const BytesRangeOpt& data_range) override;
+    void SetData(Rhi::ICommandQueue& target_cmd_queue, const SubResources& sub_resources) override;
+
+    // Texture sub-resources data is emulated in CPU memory to validate results of transfer commands,
+    // sub-resource memory is allocated on first access
+    [[nodiscard]] Data::Bytes& GetEmulatedSubResourceData(const SubResource::Index& sub_resource_index);
+
+private:
+    std::vector<Data::Bytes> m_emulated_sub_resources_data;
 };
 
 } // namespace Methane::Graphics::Null
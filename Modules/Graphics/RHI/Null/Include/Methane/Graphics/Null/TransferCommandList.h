@@ -25,20 +25,26 @@ Null implementation of the transfer command list interface.
 
 #include "CommandList.hpp"
 
-#include <Methane/Graphics/RHI/ITransferCommandList.h>
-#include <Methane/Graphics/Base/CommandList.h>
+#include <Methane/Graphics/Base/TransferCommandList.h>
 
 namespace Methane::Graphics::Null
 {
 
 class CommandQueue;
 
-class TransferCommandList final
-    : public CommandList<Base::CommandList>
-    , public Rhi::ITransferCommandList
+// Copy commands are emulated on CPU right at encoding time with resources data stored in memory
+class TransferCommandList final // NOSONAR - inheritance hierarchy depth is higher than 5
+    : public CommandList<Base::TransferCommandList>
 {
 public:
     explicit TransferCommandList(CommandQueue& command_queue);
+
+    // ITransferCommandList interface
+    void CopyBuffer(Rhi::IBuffer& src_buffer, Rhi::IBuffer& dst_buffer, const Rhi::BufferCopyRegion& copy_region) override;
+    void CopyBufferToTexture(Rhi::IBuffer& src_buffer, Data::Size src_offset, Rhi::ITexture& dst_texture, const Rhi::TextureCopyRegion& dst_region) override;
+    void CopyTextureToBuffer(Rhi::ITexture& src_texture, const Rhi::TextureCopyRegion& src_region, Rhi::IBuffer& dst_buffer, Data::Size dst_offset) override;
+    void CopyTexture(Rhi::ITexture& src_texture, const Rhi::TextureCopyRegion& src_region, Rhi::ITexture& dst_texture, const Rhi::TextureCopyRegion& dst_region) override;
+    void GenerateMipmaps(Rhi::ITexture& texture) override;
 };
 
 } // namespace Methane::Graphics::Null
@@ -23,6 +23,10 @@ Null implementation of the buffer interface.
 
 #include <Methane/Graphics/Null/Buffer.h>
 
+#include <Methane/Instrumentation.h>
+#include <Methane/Checks.hpp>
+
+#include <algorithm>
 #include <iterator>
 
 namespace Methane::Graphics::Null
@@ -30,12 +34,26 @@ namespace Methane::Graphics::Null
 
 Buffer::Buffer(const Base::Context& context, const Settings& settings)
     : Resource(context, settings)
+    , m_emulated_data(settings.size, Data::Byte{})
 {
 }
 
-Rhi::SubResource Buffer::GetData(Rhi::ICommandQueue&, const BytesRangeOpt&)
+Rhi::SubResource Buffer::GetData(Rhi::ICommandQueue&, const BytesRangeOpt& data_range)
 {
-    return {};
+    META_FUNCTION_TASK();
+    const Data::Size data_start = data_range ? data_range->GetStart() : 0U;
+    const Data::Size data_end   = data_range ? data_range->GetEnd()   : static_cast<Data::Size>(m_emulated_data.size());
+    META_CHECK_ARG_LESS_OR_EQUAL_DESCR(data_end, m_emulated_data.size(), "provided buffer data range is out of bounds");
+    return Rhi::SubResource(Data::Bytes(m_emulated_data.begin() + data_start, m_emulated_data.begin() + data_end), SubResource::Index(), data_range);
+}
+
+void Buffer::SetData(Rhi::ICommandQueue& target_cmd_queue, const SubResource& sub_resource)
+{
+    META_FUNCTION_TASK();
+    Base::Buffer::SetData(target_cmd_queue, sub_resource);
+
+    const Data::Size data_offset = sub_resource.HasDataRange() ? sub_resource.GetDataRange().GetStart() : 0U;
+    std::copy(sub_resource.GetDataPtr(), sub_resource.GetDataEndPtr(), m_emulated_data.begin() + data_offset);
 }
 
 } // namespace Methane::Graphics::Null
@@ -24,6 +24,11 @@ Null implementation of the compute command list interface.
 #include "Methane/Graphics/Base/ComputeCommandList.h"
 #include <Methane/Graphics/Null/ComputeCommandList.h>
 #include <Methane/Graphics/Null/CommandQueue.h>
+#include <Methane/Graphics/Null/Buffer.h>
+
+#include <Methane/Instrumentation.h>
+
+#include <cstring>
 
 namespace Methane::Graphics::Null
 {
@@ -38,4 +43,16 @@ void ComputeCommandList::Dispatch(const Rhi::ThreadGroupsCount& thread_groups_co
     Base::ComputeCommandList::Dispatch(thread_groups_count);
 }
 
+void ComputeCommandList::DispatchIndirect(Rhi::IBuffer& args_buffer, Data::Size args_offset)
+{
+    META_FUNCTION_TASK();
+    Base::ComputeCommandList::DispatchIndirect(args_buffer, args_offset);
+
+    Rhi::DispatchIndirectArguments dispatch_args;
+    std::memcpy(&dispatch_args, static_cast<const Buffer&>(args_buffer).GetEmulatedData().data() + args_offset, sizeof(dispatch_args));
+    m_dispatched_thread_groups_count = Rhi::ThreadGroupsCount(dispatch_args.thread_groups_count_x,
+                                                              dispatch_args.thread_groups_count_y,
+                                                              dispatch_args.thread_groups_count_z);
+}
+
 } // namespace Methane::Graphics::Null
@@ -24,6 +24,7 @@ Null implementation of the program bindings interface.
 #include <Methane/Graphics/Null/ProgramBindings.h>
 #include <Methane/Graphics/Null/Program.h>
 #include <Methane/Graphics/Null/Device.h>
+#include <Methane/Graphics/Base/Context.h>
 
 namespace Methane::Graphics::Null
 {
@@ -31,7 +32,15 @@ namespace Methane::Graphics::Null
 Ptr<Rhi::IProgramBindings> ProgramBindings::CreateCopy(const ResourceViewsByArgument& replace_resource_views_by_argument, const Opt<Data::Index>& frame_index)
 {
     META_FUNCTION_TASK();
-    return std::make_shared<ProgramBindings>(*this, replace_resource_views_by_argument, frame_index);
+    auto program_bindings_ptr = std::make_shared<ProgramBindings>(*this, replace_resource_views_by_argument, frame_index);
+    program_bindings_ptr->Initialize();
+    return program_bindings_ptr;
+}
+
+void ProgramBindings::Initialize()
+{
+    META_FUNCTION_TASK();
+    static_cast<Program&>(GetProgram()).GetContext().GetDescriptorManager().AddProgramBindings(*this);
 }
 
 } // namespace Methane::Graphics::Null
\ No newline at end of file
@@ -24,8 +24,11 @@ Null implementation of the texture interface.
 #include <Methane/Graphics/Null/Texture.h>
 #include <Methane/Graphics/Null/RenderContext.h>
 
+#include <Methane/Instrumentation.h>
 #include <Methane/Checks.hpp>
 
+#include <algorithm>
+
 namespace Methane::Graphics::Null
 {
 
@@ -41,9 +44,44 @@ Texture::Texture(const RenderContext& render_context, const Settings& settings,
     META_CHECK_ARG_EQUAL(frame_index, settings.frame_index_opt.value());
 }
 
-Rhi::SubResource Texture::GetData(Rhi::ICommandQueue&, const SubResource::Index&, const BytesRangeOpt&)
+Rhi::SubResource Texture::GetData(Rhi::ICommandQueue&, const SubResource::Index& sub_resource_index, const BytesRangeOpt& data_range)
+{
+    META_FUNCTION_TASK();
+    ValidateSubResource(sub_resource_index, data_range);
+
+    const Data::Bytes& sub_resource_data = GetEmulatedSubResourceData(sub_resource_index);
+    const Data::Size   data_start = data_range ? data_range->GetStart() : 0U;
+    const Data::Size   data_end   = data_range ? data_range->GetEnd()   : static_cast<Data::Size>(sub_resource_data.size());
+    return Rhi::SubResource(Data::Bytes(sub_resource_data.begin() + data_start, sub_resource_data.begin() + data_end), sub_resource_index, data_range);
+}
+
+void Texture::SetData(Rhi::ICommandQueue& target_cmd_queue, const SubResources& sub_resources)
+{
+    META_FUNCTION_TASK();
+    Base::Texture::SetData(target_cmd_queue, sub_resources);
+
+    for(const SubResource& sub_resource : sub_resources)
+    {
+        Data::Bytes& sub_resource_data = GetEmulatedSubResourceData(sub_resource.GetIndex());
+        const Data::Size data_size = std::min(sub_resource.GetDataSize(), static_cast<Data::Size>(sub_resource_data.size()));
+        std::copy(sub_resource.GetDataPtr(), sub_resource.GetDataPtr() + data_size, sub_resource_data.begin());
+    }
+}
+
+Data::Bytes& Texture::GetEmulatedSubResourceData(const SubResource::Index& sub_resource_index)
 {
-    return {};
+    META_FUNCTION_TASK();
+    const SubResource::Count& sub_resource_count = GetSubresourceCount();
+    META_CHECK_ARG_LESS(sub_resource_index, sub_resource_count);
+
+    if (m_emulated_sub_resources_data.empty())
+        m_emulated_sub_resources_data.resize(sub_resource_count.GetRawCount());
+
+    Data::Bytes& sub_resource_data = m_emulated_sub_resources_data[sub_resource_index.GetRawIndex(sub_resource_count)];
+    if (sub_resource_data.empty())
+        sub_resource_data.resize(GetSubResourceDataSize(sub_resource_index), Data::Byte{});
+
+    return sub_resource_data;
 }
 
 } // namespace Methane::Graphics::Null
@@ -23,12 +23,219 @@ Null implementation of the transfer command list interface.
 
 #include <Methane/Graphics/Null/TransferCommandList.h>
 #include <Methane/Graphics/Null/CommandQueue.h>
+#include <Methane/Graphics/Null/Buffer.h>
+#include <Methane/Graphics/Null/Texture.h>
+
+#include <Methane/Instrumentation.h>
+
+#include <Methane/Checks.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <type_traits>
 
 namespace Methane::Graphics::Null
 {
 
+// Copies rectangle of pixel rows between tightly packed sub-resource images of the given width
+static void CopyPixelRows(const Data::Byte* src_data_ptr, uint32_t src_row_pixels, const Point2U& src_origin,
+                          Data::Byte* dst_data_ptr, uint32_t dst_row_pixels, const Point2U& dst_origin,
+                          const Data::FrameSize& copy_size, Data::Size pixel_size)
+{
+    META_FUNCTION_TASK();
+    const Data::Size copy_row_size = copy_size.GetWidth() * pixel_size;
+    for(uint32_t row_index = 0U; row_index < copy_size.GetHeight(); ++row_index)
+    {
+        const Data::Byte* src_row_ptr = src_data_ptr + ((src_origin.GetY() + row_index) * src_row_pixels + src_origin.GetX()) * pixel_size;
+        Data::Byte*       dst_row_ptr = dst_data_ptr + ((dst_origin.GetY() + row_index) * dst_row_pixels + dst_origin.GetX()) * pixel_size;
+        std::copy(src_row_ptr, src_row_ptr + copy_row_size, dst_row_ptr);
+    }
+}
+
+// Downsamples mip level with 2x2 box filter averaging each pixel component of the given type,
+// source pixels are clamped to the edges of the previous mip level with odd dimensions
+template<typename ComponentType>
+static void DownsampleMipLevel(const Data::Bytes& src_data, const Data::FrameSize& src_size,
+                               Data::Bytes& dst_data, const Data::FrameSize& dst_size, Data::Size pixel_size)
+{
+    META_FUNCTION_TASK();
+    const Data::Size components_count = pixel_size / static_cast<Data::Size>(sizeof(ComponentType));
+    for(uint32_t y = 0U; y < dst_size.GetHeight(); ++y)
+    {
+        const uint32_t src_y0 = std::min(y * 2U, src_size.GetHeight() - 1U);
+        const uint32_t src_y1 = std::min(y * 2U + 1U, src_size.GetHeight() - 1U);
+        for(uint32_t x = 0U; x < dst_size.GetWidth(); ++x)
+        {
+            const uint32_t src_x0 = std::min(x * 2U, src_size.GetWidth() - 1U);
+            const uint32_t src_x1 = std::min(x * 2U + 1U, src_size.GetWidth() - 1U);
+            const std::array<const Data::Byte*, 4> src_pixel_ptrs{
+                src_data.data() + (src_y0 * src_size.GetWidth() + src_x0) * pixel_size,
+                src_data.data() + (src_y0 * src_size.GetWidth() + src_x1) * pixel_size,
+                src_data.data() + (src_y1 * src_size.GetWidth() + src_x0) * pixel_size,
+                src_data.data() + (src_y1 * src_size.GetWidth() + src_x1) * pixel_size
+            };
+            Data::Byte* dst_pixel_ptr = dst_data.data() + (y * dst_size.GetWidth() + x) * pixel_size;
+
+            for(Data::Size component_index = 0U; component_index < components_count; ++component_index)
+            {
+                const Data::Size component_offset = component_index * static_cast<Data::Size>(sizeof(ComponentType));
+                double components_sum = 0.0;
+                for(const Data::Byte* src_pixel_ptr : src_pixel_ptrs)
+                {
+                    ComponentType src_component{};
+                    std::memcpy(&src_component, src_pixel_ptr + component_offset, sizeof(ComponentType));
+                    components_sum += static_cast<double>(src_component);
+                }
+
+                const double components_average = components_sum / static_cast<double>(src_pixel_ptrs.size());
+                ComponentType dst_component{};
+                if constexpr (std::is_floating_point_v<ComponentType>)
+                    dst_component = static_cast<ComponentType>(components_average);
+                else
+                    dst_component = static_cast<ComponentType>(std::round(components_average));
+                std::memcpy(dst_pixel_ptr + component_offset, &dst_component, sizeof(ComponentType));
+            }
+        }
+    }
+}
+
+// Point sampling is used for pixel formats without CPU arithmetic type of pixel components
+static void PointSampleMipLevel(const Data::Bytes& src_data, const Data::FrameSize& src_size,
+                                Data::Bytes& dst_data, const Data::FrameSize& dst_size, Data::Size pixel_size)
+{
+    META_FUNCTION_TASK();
+    for(uint32_t y = 0U; y < dst_size.GetHeight(); ++y)
+    {
+        const uint32_t src_y = std::min(y * 2U, src_size.GetHeight() - 1U);
+        for(uint32_t x = 0U; x < dst_size.GetWidth(); ++x)
+        {
+            const uint32_t src_x = std::min(x * 2U, src_size.GetWidth() - 1U);
+            std::copy_n(src_data.begin() + (src_y * src_size.GetWidth() + src_x) * pixel_size, pixel_size,
+                        dst_data.begin() + (y * dst_size.GetWidth() + x) * pixel_size);
+        }
+    }
+}
+
+static void GenerateMipLevel(PixelFormat pixel_format, const Data::Bytes& src_data, const Data::FrameSize& src_size,
+                             Data::Bytes& dst_data, const Data::FrameSize& dst_size)
+{
+    META_FUNCTION_TASK();
+    const Data::Size pixel_size = GetPixelSize(pixel_format);
+    switch(pixel_format)
+    {
+    case PixelFormat::RGBA8:
+    case PixelFormat::RGBA8Unorm:
+    case PixelFormat::RGBA8Unorm_sRGB:
+    case PixelFormat::BGRA8Unorm:
+    case PixelFormat::BGRA8Unorm_sRGB:
+    case PixelFormat::R8Uint:
+    case PixelFormat::R8Unorm:
+    case PixelFormat::A8Unorm:      DownsampleMipLevel<uint8_t>(src_data, src_size, dst_data, dst_size, pixel_size); break;
+    case PixelFormat::R8Sint:
+    case PixelFormat::R8Snorm:      DownsampleMipLevel<int8_t>(src_data, src_size, dst_data, dst_size, pixel_size); break;
+    case PixelFormat::R16Uint:
+    case PixelFormat::R16Unorm:     DownsampleMipLevel<uint16_t>(src_data, src_size, dst_data, dst_size, pixel_size); break;
+    case PixelFormat::R16Sint:
+    case PixelFormat::R16Snorm:     DownsampleMipLevel<int16_t>(src_data, src_size, dst_data, dst_size, pixel_size); break;
+    case PixelFormat::R32Uint:      DownsampleMipLevel<uint32_t>(src_data, src_size, dst_data, dst_size, pixel_size); break;
+    case PixelFormat::R32Sint:      DownsampleMipLevel<int32_t>(src_data, src_size, dst_data, dst_size, pixel_size); break;
+    case PixelFormat::R32Float:
+    case PixelFormat::Depth32Float: DownsampleMipLevel<float>(src_data, src_size, dst_data, dst_size, pixel_size); break;
+    case PixelFormat::R16Float:     PointSampleMipLevel(src_data, src_size, dst_data, dst_size, pixel_size); break;
+    default:                        META_UNEXPECTED_ARG(pixel_format);
+    }
+}
+
 TransferCommandList::TransferCommandList(CommandQueue& command_queue)
-    : CommandList(command_queue, Rhi::CommandListType::Transfer)
+    : CommandList(command_queue)
 { }
 
+void TransferCommandList::CopyBuffer(Rhi::IBuffer& src_buffer, Rhi::IBuffer& dst_buffer, const Rhi::BufferCopyRegion& copy_region)
+{
+    META_FUNCTION_TASK();
+    Base::TransferCommandList::CopyBuffer(src_buffer, dst_buffer, copy_region);
+
+    const Data::Bytes& src_data = static_cast<const Buffer&>(src_buffer).GetEmulatedData();
+    Data::Bytes&       dst_data = static_cast<Buffer&>(dst_buffer).GetEmulatedData();
+    std::copy_n(src_data.begin() + copy_region.src_offset, copy_region.size, dst_data.begin() + copy_region.dst_offset);
+}
+
+void TransferCommandList::CopyBufferToTexture(Rhi::IBuffer& src_buffer, Data::Size src_offset, Rhi::ITexture& dst_texture, const Rhi::TextureCopyRegion& dst_region)
+{
+    META_FUNCTION_TASK();
+    Base::TransferCommandList::CopyBufferToTexture(src_buffer, src_offset, dst_texture, dst_region);
+
+    auto& null_dst_texture = static_cast<Texture&>(dst_texture);
+    const Rhi::TextureCopyRegion resolved_dst_region = GetResolvedCopyRegion(null_dst_texture, dst_region);
+    const Data::Size      pixel_size = GetPixelSize(dst_texture.GetSettings().pixel_format);
+    const Data::FrameSize mip_size   = null_dst_texture.GetMipLevelFrameSize(resolved_dst_region.subresource_index.GetMipLevel());
+    CopyPixelRows(static_cast<const Buffer&>(src_buffer).GetEmulatedData().data() + src_offset,
+                  resolved_dst_region.rect.size.GetWidth(), Point2U(),
+                  null_dst_texture.GetEmulatedSubResourceData(resolved_dst_region.subresource_index).data(),
+                  mip_size.GetWidth(), resolved_dst_region.rect.origin,
+                  resolved_dst_region.rect.size, pixel_size);
+}
+
+void TransferCommandList::CopyTextureToBuffer(Rhi::ITexture& src_texture, const Rhi::TextureCopyRegion& src_region, Rhi::IBuffer& dst_buffer, Data::Size dst_offset)
+{
+    META_FUNCTION_TASK();
+    Base::TransferCommandList::CopyTextureToBuffer(src_texture, src_region, dst_buffer, dst_offset);
+
+    auto& null_src_texture = static_cast<Texture&>(src_texture);
+    const Rhi::TextureCopyRegion resolved_src_region = GetResolvedCopyRegion(null_src_texture, src_region);
+    const Data::Size      pixel_size = GetPixelSize(src_texture.GetSettings().pixel_format);
+    const Data::FrameSize mip_size   = null_src_texture.GetMipLevelFrameSize(resolved_src_region.subresource_index.GetMipLevel());
+    CopyPixelRows(null_src_texture.GetEmulatedSubResourceData(resolved_src_region.subresource_index).data(),
+                  mip_size.GetWidth(), resolved_src_region.rect.origin,
+                  static_cast<Buffer&>(dst_buffer).GetEmulatedData().data() + dst_offset,
+                  resolved_src_region.rect.size.GetWidth(), Point2U(),
+                  resolved_src_region.rect.size, pixel_size);
+}
+
+void TransferCommandList::CopyTexture(Rhi::ITexture& src_texture, const Rhi::TextureCopyRegion& src_region, Rhi::ITexture& dst_texture, const Rhi::TextureCopyRegion& dst_region)
+{
+    META_FUNCTION_TASK();
+    Base::TransferCommandList::CopyTexture(src_texture, src_region, dst_texture, dst_region);
+
+    auto& null_src_texture = static_cast<Texture&>(src_texture);
+    auto& null_dst_texture = static_cast<Texture&>(dst_texture);
+    const Rhi::TextureCopyRegion resolved_src_region = GetResolvedCopyRegion(null_src_texture, src_region);
+    CopyPixelRows(null_src_texture.GetEmulatedSubResourceData(resolved_src_region.subresource_index).data(),
+                  null_src_texture.GetMipLevelFrameSize(resolved_src_region.subresource_index.GetMipLevel()).GetWidth(),
+                  resolved_src_region.rect.origin,
+                  null_dst_texture.GetEmulatedSubResourceData(dst_region.subresource_index).data(),
+                  null_dst_texture.GetMipLevelFrameSize(dst_region.subresource_index.GetMipLevel()).GetWidth(),
+                  dst_region.rect.origin,
+                  resolved_src_region.rect.size, GetPixelSize(src_texture.GetSettings().pixel_format));
+}
+
+void TransferCommandList::GenerateMipmaps(Rhi::ITexture& texture)
+{
+    META_FUNCTION_TASK();
+    Base::TransferCommandList::GenerateMipmaps(texture);
+
+    // Mip levels are emulated with 2x2 box filtering of the previous level
+    auto& null_texture = static_cast<Texture&>(texture);
+    const Rhi::SubResource::Count& subresource_count = null_texture.GetSubresourceCount();
+    const PixelFormat pixel_format = texture.GetSettings().pixel_format;
+
+    for(uint32_t base_layer_index = 0U; base_layer_index < subresource_count.GetBaseLayerCount(); ++base_layer_index)
+    {
+        for(uint32_t mip_level = 1U; mip_level < subresource_count.GetMipLevelsCount(); ++mip_level)
+        {
+            const Rhi::SubResource::Index src_index(base_layer_index * subresource_count.GetMipLevelsCount() + mip_level - 1U, subresource_count);
+            const Rhi::SubResource::Index dst_index(base_layer_index * subresource_count.GetMipLevelsCount() + mip_level, subresource_count);
+            const Data::FrameSize src_size = null_texture.GetMipLevelFrameSize(mip_level - 1U);
+            const Data::FrameSize dst_size = null_texture.GetMipLevelFrameSize(mip_level);
+            const Data::Bytes& src_data = null_texture.GetEmulatedSubResourceData(src_index);
+            Data::Bytes&       dst_data = null_texture.GetEmulatedSubResourceData(dst_index);
+            GenerateMipLevel(pixel_format, src_data, src_size, dst_data, dst_size);
+        }
+    }
+
+    texture.SetState(Rhi::ResourceState::ShaderResource);
+}
+
 } // namespace Methane::Graphics::Null
@@ -40,12 +40,10 @@ public:
     Buffer(const Base::Context& context, const Settings& settings);
 
     // IBuffer interface
+    MappedSpan GetMappedSpan() const noexcept override;
     void SetData(Rhi::ICommandQueue& target_cmd_queue, const SubResource& sub_resource) override;
     SubResource GetData(Rhi::ICommandQueue& target_cmd_queue, const BytesRangeOpt& data_range = {}) override;
 
-    // IObject interface
-    bool SetName(std::string_view name) override;
-
 protected:
     // Resource override
     Ptr<ResourceView::ViewDescriptorVariant> CreateNativeViewDescriptor(const View::Id& view_id) override;
@@ -53,10 +51,6 @@ protected:
 private:
     Data::Bytes GetDataFromSharedBuffer(const BytesRange& data_range) const;
     Data::Bytes GetDataFromPrivateBuffer(const BytesRange& data_range, Rhi::ICommandQueue& target_cmd_queue);
-
-    vk::UniqueBuffer       m_vk_unique_staging_buffer;
-    vk::UniqueDeviceMemory m_vk_unique_staging_memory;
-    vk::BufferCopy         m_vk_copy_region;
 };
 
 } // namespace Methane::Graphics::Vulkan
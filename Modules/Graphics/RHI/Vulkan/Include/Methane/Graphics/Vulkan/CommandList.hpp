@@ -187,6 +187,11 @@ public:
         const auto& vulkan_resource_barriers = static_cast<const ResourceBarriers&>(resource_barriers);
         const ResourceBarriers::NativePipelineBarrier& pipeline_barrier = vulkan_resource_barriers.GetNativePipelineBarrierData(GetVulkanCommandQueue());
 
+        // Native barriers are counted like in DirectX, their count may differ from the count of resource barriers
+        CommandListBaseT::CountResourceBarriers(pipeline_barrier.vk_memory_barriers.size() +
+                                                pipeline_barrier.vk_buffer_memory_barriers.size() +
+                                                pipeline_barrier.vk_image_memory_barriers.size());
+
         GetNativeCommandBuffer(CommandBufferType::Primary).pipelineBarrier(
             pipeline_barrier.vk_src_stage_mask,
             pipeline_barrier.vk_dst_stage_mask,
@@ -291,8 +296,10 @@ protected:
     void ApplyProgramBindings(Base::ProgramBindings& program_bindings, Rhi::ProgramBindingsApplyBehaviorMask apply_behavior) final
     {
         // Optimization to skip dynamic_cast required to call Apply method of the Base::ProgramBinding implementation
-        static_cast<ProgramBindings&>(program_bindings).Apply(*this, Base::CommandList::GetCommandQueue(),
-                                                                Base::CommandList::GetProgramBindingsPtr(), apply_behavior);
+        Base::CommandList::CountDescriptorSetBinds(
+            static_cast<ProgramBindings&>(program_bindings).Apply(*this, Base::CommandList::GetCommandQueue(),
+                                                                    Base::CommandList::GetProgramBindingsPtr(), apply_behavior)
+        );
     }
 
     void SetCommandBufferInheritInfo(const vk::CommandBufferInheritanceInfo& secondary_render_buffer_inherit_info,
@@ -23,30 +23,39 @@ Vulkan command list set implementation.
 
 #pragma once
 
+#include "CommandQueue.h"
+
 #include <Methane/Graphics/Base/CommandListSet.h>
 #include <Methane/Instrumentation.h>
 
 #include <vulkan/vulkan.hpp>
+#include <array>
+#include <atomic>
 #include <mutex>
 
 namespace Methane::Graphics::Vulkan
 {
 
-class CommandQueue;
-
 class CommandListSet final
     : public Base::CommandListSet
 {
 public:
+    using SubmitInfo = std::pair<vk::SubmitInfo, vk::TimelineSemaphoreSubmitInfo>;
+
     CommandListSet(const Refs<Rhi::ICommandList>& command_list_refs, Opt<Data::Index> frame_index_opt);
 
     // Base::CommandListSet interface
     void Execute(const Rhi::ICommandList::CompletedCallback& completed_callback) override;
     void WaitUntilCompleted() override;
 
+    // Execute as a part of command queue submission, where completion is signalled with the queue timeline semaphore value
+    [[nodiscard]] SubmitInfo ExecuteInBatch(const Rhi::ICommandList::CompletedCallback& completed_callback,
+                                            const CommandQueue::WaitInfo& wait_before_executing, uint64_t execution_timeline_value);
+
     const std::vector<vk::CommandBuffer>& GetNativeCommandBuffers() const noexcept { return m_vk_command_buffers; }
     const vk::Semaphore& GetNativeExecutionCompletedSemaphore() const noexcept     { return m_vk_unique_execution_completed_semaphore.get(); }
     const vk::Fence&     GetNativeExecutionCompletedFence() const noexcept         { return m_vk_unique_execution_completed_fence.get(); }
+    uint64_t             GetExecutionTimelineValue() const noexcept                { return m_execution_timeline_value; }
 
     CommandQueue&       GetVulkanCommandQueue() noexcept;
     const CommandQueue& GetVulkanCommandQueue() const noexcept;
@@ -56,8 +65,7 @@ protected:
     void OnObjectNameChanged(Rhi::IObject& object, const std::string& old_name) override;
 
 private:
-    using SubmitInfo = std::pair<vk::SubmitInfo, vk::TimelineSemaphoreSubmitInfo>;
-    SubmitInfo GetSubmitInfo();
+    SubmitInfo GetSubmitInfo(const CommandQueue::WaitInfo& wait_before_executing);
     const std::vector<vk::Semaphore>&          GetWaitSemaphores();
     const std::vector<vk::PipelineStageFlags>& GetWaitStages();
     const std::vector<uint64_t>&               GetWaitValues();
@@ -72,6 +80,9 @@ private:
     vk::UniqueSemaphore                 m_vk_unique_execution_completed_semaphore;
     vk::UniqueFence                     m_vk_unique_execution_completed_fence;
     bool                                m_signalled_execution_completed_fence = false;
+    std::atomic<uint64_t>               m_execution_timeline_value{ 0U };
+    std::array<vk::Semaphore, 2>        m_vk_batch_signal_semaphores;
+    std::array<uint64_t, 2>             m_batch_signal_values{ };
     TracyLockable(std::mutex,           m_execution_completed_fence_mutex);
 };
 
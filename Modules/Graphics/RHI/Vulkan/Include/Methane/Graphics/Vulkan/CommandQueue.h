@@ -59,7 +59,6 @@ public:
     [[nodiscard]] Ptr<Rhi::IParallelRenderCommandList> CreateParallelRenderCommandList(Rhi::IRenderPass& render_pass) override;
     [[nodiscard]] Ptr<Rhi::ITimestampQueryPool>        CreateTimestampQueryPool(uint32_t max_timestamps_per_frame) override;
     uint32_t GetFamilyIndex() const noexcept override { return m_queue_family_index; }
-    void Execute(Rhi::ICommandListSet& command_list_set, const Rhi::ICommandList::CompletedCallback& completed_callback = {}) override;
 
     // IObject interface
     bool SetName(std::string_view name) override;
@@ -81,9 +80,11 @@ public:
 
     vk::PipelineStageFlags GetNativeSupportedStageFlags() const noexcept    { return m_vk_supported_stage_flags; }
     vk::AccessFlags        GetNativeSupportedAccessFlags() const noexcept   { return m_vk_supported_access_flags; }
+    const vk::Semaphore&   GetNativeExecutionTimelineSemaphore() const noexcept { return m_vk_unique_execution_timeline_semaphore.get(); }
 
 protected:
-    // Base::CommandQueueTracking override
+    // Base::CommandQueueTracking overrides
+    void ExecuteCommandListSets(const CommandListSetExecutions& command_list_set_executions) override;
     void CompleteCommandListSetExecution(Base::CommandListSet& executing_command_list_set) override;
 
 private:
@@ -95,6 +96,8 @@ private:
 
     void Reset();
     void AddWaitForFrameExecution(const Rhi::ICommandListSet& command_list_set);
+    void SubmitCommandListSets(const CommandListSetExecutions& command_list_set_executions);
+    void ClearWaitBeforeExecuting();
 
     using FrameWaitInfos = std::vector<WaitInfo>;
 
@@ -104,6 +107,8 @@ private:
     vk::Queue              m_vk_queue;
     vk::PipelineStageFlags m_vk_supported_stage_flags;
     vk::AccessFlags        m_vk_supported_access_flags;
+    vk::UniqueSemaphore    m_vk_unique_execution_timeline_semaphore;
+    uint64_t               m_execution_timeline_value = 0U;
     WaitInfo               m_wait_before_executing;
     mutable WaitInfo       m_wait_execution_completed;
     FrameWaitInfos         m_wait_frame_execution_completed;
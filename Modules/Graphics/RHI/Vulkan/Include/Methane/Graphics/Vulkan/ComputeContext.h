@@ -35,6 +35,17 @@ class ComputeContext final // NOSONAR - inheritance hierarchy depth is greater t
 {
 public:
     using Context::Context;
+
+    // IContext overrides
+    void WaitForGpu(WaitFor wait_for) override
+    {
+        META_FUNCTION_TASK();
+        Context::WaitForGpu(wait_for);
+
+        // All compute commands are completed, so released descriptor sets can be recycled
+        if (wait_for == WaitFor::ComputeComplete || wait_for == WaitFor::RenderComplete)
+            GetVulkanDescriptorManager().OnComputeCompleted();
+    }
 };
 
 } // namespace Methane::Graphics::Vulkan
@@ -33,6 +33,7 @@ Vulkan template implementation of the base context interface.
 #include "Texture.h"
 #include "Sampler.h"
 #include "DescriptorManager.h"
+#include "UploadRing.h"
 
 #include <Methane/Graphics/RHI/IRenderContext.h>
 #include <Methane/Graphics/RHI/ICommandKit.h>
@@ -40,6 +41,7 @@ Vulkan template implementation of the base context interface.
 
 #include <string>
 #include <map>
+#include <mutex>
 
 namespace Methane::Graphics::Vulkan
 {
@@ -50,6 +52,9 @@ class Context
     , public IContext
 {
 public:
+    // Staging memory reserved in upload ring for resource uploads of each frame in flight
+    static constexpr vk::DeviceSize upload_ring_frame_size = 8U * 1024U * 1024U;
+
     Context(Base::Device& device, tf::Executor& parallel_executor, const typename ContextBaseT::Settings& settings)
         : ContextBaseT(device, std::make_unique<DescriptorManager>(*this), parallel_executor, settings)
     { }
@@ -62,6 +67,15 @@ public:
         // to release all descriptor sets using live device instance
         ContextBaseT::GetDescriptorManager().Release();
 
+        // Pipeline cache is saved on context release to warm start pipelines creation on next launch
+        ContextBaseT::GetBaseDevice().FlushPipelineCache();
+
+        // Upload ring staging memory has to be released before destroying device memory allocator
+        {
+            std::scoped_lock lock_guard(m_upload_ring_mutex);
+            m_upload_ring_ptr.reset();
+        }
+
         ContextBaseT::Release();
     }
 
@@ -125,6 +139,24 @@ public:
     {
         return static_cast<DescriptorManager&>(ContextBaseT::GetDescriptorManager());
     }
+
+    UploadRing& GetVulkanUploadRing() const final
+    {
+        META_FUNCTION_TASK();
+        std::scoped_lock lock_guard(m_upload_ring_mutex);
+        if (m_upload_ring_ptr)
+            return *m_upload_ring_ptr;
+
+        const uint32_t frames_count = ContextBaseT::GetType() == Rhi::ContextType::Render
+                                    ? dynamic_cast<const Rhi::IRenderContext&>(*this).GetSettings().frame_buffers_count
+                                    : 1U;
+        m_upload_ring_ptr = std::make_unique<UploadRing>(GetVulkanDevice(), upload_ring_frame_size * frames_count);
+        return *m_upload_ring_ptr;
+    }
+
+private:
+    mutable UniquePtr<UploadRing>        m_upload_ring_ptr;
+    mutable TracyLockable(std::mutex,    m_upload_ring_mutex);
 };
 
 } // namespace Methane::Graphics::Vulkan
@@ -17,17 +17,21 @@ limitations under the License.
 *******************************************************************************
 
 FILE: Methane/Graphics/Vulkan/DescriptorManager.h
-Vulkan descriptor manager with descriptor sets allocator.
+Vulkan descriptor manager with persistent descriptor sets allocator recycling released sets
+and per-frame transient descriptor sets allocator with pools reset on frame completion.
 
 ******************************************************************************/
 
 #pragma once
 
 #include <Methane/Graphics/Base/DescriptorManager.h>
+#include <Methane/Graphics/Base/TransientFramePools.hpp>
+#include <Methane/Data/Types.h>
 #include <Methane/Instrumentation.h>
 
 #include <vulkan/vulkan.hpp>
 #include <map>
+#include <set>
 #include <optional>
 #include <mutex>
 
@@ -55,6 +59,7 @@ class DescriptorManager final
 {
 public:
     using PoolSizeRatioByDescType = std::map<vk::DescriptorType, float>;
+    using LayoutBindings          = std::vector<vk::DescriptorSetLayoutBinding>;
 
     DescriptorManager(Base::Context& context, uint32_t pool_sets_count = 1000U,
                         const PoolSizeRatioByDescType& pool_size_ratio_by_desc_type = {
@@ -73,23 +78,68 @@ public:
 
     // IDescriptorManager overrides
     void Release() override;
+    Rhi::DescriptorStatistics GetStatistics() const override;
 
+    // Explicitly set size ratio is not changed by auto-tuning from observed descriptors usage
     void SetDescriptorPoolSizeRatio(vk::DescriptorType descriptor_type, float size_ratio);
-    vk::DescriptorSet AllocDescriptorSet(vk::DescriptorSetLayout layout);
+    PoolSizeRatioByDescType GetDescriptorPoolSizeRatios() const;
+
+    // Persistent descriptor set is valid until released, released sets are reused for allocations with the same layout
+    vk::DescriptorSet AllocDescriptorSet(const vk::DescriptorSetLayout& layout, const LayoutBindings& layout_bindings);
+    void ReleaseDescriptorSet(const vk::DescriptorSetLayout& layout, const vk::DescriptorSet& descriptor_set);
+    void ReleaseDescriptorSetLayout(const vk::DescriptorSetLayout& layout);
+
+    // Transient descriptor set is valid only for the current frame, its pool is reset when frame execution is completed on GPU
+    vk::DescriptorSet AllocTransientDescriptorSet(const vk::DescriptorSetLayout& layout, const LayoutBindings& layout_bindings);
+
+    // Frame notifications are sent by render context
+    void OnFramePresented(Data::Index frame_buffer_index, Data::Index frame_index);
+    void OnFrameCompleted(Data::Index frame_buffer_index);
+    void OnGpuIdle(Data::Index current_frame_index);
+
+    // Compute context has no frames, so sets released before completion of all compute commands are recycled
+    void OnComputeCompleted();
 
 private:
+    struct RetiredDescriptorSet
+    {
+        vk::DescriptorSetLayout layout;
+        vk::DescriptorSet       descriptor_set;
+        Data::Index             frame_index;
+    };
+
+    using DescriptorSetsByLayout = std::map<vk::DescriptorSetLayout, std::vector<vk::DescriptorSet>>;
+    using PoolByDescriptorSet    = std::map<vk::DescriptorSet, vk::DescriptorPool>;
+    using TransientPools         = Base::TransientFramePools<vk::DescriptorPool>;
+
+    vk::DescriptorSet  TryAllocDescriptorSet(const vk::DescriptorPool& vk_pool, const vk::DescriptorSetLayout& layout);
     vk::DescriptorPool CreateDescriptorPool();
     vk::DescriptorPool AcquireDescriptorPool();
+    void               ObserveDescriptorsUsage(const LayoutBindings& layout_bindings);
+    void               TuneDescriptorPoolSizeRatios();
+    void               CompleteFrames(Data::Index completed_frame_index);
+    void               FreeDescriptorSets(const std::vector<vk::DescriptorSet>& descriptor_sets);
+    Data::Index        GetCurrentFrameIndex() const; // compute completions count is used as frame index in compute context
     const IContext&    GetContextVk();
 
-    const IContext*                       m_vk_context_ptr = nullptr;
-    uint32_t                              m_pool_sets_count;
-    PoolSizeRatioByDescType               m_pool_size_ratio_by_desc_type;
-    std::vector<vk::UniqueDescriptorPool> m_vk_descriptor_pools;
-    std::vector<vk::DescriptorPool>       m_vk_used_pools;
-    std::vector<vk::DescriptorPool>       m_vk_free_pools;
-    vk::DescriptorPool                    m_vk_current_pool;
-    TracyLockable(std::mutex,             m_descriptor_pool_mutex);
+    const IContext*                          m_vk_context_ptr = nullptr;
+    uint32_t                                 m_pool_sets_count;
+    PoolSizeRatioByDescType                  m_pool_size_ratio_by_desc_type;
+    std::set<vk::DescriptorType>             m_fixed_ratio_desc_types;
+    std::map<vk::DescriptorType, uint64_t>   m_observed_descriptors_count_by_type;
+    std::map<vk::DescriptorType, uint32_t>   m_max_set_descriptors_count_by_type;
+    uint64_t                                 m_observed_sets_count = 0U;
+    std::vector<vk::UniqueDescriptorPool>    m_vk_descriptor_pools;
+    std::vector<vk::DescriptorPool>          m_vk_used_pools;
+    std::vector<vk::DescriptorPool>          m_vk_free_pools;
+    vk::DescriptorPool                       m_vk_current_pool;
+    PoolByDescriptorSet                      m_vk_pool_by_descriptor_set;
+    DescriptorSetsByLayout                   m_recycled_sets_by_layout;
+    std::vector<RetiredDescriptorSet>        m_retired_sets;
+    TransientPools                           m_transient_pools;
+    std::vector<Opt<Data::Index>>            m_presented_frame_index_by_frame;
+    Data::Index                              m_compute_completions_count = 0U;
+    mutable TracyLockable(std::mutex,        m_descriptor_pool_mutex);
 };
 
 } // namespace Methane::Graphics::Vulkan
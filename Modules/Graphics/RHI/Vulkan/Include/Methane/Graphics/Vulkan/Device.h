@@ -23,6 +23,9 @@ Vulkan implementation of the device interface.
 
 #pragma once
 
+#include "MemoryAllocator.h"
+#include "PipelineCache.h"
+
 #include <Methane/Graphics/Base/Device.h>
 #include <Methane/Graphics/RHI/ICommandQueue.h>
 #include <Methane/Platform/AppEnvironment.h>
@@ -63,7 +66,7 @@ private:
     mutable Data::RangeSet<uint32_t> m_free_indices;
 };
 
-class Device final
+class Device final // NOSONAR - custom destructor is required
     : public Base::Device
 {
 public:
@@ -83,10 +86,13 @@ public:
     static Rhi::DeviceFeatureMask GetSupportedFeatures(const vk::PhysicalDevice& vk_physical_device);
 
     Device(const vk::PhysicalDevice& vk_physical_device, const vk::SurfaceKHR& vk_surface, const Capabilities& capabilities);
+    ~Device() override;
 
     // IDevice interface
     [[nodiscard]] Ptr<Rhi::IRenderContext> CreateRenderContext(const Methane::Platform::AppEnvironment& env, tf::Executor& parallel_executor, const Rhi::RenderContextSettings& settings) override;
     [[nodiscard]] Ptr<Rhi::IComputeContext> CreateComputeContext(tf::Executor& parallel_executor, const Rhi::ComputeContextSettings& settings) override;
+    [[nodiscard]] MemoryStatistics GetMemoryStatistics() const override;
+    bool FlushPipelineCache() override;
 
     // IObject interface
     bool SetName(std::string_view name) override;
@@ -101,6 +107,13 @@ public:
     const vk::QueueFamilyProperties& GetNativeQueueFamilyProperties(uint32_t queue_family_index) const;
     bool                             IsExtensionSupported(std::string_view required_extension) const;
     bool                             IsDynamicStateSupported() const noexcept { return m_is_dynamic_state_supported; }
+    bool                             IsMultiDrawIndirectSupported() const noexcept { return m_is_multi_draw_indirect_supported; }
+    MemoryAllocator&                 GetMemoryAllocator() const;
+    const vk::PipelineCache&         GetNativePipelineCache() const;
+
+protected:
+    // Base::Device overrides
+    [[nodiscard]] UniquePtr<Base::ExecutionCompletionService> CreateExecutionCompletionService() const override;
 
 private:
     using QueueFamilyReservationByType = std::map<Rhi::CommandListType, Ptr<QueueFamilyReservation>>;
@@ -110,13 +123,18 @@ private:
                             const vk::SurfaceKHR& vk_surface = vk::SurfaceKHR());
 
     Rhi::DeviceFeatureMask GetSupportedFeatures() const;
+    void LoadPipelineCache();
 
     vk::PhysicalDevice                     m_vk_physical_device;
     const std::vector<std::string>         m_supported_extension_names_storage;
     const std::set<std::string_view>       m_supported_extension_names_set;
     const bool                             m_is_dynamic_state_supported = false;
+    const bool                             m_is_multi_draw_indirect_supported = false;
     std::vector<vk::QueueFamilyProperties> m_vk_queue_family_properties;
     vk::UniqueDevice                       m_vk_unique_device;
+    UniquePtr<MemoryAllocator>             m_memory_allocator_ptr; // released before device
+    UniquePtr<PipelineCache>               m_pipeline_cache_ptr;   // released before device
+    std::string                            m_loaded_pipeline_cache_path;
     QueueFamilyReservationByType           m_queue_family_reservation_by_type;
 };
 
@@ -0,0 +1,63 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+FILE: Methane/Graphics/Vulkan/ExecutionCompletionService.h
+Vulkan implementation of the command list sets execution completion service
+waiting for any of the command queue timeline semaphores.
+
+******************************************************************************/
+
+#pragma once
+
+#include <Methane/Graphics/Base/ExecutionCompletionService.h>
+#include <Methane/Instrumentation.h>
+
+#include <vulkan/vulkan.hpp>
+#include <vector>
+#include <atomic>
+#include <mutex>
+
+namespace Methane::Graphics::Vulkan
+{
+
+class ExecutionCompletionService final // NOSONAR - destructor is required
+    : public Base::ExecutionCompletionService
+{
+public:
+    explicit ExecutionCompletionService(const vk::Device& vk_device);
+    ~ExecutionCompletionService() override;
+
+protected:
+    // Base::ExecutionCompletionService overrides
+    void WaitForAnyCompleted(const Ptrs<Base::CommandListSet>& command_list_sets) override;
+    [[nodiscard]] bool IsCompleted(const Base::CommandListSet& command_list_set) const override;
+    void ResetWaitingInterrupt() override;
+    void InterruptWaiting() override;
+
+private:
+    const vk::Device&          m_vk_device;
+    vk::UniqueSemaphore        m_vk_unique_interrupt_semaphore;
+    std::atomic<bool>          m_is_interrupt_pending{ false };
+    TracyLockable(std::mutex,  m_interrupt_mutex);
+
+    // Accessed only from the completion thread
+    uint64_t                   m_interrupt_wait_value = 0U;
+    std::vector<vk::Semaphore> m_vk_wait_semaphores;
+    std::vector<uint64_t>      m_vk_wait_values;
+};
+
+} // namespace Methane::Graphics::Vulkan
@@ -0,0 +1,148 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/Vulkan/MemoryAllocator.h
+Vulkan device memory allocator placing resources in large memory blocks
+allocated per memory type, instead of allocating device memory per resource.
+
+******************************************************************************/
+
+#pragma once
+
+#include <Methane/Graphics/RHI/IDevice.h>
+#include <Methane/Data/RangeAllocator.hpp>
+#include <Methane/Data/Types.h>
+#include <Methane/Memory.hpp>
+#include <Methane/Instrumentation.h>
+
+#include <vulkan/vulkan.hpp>
+
+#include <mutex>
+#include <vector>
+
+namespace Methane::Graphics::Vulkan
+{
+
+// Buffers and linear images are placed in separate blocks from optimal tiled images,
+// so that resources of different tiling never share a page of bufferImageGranularity size
+enum class MemoryTiling : uint32_t
+{
+    Linear = 0U,
+    Optimal
+};
+
+class MemoryBlock
+{
+public:
+    MemoryBlock(const vk::Device& vk_device, uint32_t memory_type_index, uint32_t heap_index, MemoryTiling tiling,
+                vk::DeviceSize size, bool is_host_visible, bool is_dedicated);
+
+    [[nodiscard]] const vk::DeviceMemory& GetNativeDeviceMemory() const noexcept { return m_vk_unique_memory.get(); }
+    [[nodiscard]] uint32_t                GetMemoryTypeIndex() const noexcept    { return m_memory_type_index; }
+    [[nodiscard]] uint32_t                GetHeapIndex() const noexcept          { return m_heap_index; }
+    [[nodiscard]] MemoryTiling            GetTiling() const noexcept             { return m_tiling; }
+    [[nodiscard]] Data::RawPtr            GetMappedDataPtr() const noexcept      { return m_mapped_data_ptr; }
+    [[nodiscard]] bool                    IsDedicated() const noexcept           { return m_is_dedicated; }
+
+    [[nodiscard]] Data::RangeAllocator<vk::DeviceSize>&       GetRangeAllocator() noexcept       { return m_range_allocator; }
+    [[nodiscard]] const Data::RangeAllocator<vk::DeviceSize>& GetRangeAllocator() const noexcept { return m_range_allocator; }
+
+private:
+    vk::UniqueDeviceMemory               m_vk_unique_memory;
+    uint32_t                             m_memory_type_index;
+    uint32_t                             m_heap_index;
+    MemoryTiling                         m_tiling;
+    bool                                 m_is_dedicated;
+    Data::RawPtr                         m_mapped_data_ptr = nullptr;
+    Data::RangeAllocator<vk::DeviceSize> m_range_allocator;
+};
+
+class MemoryAllocator;
+
+// Range of device memory block bound to resource, returned to the block on destruction
+class MemoryAllocation
+{
+public:
+    MemoryAllocation() = default;
+    MemoryAllocation(MemoryAllocator& allocator, MemoryBlock& block, const Data::Range<vk::DeviceSize>& range) noexcept;
+    MemoryAllocation(MemoryAllocation&& other) noexcept;
+    MemoryAllocation(const MemoryAllocation&) = delete;
+    ~MemoryAllocation();
+
+    MemoryAllocation& operator=(MemoryAllocation&& other) noexcept;
+    MemoryAllocation& operator=(const MemoryAllocation&) = delete;
+
+    void Release() noexcept;
+
+    [[nodiscard]] explicit operator bool() const noexcept { return m_block_ptr != nullptr; }
+    [[nodiscard]] const vk::DeviceMemory& GetNativeDeviceMemory() const noexcept;
+    [[nodiscard]] vk::DeviceSize          GetOffset() const noexcept { return m_range.GetStart(); }
+    [[nodiscard]] vk::DeviceSize          GetSize() const noexcept   { return m_range.GetLength(); }
+
+    // Memory of host visible blocks is persistently mapped, returns nullptr for device local memory
+    [[nodiscard]] Data::RawPtr GetMappedDataPtr() const noexcept;
+
+private:
+    MemoryAllocator*            m_allocator_ptr = nullptr;
+    MemoryBlock*                m_block_ptr     = nullptr;
+    Data::Range<vk::DeviceSize> m_range;
+};
+
+class MemoryAllocator
+{
+public:
+    struct Settings
+    {
+        vk::DeviceSize block_size = 64U * 1024U * 1024U;
+        // Heaps smaller than this multiple of block size get proportionally smaller blocks
+        uint32_t       min_blocks_per_heap = 8U;
+    };
+
+    MemoryAllocator(const vk::PhysicalDevice& vk_physical_device, const vk::Device& vk_device, const Settings& settings = {});
+
+    MemoryAllocator(const MemoryAllocator&) = delete;
+    MemoryAllocator(MemoryAllocator&&) = delete;
+    MemoryAllocator& operator=(const MemoryAllocator&) = delete;
+    MemoryAllocator& operator=(MemoryAllocator&&) = delete;
+
+    // Throws vk::OutOfDeviceMemoryError when memory heap budget is exceeded or driver allocation fails
+    [[nodiscard]] MemoryAllocation Allocate(const vk::MemoryRequirements& memory_requirements, uint32_t memory_type_index, MemoryTiling tiling);
+    [[nodiscard]] Rhi::DeviceMemoryStatistics GetStatistics() const;
+
+    [[nodiscard]] const vk::PhysicalDeviceMemoryProperties& GetNativeMemoryProperties() const noexcept { return m_vk_memory_properties; }
+
+private:
+    friend class MemoryAllocation;
+
+    using Blocks = UniquePtrs<MemoryBlock>;
+
+    void Free(MemoryBlock& block, const Data::Range<vk::DeviceSize>& range) noexcept;
+    MemoryBlock& AddBlock(uint32_t memory_type_index, MemoryTiling tiling, vk::DeviceSize block_size, bool is_dedicated);
+    void RemoveBlock(const MemoryBlock& block) noexcept;
+    Blocks& GetBlocks(uint32_t memory_type_index, MemoryTiling tiling);
+    vk::DeviceSize GetBlockSize(uint32_t heap_index) const noexcept;
+
+    const Settings                     m_settings;
+    const vk::Device                   m_vk_device;
+    vk::PhysicalDeviceMemoryProperties m_vk_memory_properties;
+    std::vector<Blocks>                m_blocks_by_pool;           // pools of blocks indexed by memory type and tiling
+    std::vector<vk::DeviceSize>        m_reserved_size_by_heap;
+    mutable TracyLockable(std::mutex,  m_mutex);
+};
+
+} // namespace Methane::Graphics::Vulkan
@@ -0,0 +1,57 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/Vulkan/PipelineCache.h
+Vulkan device pipeline cache shared by all render and compute pipelines,
+persisted on disk in a versioned file keyed by device UUID and driver version.
+
+******************************************************************************/
+
+#pragma once
+
+#include <Methane/Instrumentation.h>
+
+#include <vulkan/vulkan.hpp>
+
+#include <string>
+#include <mutex>
+
+namespace Methane::Graphics::Vulkan
+{
+
+class PipelineCache
+{
+public:
+    PipelineCache(const vk::PhysicalDevice& vk_physical_device, const vk::Device& vk_device);
+
+    // Merges pipelines from cache file into device pipeline cache, returns false when file is missing or incompatible
+    bool Load(const std::string& cache_file_path);
+
+    // Writes device pipeline cache data to file, returns false when file can not be written
+    bool Save(const std::string& cache_file_path) const;
+
+    [[nodiscard]] const vk::PipelineCache& GetNativePipelineCache() const noexcept { return m_vk_unique_pipeline_cache.get(); }
+
+private:
+    const vk::Device             m_vk_device;
+    vk::PhysicalDeviceProperties m_vk_device_properties;
+    vk::UniquePipelineCache      m_vk_unique_pipeline_cache;
+    mutable TracyLockable(std::mutex, m_mutex);
+};
+
+} // namespace Methane::Graphics::Vulkan
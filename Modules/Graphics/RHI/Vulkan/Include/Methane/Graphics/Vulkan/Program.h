@@ -57,6 +57,7 @@ public:
     };
 
     Program(const Base::Context& context, const Settings& settings);
+    ~Program() override;
 
     // IProgram interface
     [[nodiscard]] Ptr<Rhi::IProgramBindings> CreateBindings(const ResourceViewsByArgument& resource_views_by_argument, Data::Index frame_index) override;
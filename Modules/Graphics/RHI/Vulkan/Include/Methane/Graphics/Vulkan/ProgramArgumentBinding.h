@@ -63,6 +63,10 @@ public:
     void SetDescriptorSetBinding(const vk::DescriptorSet& descriptor_set, uint32_t layout_binding_index) noexcept;
     void SetDescriptorSet(const vk::DescriptorSet& descriptor_set) noexcept;
 
+    // Descriptor set update is deferred till context initialization completion only when enabled by context options,
+    // but transient descriptor sets are always updated right away, because they are used in the current frame only
+    void SetDescriptorSetUpdateDeferred(bool is_update_deferred) noexcept { m_is_descriptor_set_update_deferred = is_update_deferred; }
+
     // Base::ProgramArgumentBinding interface
     [[nodiscard]] Ptr<Base::ProgramArgumentBinding> CreateCopy() const override;
     void MergeSettings(const Base::ProgramArgumentBinding& other) override;
@@ -77,6 +81,7 @@ private:
     Settings                              m_settings_vk;
     const vk::DescriptorSet*              m_vk_descriptor_set_ptr = nullptr;
     uint32_t                              m_vk_binding_value      = 0U;
+    bool                                  m_is_descriptor_set_update_deferred = true;
     vk::WriteDescriptorSet                m_vk_write_descriptor_set;
     std::vector<vk::DescriptorImageInfo>  m_vk_descriptor_images;
     std::vector<vk::DescriptorBufferInfo> m_vk_descriptor_buffers;
@@ -45,19 +45,23 @@ public:
     using ArgumentBinding = ProgramArgumentBinding;
 
     ProgramBindings(Program& program, const ResourceViewsByArgument& resource_views_by_argument, Data::Index frame_index);
-    ProgramBindings(const ProgramBindings& other_program_bindings, const ResourceViewsByArgument& replace_resource_view_by_argument, const Opt<Data::Index>& frame_index);
+    ProgramBindings(const ProgramBindings& other_program_bindings, const ResourceViewsByArgument& replace_resource_view_by_argument,
+                    const Opt<Data::Index>& frame_index, bool is_transient = false);
+    ~ProgramBindings() override;
 
     void Initialize();
 
     // IProgramBindings interface
     [[nodiscard]] Ptr<Rhi::IProgramBindings> CreateCopy(const ResourceViewsByArgument& replace_resource_views_by_argument, const Opt<Data::Index>& frame_index) override;
+    [[nodiscard]] Ptr<Rhi::IProgramBindings> CreateTransientCopy(const ResourceViewsByArgument& replace_resource_views_by_argument, const Opt<Data::Index>& frame_index) override;
     void Apply(Base::CommandList& command_list, ApplyBehaviorMask apply_behavior) const override;
 
     // Base::ProgramBindings interface
     void CompleteInitialization() override;
 
-    void Apply(ICommandList& command_list, const Rhi::ICommandQueue& command_queue,
-               const Base::ProgramBindings* p_applied_program_bindings, ApplyBehaviorMask apply_behavior) const;
+    // Returns number of descriptor sets bound to the command list
+    uint32_t Apply(ICommandList& command_list, const Rhi::ICommandQueue& command_queue,
+                   const Base::ProgramBindings* p_applied_program_bindings, ApplyBehaviorMask apply_behavior) const;
 
 private:
     // IObjectCallback interface
@@ -72,6 +76,7 @@ private:
     mutable Ptr<Rhi::IResourceBarriers> m_resource_ownership_transition_barriers_ptr;
     std::vector<vk::DescriptorSet>      m_descriptor_sets; // descriptor sets corresponding to pipeline layout in the order of their access type
     bool                                m_has_mutable_descriptor_set = false; // if true, then m_descriptor_sets.back() is mutable descriptor set
+    bool                                m_is_transient = false; // if true, then mutable descriptor set is allocated from the transient pool of the current frame
     std::vector<uint32_t>               m_dynamic_offsets; // dynamic buffer offsets for all descriptor sets from the bound ResourceView::Settings::offset
     std::vector<uint32_t>               m_dynamic_offset_index_by_set_index; // beginning index in dynamic buffer offsets corresponding to the particular descriptor set or access type
 };
@@ -30,6 +30,8 @@ Vulkan implementation of the render state interface.
 
 #include <vulkan/vulkan.hpp>
 
+#include <atomic>
+#include <future>
 #include <map>
 #include <mutex>
 
@@ -59,9 +61,11 @@ public:
     static vk::PrimitiveTopology GetVulkanPrimitiveTopology(Rhi::RenderPrimitive primitive_type);
 
     RenderState(const Base::RenderContext& context, const Settings& settings);
-    
+    ~RenderState() override;
+
     // IRenderState interface
     void Reset(const Settings& settings) override;
+    void PrewarmPipelines(const Refs<Rhi::IViewState>& view_states, const std::vector<Rhi::RenderPrimitive>& primitives) override;
 
     // Base::RenderState interface
     void Apply(Base::RenderCommandList& render_command_list, Groups state_groups) override;
@@ -70,20 +74,38 @@ public:
     bool SetName(std::string_view name) override;
 
     bool                IsNativePipelineDynamic() const noexcept  { return !Base::RenderState::IsDeferred(); }
-    const vk::Pipeline& GetNativePipelineDynamic() const;
-    const vk::Pipeline& GetNativePipelineMonolithic(ViewState& viewState, Rhi::RenderPrimitive renderPrimitive);
-    const vk::Pipeline& GetNativePipelineMonolithic(const Base::RenderDrawingState& drawing_state);
+    vk::Pipeline        GetNativePipelineDynamic() const;
+    vk::Pipeline        GetNativePipelineMonolithic(ViewState& viewState, Rhi::RenderPrimitive renderPrimitive);
+    vk::Pipeline        GetNativePipelineMonolithic(const Base::RenderDrawingState& drawing_state);
 
 private:
+    // Monolithic pipeline is compiled either by the background task or by the first draw thread which claims it,
+    // so that draw never waits for compilation task which is still queued in the parallel executor
+    struct MonolithicPipeline
+    {
+        MonolithicPipeline();
+
+        std::atomic<bool>        is_compile_claimed{ false };
+        std::promise<void>       compiled_promise;
+        std::shared_future<void> compiled_future;
+        vk::UniquePipeline       vk_pipeline;
+        bool                     is_cancelled = false; // guarded by render state mutex
+    };
+
+    using PipelineId = std::tuple<Rhi::IViewState*, Rhi::RenderPrimitive>;
+    using MonolithicPipelineById = std::map<PipelineId, Ptr<MonolithicPipeline>>;
+
     vk::UniquePipeline CreateNativePipeline(const ViewState* viewState = nullptr, Opt<Rhi::RenderPrimitive> renderPrimitive = {}) const;
+    Ptr<MonolithicPipeline> AddMonolithicPipeline(ViewState& view_state, Rhi::RenderPrimitive render_primitive);
+    void CompileMonolithicPipelineAsync(const Ptr<MonolithicPipeline>& pipeline_ptr, const PipelineId& pipeline_id);
+    void CompileMonolithicPipeline(MonolithicPipeline& pipeline, const PipelineId& pipeline_id) const;
+    void WaitMonolithicPipeline(MonolithicPipeline& pipeline, const PipelineId& pipeline_id) const;
+    void CancelMonolithicPipeline(MonolithicPipeline& pipeline) const;
 
     // IViewStateCallback overrides
     void OnViewStateChanged(Rhi::IViewState& view_state) override;
     void OnViewStateDestroyed(Rhi::IViewState& view_state) override;
 
-    using PipelineId = std::tuple<Rhi::IViewState*, Rhi::RenderPrimitive>;
-    using MonolithicPipelineById = std::map<PipelineId, vk::UniquePipeline>;
-
     const RenderContext&      m_vk_render_context;
     vk::UniquePipeline        m_vk_pipeline_dynamic;
     MonolithicPipelineById    m_vk_pipeline_monolithic_by_id;
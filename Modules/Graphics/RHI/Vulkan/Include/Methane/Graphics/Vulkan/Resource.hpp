@@ -26,6 +26,7 @@ Vulkan implementation of the resource interface.
 #include "IResource.h"
 #include "IContext.h"
 #include "Device.h"
+#include "MemoryAllocator.h"
 #include "TransferCommandList.h"
 #include "Utils.hpp"
 
@@ -143,7 +144,7 @@ public:
 
     const vk::DeviceMemory& GetNativeDeviceMemory() const noexcept final
     {
-        return m_vk_unique_device_memory.get();
+        return m_memory_allocation.GetNativeDeviceMemory();
     }
 
     const vk::Device& GetNativeDevice() const noexcept final
@@ -175,16 +176,18 @@ public:
     }
 
 protected:
-    vk::UniqueDeviceMemory AllocateDeviceMemory(const vk::MemoryRequirements& memory_requirements, vk::MemoryPropertyFlags memory_property_flags)
+    MemoryAllocation AllocateDeviceMemory(const vk::MemoryRequirements& memory_requirements, vk::MemoryPropertyFlags memory_property_flags,
+                                          MemoryTiling memory_tiling)
     {
         META_FUNCTION_TASK();
-        const Opt<uint32_t> memory_type_opt = GetVulkanContext().GetVulkanDevice().FindMemoryType(memory_requirements.memoryTypeBits, memory_property_flags);
+        const Device& device = GetVulkanContext().GetVulkanDevice();
+        const Opt<uint32_t> memory_type_opt = device.FindMemoryType(memory_requirements.memoryTypeBits, memory_property_flags);
         if (!memory_type_opt)
             throw IResource::AllocationError(*this, "suitable memory type was not found");
 
         try
         {
-            return GetNativeDevice().allocateMemoryUnique(vk::MemoryAllocateInfo(memory_requirements.size, *memory_type_opt));
+            return device.GetMemoryAllocator().Allocate(memory_requirements, *memory_type_opt, memory_tiling);
         }
         catch(const vk::SystemError& error)
         {
@@ -192,13 +195,15 @@ protected:
         }
     }
 
-    void AllocateResourceMemory(const vk::MemoryRequirements& memory_requirements, vk::MemoryPropertyFlags memory_property_flags)
+    void AllocateResourceMemory(const vk::MemoryRequirements& memory_requirements, vk::MemoryPropertyFlags memory_property_flags,
+                                MemoryTiling memory_tiling)
     {
         META_FUNCTION_TASK();
-        m_vk_unique_device_memory.release();
-        m_vk_unique_device_memory = AllocateDeviceMemory(memory_requirements, memory_property_flags);
+        m_memory_allocation = AllocateDeviceMemory(memory_requirements, memory_property_flags, memory_tiling);
     }
 
+    const MemoryAllocation& GetMemoryAllocation() const noexcept { return m_memory_allocation; }
+
     template<typename T = ResourceStorageType>
     void ResetNativeResource(T&& vk_resource)
     {
@@ -260,7 +265,7 @@ private:
     using ViewDescriptorByViewId = std::map<ResourceView::Id, Ptr<ResourceView::ViewDescriptorVariant>>;
 
     vk::Device                   m_vk_device;
-    vk::UniqueDeviceMemory       m_vk_unique_device_memory;
+    MemoryAllocation             m_memory_allocation;
     ResourceStorageType          m_vk_resource;
     ViewDescriptorByViewId       m_view_descriptor_by_view_id;
     Opt<uint32_t>                m_owner_queue_family_index_opt;
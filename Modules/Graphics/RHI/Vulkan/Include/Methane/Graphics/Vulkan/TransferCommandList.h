@@ -26,7 +26,7 @@ Vulkan implementation of the transfer command list interface.
 #include "CommandList.hpp"
 
 #include <Methane/Graphics/RHI/ITransferCommandList.h>
-#include <Methane/Graphics/Base/CommandList.h>
+#include <Methane/Graphics/Base/TransferCommandList.h>
 
 #include <vulkan/vulkan.hpp>
 
@@ -35,12 +35,18 @@ namespace Methane::Graphics::Vulkan
 
 class CommandQueue;
 
-class TransferCommandList final
-    : public CommandList<Base::CommandList, vk::PipelineBindPoint::eGraphics>
-    , public Rhi::ITransferCommandList
+class TransferCommandList final // NOSONAR - inheritance hierarchy depth is higher than 5
+    : public CommandList<Base::TransferCommandList, vk::PipelineBindPoint::eGraphics>
 {
 public:
     explicit TransferCommandList(CommandQueue& command_queue);
+
+    // ITransferCommandList interface
+    void CopyBuffer(Rhi::IBuffer& src_buffer, Rhi::IBuffer& dst_buffer, const Rhi::BufferCopyRegion& copy_region) override;
+    void CopyBufferToTexture(Rhi::IBuffer& src_buffer, Data::Size src_offset, Rhi::ITexture& dst_texture, const Rhi::TextureCopyRegion& dst_region) override;
+    void CopyTextureToBuffer(Rhi::ITexture& src_texture, const Rhi::TextureCopyRegion& src_region, Rhi::IBuffer& dst_buffer, Data::Size dst_offset) override;
+    void CopyTexture(Rhi::ITexture& src_texture, const Rhi::TextureCopyRegion& src_region, Rhi::ITexture& dst_texture, const Rhi::TextureCopyRegion& dst_region) override;
+    void GenerateMipmaps(Rhi::ITexture& texture) override;
 };
 
 } // namespace Methane::Graphics::Vulkan
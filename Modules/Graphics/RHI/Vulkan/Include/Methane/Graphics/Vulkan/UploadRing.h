@@ -0,0 +1,141 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/Vulkan/UploadRing.h
+Vulkan context-wide ring of persistently mapped staging memory used for
+resource data transfers encoded in the upload command list.
+
+******************************************************************************/
+
+#pragma once
+
+#include "MemoryAllocator.h"
+
+#include <Methane/Graphics/RHI/ICommandList.h>
+#include <Methane/Graphics/RHI/IObject.h>
+#include <Methane/Data/Receiver.hpp>
+#include <Methane/Instrumentation.h>
+
+#include <vulkan/vulkan.hpp>
+
+#include <deque>
+#include <mutex>
+#include <vector>
+
+namespace Methane::Graphics::Vulkan
+{
+
+class Device;
+
+// Staging ranges are released when execution of the upload command list they were allocated for is completed on GPU,
+// or when the command list is reset or destroyed without execution of the encoded commands;
+// uploads not fitting in the free part of the ring get temporary dedicated staging buffers
+class UploadRing final
+    : private Data::Receiver<Rhi::ICommandListCallback>
+    , private Data::Receiver<Rhi::IObjectCallback>
+{
+public:
+    static constexpr vk::DeviceSize default_alignment = 16U;
+
+    struct Range
+    {
+        vk::Buffer     vk_buffer;
+        vk::DeviceSize offset;
+        Data::RawPtr   data_ptr;
+    };
+
+    struct TemporaryBuffer
+    {
+        MemoryAllocation memory_allocation;
+        vk::UniqueBuffer vk_unique_buffer;
+    };
+
+    // Read-back staging range is owned by the caller and is not released on command list execution completion,
+    // but on destruction, so that data can be copied out of it after waiting for the command list completion
+    class ReadBackRange
+    {
+    public:
+        ReadBackRange(UploadRing& upload_ring, const Range& range, uint64_t segment_id, TemporaryBuffer&& temporary_buffer) noexcept;
+        ReadBackRange(const ReadBackRange&) = delete;
+        ReadBackRange(ReadBackRange&& other) noexcept;
+        ~ReadBackRange();
+
+        ReadBackRange& operator=(const ReadBackRange&) = delete;
+        ReadBackRange& operator=(ReadBackRange&&) = delete;
+
+        [[nodiscard]] const Range& GetRange() const noexcept { return m_range; }
+
+    private:
+        UploadRing*     m_upload_ring_ptr;
+        Range           m_range;
+        uint64_t        m_segment_id;
+        TemporaryBuffer m_temporary_buffer;
+    };
+
+    UploadRing(const Device& device, vk::DeviceSize capacity);
+
+    // Returns staging range for copy commands encoded in the given upload command list
+    [[nodiscard]] Range Allocate(Rhi::ICommandList& upload_cmd_list, vk::DeviceSize size, vk::DeviceSize alignment = default_alignment);
+
+    // Returns staging range for read-back copy commands encoded in the given upload command list
+    [[nodiscard]] ReadBackRange AllocateReadBack(Rhi::ICommandList& upload_cmd_list, vk::DeviceSize size, vk::DeviceSize alignment = default_alignment);
+
+    [[nodiscard]] vk::DeviceSize GetCapacity() const noexcept { return m_capacity; }
+    [[nodiscard]] vk::DeviceSize GetUsedSize() const;
+
+private:
+    // Contiguous part of the ring allocated for one command list; segments are kept in the ring allocation order
+    // and are released from the ring tail only, so that command lists can complete execution in any order
+    struct Segment
+    {
+        const Rhi::IObject*          cmd_list_ptr = nullptr;
+        uint64_t                     id = 0U;
+        vk::DeviceSize               used_size = 0U;
+        std::vector<TemporaryBuffer> temporary_buffers;
+        bool                         is_executing = false;
+        bool                         is_completed = false;
+        bool                         is_read_back = false;
+    };
+
+    // ICommandListCallback overrides
+    void OnCommandListStateChanged(Rhi::ICommandList& cmd_list) override;
+    void OnCommandListExecutionCompleted(Rhi::ICommandList& cmd_list) override;
+
+    // IObjectCallback overrides
+    void OnObjectDestroyed(Rhi::IObject& object) override;
+
+    void ConnectCommandList(Rhi::ICommandList& upload_cmd_list);
+    Segment& GetEncodingSegment(const Rhi::ICommandList& upload_cmd_list, bool is_read_back);
+    Opt<vk::DeviceSize> AllocateRingOffset(Segment& segment, vk::DeviceSize size, vk::DeviceSize alignment);
+    TemporaryBuffer CreateTemporaryBuffer(vk::DeviceSize size) const;
+    void ReleaseReadBackSegment(uint64_t segment_id);
+    void ReleaseNotExecutedSegments(const Rhi::IObject& cmd_list_object);
+    void ReleaseCompletedSegments();
+
+    const Device&                 m_device;
+    const vk::DeviceSize          m_capacity;
+    MemoryAllocation              m_memory_allocation;
+    vk::UniqueBuffer              m_vk_unique_buffer;
+    vk::DeviceSize                m_head_offset = 0U;
+    vk::DeviceSize                m_used_size   = 0U;
+    uint64_t                      m_next_segment_id = 0U;
+    std::deque<Segment>           m_segments;
+    mutable TracyLockable(std::mutex, m_mutex);
+};
+
+} // namespace Methane::Graphics::Vulkan
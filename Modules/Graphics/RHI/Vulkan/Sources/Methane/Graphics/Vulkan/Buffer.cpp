@@ -23,6 +23,7 @@ Vulkan implementation of the buffer interface.
 
 #include <Methane/Graphics/Vulkan/Buffer.h>
 #include <Methane/Graphics/Vulkan/IContext.h>
+#include <Methane/Graphics/Vulkan/UploadRing.h>
 
 #include <Methane/Graphics/Types.h>
 #include <Methane/Graphics/Base/Context.h>
@@ -43,6 +44,9 @@ static vk::BufferUsageFlags GetVulkanBufferUsageFlags(Rhi::BufferType buffer_typ
     case Rhi::BufferType::Constant: vk_usage_flags |= vk::BufferUsageFlagBits::eUniformBuffer; break;
     case Rhi::BufferType::Index:    vk_usage_flags |= vk::BufferUsageFlagBits::eIndexBuffer;   break;
     case Rhi::BufferType::Vertex:   vk_usage_flags |= vk::BufferUsageFlagBits::eVertexBuffer;  break;
+    case Rhi::BufferType::IndirectArgument:
+        vk_usage_flags |= vk::BufferUsageFlagBits::eIndirectBuffer | vk::BufferUsageFlagBits::eStorageBuffer;
+        break;
     // Buffer::Type::ReadBack - unsupported
     default: META_UNEXPECTED_ARG_DESCR(buffer_type, "Unsupported buffer type");
     }
@@ -63,6 +67,7 @@ static Rhi::ResourceState GetTargetResourceStateByBufferType(Rhi::BufferType buf
     case Rhi::BufferType::Index:       return Rhi::ResourceState::IndexBuffer;
     case Rhi::BufferType::Vertex:      return Rhi::ResourceState::VertexBuffer;
     case Rhi::BufferType::ReadBack:    return Rhi::ResourceState::StreamOut;
+    case Rhi::BufferType::IndirectArgument: return Rhi::ResourceState::IndirectArgument;
     default: META_UNEXPECTED_ARG_DESCR_RETURN(buffer_type, Rhi::ResourceState::Undefined, "Unsupported buffer type");
     }
 }
@@ -82,22 +87,17 @@ Buffer::Buffer(const Base::Context& context, const Settings& settings)
     const vk::MemoryPropertyFlags vk_memory_property_flags = is_private_storage ? vk::MemoryPropertyFlagBits::eDeviceLocal : vk_staging_memory_flags;
 
     // Allocate resource primary memory
-    AllocateResourceMemory(GetNativeDevice().getBufferMemoryRequirements(GetNativeResource()), vk_memory_property_flags);
-    GetNativeDevice().bindBufferMemory(GetNativeResource(), GetNativeDeviceMemory(), 0);
-
-    if (!is_private_storage)
-        return;
+    AllocateResourceMemory(GetNativeDevice().getBufferMemoryRequirements(GetNativeResource()), vk_memory_property_flags, MemoryTiling::Linear);
+    GetNativeDevice().bindBufferMemory(GetNativeResource(), GetNativeDeviceMemory(), GetMemoryAllocation().GetOffset());
+}
 
-    // Create staging buffer and allocate staging memory
-    m_vk_unique_staging_buffer = GetNativeDevice().createBufferUnique(
-        vk::BufferCreateInfo(vk::BufferCreateFlags{},
-            settings.size,
-            vk::BufferUsageFlagBits::eTransferSrc,
-            vk::SharingMode::eExclusive)
-    );
+Rhi::BufferMappedSpan Buffer::GetMappedSpan() const noexcept
+{
+    META_FUNCTION_TASK();
+    if (GetSettings().storage_mode == Rhi::IBuffer::StorageMode::Private)
+        return {};
 
-    m_vk_unique_staging_memory = AllocateDeviceMemory(GetNativeDevice().getBufferMemoryRequirements(m_vk_unique_staging_buffer.get()), vk_staging_memory_flags);
-    GetNativeDevice().bindBufferMemory(m_vk_unique_staging_buffer.get(), m_vk_unique_staging_memory.get(), 0);
+    return { GetMemoryAllocation().GetMappedDataPtr(), GetSettings().size };
 }
 
 void Buffer::SetData(Rhi::ICommandQueue& target_cmd_queue, const Rhi::SubResource& sub_resource)
@@ -106,31 +106,23 @@ void Buffer::SetData(Rhi::ICommandQueue& target_cmd_queue, const Rhi::SubResourc
     Base::Buffer::SetData(target_cmd_queue, sub_resource);
 
     const Settings& buffer_settings = GetSettings();
-    const bool is_private_storage = buffer_settings.storage_mode == Rhi::IBuffer::StorageMode::Private;
-    const vk::DeviceMemory& vk_device_memory = is_private_storage ? m_vk_unique_staging_memory.get() : GetNativeDeviceMemory();
-
-    const vk::DeviceSize sub_resource_offset = 0U;
-    Data::RawPtr sub_resource_data_ptr = nullptr;
-    const vk::Result vk_map_result = GetNativeDevice().mapMemory(vk_device_memory, sub_resource_offset, sub_resource.GetDataSize(), vk::MemoryMapFlags{},
-                                                                 reinterpret_cast<void**>(&sub_resource_data_ptr)); // NOSONAR
-
-    META_CHECK_ARG_EQUAL_DESCR(vk_map_result, vk::Result::eSuccess, "failed to map buffer subresource");
-    META_CHECK_ARG_NOT_NULL_DESCR(sub_resource_data_ptr, "failed to map buffer subresource");
-    std::copy(sub_resource.GetDataPtr(), sub_resource.GetDataEndPtr(), sub_resource_data_ptr);
-
-    GetNativeDevice().unmapMemory(vk_device_memory);
-
-    if (is_private_storage)
+    const Data::Size data_offset = sub_resource.HasDataRange() ? sub_resource.GetDataRange().GetStart() : 0U;
+    if (buffer_settings.storage_mode != Rhi::IBuffer::StorageMode::Private)
     {
-        m_vk_copy_region = vk::BufferCopy(sub_resource_offset, sub_resource_offset, static_cast<vk::DeviceSize>(sub_resource.GetDataSize()));
-    }
-
-    if (!is_private_storage)
+        // Host visible buffer memory is persistently mapped, so data is written without map/unmap calls
+        const MappedSpan mapped_span = GetMappedSpan();
+        META_CHECK_ARG_FALSE_DESCR(mapped_span.IsEmpty(), "buffer memory is not mapped");
+        std::copy(sub_resource.GetDataPtr(), sub_resource.GetDataEndPtr(), mapped_span.data_ptr + data_offset);
         return;
+    }
 
-    // In case of private GPU storage, copy buffer data from staging upload resource to the device-local GPU resource
+    // In case of private GPU storage, copy buffer data from the shared upload ring to the device-local GPU resource
     TransferCommandList& upload_cmd_list = PrepareResourceTransfer(target_cmd_queue, State::CopyDest);
-    upload_cmd_list.GetNativeCommandBufferDefault().copyBuffer(m_vk_unique_staging_buffer.get(), GetNativeResource(), 1U, &m_vk_copy_region);
+    const UploadRing::Range staging_range = GetVulkanContext().GetVulkanUploadRing().Allocate(upload_cmd_list, sub_resource.GetDataSize());
+    std::copy(sub_resource.GetDataPtr(), sub_resource.GetDataEndPtr(), staging_range.data_ptr);
+
+    const vk::BufferCopy vk_copy_region(staging_range.offset, data_offset, static_cast<vk::DeviceSize>(sub_resource.GetDataSize()));
+    upload_cmd_list.GetNativeCommandBufferDefault().copyBuffer(staging_range.vk_buffer, GetNativeResource(), 1U, &vk_copy_region);
     CompleteResourceTransfer(upload_cmd_list, GetTargetResourceStateByBufferType(buffer_settings.type), target_cmd_queue);
     GetContext().RequestDeferredAction(Rhi::ContextDeferredAction::UploadResources);
 }
@@ -158,17 +150,10 @@ Rhi::SubResource Buffer::GetData(Rhi::ICommandQueue& target_cmd_queue, const Byt
 Data::Bytes Buffer::GetDataFromSharedBuffer(const BytesRange& data_range) const
 {
     META_FUNCTION_TASK();
-    Data::RawPtr data_ptr = nullptr;
-    const vk::DeviceMemory& vk_device_memory = GetNativeDeviceMemory();
-    const vk::Result vk_map_result = GetNativeDevice().mapMemory(vk_device_memory, data_range.GetStart(), data_range.GetLength(),
-                                                                 vk::MemoryMapFlags{}, reinterpret_cast<void**>(&data_ptr)); // NOSONAR
-
-    META_CHECK_ARG_EQUAL_DESCR(vk_map_result, vk::Result::eSuccess, "failed to map buffer subresource");
-    META_CHECK_ARG_NOT_NULL_DESCR(data_ptr, "failed to map buffer subresource");
-    Data::Bytes data(data_ptr, data_ptr + data_range.GetLength());
-    GetNativeDevice().unmapMemory(vk_device_memory);
-
-    return data;
+    const MappedSpan mapped_span = GetMappedSpan();
+    META_CHECK_ARG_FALSE_DESCR(mapped_span.IsEmpty(), "buffer memory is not mapped");
+    const Data::RawPtr data_ptr = mapped_span.data_ptr + data_range.GetStart();
+    return Data::Bytes(data_ptr, data_ptr + data_range.GetLength());
 }
 
 Data::Bytes Buffer::GetDataFromPrivateBuffer(const BytesRange& data_range, Rhi::ICommandQueue& target_cmd_queue)
@@ -176,38 +161,20 @@ Data::Bytes Buffer::GetDataFromPrivateBuffer(const BytesRange& data_range, Rhi::
     META_FUNCTION_TASK();
     const State       initial_buffer_state = GetState();
     TransferCommandList&   upload_cmd_list = PrepareResourceTransfer(target_cmd_queue, State::CopySource);
+    const UploadRing::ReadBackRange read_back_range = GetVulkanContext().GetVulkanUploadRing().AllocateReadBack(upload_cmd_list, data_range.GetLength());
+    const UploadRing::Range& staging_range = read_back_range.GetRange();
     const vk::CommandBuffer& vk_cmd_buffer = upload_cmd_list.GetNativeCommandBufferDefault();
-    const vk::BufferCopy vk_buffer_copy(data_range.GetStart(), 0U, data_range.GetLength());
-    vk_cmd_buffer.copyBuffer(GetNativeResource(), m_vk_unique_staging_buffer.get(), 1U, &vk_buffer_copy);
+    const vk::BufferCopy vk_buffer_copy(data_range.GetStart(), staging_range.offset, data_range.GetLength());
+    vk_cmd_buffer.copyBuffer(GetNativeResource(), staging_range.vk_buffer, 1U, &vk_buffer_copy);
 
     CompleteResourceTransfer(upload_cmd_list, initial_buffer_state, target_cmd_queue);
 
     // Execute resource transfer commands and wait for completion
     GetBaseContext().UploadResources();
+    upload_cmd_list.WaitUntilCompleted();
 
-    // Copy buffer data from mapped staging resource
-    Data::RawPtr data_ptr = nullptr;
-    const vk::Result vk_map_result = GetNativeDevice().mapMemory(m_vk_unique_staging_memory.get(), 0U, data_range.GetLength(),
-                                                                 vk::MemoryMapFlags{}, reinterpret_cast<void**>(&data_ptr)); // NOSONAR
-    META_CHECK_ARG_EQUAL_DESCR(vk_map_result, vk::Result::eSuccess, "failed to map buffer subresource");
-    META_CHECK_ARG_NOT_NULL_DESCR(data_ptr, "failed to map buffer subresource");
-    Data::Bytes data(data_ptr, data_ptr + data_range.GetLength());
-    GetNativeDevice().unmapMemory(m_vk_unique_staging_memory.get());
-
-    return data;
-}
-
-bool Buffer::SetName(std::string_view name)
-{
-    META_FUNCTION_TASK();
-    if (!Resource::SetName(name))
-        return false;
-
-    if (m_vk_unique_staging_buffer)
-    {
-        SetVulkanObjectName(GetNativeDevice(), m_vk_unique_staging_buffer.get(), fmt::format("{} Staging Buffer", name));
-    }
-    return true;
+    // Copy buffer data from mapped staging range, which is retained by the read-back range until it is destroyed
+    return Data::Bytes(staging_range.data_ptr, staging_range.data_ptr + data_range.GetLength());
 }
 
 Ptr<ResourceView::ViewDescriptorVariant> Buffer::CreateNativeViewDescriptor(const ResourceView::Id& view_id)
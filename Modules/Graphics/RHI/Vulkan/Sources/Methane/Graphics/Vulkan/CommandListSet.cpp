@@ -128,7 +128,7 @@ void CommandListSet::Execute(const Rhi::ICommandList::CompletedCallback& complet
     META_FUNCTION_TASK();
     Base::CommandListSet::Execute(completed_callback);
 
-    auto [vk_submit_info, vk_timeline_semaphore_submit_info] = GetSubmitInfo();
+    auto [vk_submit_info, vk_timeline_semaphore_submit_info] = GetSubmitInfo(GetVulkanCommandQueue().GetWaitBeforeExecuting());
 
     // FIXME: MoltenVK is crashing on Apple platforms on attempt to use submit info with timeline semaphore values,
     //        while timeline semaphore extension is properly enabled in Device.cpp and this code works fine on Linux.
@@ -151,17 +151,50 @@ void CommandListSet::Execute(const Rhi::ICommandList::CompletedCallback& complet
 
     GetVulkanCommandQueue().GetNativeQueue().submit(vk_submit_info, m_vk_unique_execution_completed_fence.get());
     m_signalled_execution_completed_fence = true;
+    m_execution_timeline_value = 0U;
+}
+
+CommandListSet::SubmitInfo CommandListSet::ExecuteInBatch(const Rhi::ICommandList::CompletedCallback& completed_callback,
+                                                          const CommandQueue::WaitInfo& wait_before_executing, uint64_t execution_timeline_value)
+{
+    META_FUNCTION_TASK();
+    Base::CommandListSet::Execute(completed_callback);
+
+    std::scoped_lock fence_guard(m_execution_completed_fence_mutex);
+    m_execution_timeline_value = execution_timeline_value;
+    m_vk_batch_signal_semaphores = {
+        m_vk_unique_execution_completed_semaphore.get(),
+        GetVulkanCommandQueue().GetNativeExecutionTimelineSemaphore()
+    };
+    m_batch_signal_values = { 0U, execution_timeline_value };
+
+    SubmitInfo submit_info = GetSubmitInfo(wait_before_executing);
+    submit_info.first.setSignalSemaphores(m_vk_batch_signal_semaphores);
+    submit_info.second.setSignalSemaphoreValues(m_batch_signal_values);
+    return submit_info;
 }
 
 void CommandListSet::WaitUntilCompleted()
 {
     META_FUNCTION_TASK();
     std::scoped_lock fence_guard(m_execution_completed_fence_mutex);
-    const vk::Result execution_completed_fence_wait_result = m_vk_device.waitForFences(
-        GetNativeExecutionCompletedFence(),
-        true, std::numeric_limits<uint64_t>::max()
-    );
-    META_CHECK_ARG_EQUAL_DESCR(execution_completed_fence_wait_result, vk::Result::eSuccess, "failed to wait for command list set execution complete");
+    if (const uint64_t execution_timeline_value = m_execution_timeline_value;
+        execution_timeline_value)
+    {
+        const vk::SemaphoreWaitInfo wait_info(vk::SemaphoreWaitFlagBits{}, 1U,
+                                              &GetVulkanCommandQueue().GetNativeExecutionTimelineSemaphore(),
+                                              &execution_timeline_value);
+        const vk::Result execution_timeline_wait_result = m_vk_device.waitSemaphoresKHR(wait_info, std::numeric_limits<uint64_t>::max());
+        META_CHECK_ARG_EQUAL_DESCR(execution_timeline_wait_result, vk::Result::eSuccess, "failed to wait for command list set execution complete");
+    }
+    else
+    {
+        const vk::Result execution_completed_fence_wait_result = m_vk_device.waitForFences(
+            GetNativeExecutionCompletedFence(),
+            true, std::numeric_limits<uint64_t>::max()
+        );
+        META_CHECK_ARG_EQUAL_DESCR(execution_completed_fence_wait_result, vk::Result::eSuccess, "failed to wait for command list set execution complete");
+    }
     Complete();
 }
 
@@ -177,11 +210,10 @@ const CommandQueue& CommandListSet::GetVulkanCommandQueue() const noexcept
     return static_cast<const CommandQueue&>(GetBaseCommandQueue());
 }
 
-CommandListSet::SubmitInfo CommandListSet::GetSubmitInfo()
+CommandListSet::SubmitInfo CommandListSet::GetSubmitInfo(const CommandQueue::WaitInfo& wait_before_exec)
 {
     META_FUNCTION_TASK();
     const CommandQueue& command_queue = GetVulkanCommandQueue();
-    const CommandQueue::WaitInfo& wait_before_exec = command_queue.GetWaitBeforeExecuting();
 
     const std::vector<vk::Semaphore>&          vk_wait_semaphores = m_vk_wait_frame_buffer_rendering_on_stages ? m_vk_wait_semaphores : wait_before_exec.semaphores;
     const std::vector<uint64_t>&               vk_wait_values     = m_vk_wait_frame_buffer_rendering_on_stages ? m_vk_wait_values     : wait_before_exec.values;
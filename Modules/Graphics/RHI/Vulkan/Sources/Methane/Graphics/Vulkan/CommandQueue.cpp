@@ -101,6 +101,13 @@ static vk::AccessFlags GetAccessFlagsByQueueFlags(vk::QueueFlags vk_queue_flags)
     return vk_access_flags;
 }
 
+static vk::UniqueSemaphore CreateTimelineSemaphore(const vk::Device& vk_device)
+{
+    META_FUNCTION_TASK();
+    vk::SemaphoreTypeCreateInfo semaphore_type_create_info(vk::SemaphoreType::eTimeline, 0U);
+    return vk_device.createSemaphoreUnique(vk::SemaphoreCreateInfo().setPNext(&semaphore_type_create_info));
+}
+
 CommandQueue::CommandQueue(const Base::Context& context, Rhi::CommandListType command_lists_type)
     : CommandQueue(context, command_lists_type, dynamic_cast<const IContext&>(context).GetVulkanDevice())
 { }
@@ -125,6 +132,7 @@ CommandQueue::CommandQueue(const Base::Context& context, Rhi::CommandListType co
     , m_vk_queue(device.GetNativeDevice().getQueue(m_queue_family_index, m_queue_index))
     , m_vk_supported_stage_flags(GetPipelineStageFlagsByQueueFlags(family_properties.queueFlags))
     , m_vk_supported_access_flags(GetAccessFlagsByQueueFlags(family_properties.queueFlags))
+    , m_vk_unique_execution_timeline_semaphore(CreateTimelineSemaphore(device.GetNativeDevice()))
 { }
 
 CommandQueue::~CommandQueue()
@@ -170,13 +178,37 @@ Ptr<Rhi::ITimestampQueryPool> CommandQueue::CreateTimestampQueryPool(uint32_t ma
     return std::make_shared<TimestampQueryPool>(*this, max_timestamps_per_frame);
 }
 
-void CommandQueue::Execute(Rhi::ICommandListSet& command_list_set, const Rhi::ICommandList::CompletedCallback& completed_callback)
+void CommandQueue::ExecuteCommandListSets(const CommandListSetExecutions& command_list_set_executions)
 {
     META_FUNCTION_TASK();
+    for(const CommandListSetExecution& command_list_set_execution : command_list_set_executions)
+    {
+        AddWaitForFrameExecution(*command_list_set_execution.command_list_set_ptr);
+    }
 
-    AddWaitForFrameExecution(command_list_set);
-    Base::CommandQueueTracking::Execute(command_list_set, completed_callback);
+#ifdef __APPLE__
+    // FIXME: MoltenVK is crashing on attempt to use submit info with timeline semaphore values,
+    //        so command list sets are submitted one by one with execution completed fences,
+    //        which are waited by the device execution completion service instead of the timeline semaphore
+    for(const CommandListSetExecution& command_list_set_execution : command_list_set_executions)
+    {
+        command_list_set_execution.command_list_set_ptr->Execute(command_list_set_execution.completed_callback);
 
+        // Queue waits are applied to the first submission only, since binary semaphores can be waited only once
+        ClearWaitBeforeExecuting();
+    }
+    TrackExecutingCommandListSets(command_list_set_executions);
+#else
+    // All command list sets are submitted with the queue timeline semaphore signalling,
+    // so that the device execution completion service can wait for any of the queues at once
+    SubmitCommandListSets(command_list_set_executions);
+    ClearWaitBeforeExecuting();
+#endif
+}
+
+void CommandQueue::ClearWaitBeforeExecuting()
+{
+    META_FUNCTION_TASK();
     m_wait_before_executing.semaphores.clear();
     m_wait_before_executing.stages.clear();
     m_wait_before_executing.values.clear();
@@ -260,6 +292,36 @@ void CommandQueue::AddWaitForFrameExecution(const Rhi::ICommandListSet& command_
     frame_wait_info.stages.emplace_back(vk::PipelineStageFlagBits::eBottomOfPipe);
 }
 
+void CommandQueue::SubmitCommandListSets(const CommandListSetExecutions& command_list_set_executions)
+{
+    META_FUNCTION_TASK();
+    static const WaitInfo s_empty_wait_info;
+
+    // Queue waits are applied to the first submission only, since binary semaphores can be waited only once,
+    // while completion of every command list set is signalled with its own value of the queue timeline semaphore
+    const ExecutionArenaScope arena_scope;
+    FrameVector<CommandListSet::SubmitInfo> submit_infos(arena_scope.GetAllocator<CommandListSet::SubmitInfo>());
+    submit_infos.reserve(command_list_set_executions.size());
+    for(const CommandListSetExecution& command_list_set_execution : command_list_set_executions)
+    {
+        auto& vulkan_command_list_set = static_cast<CommandListSet&>(*command_list_set_execution.command_list_set_ptr);
+        submit_infos.emplace_back(vulkan_command_list_set.ExecuteInBatch(command_list_set_execution.completed_callback,
+                                                                         submit_infos.empty() ? m_wait_before_executing : s_empty_wait_info,
+                                                                         ++m_execution_timeline_value));
+    }
+
+    FrameVector<vk::SubmitInfo> vk_submit_infos(arena_scope.GetAllocator<vk::SubmitInfo>());
+    vk_submit_infos.reserve(submit_infos.size());
+    for(auto& [vk_submit_info, vk_timeline_semaphore_submit_info] : submit_infos)
+    {
+        vk_submit_infos.emplace_back(vk_submit_info).setPNext(&vk_timeline_semaphore_submit_info);
+    }
+
+    META_LOG("Command queue '{}' is submitting {} command list sets", GetName(), vk_submit_infos.size());
+    m_vk_queue.submit(vk_submit_infos);
+    TrackExecutingCommandListSets(command_list_set_executions);
+}
+
 void CommandQueue::CompleteCommandListSetExecution(Base::CommandListSet& executing_command_list_set)
 {
     META_FUNCTION_TASK();
@@ -275,6 +337,7 @@ bool CommandQueue::SetName(std::string_view name)
 
     const vk::Device& vk_device = GetVulkanDevice().GetNativeDevice();
     SetVulkanObjectName(vk_device, m_vk_queue, name);
+    SetVulkanObjectName(vk_device, m_vk_unique_execution_timeline_semaphore.get(), fmt::format("{} Execution Timeline", name));
     return true;
 }
 
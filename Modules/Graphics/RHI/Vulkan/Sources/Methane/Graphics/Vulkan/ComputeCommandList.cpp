@@ -23,6 +23,7 @@ Vulkan implementation of the compute command list interface.
 
 #include <Methane/Graphics/Vulkan/ComputeCommandList.h>
 #include <Methane/Graphics/Vulkan/CommandQueue.h>
+#include <Methane/Graphics/Vulkan/Buffer.h>
 
 #include <Methane/Instrumentation.h>
 #include <Methane/Checks.hpp>
@@ -41,4 +42,19 @@ void ComputeCommandList::Dispatch(const Rhi::ThreadGroupsCount& thread_groups_co
     GetNativeCommandBufferDefault().dispatch(thread_groups_count.GetWidth(), thread_groups_count.GetHeight(), thread_groups_count.GetDepth());
 }
 
+void ComputeCommandList::DispatchIndirect(Rhi::IBuffer& args_buffer, Data::Size args_offset)
+{
+    META_FUNCTION_TASK();
+    Base::ComputeCommandList::DispatchIndirect(args_buffer, args_offset);
+
+    auto& vk_args_buffer = static_cast<Buffer&>(args_buffer);
+    if (Ptr<Rhi::IResourceBarriers>& buffer_setup_barriers_ptr = vk_args_buffer.GetSetupTransitionBarriers();
+        vk_args_buffer.SetState(Rhi::ResourceState::IndirectArgument, buffer_setup_barriers_ptr) && buffer_setup_barriers_ptr)
+    {
+        SetResourceBarriers(*buffer_setup_barriers_ptr);
+    }
+
+    GetNativeCommandBufferDefault().dispatchIndirect(vk_args_buffer.GetNativeResource(), args_offset);
+}
+
 } // namespace Methane::Graphics::Vulkan
@@ -75,7 +75,8 @@ void ComputeState::Reset(const Settings& settings)
         program.GetNativePipelineLayout()
     );
 
-    auto pipe = m_vk_context.GetVulkanDevice().GetNativeDevice().createComputePipelineUnique(nullptr, vk_pipeline_create_info);
+    const Device& device = m_vk_context.GetVulkanDevice();
+    auto pipe = device.GetNativeDevice().createComputePipelineUnique(device.GetNativePipelineCache(), vk_pipeline_create_info);
     META_CHECK_ARG_EQUAL_DESCR(pipe.result, vk::Result::eSuccess, "Vulkan pipeline creation has failed");
     m_vk_unique_pipeline = std::move(pipe.value);
 }
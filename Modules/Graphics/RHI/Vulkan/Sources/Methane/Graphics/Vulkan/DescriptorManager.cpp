@@ -17,7 +17,8 @@ limitations under the License.
 *******************************************************************************
 
 FILE: Methane/Graphics/Vulkan/DescriptorManager.cpp
-Vulkan descriptor manager with descriptor sets allocator.
+Vulkan descriptor manager with persistent descriptor sets allocator recycling released sets
+and per-frame transient descriptor sets allocator with pools reset on frame completion.
 
 ******************************************************************************/
 
@@ -26,14 +27,22 @@ Vulkan descriptor manager with descriptor sets allocator.
 #include <Methane/Graphics/Vulkan/Device.h>
 
 #include <Methane/Graphics/Base/Context.h>
+#include <Methane/Graphics/Base/RenderContext.h>
 #include <Methane/Graphics/Base/ProgramBindings.h>
 #include <Methane/Graphics/RHI/ICommandKit.h>
 #include <Methane/Graphics/RHI/ICommandList.h>
 #include <Methane/Instrumentation.h>
+#include <Methane/Checks.hpp>
+
+#include <algorithm>
 
 namespace Methane::Graphics::Vulkan
 {
 
+// Auto-tuned pool size ratio is an observed average count of descriptors per set with headroom
+static constexpr float g_pool_size_ratio_headroom = 1.5F;
+static constexpr float g_min_pool_size_ratio      = 0.05F;
+
 DescriptorManager::DescriptorManager(Base::Context& context, uint32_t pool_sets_count, const PoolSizeRatioByDescType& pool_size_ratio_by_desc_type)
     : Base::DescriptorManager(context, false)
     , m_pool_sets_count(pool_sets_count)
@@ -47,65 +56,217 @@ void DescriptorManager::Release()
 
     std::scoped_lock lock_guard(m_descriptor_pool_mutex);
     const vk::Device& vk_device = GetContextVk().GetVulkanDevice().GetNativeDevice();
-    for(vk::DescriptorPool& vk_pool : m_vk_used_pools)
+    m_transient_pools.Release([this](const vk::DescriptorPool& vk_pool) { m_vk_used_pools.emplace_back(vk_pool); });
+    for(const vk::DescriptorPool& vk_pool : m_vk_used_pools)
     {
         vk_device.resetDescriptorPool(vk_pool);
         m_vk_free_pools.emplace_back(vk_pool);
     }
     m_vk_used_pools.clear();
     m_vk_current_pool = nullptr;
+    m_vk_pool_by_descriptor_set.clear();
+    m_recycled_sets_by_layout.clear();
+    m_retired_sets.clear();
+    m_presented_frame_index_by_frame.clear();
 }
 
 void DescriptorManager::SetDescriptorPoolSizeRatio(vk::DescriptorType descriptor_type, float size_ratio)
 {
     META_FUNCTION_TASK();
+    std::scoped_lock lock_guard(m_descriptor_pool_mutex);
     m_pool_size_ratio_by_desc_type[descriptor_type] = size_ratio;
+    m_fixed_ratio_desc_types.insert(descriptor_type);
+}
+
+DescriptorManager::PoolSizeRatioByDescType DescriptorManager::GetDescriptorPoolSizeRatios() const
+{
+    META_FUNCTION_TASK();
+    std::scoped_lock lock_guard(m_descriptor_pool_mutex);
+    return m_pool_size_ratio_by_desc_type;
+}
+
+Rhi::DescriptorStatistics DescriptorManager::GetStatistics() const
+{
+    META_FUNCTION_TASK();
+    std::scoped_lock lock_guard(m_descriptor_pool_mutex);
+
+    Rhi::DescriptorStatistics statistics;
+    statistics.pools_count           = static_cast<uint32_t>(m_vk_descriptor_pools.size());
+    statistics.free_pools_count      = static_cast<uint32_t>(m_vk_free_pools.size());
+    statistics.allocated_sets_count  = static_cast<uint32_t>(m_vk_pool_by_descriptor_set.size());
+    statistics.retired_sets_count    = static_cast<uint32_t>(m_retired_sets.size());
+    statistics.transient_pools_count = m_transient_pools.GetPoolsCount();
+    statistics.transient_sets_count  = m_transient_pools.GetAllocationsCount();
+    for(const auto& [layout, descriptor_sets] : m_recycled_sets_by_layout)
+    {
+        statistics.recycled_sets_count += static_cast<uint32_t>(descriptor_sets.size());
+    }
+    return statistics;
 }
 
-vk::DescriptorSet DescriptorManager::AllocDescriptorSet(vk::DescriptorSetLayout layout)
+vk::DescriptorSet DescriptorManager::AllocDescriptorSet(const vk::DescriptorSetLayout& layout, const LayoutBindings& layout_bindings)
 {
     META_FUNCTION_TASK();
     std::scoped_lock lock_guard(m_descriptor_pool_mutex);
-    if (!m_vk_current_pool)
+
+    // Released descriptor set with the same layout is reused without allocation from pool,
+    // its descriptors are fully overwritten by program bindings initialization
+    if (const auto recycled_sets_it = m_recycled_sets_by_layout.find(layout);
+        recycled_sets_it != m_recycled_sets_by_layout.end() && !recycled_sets_it->second.empty())
+    {
+        const vk::DescriptorSet descriptor_set = recycled_sets_it->second.back();
+        recycled_sets_it->second.pop_back();
+        return descriptor_set;
+    }
+
+    ObserveDescriptorsUsage(layout_bindings);
+
+    vk::DescriptorSet descriptor_set = m_vk_current_pool ? TryAllocDescriptorSet(m_vk_current_pool, layout) : vk::DescriptorSet();
+    if (!descriptor_set)
+    {
+        // Allocate descriptor set from the new pool
         m_vk_current_pool = AcquireDescriptorPool();
+        m_vk_used_pools.emplace_back(m_vk_current_pool);
+        descriptor_set = TryAllocDescriptorSet(m_vk_current_pool, layout);
+        META_CHECK_ARG_TRUE_DESCR(!!descriptor_set, "failed to allocate descriptor set from the new descriptor pool");
+    }
 
-    const vk::Device& vk_device = GetContextVk().GetVulkanDevice().GetNativeDevice();
+    m_vk_pool_by_descriptor_set.try_emplace(descriptor_set, m_vk_current_pool);
+    return descriptor_set;
+}
+
+void DescriptorManager::ReleaseDescriptorSet(const vk::DescriptorSetLayout& layout, const vk::DescriptorSet& descriptor_set)
+{
+    META_FUNCTION_TASK();
+    std::scoped_lock lock_guard(m_descriptor_pool_mutex);
+
+    // Descriptor sets allocated before descriptor manager release were already reclaimed with pools reset
+    if (!m_vk_pool_by_descriptor_set.count(descriptor_set))
+        return;
+
+    // Descriptor set may be still used by command lists of the current and previous frames executing on GPU,
+    // so it is reused only after completion of the current frame
+    m_retired_sets.push_back(RetiredDescriptorSet{ layout, descriptor_set, GetCurrentFrameIndex() });
+}
+
+void DescriptorManager::ReleaseDescriptorSetLayout(const vk::DescriptorSetLayout& layout)
+{
+    META_FUNCTION_TASK();
+    std::scoped_lock lock_guard(m_descriptor_pool_mutex);
+
+    // Descriptor sets of destroyed layout can not be reused, because layout handle may be reused by the new layout
+    if (const auto recycled_sets_it = m_recycled_sets_by_layout.find(layout);
+        recycled_sets_it != m_recycled_sets_by_layout.end())
+    {
+        FreeDescriptorSets(recycled_sets_it->second);
+        m_recycled_sets_by_layout.erase(recycled_sets_it);
+    }
+
+    for(RetiredDescriptorSet& retired_set : m_retired_sets)
+    {
+        if (retired_set.layout == layout)
+            retired_set.layout = nullptr;
+    }
+}
+
+vk::DescriptorSet DescriptorManager::AllocTransientDescriptorSet(const vk::DescriptorSetLayout& layout, const LayoutBindings& layout_bindings)
+{
+    META_FUNCTION_TASK();
+    std::scoped_lock lock_guard(m_descriptor_pool_mutex);
+    ObserveDescriptorsUsage(layout_bindings);
+
+    return m_transient_pools.Allocate(GetCurrentFrameIndex(),
+        [this, &layout](const vk::DescriptorPool& vk_pool) { return TryAllocDescriptorSet(vk_pool, layout); },
+        [this]() { return AcquireDescriptorPool(); });
+}
+
+void DescriptorManager::OnFramePresented(Data::Index frame_buffer_index, Data::Index frame_index)
+{
+    META_FUNCTION_TASK();
+    std::scoped_lock lock_guard(m_descriptor_pool_mutex);
+    if (m_presented_frame_index_by_frame.size() <= frame_buffer_index)
+        m_presented_frame_index_by_frame.resize(frame_buffer_index + 1U);
+
+    m_presented_frame_index_by_frame[frame_buffer_index] = frame_index;
+}
+
+void DescriptorManager::OnFrameCompleted(Data::Index frame_buffer_index)
+{
+    META_FUNCTION_TASK();
+    std::scoped_lock lock_guard(m_descriptor_pool_mutex);
+    if (frame_buffer_index >= m_presented_frame_index_by_frame.size() ||
+        !m_presented_frame_index_by_frame[frame_buffer_index].has_value())
+        return;
 
+    // Frames are executed in order on render queue, so all frames presented before the completed one are completed too
+    CompleteFrames(*m_presented_frame_index_by_frame[frame_buffer_index]);
+}
+
+void DescriptorManager::OnGpuIdle(Data::Index current_frame_index)
+{
+    META_FUNCTION_TASK();
+    std::scoped_lock lock_guard(m_descriptor_pool_mutex);
+
+    // Current frame command lists may be still encoded and not executed yet
+    if (current_frame_index > 0U)
+        CompleteFrames(current_frame_index - 1U);
+}
+
+void DescriptorManager::OnComputeCompleted()
+{
+    META_FUNCTION_TASK();
+    std::scoped_lock lock_guard(m_descriptor_pool_mutex);
+    CompleteFrames(m_compute_completions_count);
+    m_compute_completions_count++;
+}
+
+vk::DescriptorSet DescriptorManager::TryAllocDescriptorSet(const vk::DescriptorPool& vk_pool, const vk::DescriptorSetLayout& layout)
+{
+    META_FUNCTION_TASK();
+    const vk::Device& vk_device = GetContextVk().GetVulkanDevice().GetNativeDevice();
     try
     {
-        const auto descriptor_sets = vk_device.allocateDescriptorSets(vk::DescriptorSetAllocateInfo(m_vk_current_pool, 1, &layout));
+        const auto descriptor_sets = vk_device.allocateDescriptorSets(vk::DescriptorSetAllocateInfo(vk_pool, 1, &layout));
         if (!descriptor_sets.empty())
             return descriptor_sets.back();
     }
     catch(const vk::OutOfPoolMemoryError&)
     {
-        // Exception is handled below try-catch block
+        // Empty descriptor set is returned to allocate it from another pool
         META_LOG("Out of descriptor pool memory, reallocating.");
     }
     catch(const vk::FragmentedPoolError&)
     {
-        // Exception is handled below try-catch block
+        // Empty descriptor set is returned to allocate it from another pool
         META_LOG("Fragmented descriptor pool, reallocating.");
     }
-
-    // Reallocate descriptor set for the new pool
-    m_vk_current_pool = AcquireDescriptorPool();
-    const auto descriptor_sets = vk_device.allocateDescriptorSets(vk::DescriptorSetAllocateInfo(m_vk_current_pool, 1, &layout));
-    META_CHECK_ARG_NOT_EMPTY(descriptor_sets);
-    return descriptor_sets.back();
+    return vk::DescriptorSet();
 }
 
 vk::DescriptorPool DescriptorManager::CreateDescriptorPool()
 {
     META_FUNCTION_TASK();
+    TuneDescriptorPoolSizeRatios();
+
     std::vector<vk::DescriptorPoolSize> pool_sizes;
     pool_sizes.reserve(m_pool_size_ratio_by_desc_type.size());
     for (const auto& [desc_type, size_ratio] : m_pool_size_ratio_by_desc_type)
     {
-        pool_sizes.emplace_back(desc_type, static_cast<uint32_t>(static_cast<float>(m_pool_sets_count) * size_ratio));
+        // Pool must fit at least one descriptor set with the largest observed count of descriptors of each type
+        const auto max_set_descriptors_it = m_max_set_descriptors_count_by_type.find(desc_type);
+        const uint32_t descriptors_count = std::max({
+            static_cast<uint32_t>(static_cast<float>(m_pool_sets_count) * size_ratio),
+            max_set_descriptors_it == m_max_set_descriptors_count_by_type.end() ? 0U : max_set_descriptors_it->second,
+            1U
+        });
+        pool_sizes.emplace_back(desc_type, descriptors_count);
     }
+
+    // Descriptor sets are freed individually only when their layout is destroyed, otherwise they are recycled or reset with pool
     const vk::Device& vk_device = GetContextVk().GetVulkanDevice().GetNativeDevice();
-    m_vk_descriptor_pools.emplace_back(vk_device.createDescriptorPoolUnique(vk::DescriptorPoolCreateInfo({}, m_pool_sets_count, pool_sizes)));
+    m_vk_descriptor_pools.emplace_back(vk_device.createDescriptorPoolUnique(
+        vk::DescriptorPoolCreateInfo(vk::DescriptorPoolCreateFlagBits::eFreeDescriptorSet, m_pool_sets_count, pool_sizes)
+    ));
     return m_vk_descriptor_pools.back().get();
 }
 
@@ -113,17 +274,105 @@ vk::DescriptorPool DescriptorManager::AcquireDescriptorPool()
 {
     META_FUNCTION_TASK();
     if (m_vk_free_pools.empty())
-    {
-        vk::DescriptorPool new_pool = CreateDescriptorPool();
-        m_vk_used_pools.emplace_back(new_pool);
-        return new_pool;
-    }
+        return CreateDescriptorPool();
 
     vk::DescriptorPool free_pool = m_vk_free_pools.back();
     m_vk_free_pools.pop_back();
     return free_pool;
 }
 
+void DescriptorManager::ObserveDescriptorsUsage(const LayoutBindings& layout_bindings)
+{
+    META_FUNCTION_TASK();
+    std::map<vk::DescriptorType, uint32_t> set_descriptors_count_by_type;
+    for(const vk::DescriptorSetLayoutBinding& layout_binding : layout_bindings)
+    {
+        set_descriptors_count_by_type[layout_binding.descriptorType] += layout_binding.descriptorCount;
+    }
+    for(const auto& [desc_type, descriptors_count] : set_descriptors_count_by_type)
+    {
+        m_observed_descriptors_count_by_type[desc_type] += descriptors_count;
+        uint32_t& max_set_descriptors_count = m_max_set_descriptors_count_by_type[desc_type];
+        max_set_descriptors_count = std::max(max_set_descriptors_count, descriptors_count);
+    }
+    m_observed_sets_count++;
+}
+
+void DescriptorManager::TuneDescriptorPoolSizeRatios()
+{
+    META_FUNCTION_TASK();
+    if (!m_observed_sets_count)
+        return;
+
+    // Descriptor types which were not used so far get minimal pool size,
+    // pool allocated after their first use will be tuned with their usage
+    for(auto& [desc_type, size_ratio] : m_pool_size_ratio_by_desc_type)
+    {
+        if (!m_fixed_ratio_desc_types.count(desc_type) && !m_observed_descriptors_count_by_type.count(desc_type))
+            size_ratio = g_min_pool_size_ratio;
+    }
+
+    for(const auto& [desc_type, descriptors_count] : m_observed_descriptors_count_by_type)
+    {
+        if (m_fixed_ratio_desc_types.count(desc_type))
+            continue;
+
+        const float observed_ratio = static_cast<float>(descriptors_count) / static_cast<float>(m_observed_sets_count);
+        m_pool_size_ratio_by_desc_type[desc_type] = std::max(observed_ratio * g_pool_size_ratio_headroom, g_min_pool_size_ratio);
+    }
+}
+
+void DescriptorManager::CompleteFrames(Data::Index completed_frame_index)
+{
+    META_FUNCTION_TASK();
+    std::vector<vk::DescriptorSet> orphan_sets;
+    const auto retired_sets_end_it = std::remove_if(m_retired_sets.begin(), m_retired_sets.end(),
+        [this, completed_frame_index, &orphan_sets](const RetiredDescriptorSet& retired_set)
+        {
+            if (retired_set.frame_index > completed_frame_index)
+                return false;
+
+            if (retired_set.layout)
+                m_recycled_sets_by_layout[retired_set.layout].push_back(retired_set.descriptor_set);
+            else
+                orphan_sets.push_back(retired_set.descriptor_set);
+            return true;
+        });
+    m_retired_sets.erase(retired_sets_end_it, m_retired_sets.end());
+    FreeDescriptorSets(orphan_sets);
+
+    // Transient pools of completed frames are reset wholesale and returned to the free pools
+    const vk::Device& vk_device = GetContextVk().GetVulkanDevice().GetNativeDevice();
+    m_transient_pools.CompleteFrames(completed_frame_index,
+        [this, &vk_device](const vk::DescriptorPool& vk_pool)
+        {
+            vk_device.resetDescriptorPool(vk_pool);
+            m_vk_free_pools.emplace_back(vk_pool);
+        });
+}
+
+void DescriptorManager::FreeDescriptorSets(const std::vector<vk::DescriptorSet>& descriptor_sets)
+{
+    META_FUNCTION_TASK();
+    const vk::Device& vk_device = GetContextVk().GetVulkanDevice().GetNativeDevice();
+    for(const vk::DescriptorSet& descriptor_set : descriptor_sets)
+    {
+        const auto pool_by_descriptor_set_it = m_vk_pool_by_descriptor_set.find(descriptor_set);
+        META_CHECK_ARG_TRUE_DESCR(pool_by_descriptor_set_it != m_vk_pool_by_descriptor_set.end(), "descriptor set was not allocated by descriptor manager");
+        vk_device.freeDescriptorSets(pool_by_descriptor_set_it->second, descriptor_set);
+        m_vk_pool_by_descriptor_set.erase(pool_by_descriptor_set_it);
+    }
+}
+
+Data::Index DescriptorManager::GetCurrentFrameIndex() const
+{
+    META_FUNCTION_TASK();
+    const Base::Context& context = GetContext();
+    return context.GetType() == Rhi::IContext::Type::Render
+         ? dynamic_cast<const Base::RenderContext&>(context).GetFrameIndex()
+         : m_compute_completions_count;
+}
+
 const IContext& DescriptorManager::GetContextVk()
 {
     META_FUNCTION_TASK();
@@ -25,6 +25,7 @@ Vulkan implementation of the device interface.
 #include <Methane/Graphics/Vulkan/Platform.h>
 #include <Methane/Graphics/Vulkan/RenderContext.h>
 #include <Methane/Graphics/Vulkan/ComputeContext.h>
+#include <Methane/Graphics/Vulkan/ExecutionCompletionService.h>
 #include <Methane/Graphics/Vulkan/Utils.hpp>
 
 #include <Methane/Graphics/TypeFormatters.hpp>
@@ -209,6 +210,7 @@ Device::Device(const vk::PhysicalDevice& vk_physical_device, const vk::SurfaceKH
     , m_supported_extension_names_storage(GetDeviceSupportedExtensionNames(vk_physical_device))
     , m_supported_extension_names_set(m_supported_extension_names_storage.begin(), m_supported_extension_names_storage.end())
     , m_is_dynamic_state_supported(IsExtensionSupported(VK_EXT_EXTENDED_DYNAMIC_STATE_EXTENSION_NAME))
+    , m_is_multi_draw_indirect_supported(vk_physical_device.getFeatures().multiDrawIndirect)
     , m_vk_queue_family_properties(vk_physical_device.getQueueFamilyProperties())
 {
     META_FUNCTION_TASK();
@@ -245,6 +247,10 @@ Device::Device(const vk::PhysicalDevice& vk_physical_device, const vk::SurfaceKH
         {
             enabled_extension_names.push_back(VK_EXT_EXTENDED_DYNAMIC_STATE_EXTENSION_NAME);
         }
+        if (capabilities.features.HasBit(Rhi::DeviceFeature::IndirectDrawCount))
+        {
+            enabled_extension_names.push_back(VK_KHR_DRAW_INDIRECT_COUNT_EXTENSION_NAME);
+        }
     }
 
     if (IsExtensionSupported(VK_KHR_PORTABILITY_SUBSET_EXTENSION_NAME))
@@ -260,6 +266,8 @@ Device::Device(const vk::PhysicalDevice& vk_physical_device, const vk::SurfaceKH
     vk::PhysicalDeviceFeatures vk_device_features;
     vk_device_features.samplerAnisotropy = capabilities.features.HasBit(Rhi::DeviceFeature::AnisotropicFiltering);
     vk_device_features.imageCubeArray    = capabilities.features.HasBit(Rhi::DeviceFeature::ImageCubeArray);
+    vk_device_features.multiDrawIndirect = m_is_multi_draw_indirect_supported;
+    vk_device_features.drawIndirectFirstInstance = vk_physical_device.getFeatures().drawIndirectFirstInstance;
 
     // Add descriptions of enabled device features:
     vk::PhysicalDeviceExtendedDynamicStateFeaturesEXT vk_device_dynamic_state_feature(m_is_dynamic_state_supported);
@@ -278,11 +286,22 @@ Device::Device(const vk::PhysicalDevice& vk_physical_device, const vk::SurfaceKH
 
     m_vk_unique_device = vk_physical_device.createDeviceUnique(vk_device_info);
     VULKAN_HPP_DEFAULT_DISPATCHER.init(m_vk_unique_device.get());
+
+    m_memory_allocator_ptr = std::make_unique<MemoryAllocator>(m_vk_physical_device, m_vk_unique_device.get());
+    m_pipeline_cache_ptr   = std::make_unique<PipelineCache>(m_vk_physical_device, m_vk_unique_device.get());
+}
+
+Device::~Device()
+{
+    META_FUNCTION_TASK();
+    // Execution completion service waits with native semaphores and must be released before device
+    ReleaseExecutionCompletionService();
 }
 
 Ptr<Rhi::IRenderContext> Device::CreateRenderContext(const Methane::Platform::AppEnvironment& env, tf::Executor& parallel_executor, const Rhi::RenderContextSettings& settings)
 {
     META_FUNCTION_TASK();
+    LoadPipelineCache();
     const auto render_context_ptr = std::make_shared<Vulkan::RenderContext>(env, *this, parallel_executor, settings);
     render_context_ptr->Initialize(*this, true);
     return render_context_ptr;
@@ -291,11 +310,29 @@ Ptr<Rhi::IRenderContext> Device::CreateRenderContext(const Methane::Platform::Ap
 Ptr<Rhi::IComputeContext> Device::CreateComputeContext(tf::Executor& parallel_executor, const Rhi::ComputeContextSettings& settings)
 {
     META_FUNCTION_TASK();
+    LoadPipelineCache();
     const auto compute_context_ptr = std::make_shared<Vulkan::ComputeContext>(*this, parallel_executor, settings);
     compute_context_ptr->Initialize(*this, true);
     return compute_context_ptr;
 }
 
+Rhi::DeviceMemoryStatistics Device::GetMemoryStatistics() const
+{
+    META_FUNCTION_TASK();
+    return GetMemoryAllocator().GetStatistics();
+}
+
+bool Device::FlushPipelineCache()
+{
+    META_FUNCTION_TASK();
+    const std::string& pipeline_cache_path = GetPipelineCachePath();
+    if (pipeline_cache_path.empty())
+        return false;
+
+    META_CHECK_ARG_NOT_NULL(m_pipeline_cache_ptr);
+    return m_pipeline_cache_ptr->Save(pipeline_cache_path);
+}
+
 bool Device::SetName(std::string_view name)
 {
     META_FUNCTION_TASK();
@@ -354,6 +391,45 @@ Opt<uint32_t> Device::FindMemoryType(uint32_t type_filter, vk::MemoryPropertyFla
     return std::nullopt;
 }
 
+MemoryAllocator& Device::GetMemoryAllocator() const
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_NOT_NULL(m_memory_allocator_ptr);
+    return *m_memory_allocator_ptr;
+}
+
+const vk::PipelineCache& Device::GetNativePipelineCache() const
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_NOT_NULL(m_pipeline_cache_ptr);
+    return m_pipeline_cache_ptr->GetNativePipelineCache();
+}
+
+UniquePtr<Base::ExecutionCompletionService> Device::CreateExecutionCompletionService() const
+{
+    META_FUNCTION_TASK();
+#ifdef __APPLE__
+    // FIXME: MoltenVK is crashing on attempt to use timeline semaphores, so command list sets are submitted
+    //        with execution completed fences, which are waited by the base execution completion service
+    return Base::Device::CreateExecutionCompletionService();
+#else
+    return std::make_unique<ExecutionCompletionService>(m_vk_unique_device.get());
+#endif
+}
+
+void Device::LoadPipelineCache()
+{
+    META_FUNCTION_TASK();
+    // Pipeline cache file is loaded once for every new path, cached pipelines of all contexts are accumulated in device cache
+    const std::string& pipeline_cache_path = GetPipelineCachePath();
+    if (pipeline_cache_path.empty() || pipeline_cache_path == m_loaded_pipeline_cache_path)
+        return;
+
+    META_CHECK_ARG_NOT_NULL(m_pipeline_cache_ptr);
+    m_pipeline_cache_ptr->Load(pipeline_cache_path);
+    m_loaded_pipeline_cache_path = pipeline_cache_path;
+}
+
 const vk::QueueFamilyProperties& Device::GetNativeQueueFamilyProperties(uint32_t queue_family_index) const
 {
     META_FUNCTION_TASK();
@@ -405,6 +481,7 @@ Rhi::DeviceFeatureMask Device::GetSupportedFeatures() const
     device_features.SetBit(Rhi::DeviceFeature::PresentToWindow,      IsExtensionSupported(VK_KHR_SWAPCHAIN_EXTENSION_NAME));
     device_features.SetBit(Rhi::DeviceFeature::AnisotropicFiltering, vk_device_features.samplerAnisotropy);
     device_features.SetBit(Rhi::DeviceFeature::ImageCubeArray,       vk_device_features.imageCubeArray);
+    device_features.SetBit(Rhi::DeviceFeature::IndirectDrawCount,    IsExtensionSupported(VK_KHR_DRAW_INDIRECT_COUNT_EXTENSION_NAME));
     return device_features;
 }
 
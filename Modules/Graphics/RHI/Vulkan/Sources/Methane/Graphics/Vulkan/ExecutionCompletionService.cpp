@@ -0,0 +1,117 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+FILE: Methane/Graphics/Vulkan/ExecutionCompletionService.cpp
+Vulkan implementation of the command list sets execution completion service
+waiting for any of the command queue timeline semaphores.
+
+******************************************************************************/
+
+#include <Methane/Graphics/Vulkan/ExecutionCompletionService.h>
+#include <Methane/Graphics/Vulkan/CommandListSet.h>
+
+#include <Methane/Instrumentation.h>
+#include <Methane/Checks.hpp>
+
+#include <limits>
+
+namespace Methane::Graphics::Vulkan
+{
+
+static vk::UniqueSemaphore CreateTimelineSemaphore(const vk::Device& vk_device)
+{
+    META_FUNCTION_TASK();
+    vk::SemaphoreTypeCreateInfo semaphore_type_create_info(vk::SemaphoreType::eTimeline, 0U);
+    return vk_device.createSemaphoreUnique(vk::SemaphoreCreateInfo().setPNext(&semaphore_type_create_info));
+}
+
+ExecutionCompletionService::ExecutionCompletionService(const vk::Device& vk_device)
+    : m_vk_device(vk_device)
+    , m_vk_unique_interrupt_semaphore(CreateTimelineSemaphore(vk_device))
+{ }
+
+ExecutionCompletionService::~ExecutionCompletionService()
+{
+    META_FUNCTION_TASK();
+    // Completion thread has to be stopped before the interrupt semaphore is destroyed
+    Shutdown();
+}
+
+void ExecutionCompletionService::WaitForAnyCompleted(const Ptrs<Base::CommandListSet>& command_list_sets)
+{
+    META_FUNCTION_TASK();
+    m_vk_wait_semaphores.clear();
+    m_vk_wait_values.clear();
+
+    for(const Ptr<Base::CommandListSet>& command_list_set_ptr : command_list_sets)
+    {
+        const auto& vulkan_command_list_set = static_cast<const CommandListSet&>(*command_list_set_ptr);
+        const uint64_t execution_timeline_value = vulkan_command_list_set.GetExecutionTimelineValue();
+        if (!execution_timeline_value)
+        {
+            // Command list set was executed without queue timeline signalling, so it can be waited only with its fence
+            Base::ExecutionCompletionService::WaitForAnyCompleted({ command_list_set_ptr });
+            return;
+        }
+        m_vk_wait_semaphores.emplace_back(vulkan_command_list_set.GetVulkanCommandQueue().GetNativeExecutionTimelineSemaphore());
+        m_vk_wait_values.emplace_back(execution_timeline_value);
+    }
+
+    m_vk_wait_semaphores.emplace_back(m_vk_unique_interrupt_semaphore.get());
+    m_vk_wait_values.emplace_back(m_interrupt_wait_value);
+
+    const vk::SemaphoreWaitInfo wait_info(vk::SemaphoreWaitFlagBits::eAny, m_vk_wait_semaphores, m_vk_wait_values);
+    const vk::Result wait_result = m_vk_device.waitSemaphoresKHR(wait_info, std::numeric_limits<uint64_t>::max());
+    META_CHECK_ARG_EQUAL_DESCR(wait_result, vk::Result::eSuccess, "failed to wait for any command list set execution completed");
+}
+
+bool ExecutionCompletionService::IsCompleted(const Base::CommandListSet& command_list_set) const
+{
+    META_FUNCTION_TASK();
+    const auto& vulkan_command_list_set = static_cast<const CommandListSet&>(command_list_set);
+    const uint64_t execution_timeline_value = vulkan_command_list_set.GetExecutionTimelineValue();
+    if (!execution_timeline_value)
+        return Base::ExecutionCompletionService::IsCompleted(command_list_set);
+
+    const vk::Semaphore& vk_timeline_semaphore = vulkan_command_list_set.GetVulkanCommandQueue().GetNativeExecutionTimelineSemaphore();
+    return m_vk_device.getSemaphoreCounterValueKHR(vk_timeline_semaphore) >= execution_timeline_value;
+}
+
+void ExecutionCompletionService::ResetWaitingInterrupt()
+{
+    META_FUNCTION_TASK();
+    // Base waiting is used for command list sets executed without queue timeline signalling
+    Base::ExecutionCompletionService::ResetWaitingInterrupt();
+    m_is_interrupt_pending = false;
+    m_interrupt_wait_value = m_vk_device.getSemaphoreCounterValueKHR(m_vk_unique_interrupt_semaphore.get()) + 1U;
+}
+
+void ExecutionCompletionService::InterruptWaiting()
+{
+    META_FUNCTION_TASK();
+    Base::ExecutionCompletionService::InterruptWaiting();
+    if (m_is_interrupt_pending.exchange(true))
+        return;
+
+    // Timeline semaphore can be signalled from host with the value greater than its current counter value only
+    std::scoped_lock lock_guard(m_interrupt_mutex);
+    const vk::Semaphore& vk_interrupt_semaphore = m_vk_unique_interrupt_semaphore.get();
+    const uint64_t interrupt_value = m_vk_device.getSemaphoreCounterValueKHR(vk_interrupt_semaphore) + 1U;
+    m_vk_device.signalSemaphoreKHR(vk::SemaphoreSignalInfo(vk_interrupt_semaphore, interrupt_value));
+}
+
+} // namespace Methane::Graphics::Vulkan
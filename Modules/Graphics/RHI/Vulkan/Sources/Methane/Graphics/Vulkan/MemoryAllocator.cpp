@@ -0,0 +1,269 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/Vulkan/MemoryAllocator.cpp
+Vulkan device memory allocator placing resources in large memory blocks
+allocated per memory type, instead of allocating device memory per resource.
+
+******************************************************************************/
+
+#include <Methane/Graphics/Vulkan/MemoryAllocator.h>
+
+#include <Methane/Instrumentation.h>
+#include <Methane/Checks.hpp>
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <cassert>
+
+namespace Methane::Graphics::Vulkan
+{
+
+static constexpr size_t g_tilings_count = 2U;
+
+MemoryBlock::MemoryBlock(const vk::Device& vk_device, uint32_t memory_type_index, uint32_t heap_index, MemoryTiling tiling,
+                         vk::DeviceSize size, bool is_host_visible, bool is_dedicated)
+    : m_vk_unique_memory(vk_device.allocateMemoryUnique(vk::MemoryAllocateInfo(size, memory_type_index)))
+    , m_memory_type_index(memory_type_index)
+    , m_heap_index(heap_index)
+    , m_tiling(tiling)
+    , m_is_dedicated(is_dedicated)
+    , m_range_allocator(size)
+{
+    META_FUNCTION_TASK();
+    if (!is_host_visible)
+        return;
+
+    // Host visible blocks are mapped once for the whole lifetime, because one memory object can not be mapped twice
+    const vk::Result vk_map_result = vk_device.mapMemory(m_vk_unique_memory.get(), 0U, VK_WHOLE_SIZE, vk::MemoryMapFlags{},
+                                                         reinterpret_cast<void**>(&m_mapped_data_ptr)); // NOSONAR
+    META_CHECK_ARG_EQUAL_DESCR(vk_map_result, vk::Result::eSuccess, "failed to map device memory block");
+    META_CHECK_ARG_NOT_NULL_DESCR(m_mapped_data_ptr, "failed to map device memory block");
+}
+
+MemoryAllocation::MemoryAllocation(MemoryAllocator& allocator, MemoryBlock& block, const Data::Range<vk::DeviceSize>& range) noexcept
+    : m_allocator_ptr(&allocator)
+    , m_block_ptr(&block)
+    , m_range(range)
+{ }
+
+MemoryAllocation::MemoryAllocation(MemoryAllocation&& other) noexcept
+    : m_allocator_ptr(other.m_allocator_ptr)
+    , m_block_ptr(other.m_block_ptr)
+    , m_range(other.m_range)
+{
+    other.m_allocator_ptr = nullptr;
+    other.m_block_ptr     = nullptr;
+}
+
+MemoryAllocation::~MemoryAllocation()
+{
+    Release();
+}
+
+MemoryAllocation& MemoryAllocation::operator=(MemoryAllocation&& other) noexcept
+{
+    if (this == &other)
+        return *this;
+
+    Release();
+    m_allocator_ptr = other.m_allocator_ptr;
+    m_block_ptr     = other.m_block_ptr;
+    m_range         = other.m_range;
+    other.m_allocator_ptr = nullptr;
+    other.m_block_ptr     = nullptr;
+    return *this;
+}
+
+void MemoryAllocation::Release() noexcept
+{
+    if (!m_block_ptr)
+        return;
+
+    m_allocator_ptr->Free(*m_block_ptr, m_range);
+    m_allocator_ptr = nullptr;
+    m_block_ptr     = nullptr;
+    m_range         = {};
+}
+
+const vk::DeviceMemory& MemoryAllocation::GetNativeDeviceMemory() const noexcept
+{
+    static const vk::DeviceMemory s_empty_device_memory;
+    return m_block_ptr ? m_block_ptr->GetNativeDeviceMemory() : s_empty_device_memory;
+}
+
+Data::RawPtr MemoryAllocation::GetMappedDataPtr() const noexcept
+{
+    if (!m_block_ptr || !m_block_ptr->GetMappedDataPtr())
+        return nullptr;
+
+    return m_block_ptr->GetMappedDataPtr() + m_range.GetStart();
+}
+
+MemoryAllocator::MemoryAllocator(const vk::PhysicalDevice& vk_physical_device, const vk::Device& vk_device, const Settings& settings)
+    : m_settings(settings)
+    , m_vk_device(vk_device)
+    , m_vk_memory_properties(vk_physical_device.getMemoryProperties())
+    , m_blocks_by_pool(m_vk_memory_properties.memoryTypeCount * g_tilings_count)
+    , m_reserved_size_by_heap(m_vk_memory_properties.memoryHeapCount, 0U)
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_NOT_ZERO(settings.block_size);
+    META_CHECK_ARG_NOT_ZERO(settings.min_blocks_per_heap);
+}
+
+MemoryAllocation MemoryAllocator::Allocate(const vk::MemoryRequirements& memory_requirements, uint32_t memory_type_index, MemoryTiling tiling)
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_LESS(memory_type_index, m_vk_memory_properties.memoryTypeCount);
+    META_CHECK_ARG_NOT_ZERO(memory_requirements.size);
+
+    std::scoped_lock lock_guard(m_mutex);
+    const uint32_t       heap_index = m_vk_memory_properties.memoryTypes[memory_type_index].heapIndex;
+    const vk::DeviceSize block_size = GetBlockSize(heap_index);
+    const vk::DeviceSize alignment  = std::max<vk::DeviceSize>(memory_requirements.alignment, 1U);
+
+    // Resources larger than half of the block get dedicated memory to limit fragmentation of shared blocks
+    if (memory_requirements.size > block_size / 2U)
+    {
+        MemoryBlock& dedicated_block = AddBlock(memory_type_index, tiling, memory_requirements.size, true);
+        const Opt<Data::Range<vk::DeviceSize>> range_opt = dedicated_block.GetRangeAllocator().Allocate(memory_requirements.size);
+        META_CHECK_ARG_TRUE(range_opt.has_value());
+        return MemoryAllocation(*this, dedicated_block, *range_opt);
+    }
+
+    for(const UniquePtr<MemoryBlock>& block_ptr : GetBlocks(memory_type_index, tiling))
+    {
+        if (block_ptr->IsDedicated() || block_ptr->GetRangeAllocator().GetLargestFreeLength() < memory_requirements.size)
+            continue;
+
+        if (const Opt<Data::Range<vk::DeviceSize>> range_opt = block_ptr->GetRangeAllocator().Allocate(memory_requirements.size, alignment);
+            range_opt)
+            return MemoryAllocation(*this, *block_ptr, *range_opt);
+    }
+
+    MemoryBlock& new_block = AddBlock(memory_type_index, tiling, block_size, false);
+    const Opt<Data::Range<vk::DeviceSize>> range_opt = new_block.GetRangeAllocator().Allocate(memory_requirements.size, alignment);
+    META_CHECK_ARG_TRUE(range_opt.has_value());
+    return MemoryAllocation(*this, new_block, *range_opt);
+}
+
+Rhi::DeviceMemoryStatistics MemoryAllocator::GetStatistics() const
+{
+    META_FUNCTION_TASK();
+    Rhi::DeviceMemoryStatistics statistics;
+    for(uint32_t heap_index = 0U; heap_index < m_vk_memory_properties.memoryHeapCount; ++heap_index)
+    {
+        statistics.budget_size += m_vk_memory_properties.memoryHeaps[heap_index].size;
+    }
+
+    std::scoped_lock lock_guard(m_mutex);
+    for(const Blocks& blocks : m_blocks_by_pool)
+    {
+        for(const UniquePtr<MemoryBlock>& block_ptr : blocks)
+        {
+            const Data::RangeAllocator<vk::DeviceSize>& range_allocator = block_ptr->GetRangeAllocator();
+            statistics.blocks_count++;
+            statistics.dedicated_blocks_count += block_ptr->IsDedicated() ? 1U : 0U;
+            statistics.allocations_count      += static_cast<uint32_t>(range_allocator.GetAllocationsCount());
+            statistics.reserved_size          += range_allocator.GetCapacity();
+            statistics.used_size              += range_allocator.GetAllocatedSize();
+        }
+    }
+    return statistics;
+}
+
+void MemoryAllocator::Free(MemoryBlock& block, const Data::Range<vk::DeviceSize>& range) noexcept
+{
+    META_FUNCTION_TASK();
+    std::scoped_lock lock_guard(m_mutex);
+    try
+    {
+        block.GetRangeAllocator().Free(range);
+    }
+    catch(const std::exception& e)
+    {
+        META_UNUSED(e);
+        META_LOG("WARNING: Unexpected error during device memory release: {}", e.what());
+        assert(false);
+        return;
+    }
+
+    if (!block.GetRangeAllocator().IsEmpty())
+        return;
+
+    // Dedicated blocks are released right away, while one empty shared block is kept in every pool for reuse
+    const Blocks& blocks = GetBlocks(block.GetMemoryTypeIndex(), block.GetTiling());
+    const bool has_other_free_block = std::any_of(blocks.begin(), blocks.end(),
+        [&block](const UniquePtr<MemoryBlock>& block_ptr)
+        { return block_ptr.get() != &block && !block_ptr->IsDedicated() && block_ptr->GetRangeAllocator().IsEmpty(); });
+
+    if (block.IsDedicated() || has_other_free_block)
+    {
+        RemoveBlock(block);
+    }
+}
+
+MemoryBlock& MemoryAllocator::AddBlock(uint32_t memory_type_index, MemoryTiling tiling, vk::DeviceSize block_size, bool is_dedicated)
+{
+    META_FUNCTION_TASK();
+    const vk::MemoryType& vk_memory_type = m_vk_memory_properties.memoryTypes[memory_type_index];
+    const vk::MemoryHeap& vk_memory_heap = m_vk_memory_properties.memoryHeaps[vk_memory_type.heapIndex];
+    vk::DeviceSize& heap_reserved_size   = m_reserved_size_by_heap[vk_memory_type.heapIndex];
+    if (heap_reserved_size + block_size > vk_memory_heap.size)
+        throw vk::OutOfDeviceMemoryError(fmt::format("memory heap {} budget of {} bytes is exceeded with {} bytes reserved and {} bytes requested",
+                                                     vk_memory_type.heapIndex, vk_memory_heap.size, heap_reserved_size, block_size));
+
+    const bool is_host_visible = static_cast<bool>(vk_memory_type.propertyFlags & vk::MemoryPropertyFlagBits::eHostVisible);
+    Blocks& blocks = GetBlocks(memory_type_index, tiling);
+    blocks.emplace_back(std::make_unique<MemoryBlock>(m_vk_device, memory_type_index, vk_memory_type.heapIndex, tiling,
+                                                      block_size, is_host_visible, is_dedicated));
+    heap_reserved_size += block_size;
+    return *blocks.back();
+}
+
+void MemoryAllocator::RemoveBlock(const MemoryBlock& block) noexcept
+{
+    META_FUNCTION_TASK();
+    Blocks& blocks = m_blocks_by_pool[static_cast<size_t>(block.GetMemoryTypeIndex()) * g_tilings_count + static_cast<size_t>(block.GetTiling())];
+    const auto block_it = std::find_if(blocks.begin(), blocks.end(),
+                                       [&block](const UniquePtr<MemoryBlock>& block_ptr) { return block_ptr.get() == &block; });
+    if (block_it == blocks.end())
+        return;
+
+    m_reserved_size_by_heap[block.GetHeapIndex()] -= block.GetRangeAllocator().GetCapacity();
+    blocks.erase(block_it);
+}
+
+MemoryAllocator::Blocks& MemoryAllocator::GetBlocks(uint32_t memory_type_index, MemoryTiling tiling)
+{
+    META_FUNCTION_TASK();
+    const size_t pool_index = static_cast<size_t>(memory_type_index) * g_tilings_count + static_cast<size_t>(tiling);
+    META_CHECK_ARG_LESS(pool_index, m_blocks_by_pool.size());
+    return m_blocks_by_pool[pool_index];
+}
+
+vk::DeviceSize MemoryAllocator::GetBlockSize(uint32_t heap_index) const noexcept
+{
+    META_FUNCTION_TASK();
+    const vk::DeviceSize heap_size = m_vk_memory_properties.memoryHeaps[heap_index].size;
+    return std::min(m_settings.block_size, heap_size / m_settings.min_blocks_per_heap);
+}
+
+} // namespace Methane::Graphics::Vulkan
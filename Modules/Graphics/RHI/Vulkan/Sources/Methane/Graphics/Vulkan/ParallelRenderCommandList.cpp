@@ -168,6 +168,8 @@ RenderPass& ParallelRenderCommandList::GetVulkanRenderPass() const noexcept
 
 Ptr<Rhi::IRenderCommandList> ParallelRenderCommandList::CreateCommandList(bool is_beginning_list)
 {
+    // Every thread render command list owns its command pool, so that command buffers
+    // of different threads can be reset and encoded concurrently without external synchronization
     return std::make_shared<RenderCommandList>(*this, is_beginning_list);
 }
 
@@ -0,0 +1,182 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/Vulkan/PipelineCache.cpp
+Vulkan device pipeline cache shared by all render and compute pipelines,
+persisted on disk in a versioned file keyed by device UUID and driver version.
+
+******************************************************************************/
+
+#include <Methane/Graphics/Vulkan/PipelineCache.h>
+
+#include <Methane/Data/Types.h>
+#include <Methane/Instrumentation.h>
+#include <Methane/Checks.hpp>
+
+#include <fstream>
+#include <filesystem>
+#include <system_error>
+#include <cstring>
+#include <algorithm>
+
+namespace Methane::Graphics::Vulkan
+{
+
+static constexpr uint32_t g_cache_file_magic   = 0x4D504C43; // 'MPLC'
+static constexpr uint32_t g_cache_file_version = 1U;
+static constexpr uint64_t g_cache_max_data_size = 1ULL << 30U;
+
+// Pipeline cache file starts with header identifying device and driver which produced cache data,
+// because driver validation of cache data header is not reliable across all drivers
+struct PipelineCacheFileHeader
+{
+    uint32_t magic          = g_cache_file_magic;
+    uint32_t format_version = g_cache_file_version;
+    uint32_t vendor_id      = 0U;
+    uint32_t device_id      = 0U;
+    uint32_t driver_version = 0U;
+    uint8_t  pipeline_cache_uuid[VK_UUID_SIZE]{};
+    uint64_t data_size      = 0U;
+    uint64_t data_hash      = 0U;
+};
+
+[[nodiscard]]
+static uint64_t ComputeDataHash(const Data::Bytes& data) noexcept
+{
+    // FNV-1a hash is used to detect truncated or corrupted cache files
+    uint64_t hash = 14695981039346656037ULL;
+    for(const Data::Byte byte : data)
+    {
+        hash ^= static_cast<uint64_t>(byte);
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+[[nodiscard]]
+static PipelineCacheFileHeader MakeFileHeader(const vk::PhysicalDeviceProperties& vk_device_properties, const Data::Bytes& data) noexcept
+{
+    PipelineCacheFileHeader header;
+    header.vendor_id      = vk_device_properties.vendorID;
+    header.device_id      = vk_device_properties.deviceID;
+    header.driver_version = vk_device_properties.driverVersion;
+    header.data_size      = data.size();
+    header.data_hash      = ComputeDataHash(data);
+    std::copy(vk_device_properties.pipelineCacheUUID.begin(), vk_device_properties.pipelineCacheUUID.end(), std::begin(header.pipeline_cache_uuid));
+    return header;
+}
+
+[[nodiscard]]
+static bool IsFileHeaderCompatible(const PipelineCacheFileHeader& header, const vk::PhysicalDeviceProperties& vk_device_properties) noexcept
+{
+    return header.magic          == g_cache_file_magic &&
+           header.format_version == g_cache_file_version &&
+           header.vendor_id      == vk_device_properties.vendorID &&
+           header.device_id      == vk_device_properties.deviceID &&
+           header.driver_version == vk_device_properties.driverVersion &&
+           std::equal(vk_device_properties.pipelineCacheUUID.begin(), vk_device_properties.pipelineCacheUUID.end(),
+                      std::begin(header.pipeline_cache_uuid));
+}
+
+PipelineCache::PipelineCache(const vk::PhysicalDevice& vk_physical_device, const vk::Device& vk_device)
+    : m_vk_device(vk_device)
+    , m_vk_device_properties(vk_physical_device.getProperties())
+    , m_vk_unique_pipeline_cache(vk_device.createPipelineCacheUnique(vk::PipelineCacheCreateInfo()))
+{ }
+
+bool PipelineCache::Load(const std::string& cache_file_path)
+{
+    META_FUNCTION_TASK();
+    std::ifstream cache_file(cache_file_path, std::ios::binary);
+    if (!cache_file.is_open())
+        return false;
+
+    PipelineCacheFileHeader header;
+    if (!cache_file.read(reinterpret_cast<char*>(&header), sizeof(header)) || // NOSONAR
+        !IsFileHeaderCompatible(header, m_vk_device_properties))
+    {
+        META_LOG("Pipeline cache file '{}' is incompatible with current device or driver and will be overwritten", cache_file_path);
+        return false;
+    }
+
+    if (header.data_size > g_cache_max_data_size)
+    {
+        META_LOG("Pipeline cache file '{}' is corrupted and will be overwritten", cache_file_path);
+        return false;
+    }
+
+    Data::Bytes cache_data(static_cast<size_t>(header.data_size));
+    if (!cache_file.read(reinterpret_cast<char*>(cache_data.data()), static_cast<std::streamsize>(cache_data.size())) || // NOSONAR
+        ComputeDataHash(cache_data) != header.data_hash)
+    {
+        META_LOG("Pipeline cache file '{}' is corrupted and will be overwritten", cache_file_path);
+        return false;
+    }
+
+    // Cache data is loaded to a separate pipeline cache and merged, so that pipelines created before loading are kept
+    const vk::UniquePipelineCache vk_unique_loaded_cache = m_vk_device.createPipelineCacheUnique(
+        vk::PipelineCacheCreateInfo(vk::PipelineCacheCreateFlags{}, cache_data.size(), cache_data.data())
+    );
+
+    std::scoped_lock lock_guard(m_mutex);
+    m_vk_device.mergePipelineCaches(m_vk_unique_pipeline_cache.get(), vk_unique_loaded_cache.get());
+    META_LOG("Pipeline cache of {} bytes was loaded from file '{}'", cache_data.size(), cache_file_path);
+    return true;
+}
+
+bool PipelineCache::Save(const std::string& cache_file_path) const
+{
+    META_FUNCTION_TASK();
+    Data::Bytes cache_data;
+    {
+        std::scoped_lock lock_guard(m_mutex);
+        const std::vector<uint8_t> vk_cache_data = m_vk_device.getPipelineCacheData(m_vk_unique_pipeline_cache.get());
+        cache_data.resize(vk_cache_data.size());
+        std::memcpy(cache_data.data(), vk_cache_data.data(), vk_cache_data.size());
+    }
+
+    // Cache is written to temporary file first, so that failed write does not leave truncated cache file
+    const std::string temp_file_path = cache_file_path + ".tmp";
+    {
+        const PipelineCacheFileHeader header = MakeFileHeader(m_vk_device_properties, cache_data);
+        std::ofstream cache_file(temp_file_path, std::ios::binary | std::ios::trunc);
+        if (!cache_file.is_open() ||
+            !cache_file.write(reinterpret_cast<const char*>(&header), sizeof(header)) || // NOSONAR
+            !cache_file.write(reinterpret_cast<const char*>(cache_data.data()), static_cast<std::streamsize>(cache_data.size()))) // NOSONAR
+        {
+            META_LOG("Failed to write pipeline cache file '{}'", temp_file_path);
+            return false;
+        }
+    }
+
+    // Existing cache file is atomically replaced by rename, so that there is no moment without cache file:
+    // filesystem rename replaces target with POSIX rename and with MoveFileEx(MOVEFILE_REPLACE_EXISTING) on Windows
+    std::error_code error_code;
+    std::filesystem::rename(temp_file_path, cache_file_path, error_code);
+    if (error_code)
+    {
+        META_LOG("Failed to replace pipeline cache file '{}': {}", cache_file_path, error_code.message());
+        std::filesystem::remove(temp_file_path, error_code);
+        return false;
+    }
+
+    META_LOG("Pipeline cache of {} bytes was saved to file '{}'", cache_data.size(), cache_file_path);
+    return true;
+}
+
+} // namespace Methane::Graphics::Vulkan
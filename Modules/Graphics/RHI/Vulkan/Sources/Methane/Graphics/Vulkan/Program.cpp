@@ -49,6 +49,29 @@ Program::Program(const Base::Context& context, const Settings& settings)
     InitializeDescriptorSetLayouts();
 }
 
+Program::~Program()
+{
+    META_FUNCTION_TASK();
+    DescriptorManager& descriptor_manager = GetVulkanContext().GetVulkanDescriptorManager();
+    if (m_vk_constant_descriptor_set_opt.has_value() && m_vk_constant_descriptor_set_opt.value())
+    {
+        descriptor_manager.ReleaseDescriptorSet(GetNativeDescriptorSetLayout(Rhi::ProgramArgumentAccessType::Constant),
+                                                m_vk_constant_descriptor_set_opt.value());
+    }
+    for(const vk::DescriptorSet& frame_descriptor_set : m_vk_frame_constant_descriptor_sets)
+    {
+        if (frame_descriptor_set)
+            descriptor_manager.ReleaseDescriptorSet(GetNativeDescriptorSetLayout(Rhi::ProgramArgumentAccessType::FrameConstant),
+                                                    frame_descriptor_set);
+    }
+
+    // Released descriptor sets of this program layouts can not be recycled after layouts destruction
+    for(const vk::DescriptorSetLayout& layout : m_vk_descriptor_set_layouts)
+    {
+        descriptor_manager.ReleaseDescriptorSetLayout(layout);
+    }
+}
+
 Ptr<Rhi::IProgramBindings> Program::CreateBindings(const ResourceViewsByArgument& resource_views_by_argument, Data::Index frame_index)
 {
     META_FUNCTION_TASK();
@@ -142,7 +165,8 @@ const vk::DescriptorSet& Program::GetConstantDescriptorSet()
 
     const vk::DescriptorSetLayout& layout = GetNativeDescriptorSetLayout(Rhi::ProgramArgumentAccessType::Constant);
     m_vk_constant_descriptor_set_opt = layout
-                                     ? GetVulkanContext().GetVulkanDescriptorManager().AllocDescriptorSet(layout)
+                                     ? GetVulkanContext().GetVulkanDescriptorManager().AllocDescriptorSet(layout,
+                                           GetDescriptorSetLayoutInfo(Rhi::ProgramArgumentAccessType::Constant).bindings)
                                      : vk::DescriptorSet();
 
     UpdateConstantDescriptorSetName();
@@ -171,9 +195,10 @@ const vk::DescriptorSet& Program::GetFrameConstantDescriptorSet(Data::Index fram
         return m_vk_frame_constant_descriptor_sets.at(frame_index);
 
     DescriptorManager& descriptor_manager = GetVulkanContext().GetVulkanDescriptorManager();
+    const DescriptorSetLayoutInfo& layout_info = GetDescriptorSetLayoutInfo(Rhi::ProgramArgumentAccessType::FrameConstant);
     for(vk::DescriptorSet& frame_descriptor_set : m_vk_frame_constant_descriptor_sets)
     {
-        frame_descriptor_set = descriptor_manager.AllocDescriptorSet(layout);
+        frame_descriptor_set = descriptor_manager.AllocDescriptorSet(layout, layout_info.bindings);
     }
 
     UpdateFrameConstantDescriptorSetNames();
@@ -131,7 +131,7 @@ bool ProgramArgumentBinding::SetResourceViews(const Rhi::IResource::Views& resou
     );
 
     // Descriptions are updated on GPU during context initialization complete
-    if (GetContext().GetOptions().HasBit(Rhi::ContextOption::DeferredProgramBindingsInitialization))
+    if (m_is_descriptor_set_update_deferred && GetContext().GetOptions().HasBit(Rhi::ContextOption::DeferredProgramBindingsInitialization))
     {
         GetContext().RequestDeferredAction(Rhi::IContext::DeferredAction::CompleteInitialization);
     }
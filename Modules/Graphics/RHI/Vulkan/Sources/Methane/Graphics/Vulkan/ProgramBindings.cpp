@@ -58,7 +58,8 @@ ProgramBindings::ProgramBindings(Program& program,
         vk_mutable_descriptor_set_layout)
     {
         DescriptorManager& descriptor_manager = program.GetVulkanContext().GetVulkanDescriptorManager();
-        m_descriptor_sets.emplace_back(descriptor_manager.AllocDescriptorSet(vk_mutable_descriptor_set_layout));
+        const Program::DescriptorSetLayoutInfo& mutable_layout_info = program.GetDescriptorSetLayoutInfo(Rhi::ProgramArgumentAccessType::Mutable);
+        m_descriptor_sets.emplace_back(descriptor_manager.AllocDescriptorSet(vk_mutable_descriptor_set_layout, mutable_layout_info.bindings));
         m_has_mutable_descriptor_set = true;
     }
 
@@ -107,10 +108,12 @@ ProgramBindings::ProgramBindings(Program& program,
 
 ProgramBindings::ProgramBindings(const ProgramBindings& other_program_bindings,
                                  const ResourceViewsByArgument& replace_resource_view_by_argument,
-                                 const Opt<Data::Index>& frame_index)
+                                 const Opt<Data::Index>& frame_index,
+                                 bool is_transient)
     : Base::ProgramBindings(other_program_bindings, frame_index)
     , m_descriptor_sets(other_program_bindings.m_descriptor_sets)
     , m_has_mutable_descriptor_set(other_program_bindings.m_has_mutable_descriptor_set)
+    , m_is_transient(is_transient)
     , m_dynamic_offsets(other_program_bindings.m_dynamic_offsets)
     , m_dynamic_offset_index_by_set_index(other_program_bindings.m_dynamic_offset_index_by_set_index)
 {
@@ -122,11 +125,14 @@ ProgramBindings::ProgramBindings(const ProgramBindings& other_program_bindings,
         auto& program = static_cast<Program&>(GetProgram());
         const vk::DescriptorSetLayout& vk_mutable_desc_set_layout = program.GetNativeDescriptorSetLayout(Rhi::ProgramArgumentAccessType::Mutable);
         META_CHECK_ARG_NOT_NULL(vk_mutable_desc_set_layout);
-        vk::DescriptorSet copy_mutable_descriptor_set = program.GetVulkanContext().GetVulkanDescriptorManager().AllocDescriptorSet(vk_mutable_desc_set_layout);
+        const Program::DescriptorSetLayoutInfo& mutable_desc_set_layout_info = program.GetDescriptorSetLayoutInfo(Rhi::ProgramArgumentAccessType::Mutable);
+        DescriptorManager& descriptor_manager = program.GetVulkanContext().GetVulkanDescriptorManager();
+        vk::DescriptorSet copy_mutable_descriptor_set = m_is_transient
+                                                      ? descriptor_manager.AllocTransientDescriptorSet(vk_mutable_desc_set_layout, mutable_desc_set_layout_info.bindings)
+                                                      : descriptor_manager.AllocDescriptorSet(vk_mutable_desc_set_layout, mutable_desc_set_layout_info.bindings);
 
         // Copy descriptors from original to new mutable descriptor set
         const vk::Device& vk_device = program.GetVulkanContext().GetVulkanDevice().GetNativeDevice();
-        const Program::DescriptorSetLayoutInfo& mutable_desc_set_layout_info = program.GetDescriptorSetLayoutInfo(Rhi::ProgramArgumentAccessType::Mutable);
         vk_device.updateDescriptorSets({}, {
             vk::CopyDescriptorSet(other_program_bindings.m_descriptor_sets.back(), {}, {}, copy_mutable_descriptor_set, {}, mutable_desc_set_layout_info.descriptors_count)
         });
@@ -135,12 +141,13 @@ ProgramBindings::ProgramBindings(const ProgramBindings& other_program_bindings,
         vk_mutable_descriptor_set = copy_mutable_descriptor_set;
 
         // Update mutable argument bindings with a pointer to the copied descriptor set
-        ForEachArgumentBinding([&vk_mutable_descriptor_set](const Rhi::IProgram::Argument&, ArgumentBinding& argument_binding)
+        ForEachArgumentBinding([this, &vk_mutable_descriptor_set](const Rhi::IProgram::Argument&, ArgumentBinding& argument_binding)
         {
             if (argument_binding.GetVulkanSettings().argument.GetAccessorType() != Rhi::ProgramArgumentAccessType::Mutable)
                 return;
 
             argument_binding.SetDescriptorSet(vk_mutable_descriptor_set);
+            argument_binding.SetDescriptorSetUpdateDeferred(!m_is_transient);
         });
     }
 
@@ -149,6 +156,19 @@ ProgramBindings::ProgramBindings(const ProgramBindings& other_program_bindings,
     VerifyAllArgumentsAreBoundToResources();
 }
 
+ProgramBindings::~ProgramBindings()
+{
+    META_FUNCTION_TASK();
+    if (!m_has_mutable_descriptor_set || m_is_transient)
+        return;
+
+    // Only mutable descriptor set is owned by program bindings, while constant descriptor sets are owned by program;
+    // transient descriptor set is not released, since its pool is reset on completion of the frame it was allocated for
+    auto& program = static_cast<Program&>(GetProgram());
+    program.GetVulkanContext().GetVulkanDescriptorManager().ReleaseDescriptorSet(
+        program.GetNativeDescriptorSetLayout(Rhi::ProgramArgumentAccessType::Mutable), m_descriptor_sets.back());
+}
+
 Ptr<Rhi::IProgramBindings> ProgramBindings::CreateCopy(const ResourceViewsByArgument& replace_resource_views_by_argument, const Opt<Data::Index>& frame_index)
 {
     META_FUNCTION_TASK();
@@ -157,6 +177,13 @@ Ptr<Rhi::IProgramBindings> ProgramBindings::CreateCopy(const ResourceViewsByArgu
     return program_bindings_ptr;
 }
 
+Ptr<Rhi::IProgramBindings> ProgramBindings::CreateTransientCopy(const ResourceViewsByArgument& replace_resource_views_by_argument, const Opt<Data::Index>& frame_index)
+{
+    META_FUNCTION_TASK();
+    // Transient program bindings are not added to descriptor manager, because their descriptor sets are updated on GPU right away
+    return std::make_shared<ProgramBindings>(*this, replace_resource_views_by_argument, frame_index, true);
+}
+
 void ProgramBindings::SetResourcesForArguments(const ResourceViewsByArgument& resource_views_by_argument)
 {
     META_FUNCTION_TASK();
@@ -217,12 +244,14 @@ void ProgramBindings::CompleteInitialization()
 void ProgramBindings::Apply(Base::CommandList& command_list, ApplyBehaviorMask apply_behavior) const
 {
     META_FUNCTION_TASK();
-    Apply(dynamic_cast<ICommandList&>(command_list), command_list.GetCommandQueue(),
-          command_list.GetProgramBindingsPtr(), apply_behavior);
+    command_list.CountDescriptorSetBinds(
+        Apply(dynamic_cast<ICommandList&>(command_list), command_list.GetCommandQueue(),
+              command_list.GetProgramBindingsPtr(), apply_behavior)
+    );
 }
 
-void ProgramBindings::Apply(ICommandList& command_list_vk, const Rhi::ICommandQueue& command_queue,
-                            const Base::ProgramBindings* p_applied_program_bindings, ApplyBehaviorMask apply_behavior) const
+uint32_t ProgramBindings::Apply(ICommandList& command_list_vk, const Rhi::ICommandQueue& command_queue,
+                                const Base::ProgramBindings* p_applied_program_bindings, ApplyBehaviorMask apply_behavior) const
 {
     META_FUNCTION_TASK();
     META_CHECK_ARG_NOT_EMPTY(m_descriptor_sets);
@@ -234,7 +263,7 @@ void ProgramBindings::Apply(ICommandList& command_list_vk, const Rhi::ICommandQu
     if (apply_behavior == ApplyBehaviorMask(ApplyBehavior::ConstantOnce) && p_applied_program_bindings)
     {
         if (!m_has_mutable_descriptor_set)
-            return;
+            return 0U;
 
         first_descriptor_set_layout_index = static_cast<uint32_t>(m_descriptor_sets.size() - 1);
     }
@@ -253,16 +282,18 @@ void ProgramBindings::Apply(ICommandList& command_list_vk, const Rhi::ICommandQu
     const vk::CommandBuffer&    vk_command_buffer      = command_list_vk.GetNativeCommandBufferDefault();
     const vk::PipelineBindPoint vk_pipeline_bind_point = command_list_vk.GetNativePipelineBindPoint();
     const uint32_t first_dynamic_offset_index = m_dynamic_offset_index_by_set_index[first_descriptor_set_layout_index];
+    const auto     descriptor_sets_count = static_cast<uint32_t>(m_descriptor_sets.size() - first_descriptor_set_layout_index);
 
     // Bind descriptor sets to pipeline
     auto& program = static_cast<Program&>(GetProgram());
     vk_command_buffer.bindDescriptorSets(vk_pipeline_bind_point,
                                          program.GetNativePipelineLayout(),
                                          first_descriptor_set_layout_index,
-                                         static_cast<uint32_t>(m_descriptor_sets.size() - first_descriptor_set_layout_index),
+                                         descriptor_sets_count,
                                          m_descriptor_sets.data() + first_descriptor_set_layout_index,
                                          static_cast<uint32_t>(m_dynamic_offsets.size() - first_dynamic_offset_index),
                                          m_dynamic_offsets.data() + first_dynamic_offset_index);
+    return descriptor_sets_count;
 }
 
 void ProgramBindings::OnObjectNameChanged(IObject&, const std::string&)
@@ -73,11 +73,13 @@ static vk::CommandBufferInheritanceInfo CreateCommandBufferInheritInfo(const Ren
 RenderCommandList::RenderCommandList(CommandQueue& command_queue)
     : CommandList(vk::CommandBufferInheritanceInfo(), command_queue)
     , m_is_dynamic_state_supported(GetVulkanCommandQueue().GetVulkanDevice().IsDynamicStateSupported())
+    , m_is_multi_draw_indirect_supported(GetVulkanCommandQueue().GetVulkanDevice().IsMultiDrawIndirectSupported())
 { }
 
 RenderCommandList::RenderCommandList(CommandQueue& command_queue, RenderPass& render_pass)
     : CommandList(CreateCommandBufferInheritInfo(render_pass), command_queue, render_pass)
     , m_is_dynamic_state_supported(GetVulkanCommandQueue().GetVulkanDevice().IsDynamicStateSupported())
+    , m_is_multi_draw_indirect_supported(GetVulkanCommandQueue().GetVulkanDevice().IsMultiDrawIndirectSupported())
 {
     META_FUNCTION_TASK();
     static_cast<Data::IEmitter<IRenderPassCallback>&>(render_pass).Connect(*this);
@@ -86,6 +88,7 @@ RenderCommandList::RenderCommandList(CommandQueue& command_queue, RenderPass& re
 RenderCommandList::RenderCommandList(ParallelRenderCommandList& parallel_render_command_list, bool is_beginning_cmd_list)
     : CommandList(CreateCommandBufferInheritInfo(parallel_render_command_list.GetVulkanRenderPass()), parallel_render_command_list, is_beginning_cmd_list)
     , m_is_dynamic_state_supported(GetVulkanCommandQueue().GetVulkanDevice().IsDynamicStateSupported())
+    , m_is_multi_draw_indirect_supported(GetVulkanCommandQueue().GetVulkanDevice().IsMultiDrawIndirectSupported())
 {
     META_FUNCTION_TASK();
 }
@@ -167,6 +170,68 @@ void RenderCommandList::Draw(Primitive primitive, uint32_t vertex_count, uint32_
     GetNativeCommandBufferDefault().draw(vertex_count, instance_count, start_vertex, start_instance);
 }
 
+void RenderCommandList::DrawIndexedIndirect(Primitive primitive, Rhi::IBuffer& args_buffer, Data::Size args_offset, uint32_t draw_count,
+                                            Rhi::IBuffer* count_buffer_ptr, Data::Size count_offset)
+{
+    META_FUNCTION_TASK();
+    Base::RenderCommandList::DrawIndexedIndirect(primitive, args_buffer, args_offset, draw_count, count_buffer_ptr, count_offset);
+
+    SetIndirectArgumentBufferState(args_buffer);
+    UpdatePrimitiveTopology(primitive);
+
+    const vk::CommandBuffer& vk_command_buffer = GetNativeCommandBufferDefault();
+    const vk::Buffer&        vk_args_buffer    = static_cast<Buffer&>(args_buffer).GetNativeResource();
+    constexpr auto           args_stride       = static_cast<uint32_t>(sizeof(Rhi::DrawIndexedIndirectArguments));
+    if (count_buffer_ptr)
+    {
+        SetIndirectArgumentBufferState(*count_buffer_ptr);
+        vk_command_buffer.drawIndexedIndirectCountKHR(vk_args_buffer, args_offset,
+                                                      static_cast<Buffer&>(*count_buffer_ptr).GetNativeResource(), count_offset,
+                                                      draw_count, args_stride);
+    }
+    else if (m_is_multi_draw_indirect_supported || draw_count == 1U)
+    {
+        vk_command_buffer.drawIndexedIndirect(vk_args_buffer, args_offset, draw_count, args_stride);
+    }
+    else
+    {
+        // Multiple indirect draws are encoded one by one when device does not support multi-draw indirect feature
+        for(uint32_t draw_index = 0U; draw_index < draw_count; ++draw_index)
+            vk_command_buffer.drawIndexedIndirect(vk_args_buffer, args_offset + draw_index * args_stride, 1U, args_stride);
+    }
+}
+
+void RenderCommandList::DrawIndirect(Primitive primitive, Rhi::IBuffer& args_buffer, Data::Size args_offset, uint32_t draw_count,
+                                     Rhi::IBuffer* count_buffer_ptr, Data::Size count_offset)
+{
+    META_FUNCTION_TASK();
+    Base::RenderCommandList::DrawIndirect(primitive, args_buffer, args_offset, draw_count, count_buffer_ptr, count_offset);
+
+    SetIndirectArgumentBufferState(args_buffer);
+    UpdatePrimitiveTopology(primitive);
+
+    const vk::CommandBuffer& vk_command_buffer = GetNativeCommandBufferDefault();
+    const vk::Buffer&        vk_args_buffer    = static_cast<Buffer&>(args_buffer).GetNativeResource();
+    constexpr auto           args_stride       = static_cast<uint32_t>(sizeof(Rhi::DrawIndirectArguments));
+    if (count_buffer_ptr)
+    {
+        SetIndirectArgumentBufferState(*count_buffer_ptr);
+        vk_command_buffer.drawIndirectCountKHR(vk_args_buffer, args_offset,
+                                               static_cast<Buffer&>(*count_buffer_ptr).GetNativeResource(), count_offset,
+                                               draw_count, args_stride);
+    }
+    else if (m_is_multi_draw_indirect_supported || draw_count == 1U)
+    {
+        vk_command_buffer.drawIndirect(vk_args_buffer, args_offset, draw_count, args_stride);
+    }
+    else
+    {
+        // Multiple indirect draws are encoded one by one when device does not support multi-draw indirect feature
+        for(uint32_t draw_index = 0U; draw_index < draw_count; ++draw_index)
+            vk_command_buffer.drawIndirect(vk_args_buffer, args_offset + draw_index * args_stride, 1U, args_stride);
+    }
+}
+
 void RenderCommandList::Commit()
 {
     META_FUNCTION_TASK();
@@ -214,6 +279,17 @@ void RenderCommandList::UpdatePrimitiveTopology(Primitive primitive)
     }
 }
 
+void RenderCommandList::SetIndirectArgumentBufferState(Rhi::IBuffer& buffer)
+{
+    META_FUNCTION_TASK();
+    auto& vk_buffer = static_cast<Buffer&>(buffer);
+    if (Ptr<Rhi::IResourceBarriers>& buffer_setup_barriers_ptr = vk_buffer.GetSetupTransitionBarriers();
+        vk_buffer.SetState(Rhi::ResourceState::IndirectArgument, buffer_setup_barriers_ptr) && buffer_setup_barriers_ptr)
+    {
+        SetResourceBarriers(*buffer_setup_barriers_ptr);
+    }
+}
+
 RenderPass& RenderCommandList::GetVulkanPass()
 {
     META_FUNCTION_TASK();
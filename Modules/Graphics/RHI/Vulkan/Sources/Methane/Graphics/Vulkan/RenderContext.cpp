@@ -136,6 +136,12 @@ void RenderContext::WaitForGpu(WaitFor wait_for)
 
     GetVulkanDefaultCommandQueue(cl_type).CompleteExecution(frame_buffer_index);
 
+    // Descriptor sets released before completed frames are recycled
+    if (wait_for == WaitFor::RenderComplete)
+        GetVulkanDescriptorManager().OnGpuIdle(GetFrameIndex());
+    else if (frame_buffer_index)
+        GetVulkanDescriptorManager().OnFrameCompleted(*frame_buffer_index);
+
     m_vk_deferred_release_pipelines.clear();
 }
 
@@ -187,6 +193,7 @@ void RenderContext::Present()
     render_command_queue.ResetWaitForFrameExecution(image_index);
 
     Context<Base::RenderContext>::OnCpuPresentComplete();
+    GetVulkanDescriptorManager().OnFramePresented(image_index, GetFrameIndex());
     UpdateFrameBufferIndex();
 }
 
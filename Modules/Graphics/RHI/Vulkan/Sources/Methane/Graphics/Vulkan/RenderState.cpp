@@ -36,6 +36,9 @@ Vulkan implementation of the render state interface.
 #include <Methane/Graphics/Base/RenderContext.h>
 #include <Methane/Instrumentation.h>
 #include <Methane/Checks.hpp>
+#include <Methane/Timer.hpp>
+
+#include <taskflow/taskflow.hpp>
 
 #include <algorithm>
 #include <vulkan/vulkan_enums.hpp>
@@ -191,6 +194,10 @@ vk::PrimitiveTopology RenderState::GetVulkanPrimitiveTopology(Rhi::RenderPrimiti
     }
 }
 
+RenderState::MonolithicPipeline::MonolithicPipeline()
+    : compiled_future(compiled_promise.get_future().share())
+{ }
+
 RenderState::RenderState(const Base::RenderContext& context, const Settings& settings)
     : Base::RenderState(context, settings,
                         !dynamic_cast<const IContext&>(context).GetVulkanDevice().IsDynamicStateSupported())
@@ -200,34 +207,88 @@ RenderState::RenderState(const Base::RenderContext& context, const Settings& set
     Reset(settings);
 }
 
+RenderState::~RenderState()
+{
+    META_FUNCTION_TASK();
+    std::scoped_lock lock_guard(m_mutex);
+
+    // Background compilation tasks reference this render state, so they have to be finished before destruction
+    for(const auto& [pipeline_id, pipeline_ptr] : m_vk_pipeline_monolithic_by_id)
+    {
+        CancelMonolithicPipeline(*pipeline_ptr);
+    }
+}
+
 void RenderState::Reset(const Settings& settings)
 {
     META_FUNCTION_TASK();
+    std::scoped_lock lock_guard(m_mutex);
+
+    // Background compilation tasks use current render state settings, so they have to be finished before settings change
+    for(const auto& [pipeline_id, pipeline_ptr] : m_vk_pipeline_monolithic_by_id)
+    {
+        CancelMonolithicPipeline(*pipeline_ptr);
+    }
+
     Base::RenderState::Reset(settings);
 
     if (IsNativePipelineDynamic())
     {
         m_vk_pipeline_dynamic = CreateNativePipeline();
+        return;
     }
-    else
+
+    // Pipelines of all previously used view states and primitives are recompiled in background with new settings
+    for(auto& [pipeline_id, pipeline_ptr] : m_vk_pipeline_monolithic_by_id)
     {
-        m_vk_pipeline_monolithic_by_id.clear();
+        if (pipeline_ptr->vk_pipeline)
+            m_vk_render_context.DeferredRelease(std::move(pipeline_ptr->vk_pipeline));
+
+        pipeline_ptr = std::make_shared<MonolithicPipeline>();
+        CompileMonolithicPipelineAsync(pipeline_ptr, pipeline_id);
     }
 }
 
+void RenderState::PrewarmPipelines(const Refs<Rhi::IViewState>& view_states, const std::vector<Rhi::RenderPrimitive>& primitives)
+{
+    META_FUNCTION_TASK();
+    if (IsNativePipelineDynamic())
+        return;
+
+    std::scoped_lock lock_guard(m_mutex);
+    for(const Ref<Rhi::IViewState>& view_state_ref : view_states)
+        for(const Rhi::RenderPrimitive render_primitive : primitives)
+        {
+            const PipelineId pipeline_id(&view_state_ref.get(), render_primitive);
+            if (m_vk_pipeline_monolithic_by_id.count(pipeline_id))
+                continue;
+
+            const Ptr<MonolithicPipeline> pipeline_ptr = AddMonolithicPipeline(static_cast<ViewState&>(view_state_ref.get()), render_primitive);
+            CompileMonolithicPipelineAsync(pipeline_ptr, pipeline_id);
+        }
+}
+
 void RenderState::Apply(Base::RenderCommandList& render_command_list, Groups /*state_groups*/)
 {
     META_FUNCTION_TASK();
     const auto& vulkan_render_command_list = static_cast<RenderCommandList&>(render_command_list);
-    const vk::Pipeline& vk_pipeline_state = IsNativePipelineDynamic()
-                                          ? GetNativePipelineDynamic()
-                                          : GetNativePipelineMonolithic(vulkan_render_command_list.GetDrawingState());
+    const vk::Pipeline vk_pipeline_state = IsNativePipelineDynamic()
+                                         ? GetNativePipelineDynamic()
+                                         : GetNativePipelineMonolithic(vulkan_render_command_list.GetDrawingState());
     vulkan_render_command_list.GetNativeCommandBufferDefault().bindPipeline(vk::PipelineBindPoint::eGraphics, vk_pipeline_state);
 }
 
 bool RenderState::SetName(std::string_view name)
 {
     META_FUNCTION_TASK();
+    std::scoped_lock lock_guard(m_mutex);
+
+    // Background compilation tasks use render state name for pipeline naming, so they have to be finished before name change
+    for(const auto& [pipeline_id, pipeline_ptr] : m_vk_pipeline_monolithic_by_id)
+    {
+        WaitMonolithicPipeline(*pipeline_ptr, pipeline_id);
+    }
+
     if (!Base::RenderState::SetName(name))
         return false;
 
@@ -237,39 +298,59 @@ bool RenderState::SetName(std::string_view name)
     }
     else
     {
-        for(const auto& [pipeline_id, vk_pipeline_monolithic] : m_vk_pipeline_monolithic_by_id)
+        for(const auto& [pipeline_id, pipeline_ptr] : m_vk_pipeline_monolithic_by_id)
         {
-            SetVulkanObjectName(m_vk_render_context.GetVulkanDevice().GetNativeDevice(), vk_pipeline_monolithic.get(), name);
+            SetVulkanObjectName(m_vk_render_context.GetVulkanDevice().GetNativeDevice(), pipeline_ptr->vk_pipeline.get(), name);
         }
     }
     return true;
 }
 
-const vk::Pipeline& RenderState::GetNativePipelineDynamic() const
+vk::Pipeline RenderState::GetNativePipelineDynamic() const
 {
     META_FUNCTION_TASK();
     META_CHECK_ARG_TRUE_DESCR(IsNativePipelineDynamic(), "dynamic pipeline is not supported by device");
     return m_vk_pipeline_dynamic.get();
 }
 
-const vk::Pipeline& RenderState::GetNativePipelineMonolithic(ViewState& view_state, Rhi::RenderPrimitive render_primitive)
+vk::Pipeline RenderState::GetNativePipelineMonolithic(ViewState& view_state, Rhi::RenderPrimitive render_primitive)
 {
     META_FUNCTION_TASK();
     META_CHECK_ARG_FALSE_DESCR(IsNativePipelineDynamic(), "dynamic pipeline should be used");
-    std::lock_guard lock(m_mutex);
 
     const PipelineId pipeline_id(static_cast<Rhi::IViewState*>(&view_state), render_primitive);
-    const auto pipeline_monolithic_by_id_it = m_vk_pipeline_monolithic_by_id.find(pipeline_id);
-    if (pipeline_monolithic_by_id_it == m_vk_pipeline_monolithic_by_id.end())
+    while(true)
     {
-        view_state.Connect(*this);
-        return m_vk_pipeline_monolithic_by_id.try_emplace(pipeline_id, CreateNativePipeline(&view_state, render_primitive)).first->second.get();
-    }
+        Ptr<MonolithicPipeline> pipeline_ptr;
+        {
+            std::scoped_lock lock_guard(m_mutex);
+            const auto pipeline_monolithic_by_id_it = m_vk_pipeline_monolithic_by_id.find(pipeline_id);
+            pipeline_ptr = pipeline_monolithic_by_id_it == m_vk_pipeline_monolithic_by_id.end()
+                         ? AddMonolithicPipeline(view_state, render_primitive)
+                         : pipeline_monolithic_by_id_it->second;
+        }
 
-    return pipeline_monolithic_by_id_it->second.get();
+        // Pipeline was not prewarmed or its background compilation is not finished yet,
+        // so draw is stalled and the stall time is reported as frame hitch
+        if (pipeline_ptr->compiled_future.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+        {
+            const Timer hitch_timer;
+            WaitMonolithicPipeline(*pipeline_ptr, pipeline_id);
+            m_vk_render_context.AddFrameHitchTime(hitch_timer.GetElapsedSecondsD());
+        }
+
+        pipeline_ptr->compiled_future.get();
+
+        // Pipeline may be cancelled by render state reset or view state change while waiting for it,
+        // in which case its entry is replaced or removed and has to be looked up again;
+        // pipeline handle is returned by value, because released pipeline is kept alive by deferred release
+        std::scoped_lock lock_guard(m_mutex);
+        if (!pipeline_ptr->is_cancelled)
+            return pipeline_ptr->vk_pipeline.get();
+    }
 }
 
-const vk::Pipeline& RenderState::GetNativePipelineMonolithic(const Base::RenderDrawingState& drawing_state)
+vk::Pipeline RenderState::GetNativePipelineMonolithic(const Base::RenderDrawingState& drawing_state)
 {
     META_FUNCTION_TASK();
     META_CHECK_ARG_NOT_NULL_DESCR(drawing_state.view_state_ptr, "view state is not set in render command list drawing state");
@@ -414,42 +495,110 @@ vk::UniquePipeline RenderState::CreateNativePipeline(const ViewState* view_state
         render_pattern.GetNativeRenderPass()
     );
 
-    auto pipe = m_vk_render_context.GetVulkanDevice().GetNativeDevice().createGraphicsPipelineUnique(nullptr, vk_pipeline_create_info);
+    const Device& device = m_vk_render_context.GetVulkanDevice();
+    auto pipe = device.GetNativeDevice().createGraphicsPipelineUnique(device.GetNativePipelineCache(), vk_pipeline_create_info);
     META_CHECK_ARG_EQUAL_DESCR(pipe.result, vk::Result::eSuccess, "Vulkan pipeline creation has failed");
 
     SetVulkanObjectName(m_vk_render_context.GetVulkanDevice().GetNativeDevice(), pipe.value.get(), Base::Object::GetName());
     return std::move(pipe.value);
 }
 
+Ptr<RenderState::MonolithicPipeline> RenderState::AddMonolithicPipeline(ViewState& view_state, Rhi::RenderPrimitive render_primitive)
+{
+    META_FUNCTION_TASK();
+    view_state.Connect(*this);
+    return m_vk_pipeline_monolithic_by_id.try_emplace(PipelineId(static_cast<Rhi::IViewState*>(&view_state), render_primitive),
+                                                      std::make_shared<MonolithicPipeline>()).first->second;
+}
+
+void RenderState::CompileMonolithicPipelineAsync(const Ptr<MonolithicPipeline>& pipeline_ptr, const PipelineId& pipeline_id)
+{
+    META_FUNCTION_TASK();
+    GetRenderContext().GetParallelExecutor().silent_async([this, pipeline_ptr, pipeline_id]
+    {
+        META_FUNCTION_TASK();
+        // Compilation may be already claimed by draw thread or cancelled on render state change
+        if (pipeline_ptr->is_compile_claimed.exchange(true))
+            return;
+
+        CompileMonolithicPipeline(*pipeline_ptr, pipeline_id);
+    });
+}
+
+void RenderState::CompileMonolithicPipeline(MonolithicPipeline& pipeline, const PipelineId& pipeline_id) const
+{
+    META_FUNCTION_TASK();
+    try
+    {
+        pipeline.vk_pipeline = CreateNativePipeline(static_cast<const ViewState*>(std::get<0>(pipeline_id)), std::get<1>(pipeline_id));
+        pipeline.compiled_promise.set_value();
+    }
+    catch(...)
+    {
+        // Compilation error is re-thrown from the draw call using this pipeline
+        pipeline.compiled_promise.set_exception(std::current_exception());
+    }
+}
+
+void RenderState::WaitMonolithicPipeline(MonolithicPipeline& pipeline, const PipelineId& pipeline_id) const
+{
+    META_FUNCTION_TASK();
+    // Pipeline compilation task which is still queued in executor is taken over by the waiting thread,
+    // so the wait time is limited with compilation time of one pipeline, which is already in progress
+    if (!pipeline.is_compile_claimed.exchange(true))
+        CompileMonolithicPipeline(pipeline, pipeline_id);
+
+    pipeline.compiled_future.wait();
+}
+
+void RenderState::CancelMonolithicPipeline(MonolithicPipeline& pipeline) const
+{
+    META_FUNCTION_TASK();
+    pipeline.is_cancelled = true;
+    if (!pipeline.is_compile_claimed.exchange(true))
+        pipeline.compiled_promise.set_value();
+    else
+        pipeline.compiled_future.wait();
+}
+
 void RenderState::OnViewStateChanged(Rhi::IViewState& view_state)
 {
     META_FUNCTION_TASK();
-    std::lock_guard lock(m_mutex);
+    std::scoped_lock lock_guard(m_mutex);
 
-    for(auto& [pipeline_id, vk_pipeline_monolithic] : m_vk_pipeline_monolithic_by_id)
-        if (std::get<0>(pipeline_id) == &view_state)
-        {
-            m_vk_render_context.DeferredRelease(std::move(vk_pipeline_monolithic));
-            vk_pipeline_monolithic = CreateNativePipeline(static_cast<const ViewState*>(&view_state), std::get<1>(pipeline_id));
-        }
+    for(auto& [pipeline_id, pipeline_ptr] : m_vk_pipeline_monolithic_by_id)
+    {
+        if (std::get<0>(pipeline_id) != &view_state)
+            continue;
+
+        CancelMonolithicPipeline(*pipeline_ptr);
+        if (pipeline_ptr->vk_pipeline)
+            m_vk_render_context.DeferredRelease(std::move(pipeline_ptr->vk_pipeline));
+
+        pipeline_ptr = std::make_shared<MonolithicPipeline>();
+        CompileMonolithicPipelineAsync(pipeline_ptr, pipeline_id);
+    }
 }
 
 void RenderState::OnViewStateDestroyed(Rhi::IViewState& view_state)
 {
     META_FUNCTION_TASK();
-    std::lock_guard lock(m_mutex);
+    std::scoped_lock lock_guard(m_mutex);
 
-    for(auto vk_pipeline_it = m_vk_pipeline_monolithic_by_id.begin();
-        vk_pipeline_it != m_vk_pipeline_monolithic_by_id.end();)
+    for(auto pipeline_it = m_vk_pipeline_monolithic_by_id.begin();
+        pipeline_it != m_vk_pipeline_monolithic_by_id.end();)
     {
-        if (std::get<0>(vk_pipeline_it->first) != &view_state)
+        if (std::get<0>(pipeline_it->first) != &view_state)
         {
-            vk_pipeline_it++;
+            pipeline_it++;
             continue;
         }
 
-        m_vk_render_context.DeferredRelease(std::move(vk_pipeline_it->second));
-        vk_pipeline_it = m_vk_pipeline_monolithic_by_id.erase(vk_pipeline_it);
+        CancelMonolithicPipeline(*pipeline_it->second);
+        if (pipeline_it->second->vk_pipeline)
+            m_vk_render_context.DeferredRelease(std::move(pipeline_it->second->vk_pipeline));
+
+        pipeline_it = m_vk_pipeline_monolithic_by_id.erase(pipeline_it);
     }
 }
 
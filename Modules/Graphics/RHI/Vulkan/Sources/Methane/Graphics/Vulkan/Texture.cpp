@@ -26,6 +26,7 @@ Vulkan implementation of the texture interface.
 #include <Methane/Graphics/Vulkan/RenderCommandList.h>
 #include <Methane/Graphics/Vulkan/Device.h>
 #include <Methane/Graphics/Vulkan/Types.h>
+#include <Methane/Graphics/Vulkan/UploadRing.h>
 
 #include <Methane/Data/EnumMaskUtil.hpp>
 #include <Methane/Instrumentation.h>
@@ -36,6 +37,11 @@ Vulkan implementation of the texture interface.
 namespace Methane::Graphics::Vulkan
 {
 
+static vk::DeviceSize AlignUp(vk::DeviceSize offset, vk::DeviceSize alignment = UploadRing::default_alignment) noexcept
+{
+    return (offset + alignment - 1U) & ~(alignment - 1U);
+}
+
 vk::ImageAspectFlags Texture::GetNativeImageAspectFlags(const Rhi::TextureSettings& settings)
 {
     META_FUNCTION_TASK();
@@ -267,21 +273,8 @@ void Texture::InitializeAsImage()
 
     // Allocate resource primary memory
     const vk::Device& vk_device = GetNativeDevice();
-    const vk::MemoryRequirements vk_image_memory_requirements = vk_device.getImageMemoryRequirements(GetNativeResource());
-    AllocateResourceMemory(vk_image_memory_requirements, vk::MemoryPropertyFlagBits::eDeviceLocal);
-    vk_device.bindImageMemory(GetNativeResource(), GetNativeDeviceMemory(), 0);
-
-    // Create staging buffer and allocate staging memory
-    m_vk_unique_staging_buffer = vk_device.createBufferUnique(
-        vk::BufferCreateInfo(vk::BufferCreateFlags{},
-                             vk_image_memory_requirements.size,
-                             vk::BufferUsageFlagBits::eTransferSrc | vk::BufferUsageFlagBits::eTransferDst,
-                             vk::SharingMode::eExclusive)
-    );
-
-    const vk::MemoryPropertyFlags vk_staging_memory_flags = vk::MemoryPropertyFlagBits::eHostVisible | vk::MemoryPropertyFlagBits::eHostCoherent;
-    m_vk_unique_staging_memory = AllocateDeviceMemory(vk_device.getBufferMemoryRequirements(m_vk_unique_staging_buffer.get()), vk_staging_memory_flags);
-    vk_device.bindBufferMemory(m_vk_unique_staging_buffer.get(), m_vk_unique_staging_memory.get(), 0);
+    AllocateResourceMemory(vk_device.getImageMemoryRequirements(GetNativeResource()), vk::MemoryPropertyFlagBits::eDeviceLocal, MemoryTiling::Optimal);
+    vk_device.bindImageMemory(GetNativeResource(), GetNativeDeviceMemory(), GetMemoryAllocation().GetOffset());
 }
 
 void Texture::InitializeAsRenderTarget()
@@ -292,8 +285,8 @@ void Texture::InitializeAsRenderTarget()
 
     // Allocate resource primary memory
     const vk::Device& vk_device = GetNativeDevice();
-    AllocateResourceMemory(vk_device.getImageMemoryRequirements(GetNativeResource()), vk::MemoryPropertyFlagBits::eDeviceLocal);
-    vk_device.bindImageMemory(GetNativeResource(), GetNativeDeviceMemory(), 0);
+    AllocateResourceMemory(vk_device.getImageMemoryRequirements(GetNativeResource()), vk::MemoryPropertyFlagBits::eDeviceLocal, MemoryTiling::Optimal);
+    vk_device.bindImageMemory(GetNativeResource(), GetNativeDeviceMemory(), GetMemoryAllocation().GetOffset());
 }
 
 void Texture::InitializeAsDepthStencil()
@@ -309,8 +302,8 @@ void Texture::InitializeAsDepthStencil()
 
     // Allocate resource primary memory
     const vk::Device& vk_device = GetNativeDevice();
-    AllocateResourceMemory(vk_device.getImageMemoryRequirements(GetNativeResource()), vk::MemoryPropertyFlagBits::eDeviceLocal);
-    vk_device.bindImageMemory(GetNativeResource(), GetNativeDeviceMemory(), 0);
+    AllocateResourceMemory(vk_device.getImageMemoryRequirements(GetNativeResource()), vk::MemoryPropertyFlagBits::eDeviceLocal, MemoryTiling::Optimal);
+    vk_device.bindImageMemory(GetNativeResource(), GetNativeDeviceMemory(), GetMemoryAllocation().GetOffset());
 }
 
 void Texture::ResetNativeFrameImage()
@@ -338,25 +331,26 @@ void Texture::SetData(Rhi::ICommandQueue& target_cmd_queue, const SubResources&
     m_vk_copy_regions.clear();
     m_vk_copy_regions.reserve(sub_resources.size());
 
-    const SubResource::Count& subresource_count = GetSubresourceCount();
-    const vk::DeviceMemory& vk_device_memory = m_vk_unique_staging_memory.get();
-    vk::DeviceSize sub_resource_offset = 0U;
-
+    // Sub-resources data is placed in a single upload ring range with aligned offsets of every sub-resource
+    vk::DeviceSize staging_data_size = 0U;
     for(const SubResource& sub_resource : sub_resources)
     {
         ValidateSubResource(sub_resource);
-        Data::RawPtr sub_resource_data_ptr = nullptr;
-        const vk::Result vk_map_result = GetNativeDevice().mapMemory(vk_device_memory, sub_resource_offset, sub_resource.GetDataSize(), vk::MemoryMapFlags{},
-                                                                     reinterpret_cast<void**>(&sub_resource_data_ptr)); // NOSONAR
+        staging_data_size = AlignUp(staging_data_size) + sub_resource.GetDataSize();
+    }
 
-        META_CHECK_ARG_EQUAL_DESCR(vk_map_result, vk::Result::eSuccess, "failed to map staging buffer subresource");
-        META_CHECK_ARG_NOT_NULL_DESCR(sub_resource_data_ptr, "failed to map buffer subresource");
-        std::copy(sub_resource.GetDataPtr(), sub_resource.GetDataEndPtr(), sub_resource_data_ptr);
+    TransferCommandList&   upload_cmd_list = PrepareResourceTransfer(target_cmd_queue, State::CopyDest);
+    const UploadRing::Range  staging_range = GetVulkanContext().GetVulkanUploadRing().Allocate(upload_cmd_list, staging_data_size);
+    const SubResource::Count& subresource_count = GetSubresourceCount();
+    vk::DeviceSize sub_resource_offset = 0U;
 
-        GetNativeDevice().unmapMemory(vk_device_memory);
+    for(const SubResource& sub_resource : sub_resources)
+    {
+        sub_resource_offset = AlignUp(sub_resource_offset);
+        std::copy(sub_resource.GetDataPtr(), sub_resource.GetDataEndPtr(), staging_range.data_ptr + sub_resource_offset);
 
         m_vk_copy_regions.emplace_back(
-            sub_resource_offset, 0, 0,
+            staging_range.offset + sub_resource_offset, 0, 0,
             vk::ImageSubresourceLayers(
                 vk::ImageAspectFlagBits::eColor,
                 sub_resource.GetIndex().GetMipLevel(),
@@ -370,10 +364,9 @@ void Texture::SetData(Rhi::ICommandQueue& target_cmd_queue, const SubResources&
         sub_resource_offset += sub_resource.GetDataSize();
     }
 
-    // Copy buffer data from staging upload resource to the device-local GPU resource
-    TransferCommandList&   upload_cmd_list = PrepareResourceTransfer(target_cmd_queue, State::CopyDest);
+    // Copy buffer data from upload ring staging range to the device-local GPU resource
     const vk::CommandBuffer& vk_cmd_buffer = upload_cmd_list.GetNativeCommandBufferDefault();
-    vk_cmd_buffer.copyBufferToImage(m_vk_unique_staging_buffer.get(), GetNativeResource(),
+    vk_cmd_buffer.copyBufferToImage(staging_range.vk_buffer, GetNativeResource(),
                                     vk::ImageLayout::eTransferDstOptimal, m_vk_copy_regions);
 
     if (GetSettings().mipmapped && sub_resources.size() < GetSubresourceCount().GetRawCount())
@@ -400,9 +393,13 @@ Rhi::SubResource Texture::GetData(Rhi::ICommandQueue& target_cmd_queue, const Su
     const SubResource::Count& subresource_count = GetSubresourceCount();
     const State           initial_texture_state = GetState();
 
-    // Copy texture data from device-local GPU resource to staging resource for read-back
+    TransferCommandList&   upload_cmd_list = PrepareResourceTransfer(target_cmd_queue, State::CopySource);
+    const UploadRing::ReadBackRange read_back_range = GetVulkanContext().GetVulkanUploadRing().AllocateReadBack(upload_cmd_list, bytes_per_image);
+    const UploadRing::Range& staging_range = read_back_range.GetRange();
+
+    // Copy texture data from device-local GPU resource to upload ring staging range for read-back
     vk::BufferImageCopy image_to_buffer_copy(
-        0U, 0U, 0U,
+        staging_range.offset, 0U, 0U,
         vk::ImageSubresourceLayers(
             Texture::GetNativeImageAspectFlags(settings),
             sub_resource_index.GetMipLevel(),
@@ -412,67 +409,49 @@ Rhi::SubResource Texture::GetData(Rhi::ICommandQueue& target_cmd_queue, const Su
         vk::Offset3D(),
         TypeConverter::FrameSizeToExtent3D(GetSettings().dimensions.AsRectSize())
     );
-    TransferCommandList&   upload_cmd_list = PrepareResourceTransfer(target_cmd_queue, State::CopySource);
     const vk::CommandBuffer& vk_cmd_buffer = upload_cmd_list.GetNativeCommandBufferDefault();
     vk_cmd_buffer.copyImageToBuffer(GetNativeResource(), vk::ImageLayout::eTransferSrcOptimal,
-                                    m_vk_unique_staging_buffer.get(), image_to_buffer_copy);
+                                    staging_range.vk_buffer, image_to_buffer_copy);
 
     CompleteResourceTransfer(upload_cmd_list, initial_texture_state, target_cmd_queue);
 
     // Execute resource transfer commands and wait for completion
     GetBaseContext().UploadResources();
+    upload_cmd_list.WaitUntilCompleted();
 
-    // Map staging buffer memory and copy texture subresource data
-    const vk::DeviceMemory& vk_device_memory = m_vk_unique_staging_memory.get();
+    // Copy texture subresource data from mapped staging range, which is retained by the read-back range until it is destroyed
     Data::Size   staging_data_offset = 0U;
     Data::Size   staging_data_size   = bytes_per_image;
-    Data::RawPtr staging_data_ptr    = nullptr;
     if (data_range)
     {
         META_CHECK_ARG_LESS_DESCR(data_range->GetEnd(), staging_data_size, "provided texture subresource data range is out of bounds");
         staging_data_offset = data_range->GetStart();
         staging_data_size   = data_range->GetLength();
     }
-    const vk::Result vk_map_result = GetNativeDevice().mapMemory(vk_device_memory, staging_data_offset, staging_data_size, vk::MemoryMapFlags{},
-                                                                 reinterpret_cast<void**>(&staging_data_ptr)); // NOSONAR
-
-    META_CHECK_ARG_EQUAL_DESCR(vk_map_result, vk::Result::eSuccess, "failed to map staging buffer subresource");
-    META_CHECK_ARG_NOT_NULL_DESCR(staging_data_ptr, "failed to map buffer subresource");
-    Rhi::SubResource sub_resource(Data::Bytes(staging_data_ptr, staging_data_ptr + staging_data_size), sub_resource_index, data_range);
-
-    GetNativeDevice().unmapMemory(vk_device_memory);
-    return sub_resource;
+    const Data::RawPtr staging_data_ptr = staging_range.data_ptr + staging_data_offset;
+    return Rhi::SubResource(Data::Bytes(staging_data_ptr, staging_data_ptr + staging_data_size), sub_resource_index, data_range);
 }
 
-bool Texture::SetName(std::string_view name)
+void Texture::GenerateMipLevels(Rhi::ICommandQueue& target_cmd_queue, State target_resource_state)
 {
     META_FUNCTION_TASK();
-    if (!Resource::SetName(name))
-        return false;
+    META_CHECK_ARG_EQUAL_DESCR(target_cmd_queue.GetCommandListType(), Rhi::CommandListType::Render,
+                               "texture target command queue is not suitable for mip-maps generation");
 
-    if (m_vk_unique_staging_buffer)
-    {
-        SetVulkanObjectName(GetNativeDevice(), m_vk_unique_staging_buffer.get(), fmt::format("{} Staging Buffer", name));
-    }
-    return true;
+    constexpr auto post_upload_cmd_list_id = static_cast<Rhi::CommandListId>(Rhi::CommandListPurpose::PostUploadSync);
+    const Rhi::ICommandList& target_cmd_list = GetContext().GetDefaultCommandKit(target_cmd_queue).GetListForEncoding(post_upload_cmd_list_id);
+    GenerateMipLevels(dynamic_cast<const RenderCommandList&>(target_cmd_list).GetNativeCommandBufferDefault(), target_resource_state);
 }
 
-void Texture::GenerateMipLevels(Rhi::ICommandQueue& target_cmd_queue, State target_resource_state)
+void Texture::GenerateMipLevels(const vk::CommandBuffer& vk_cmd_buffer, State target_resource_state)
 {
     META_FUNCTION_TASK();
-    META_CHECK_ARG_EQUAL_DESCR(target_cmd_queue.GetCommandListType(), Rhi::CommandListType::Render,
-                               "texture target command queue is not suitable for mip-maps generation");
-
     const Rhi::TextureSettings& texture_settings = GetSettings();
     const vk::Format image_format = TypeConverter::PixelFormatToVulkan(texture_settings.pixel_format);
     const vk::FormatProperties image_format_properties = GetVulkanContext().GetVulkanDevice().GetNativePhysicalDevice().getFormatProperties(image_format);
     META_CHECK_ARG_TRUE_DESCR(static_cast<bool>(image_format_properties.optimalTilingFeatures & vk::FormatFeatureFlagBits::eSampledImageFilterLinear),
                               "texture pixel format does not support linear blitting");
 
-    constexpr auto post_upload_cmd_list_id = static_cast<Rhi::CommandListId>(Rhi::CommandListPurpose::PostUploadSync);
-    const Rhi::ICommandList     & target_cmd_list = GetContext().GetDefaultCommandKit(target_cmd_queue).GetListForEncoding(post_upload_cmd_list_id);
-    const vk::CommandBuffer& vk_cmd_buffer   = dynamic_cast<const RenderCommandList&>(target_cmd_list).GetNativeCommandBufferDefault();
-
     const SubResource::Count& subresource_count = GetSubresourceCount();
     const uint32_t mip_levels_count = subresource_count.GetMipLevelsCount();
     const State source_resource_state = GetState();
@@ -23,6 +23,8 @@ Vulkan implementation of the transfer command list interface.
 
 #include <Methane/Graphics/Vulkan/TransferCommandList.h>
 #include <Methane/Graphics/Vulkan/CommandQueue.h>
+#include <Methane/Graphics/Vulkan/Buffer.h>
+#include <Methane/Graphics/Vulkan/Texture.h>
 
 #include <Methane/Instrumentation.h>
 #include <Methane/Checks.hpp>
@@ -30,8 +32,94 @@ Vulkan implementation of the transfer command list interface.
 namespace Methane::Graphics::Vulkan
 {
 
+static vk::ImageSubresourceLayers GetNativeImageSubresourceLayers(const Texture& texture, const Rhi::SubResource::Index& subresource_index)
+{
+    META_FUNCTION_TASK();
+    return vk::ImageSubresourceLayers(
+        Texture::GetNativeImageAspectFlags(texture.GetSettings()),
+        subresource_index.GetMipLevel(),
+        subresource_index.GetBaseLayerIndex(texture.GetSubresourceCount()),
+        1U
+    );
+}
+
+static vk::BufferImageCopy GetNativeBufferImageCopy(const Texture& texture, const Rhi::TextureCopyRegion& copy_region, Data::Size buffer_offset)
+{
+    META_FUNCTION_TASK();
+    const Rhi::TextureCopyRegion resolved_region = Base::TransferCommandList::GetResolvedCopyRegion(texture, copy_region);
+    return vk::BufferImageCopy(
+        buffer_offset, 0U, 0U, // buffer data is tightly packed
+        GetNativeImageSubresourceLayers(texture, resolved_region.subresource_index),
+        vk::Offset3D(static_cast<int32_t>(resolved_region.rect.origin.GetX()), static_cast<int32_t>(resolved_region.rect.origin.GetY()), 0),
+        vk::Extent3D(resolved_region.rect.size.GetWidth(), resolved_region.rect.size.GetHeight(), 1U)
+    );
+}
+
 TransferCommandList::TransferCommandList(CommandQueue& command_queue)
-    : CommandList(vk::CommandBufferLevel::ePrimary, {}, command_queue, Rhi::CommandListType::Transfer)
+    : CommandList(vk::CommandBufferLevel::ePrimary, {}, command_queue)
 { }
 
+void TransferCommandList::CopyBuffer(Rhi::IBuffer& src_buffer, Rhi::IBuffer& dst_buffer, const Rhi::BufferCopyRegion& copy_region)
+{
+    META_FUNCTION_TASK();
+    Base::TransferCommandList::CopyBuffer(src_buffer, dst_buffer, copy_region);
+
+    const vk::BufferCopy vk_buffer_copy(copy_region.src_offset, copy_region.dst_offset, copy_region.size);
+    GetNativeCommandBufferDefault().copyBuffer(static_cast<const Buffer&>(src_buffer).GetNativeResource(),
+                                               static_cast<const Buffer&>(dst_buffer).GetNativeResource(),
+                                               vk_buffer_copy);
+}
+
+void TransferCommandList::CopyBufferToTexture(Rhi::IBuffer& src_buffer, Data::Size src_offset, Rhi::ITexture& dst_texture, const Rhi::TextureCopyRegion& dst_region)
+{
+    META_FUNCTION_TASK();
+    Base::TransferCommandList::CopyBufferToTexture(src_buffer, src_offset, dst_texture, dst_region);
+
+    const auto& vk_dst_texture = static_cast<const Texture&>(dst_texture);
+    GetNativeCommandBufferDefault().copyBufferToImage(static_cast<const Buffer&>(src_buffer).GetNativeResource(),
+                                                      vk_dst_texture.GetNativeImage(), vk::ImageLayout::eTransferDstOptimal,
+                                                      GetNativeBufferImageCopy(vk_dst_texture, dst_region, src_offset));
+}
+
+void TransferCommandList::CopyTextureToBuffer(Rhi::ITexture& src_texture, const Rhi::TextureCopyRegion& src_region, Rhi::IBuffer& dst_buffer, Data::Size dst_offset)
+{
+    META_FUNCTION_TASK();
+    Base::TransferCommandList::CopyTextureToBuffer(src_texture, src_region, dst_buffer, dst_offset);
+
+    const auto& vk_src_texture = static_cast<const Texture&>(src_texture);
+    GetNativeCommandBufferDefault().copyImageToBuffer(vk_src_texture.GetNativeImage(), vk::ImageLayout::eTransferSrcOptimal,
+                                                      static_cast<const Buffer&>(dst_buffer).GetNativeResource(),
+                                                      GetNativeBufferImageCopy(vk_src_texture, src_region, dst_offset));
+}
+
+void TransferCommandList::CopyTexture(Rhi::ITexture& src_texture, const Rhi::TextureCopyRegion& src_region, Rhi::ITexture& dst_texture, const Rhi::TextureCopyRegion& dst_region)
+{
+    META_FUNCTION_TASK();
+    Base::TransferCommandList::CopyTexture(src_texture, src_region, dst_texture, dst_region);
+
+    const auto& vk_src_texture = static_cast<const Texture&>(src_texture);
+    const auto& vk_dst_texture = static_cast<const Texture&>(dst_texture);
+    const Rhi::TextureCopyRegion resolved_src_region = Base::TransferCommandList::GetResolvedCopyRegion(vk_src_texture, src_region);
+    const vk::ImageCopy vk_image_copy(
+        GetNativeImageSubresourceLayers(vk_src_texture, resolved_src_region.subresource_index),
+        vk::Offset3D(static_cast<int32_t>(resolved_src_region.rect.origin.GetX()), static_cast<int32_t>(resolved_src_region.rect.origin.GetY()), 0),
+        GetNativeImageSubresourceLayers(vk_dst_texture, dst_region.subresource_index),
+        vk::Offset3D(static_cast<int32_t>(dst_region.rect.origin.GetX()), static_cast<int32_t>(dst_region.rect.origin.GetY()), 0),
+        vk::Extent3D(resolved_src_region.rect.size.GetWidth(), resolved_src_region.rect.size.GetHeight(), 1U)
+    );
+    GetNativeCommandBufferDefault().copyImage(vk_src_texture.GetNativeImage(), vk::ImageLayout::eTransferSrcOptimal,
+                                              vk_dst_texture.GetNativeImage(), vk::ImageLayout::eTransferDstOptimal,
+                                              vk_image_copy);
+}
+
+void TransferCommandList::GenerateMipmaps(Rhi::ITexture& texture)
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_TRUE_DESCR(static_cast<bool>(GetVulkanCommandQueue().GetNativeSupportedStageFlags() & vk::PipelineStageFlagBits::eAllGraphics),
+                              "mipmaps generation requires command queue family with graphics capabilities for image blitting");
+    Base::TransferCommandList::GenerateMipmaps(texture);
+
+    static_cast<Texture&>(texture).GenerateMipLevels(GetNativeCommandBufferDefault(), Rhi::ResourceState::ShaderResource);
+}
+
 } // namespace Methane::Graphics::Vulkan
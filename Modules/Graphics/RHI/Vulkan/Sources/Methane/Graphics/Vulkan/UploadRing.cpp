@@ -0,0 +1,326 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/Vulkan/UploadRing.cpp
+Vulkan context-wide ring of persistently mapped staging memory used for
+resource data transfers encoded in the upload command list.
+
+******************************************************************************/
+
+#include <Methane/Graphics/Vulkan/UploadRing.h>
+#include <Methane/Graphics/Vulkan/Device.h>
+#include <Methane/Graphics/Vulkan/Utils.hpp>
+
+#include <Methane/Instrumentation.h>
+#include <Methane/Checks.hpp>
+
+#include <algorithm>
+#include <utility>
+
+namespace Methane::Graphics::Vulkan
+{
+
+static constexpr vk::MemoryPropertyFlags g_staging_memory_flags = vk::MemoryPropertyFlagBits::eHostVisible | vk::MemoryPropertyFlagBits::eHostCoherent;
+
+static vk::UniqueBuffer CreateStagingBuffer(const vk::Device& vk_device, vk::DeviceSize size)
+{
+    META_FUNCTION_TASK();
+    return vk_device.createBufferUnique(
+        vk::BufferCreateInfo(vk::BufferCreateFlags{},
+                             size,
+                             vk::BufferUsageFlagBits::eTransferSrc | vk::BufferUsageFlagBits::eTransferDst,
+                             vk::SharingMode::eExclusive)
+    );
+}
+
+static MemoryAllocation AllocateStagingMemory(const Device& device, const vk::Buffer& vk_buffer)
+{
+    META_FUNCTION_TASK();
+    const vk::Device& vk_device = device.GetNativeDevice();
+    const vk::MemoryRequirements vk_memory_requirements = vk_device.getBufferMemoryRequirements(vk_buffer);
+    const Opt<uint32_t> memory_type_opt = device.FindMemoryType(vk_memory_requirements.memoryTypeBits, g_staging_memory_flags);
+    META_CHECK_ARG_TRUE_DESCR(memory_type_opt.has_value(), "host visible memory type was not found for upload staging buffer");
+
+    MemoryAllocation memory_allocation = device.GetMemoryAllocator().Allocate(vk_memory_requirements, *memory_type_opt, MemoryTiling::Linear);
+    vk_device.bindBufferMemory(vk_buffer, memory_allocation.GetNativeDeviceMemory(), memory_allocation.GetOffset());
+    META_CHECK_ARG_NOT_NULL_DESCR(memory_allocation.GetMappedDataPtr(), "upload staging memory is not mapped");
+    return memory_allocation;
+}
+
+static vk::DeviceSize AlignUp(vk::DeviceSize offset, vk::DeviceSize alignment) noexcept
+{
+    return (offset + alignment - 1U) & ~(alignment - 1U);
+}
+
+UploadRing::ReadBackRange::ReadBackRange(UploadRing& upload_ring, const Range& range, uint64_t segment_id, TemporaryBuffer&& temporary_buffer) noexcept
+    : m_upload_ring_ptr(&upload_ring)
+    , m_range(range)
+    , m_segment_id(segment_id)
+    , m_temporary_buffer(std::move(temporary_buffer))
+{ }
+
+UploadRing::ReadBackRange::ReadBackRange(ReadBackRange&& other) noexcept
+    : m_upload_ring_ptr(std::exchange(other.m_upload_ring_ptr, nullptr))
+    , m_range(other.m_range)
+    , m_segment_id(other.m_segment_id)
+    , m_temporary_buffer(std::move(other.m_temporary_buffer))
+{ }
+
+UploadRing::ReadBackRange::~ReadBackRange()
+{
+    META_FUNCTION_TASK();
+    if (m_upload_ring_ptr && !m_temporary_buffer.vk_unique_buffer)
+    {
+        m_upload_ring_ptr->ReleaseReadBackSegment(m_segment_id);
+    }
+}
+
+UploadRing::UploadRing(const Device& device, vk::DeviceSize capacity)
+    : m_device(device)
+    , m_capacity(capacity)
+    , m_vk_unique_buffer(CreateStagingBuffer(device.GetNativeDevice(), capacity))
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_NOT_ZERO(capacity);
+    m_memory_allocation = AllocateStagingMemory(device, m_vk_unique_buffer.get());
+    SetVulkanObjectName(device.GetNativeDevice(), m_vk_unique_buffer.get(), "Upload Ring Buffer");
+}
+
+UploadRing::Range UploadRing::Allocate(Rhi::ICommandList& upload_cmd_list, vk::DeviceSize size, vk::DeviceSize alignment)
+{
+    META_FUNCTION_TASK();
+    ConnectCommandList(upload_cmd_list);
+    META_CHECK_ARG_NOT_ZERO(size);
+    META_CHECK_ARG_DESCR(alignment, alignment && !(alignment & (alignment - 1U)), "alignment must be a power of two");
+
+    std::scoped_lock lock_guard(m_mutex);
+    Segment& segment = GetEncodingSegment(upload_cmd_list, false);
+    if (const Opt<vk::DeviceSize> ring_offset_opt = AllocateRingOffset(segment, size, alignment); ring_offset_opt)
+        return Range{ m_vk_unique_buffer.get(), *ring_offset_opt, m_memory_allocation.GetMappedDataPtr() + *ring_offset_opt };
+
+    TemporaryBuffer& temporary_buffer = segment.temporary_buffers.emplace_back(CreateTemporaryBuffer(size));
+    return Range{ temporary_buffer.vk_unique_buffer.get(), 0U, temporary_buffer.memory_allocation.GetMappedDataPtr() };
+}
+
+UploadRing::ReadBackRange UploadRing::AllocateReadBack(Rhi::ICommandList& upload_cmd_list, vk::DeviceSize size, vk::DeviceSize alignment)
+{
+    META_FUNCTION_TASK();
+    ConnectCommandList(upload_cmd_list);
+    META_CHECK_ARG_NOT_ZERO(size);
+    META_CHECK_ARG_DESCR(alignment, alignment && !(alignment & (alignment - 1U)), "alignment must be a power of two");
+
+    std::scoped_lock lock_guard(m_mutex);
+    Segment& segment = GetEncodingSegment(upload_cmd_list, true);
+    if (const Opt<vk::DeviceSize> ring_offset_opt = AllocateRingOffset(segment, size, alignment); ring_offset_opt)
+    {
+        const Range range{ m_vk_unique_buffer.get(), *ring_offset_opt, m_memory_allocation.GetMappedDataPtr() + *ring_offset_opt };
+        return ReadBackRange(*this, range, segment.id, TemporaryBuffer());
+    }
+
+    // Temporary buffer is owned by the read-back range, so the empty ring segment is not retained by it
+    segment.is_read_back = false;
+    TemporaryBuffer temporary_buffer = CreateTemporaryBuffer(size);
+    const Range range{ temporary_buffer.vk_unique_buffer.get(), 0U, temporary_buffer.memory_allocation.GetMappedDataPtr() };
+    return ReadBackRange(*this, range, segment.id, std::move(temporary_buffer));
+}
+
+vk::DeviceSize UploadRing::GetUsedSize() const
+{
+    META_FUNCTION_TASK();
+    std::scoped_lock lock_guard(m_mutex);
+    return m_used_size;
+}
+
+void UploadRing::OnCommandListStateChanged(Rhi::ICommandList& cmd_list)
+{
+    META_FUNCTION_TASK();
+    const Rhi::IObject* cmd_list_object_ptr = &static_cast<Rhi::IObject&>(cmd_list);
+    switch(cmd_list.GetState())
+    {
+    case Rhi::CommandListState::Executing:
+    {
+        std::scoped_lock lock_guard(m_mutex);
+        for(Segment& segment : m_segments)
+        {
+            if (segment.cmd_list_ptr == cmd_list_object_ptr && !segment.is_completed)
+                segment.is_executing = true;
+        }
+        break;
+    }
+
+    // Ranges encoded in the command list which is reset or returned to pending state without execution are not used by GPU
+    case Rhi::CommandListState::Encoding:
+    case Rhi::CommandListState::Pending:
+        ReleaseNotExecutedSegments(*cmd_list_object_ptr);
+        break;
+
+    default:
+        break;
+    }
+}
+
+void UploadRing::OnCommandListExecutionCompleted(Rhi::ICommandList& cmd_list)
+{
+    META_FUNCTION_TASK();
+    const Rhi::IObject* cmd_list_object_ptr = &static_cast<Rhi::IObject&>(cmd_list);
+    std::scoped_lock lock_guard(m_mutex);
+    for(Segment& segment : m_segments)
+    {
+        if (segment.cmd_list_ptr != cmd_list_object_ptr || !segment.is_executing || segment.is_completed)
+            continue;
+
+        // Temporary buffers are released right away, while ring space is released in allocation order
+        segment.is_completed = true;
+        segment.temporary_buffers.clear();
+    }
+    ReleaseCompletedSegments();
+}
+
+void UploadRing::OnObjectDestroyed(Rhi::IObject& object)
+{
+    META_FUNCTION_TASK();
+    ReleaseNotExecutedSegments(object);
+}
+
+void UploadRing::ConnectCommandList(Rhi::ICommandList& upload_cmd_list)
+{
+    META_FUNCTION_TASK();
+    META_CHECK_ARG_EQUAL_DESCR(upload_cmd_list.GetState(), Rhi::CommandListState::Encoding,
+                               "upload ring range can be allocated only for command list in encoding state");
+
+    // Connection is done outside of the ring lock, because command list callbacks are emitted under emitter lock
+    static_cast<Data::IEmitter<Rhi::ICommandListCallback>&>(upload_cmd_list).Connect(*this);
+    static_cast<Data::IEmitter<Rhi::IObjectCallback>&>(upload_cmd_list).Connect(*this);
+}
+
+UploadRing::Segment& UploadRing::GetEncodingSegment(const Rhi::ICommandList& upload_cmd_list, bool is_read_back)
+{
+    META_FUNCTION_TASK();
+    if (!is_read_back && !m_segments.empty())
+    {
+        Segment& last_segment = m_segments.back();
+        if (last_segment.cmd_list_ptr == &static_cast<const Rhi::IObject&>(upload_cmd_list) && !last_segment.is_executing && !last_segment.is_read_back)
+            return last_segment;
+    }
+
+    Segment& segment = m_segments.emplace_back();
+    segment.cmd_list_ptr = &static_cast<const Rhi::IObject&>(upload_cmd_list);
+    segment.id           = m_next_segment_id++;
+    segment.is_read_back = is_read_back;
+    return segment;
+}
+
+Opt<vk::DeviceSize> UploadRing::AllocateRingOffset(Segment& segment, vk::DeviceSize size, vk::DeviceSize alignment)
+{
+    META_FUNCTION_TASK();
+    if (size > m_capacity - m_used_size)
+        return std::nullopt;
+
+    if (!m_used_size)
+        m_head_offset = 0U;
+
+    // Ranges in use occupy the ring from tail to head offset, possibly wrapping around the end of buffer
+    const vk::DeviceSize tail_offset    = (m_head_offset + m_capacity - m_used_size) % m_capacity;
+    const vk::DeviceSize aligned_offset = AlignUp(m_head_offset, alignment);
+    vk::DeviceSize allocated_offset = 0U;
+    vk::DeviceSize consumed_size    = 0U;
+
+    if (m_head_offset >= tail_offset)
+    {
+        if (aligned_offset + size <= m_capacity)
+        {
+            allocated_offset = aligned_offset;
+            consumed_size    = aligned_offset + size - m_head_offset;
+        }
+        else if (size <= tail_offset)
+        {
+            // Wrap to the buffer start, the skipped tail space is released along with this range
+            allocated_offset = 0U;
+            consumed_size    = m_capacity - m_head_offset + size;
+        }
+        else
+            return std::nullopt;
+    }
+    else if (aligned_offset + size <= tail_offset)
+    {
+        allocated_offset = aligned_offset;
+        consumed_size    = aligned_offset + size - m_head_offset;
+    }
+    else
+        return std::nullopt;
+
+    m_head_offset = (allocated_offset + size) % m_capacity;
+    m_used_size  += consumed_size;
+    segment.used_size += consumed_size;
+    return allocated_offset;
+}
+
+UploadRing::TemporaryBuffer UploadRing::CreateTemporaryBuffer(vk::DeviceSize size) const
+{
+    META_FUNCTION_TASK();
+    TemporaryBuffer temporary_buffer;
+    temporary_buffer.vk_unique_buffer  = CreateStagingBuffer(m_device.GetNativeDevice(), size);
+    temporary_buffer.memory_allocation = AllocateStagingMemory(m_device, temporary_buffer.vk_unique_buffer.get());
+    SetVulkanObjectName(m_device.GetNativeDevice(), temporary_buffer.vk_unique_buffer.get(), "Upload Temporary Buffer");
+    return temporary_buffer;
+}
+
+void UploadRing::ReleaseReadBackSegment(uint64_t segment_id)
+{
+    META_FUNCTION_TASK();
+    std::scoped_lock lock_guard(m_mutex);
+    const auto segment_it = std::find_if(m_segments.begin(), m_segments.end(),
+                                         [segment_id](const Segment& segment) { return segment.id == segment_id; });
+    META_CHECK_ARG_TRUE_DESCR(segment_it != m_segments.end(), "read-back segment was not found in upload ring");
+
+    // Read-back range released before execution completion is released with its command list execution
+    segment_it->is_read_back = false;
+    ReleaseCompletedSegments();
+}
+
+void UploadRing::ReleaseNotExecutedSegments(const Rhi::IObject& cmd_list_object)
+{
+    META_FUNCTION_TASK();
+    std::scoped_lock lock_guard(m_mutex);
+    for(Segment& segment : m_segments)
+    {
+        if (segment.cmd_list_ptr != &cmd_list_object || segment.is_executing || segment.is_completed)
+            continue;
+
+        // Segment is retired as completed, so that its ring space is released in allocation order,
+        // while read-back segment is still retained by its range until destruction
+        segment.is_completed = true;
+        segment.cmd_list_ptr = nullptr;
+        segment.temporary_buffers.clear();
+    }
+    ReleaseCompletedSegments();
+}
+
+void UploadRing::ReleaseCompletedSegments()
+{
+    META_FUNCTION_TASK();
+    while(!m_segments.empty() && m_segments.front().is_completed && !m_segments.front().is_read_back)
+    {
+        const vk::DeviceSize released_size = m_segments.front().used_size;
+        META_CHECK_ARG_LESS_OR_EQUAL(released_size, m_used_size);
+        m_used_size -= released_size;
+        m_segments.pop_front();
+    }
+}
+
+} // namespace Methane::Graphics::Vulkan
@@ -159,6 +159,11 @@ AppBase::AppBase(const AppBase::Settings& settings)
 
     AddRectSizeOption(*this, "-w,--wnd-size", m_settings.size, "Window size in pixels or as ratio of desktop size", true);
     add_option("-f,--full-screen", m_settings.is_full_screen, "Full-screen mode");
+#ifdef METHANE_SCOPE_TIMERS_ENABLED
+    add_option_function<std::string>("--scope-trace",
+                                     [](const std::string& trace_file_path) { META_SCOPE_TIMERS_TRACE_FILE(trace_file_path); },
+                                     "Scope timers trace file path in Chrome trace event format");
+#endif
 
 #ifdef __APPLE__
     // When application is opened on MacOS with its Bundle,
@@ -41,10 +41,13 @@ inline void ThrowFreeTypeError(FT_Error error)
 bool FontChar::BinPack::TryPack(const Refs<FontChar>& font_chars)
 {
     META_FUNCTION_TASK();
-    return std::all_of(font_chars.begin(), font_chars.end(),
-                       [this](const Ref<FontChar>& font_char)
-                       { return TryPack(font_char.get()); }
-    );
+    Refs<gfx::FrameRect> char_rects;
+    char_rects.reserve(font_chars.size());
+    for(const Ref<FontChar>& font_char : font_chars)
+    {
+        char_rects.emplace_back(font_char.get().m_rect);
+    }
+    return FrameBinPack::TryPackAll(char_rects);
 }
 
 bool FontChar::BinPack::TryPack(FontChar& font_char)
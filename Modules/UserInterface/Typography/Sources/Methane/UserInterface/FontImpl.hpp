@@ -481,11 +481,11 @@ private:
 
         // Pack all character glyphs intro atlas size with doubling the size until all chars fit in
         gfx::FrameSize atlas_size(square_atlas_dimension, square_atlas_dimension);
-        m_atlas_pack_ptr = std::make_unique<CharBinPack>(atlas_size);
+        m_atlas_pack_ptr = std::make_unique<CharBinPack>(atlas_size, gfx::FrameSize(), Data::RectBinPackMethod::MaxRects);
         while(!m_atlas_pack_ptr->TryPack(font_chars))
         {
             atlas_size *= 2;
-            m_atlas_pack_ptr = std::make_unique<CharBinPack>(atlas_size);
+            m_atlas_pack_ptr = std::make_unique<CharBinPack>(atlas_size, gfx::FrameSize(), Data::RectBinPackMethod::MaxRects);
         }
         return true;
     }
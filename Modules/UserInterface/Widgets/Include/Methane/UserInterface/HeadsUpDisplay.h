@@ -89,6 +89,7 @@ private:
         HelpKey,
         FrameBuffersAndApi,
         VSync,
+        EncodingStatistics,
 
         Count
     };
@@ -26,6 +26,8 @@ Heads-Up-Display widget for displaying runtime rendering parameters.
  | CPU Time %    |                                |
  |-------------- |--------------------------------|
  | VSync ON/OFF  | W x H       N FB      GFX API  |
+ |-------------- ---------------------------------|
+ | Draws, Bindings, Barriers, States per Frame    |
  --------------------------------------------------
 
 ******************************************************************************/
@@ -176,7 +178,7 @@ HeadsUpDisplay::HeadsUpDisplay(Context& ui_context, const FontContext& font_cont
             Text::SettingsUtf8
             {
                 "Frame Time",
-                "00.00 ms",
+                "00.00 ms  p50 00.0  p99 00.0",
                 UnitRect{ Units::Dots, gfx::Point2I{ }, gfx::FrameSize{ 0U, GetTimingTextHeightInDots(ui_context, m_major_font, m_minor_font, m_settings.text_margins) } },
                 Text::Layout{ Text::Wrap::None, Text::HorizontalAlignment::Left, Text::VerticalAlignment::Center },
                 m_settings.text_color
@@ -231,6 +233,16 @@ HeadsUpDisplay::HeadsUpDisplay(Context& ui_context, const FontContext& font_cont
                 Text::Layout{ Text::Wrap::None, Text::HorizontalAlignment::Left, Text::VerticalAlignment::Top },
                 m_settings.on_color
             }
+        ),
+        std::make_shared<TextItem>(ui_context, m_minor_font,
+            Text::SettingsUtf8
+            {
+                "Encoding Statistics",
+                "0 draws  0 bindings  0 sets  0 barriers  0/0 states skipped",
+                UnitRect{ Units::Dots, gfx::Point2I{ }, gfx::FrameSize{ 0U, GetTextHeightInDots(ui_context, m_minor_font) } },
+                Text::Layout{ Text::Wrap::None, Text::HorizontalAlignment::Left, Text::VerticalAlignment::Top },
+                m_settings.text_color
+            }
         )
     })
 {
@@ -277,9 +289,13 @@ void HeadsUpDisplay::Update(const FrameSize& render_attachment_size)
 
     const Data::IFpsCounter&          fps_counter      = GetUIContext().GetRenderContext().GetFpsCounter();
     const rhi::RenderContextSettings& context_settings = GetUIContext().GetRenderContext().GetSettings();
+    const rhi::CommandListStatistics  frame_statistics = GetUIContext().GetRenderContext().GetFrameStatistics();
 
     GetTextBlock(TextBlock::Fps).SetText(fmt::format("{:d} FPS", fps_counter.GetFramesPerSecond()));
-    GetTextBlock(TextBlock::FrameTime).SetText(fmt::format("{:.2f} ms", fps_counter.GetAverageFrameTiming().GetTotalTimeMSec()));
+    GetTextBlock(TextBlock::FrameTime).SetText(fmt::format("{:.2f} ms  p50 {:.1f}  p99 {:.1f}",
+                                                           fps_counter.GetAverageFrameTiming().GetTotalTimeMSec(),
+                                                           fps_counter.GetPercentileFrameTimeSec(50.0) * 1000.0,
+                                                           fps_counter.GetPercentileFrameTimeSec(99.0) * 1000.0));
     GetTextBlock(TextBlock::CpuTime).SetText(fmt::format("{:.2f}% cpu", fps_counter.GetAverageFrameTiming().GetCpuTimePercent()));
     GetTextBlock(TextBlock::GpuName).SetText(GetUIContext().GetRenderContext().GetDevice().GetAdapterName());
     GetTextBlock(TextBlock::FrameBuffersAndApi).SetText(fmt::format("{:d} x {:d}  {:d} FB  {:s}", // NOSONAR - string contains invisible NBSP symbols
@@ -289,6 +305,13 @@ void HeadsUpDisplay::Update(const FrameSize& render_attachment_size)
                                                                     magic_enum::enum_name(rhi::ISystem::GetNativeApi())));
     GetTextBlock(TextBlock::VSync).SetText(context_settings.vsync_enabled ? "VSync ON" : "VSync OFF");
     GetTextBlock(TextBlock::VSync).SetColor(context_settings.vsync_enabled ? m_settings.on_color : m_settings.off_color);
+    GetTextBlock(TextBlock::EncodingStatistics).SetText(fmt::format("{:d} draws  {:d} bindings  {:d} sets  {:d} barriers  {:d}/{:d} states skipped",
+                                                                    frame_statistics.draws_count,
+                                                                    frame_statistics.applied_bindings_count,
+                                                                    frame_statistics.descriptor_set_binds_count,
+                                                                    frame_statistics.resource_barriers_count,
+                                                                    frame_statistics.skipped_state_changes_count,
+                                                                    frame_statistics.applied_state_changes_count + frame_statistics.skipped_state_changes_count));
 
     LayoutTextBlocks();
     UpdateAllTextBlocks(render_attachment_size);
@@ -356,13 +379,19 @@ void HeadsUpDisplay::LayoutTextBlocks()
     position.SetY(position.GetY() + gpu_name_size.GetHeight() + text_margins_in_dots.GetHeight());
     GetTextBlock(TextBlock::Fps).SetRelOrigin(position);
 
+    // Layout bottom row text block spanning both columns
+    const FrameSize encoding_statistics_size = GetTextBlock(TextBlock::EncodingStatistics).GetRectInDots().size;
+    position.SetX(text_margins_in_dots.GetWidth());
+    position.SetY(right_bottom_position.GetY() + vsync_size.GetHeight() + text_margins_in_dots.GetHeight());
+    GetTextBlock(TextBlock::EncodingStatistics).SetRelOrigin(position);
+
     Panel::SetRect(UnitRect{
         Units::Dots,
         m_settings.position,
         gfx::FrameSize
         {
-            right_bottom_position.GetX() + right_column_width + text_margins_in_dots.GetWidth(),
-            right_bottom_position.GetY() + vsync_size.GetHeight() + text_margins_in_dots.GetHeight()
+            std::max(right_bottom_position.GetX() + right_column_width, encoding_statistics_size.GetWidth() + text_margins_in_dots.GetWidth()) + text_margins_in_dots.GetWidth(),
+            position.GetY() + encoding_statistics_size.GetHeight() + text_margins_in_dots.GetHeight()
         }
     });
 }
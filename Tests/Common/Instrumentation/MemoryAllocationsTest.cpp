@@ -0,0 +1,167 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Common/Instrumentation/MemoryAllocationsTest.cpp
+Unit-tests of the frame arena allocator and memory allocations tracking
+
+******************************************************************************/
+
+#include <Methane/FrameArena.hpp>
+#include <Methane/MemoryAllocations.h>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <thread>
+#include <vector>
+#include <stdexcept>
+
+using namespace Methane;
+
+static bool IsAligned(const void* ptr, size_t alignment)
+{
+    return reinterpret_cast<uintptr_t>(ptr) % alignment == 0U;
+}
+
+TEST_CASE("Frame arena allocations", "[memory][arena]")
+{
+    FrameArena arena(1024U);
+    CHECK(arena.GetBlocksCount() == 0U);
+    CHECK(arena.GetUsedSize() == 0U);
+
+    SECTION("Allocations are aligned and do not overlap")
+    {
+        auto* const byte_ptr   = arena.Allocate<uint8_t>(3U);
+        auto* const double_ptr = arena.Allocate<double>(2U);
+        void* const page_ptr   = arena.Allocate(16U, 256U);
+        CHECK(IsAligned(double_ptr, alignof(double)));
+        CHECK(IsAligned(page_ptr, 256U));
+        CHECK(reinterpret_cast<uint8_t*>(double_ptr) >= byte_ptr + 3U);
+        CHECK(static_cast<uint8_t*>(page_ptr) >= reinterpret_cast<uint8_t*>(double_ptr + 2U));
+        CHECK(arena.GetBlocksCount() == 1U);
+        CHECK(arena.GetUsedSize() >= 3U + 2U * sizeof(double) + 16U);
+    }
+
+    SECTION("Large allocation gets dedicated block")
+    {
+        CHECK(arena.Allocate(100U) != nullptr);
+        CHECK(arena.Allocate(4096U) != nullptr);
+        CHECK(arena.GetBlocksCount() == 2U);
+        CHECK(arena.GetCapacity() >= 1024U + 4096U);
+    }
+
+    SECTION("Reset coalesces blocks and reuses memory")
+    {
+        CHECK(arena.Allocate(800U) != nullptr);
+        CHECK(arena.Allocate(800U) != nullptr);
+        CHECK(arena.GetBlocksCount() == 2U);
+
+        const size_t capacity = arena.GetCapacity();
+        arena.Reset();
+        CHECK(arena.GetBlocksCount() == 1U);
+        CHECK(arena.GetCapacity() == capacity);
+        CHECK(arena.GetUsedSize() == 0U);
+
+        CHECK(arena.Allocate(800U) != nullptr);
+        CHECK(arena.Allocate(800U) != nullptr);
+        CHECK(arena.GetBlocksCount() == 1U);
+        CHECK(arena.GetCapacity() == capacity);
+    }
+
+    SECTION("Invalid alignment is rejected")
+    {
+        CHECK_THROWS_AS(arena.Allocate(8U, 3U), std::invalid_argument);
+    }
+}
+
+TEST_CASE("Frame arena allocator for STL containers", "[memory][arena]")
+{
+    FrameArena arena;
+    FrameVector<uint32_t> values{ FrameArenaAllocator<uint32_t>(arena) };
+    for(uint32_t value = 0U; value < 1000U; ++value)
+    {
+        values.push_back(value);
+    }
+
+    CHECK(values.size() == 1000U);
+    CHECK(values[999] == 999U);
+    CHECK(arena.GetUsedSize() >= values.size() * sizeof(uint32_t));
+    CHECK(FrameArenaAllocator<uint32_t>(arena) == FrameArenaAllocator<double>(arena));
+}
+
+#ifdef METHANE_MEMORY_ALLOCATIONS_TRACKING_ENABLED
+
+TEST_CASE("Memory allocations tracking", "[memory][tracking]")
+{
+    SECTION("Thread counters include allocations of the current thread only")
+    {
+        const MemoryAllocations::Counters start_counters = MemoryAllocations::GetThreadCounters();
+        std::thread([] { std::vector<uint32_t> values(1000U); }).join();
+        auto values_ptr = std::make_unique<std::vector<uint32_t>>(100U);
+        const MemoryAllocations::Counters allocation_counters = MemoryAllocations::GetThreadCounters() - start_counters;
+        CHECK(allocation_counters.allocations_count >= 2U);
+        CHECK(allocation_counters.allocated_size >= 100U * sizeof(uint32_t));
+        CHECK(allocation_counters.allocated_size < 1000U * sizeof(uint32_t));
+    }
+
+    SECTION("Total counters include allocations of all threads")
+    {
+        const MemoryAllocations::Counters start_counters = MemoryAllocations::GetTotalCounters();
+        std::thread([] { std::vector<uint32_t> values(1000U); }).join();
+        const MemoryAllocations::Counters allocation_counters = MemoryAllocations::GetTotalCounters() - start_counters;
+        CHECK(allocation_counters.allocations_count >= 1U);
+        CHECK(allocation_counters.allocated_size >= 1000U * sizeof(uint32_t));
+        CHECK(allocation_counters.deallocations_count >= 1U);
+    }
+
+    SECTION("Frame statistics are split by frame delimiter")
+    {
+        MemoryAllocations::ResetFrameStatistics();
+        auto values_ptr = std::make_unique<std::vector<uint32_t>>(100U);
+        MemoryAllocations::OnFrameDelimiter();
+        const MemoryAllocations::Counters allocating_frame = MemoryAllocations::GetFrameStatistics().last_frame;
+        MemoryAllocations::OnFrameDelimiter();
+
+        const MemoryAllocations::FrameStatistics frame_statistics = MemoryAllocations::GetFrameStatistics();
+        CHECK(allocating_frame.allocations_count >= 2U);
+        CHECK(frame_statistics.frames_count == 2U);
+        CHECK(frame_statistics.allocating_frames_count == 1U);
+        CHECK(frame_statistics.max_frame_allocated_size >= 100U * sizeof(uint32_t));
+        CHECK(frame_statistics.last_frame.IsEmpty());
+    }
+
+    SECTION("Frame arena does not allocate after warm-up frame")
+    {
+        FrameArena arena(256U);
+        const auto encode_frame = [&arena]
+        {
+            FrameVector<uint64_t> values{ FrameArenaAllocator<uint64_t>(arena) };
+            values.reserve(100U);
+            for(uint64_t value = 0U; value < 100U; ++value)
+                values.push_back(value);
+            arena.Reset();
+        };
+
+        encode_frame();
+        const MemoryAllocations::Counters start_counters = MemoryAllocations::GetThreadCounters();
+        encode_frame();
+        encode_frame();
+        CHECK((MemoryAllocations::GetThreadCounters() - start_counters).IsEmpty());
+    }
+}
+
+#endif // ifdef METHANE_MEMORY_ALLOCATIONS_TRACKING_ENABLED
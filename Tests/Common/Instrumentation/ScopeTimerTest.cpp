@@ -0,0 +1,175 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+*******************************************************************************
+
+FILE: Tests/Common/Instrumentation/ScopeTimerTest.cpp
+Unit-tests of the scope timers aggregation in per-thread buffers and trace export
+
+******************************************************************************/
+
+#include <Methane/ScopeTimer.h>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <thread>
+#include <vector>
+#include <sstream>
+#include <algorithm>
+
+using namespace Methane;
+
+using ScopeStatistics = ScopeTimer::Aggregator::ScopeStatistics;
+
+static const ScopeStatistics* FindScopeStatistics(const std::vector<ScopeStatistics>& scopes_statistics, std::string_view scope_name)
+{
+    const auto scope_statistics_it = std::find_if(scopes_statistics.begin(), scopes_statistics.end(),
+                                                  [scope_name](const ScopeStatistics& scope_statistics)
+                                                  { return scope_name == scope_statistics.name; });
+    return scope_statistics_it == scopes_statistics.end() ? nullptr : &*scope_statistics_it;
+}
+
+static void MeasureScopes(const ScopeTimer::Registration& scope_registration, uint32_t scopes_count)
+{
+    for(uint32_t index = 0U; index < scopes_count; ++index)
+    {
+        ScopeTimer scope_timer(scope_registration);
+    }
+}
+
+TEST_CASE("Scope timer registration", "[scope-timer]")
+{
+    ScopeTimer::Aggregator& aggregator = ScopeTimer::Aggregator::Get();
+    const ScopeTimer::Registration registration = aggregator.RegisterScope("Registration Test Scope");
+    CHECK(std::string_view(registration.name) == "Registration Test Scope");
+
+    SECTION("Scope with the same name is registered once")
+    {
+        const std::string scope_name_copy = "Registration Test Scope";
+        const ScopeTimer::Registration same_registration = aggregator.RegisterScope(scope_name_copy.c_str());
+        CHECK(same_registration.id == registration.id);
+        CHECK(same_registration.name == registration.name);
+    }
+
+    SECTION("Scope timer uses given registration")
+    {
+        const ScopeTimer scope_timer(registration);
+        CHECK(scope_timer.GetScopeId() == registration.id);
+        CHECK(scope_timer.GetScopeName() == registration.name);
+    }
+}
+
+TEST_CASE("Scope timings are merged from all threads", "[scope-timer]")
+{
+    constexpr uint32_t threads_count = 4U;
+    constexpr uint32_t thread_scopes_count = 10000U;
+
+    ScopeTimer::Aggregator& aggregator = ScopeTimer::Aggregator::Get();
+    aggregator.Flush();
+
+    const ScopeTimer::Registration registration = aggregator.RegisterScope("Multi-Thread Test Scope");
+    std::vector<std::thread> threads;
+    for(uint32_t thread_index = 0U; thread_index < threads_count; ++thread_index)
+    {
+        threads.emplace_back(MeasureScopes, registration, thread_scopes_count);
+    }
+
+    // Statistics are collected concurrently with timings being added
+    const std::vector<ScopeStatistics> intermediate_statistics = aggregator.GetScopeStatistics();
+    if (const ScopeStatistics* intermediate_scope_statistics_ptr = FindScopeStatistics(intermediate_statistics, registration.name))
+    {
+        CHECK(intermediate_scope_statistics_ptr->count <= threads_count * thread_scopes_count);
+    }
+
+    for(std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    const std::vector<ScopeStatistics> scopes_statistics = aggregator.GetScopeStatistics();
+    const ScopeStatistics* scope_statistics_ptr = FindScopeStatistics(scopes_statistics, registration.name);
+    REQUIRE(scope_statistics_ptr);
+    CHECK(scope_statistics_ptr->count == threads_count * thread_scopes_count);
+    CHECK(scope_statistics_ptr->min_duration <= scope_statistics_ptr->p50_duration);
+    CHECK(scope_statistics_ptr->p50_duration <= scope_statistics_ptr->p95_duration);
+    CHECK(scope_statistics_ptr->p95_duration <= scope_statistics_ptr->p99_duration);
+    CHECK(scope_statistics_ptr->p99_duration <= scope_statistics_ptr->max_duration);
+
+    SECTION("Flush resets statistics")
+    {
+        aggregator.Flush();
+        CHECK_FALSE(FindScopeStatistics(aggregator.GetScopeStatistics(), registration.name));
+
+        MeasureScopes(registration, 5U);
+        const std::vector<ScopeStatistics> flushed_scopes_statistics = aggregator.GetScopeStatistics();
+        scope_statistics_ptr = FindScopeStatistics(flushed_scopes_statistics, registration.name);
+        REQUIRE(scope_statistics_ptr);
+        CHECK(scope_statistics_ptr->count == 5U);
+    }
+}
+
+TEST_CASE("Scope timer percentiles", "[scope-timer]")
+{
+    ScopeTimer::Aggregator& aggregator = ScopeTimer::Aggregator::Get();
+    const ScopeTimer::Registration registration = aggregator.RegisterScope("Percentile Test Scope");
+    for(uint32_t index = 0U; index < 100U; ++index)
+    {
+        ScopeTimer scope_timer(registration);
+        if (index % 10U)
+            continue;
+
+        // Every 10th scope is long
+        while(scope_timer.GetElapsedDuration() < std::chrono::milliseconds(2))
+            std::this_thread::yield();
+    }
+
+    const std::vector<ScopeStatistics> scopes_statistics = aggregator.GetScopeStatistics();
+    const ScopeStatistics* scope_statistics_ptr = FindScopeStatistics(scopes_statistics, registration.name);
+    REQUIRE(scope_statistics_ptr);
+    CHECK(scope_statistics_ptr->count == 100U);
+    CHECK(scope_statistics_ptr->p99_duration >= std::chrono::microseconds(1800));
+    CHECK(scope_statistics_ptr->max_duration >= std::chrono::microseconds(1800));
+    CHECK(scope_statistics_ptr->GetAverageDuration() >= std::chrono::microseconds(180));
+}
+
+TEST_CASE("Scope timer trace export", "[scope-timer]")
+{
+    ScopeTimer::Aggregator& aggregator = ScopeTimer::Aggregator::Get();
+    const ScopeTimer::Registration registration = aggregator.RegisterScope("Trace \"Test\" Scope");
+    aggregator.ClearTrace();
+
+    MeasureScopes(registration, 3U);
+    CHECK(aggregator.GetTraceEventsCount() == 0U);
+
+    aggregator.SetTraceEnabled(true);
+    std::thread trace_thread(MeasureScopes, registration, 5000U);
+    MeasureScopes(registration, 5000U);
+    trace_thread.join();
+    aggregator.SetTraceEnabled(false);
+
+    CHECK(aggregator.GetTraceEventsCount() == 10000U);
+
+    std::stringstream trace_stream;
+    aggregator.WriteTrace(trace_stream);
+    const std::string trace_json = trace_stream.str();
+    CHECK(trace_json.find("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[") == 0U);
+    CHECK(trace_json.find("{\"name\":\"Trace \\\"Test\\\" Scope\",\"cat\":\"ScopeTimer\",\"ph\":\"X\"") != std::string::npos);
+    CHECK(trace_json.rfind("]}") != std::string::npos);
+
+    aggregator.ClearTrace();
+    CHECK(aggregator.GetTraceEventsCount() == 0U);
+}
@@ -0,0 +1,94 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Test/AnimationsPoolBenchmark.cpp
+Benchmark of animations pool update with individual, batched and parallel batched animations.
+
+******************************************************************************/
+
+#include <Methane/Data/AnimationsPool.h>
+#include <Methane/Data/ValueAnimation.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <taskflow/taskflow.hpp>
+
+#include <vector>
+#include <string>
+
+using namespace Methane;
+using namespace Methane::Data;
+
+static bool AnimateValue(float& value, const float& start_value, double elapsed_seconds, double)
+{
+    value = start_value + static_cast<float>(elapsed_seconds);
+    return true;
+}
+
+static void BenchmarkAnimationsUpdate(uint32_t animations_count, tf::Executor& executor)
+{
+    const std::string count_str = std::to_string(animations_count);
+    std::vector<float> values(animations_count, 0.F);
+
+    AnimationsPool individual_animations;
+    for(float& value : values)
+    {
+        individual_animations.emplace_back(std::make_shared<ValueAnimation<float>>(value, AnimateValue));
+    }
+
+    BENCHMARK("Update " + count_str + " individual value animations")
+    {
+        individual_animations.Update();
+        return values.back();
+    };
+    individual_animations.clear();
+
+    AnimationsPool batched_animations;
+    for(float& value : values)
+    {
+        batched_animations.AddValueAnimation<float>(value, AnimateValue);
+    }
+
+    BENCHMARK("Update " + count_str + " batched value animations")
+    {
+        batched_animations.Update();
+        return values.back();
+    };
+
+    batched_animations.SetParallelExecutor(&executor);
+    BENCHMARK("Update " + count_str + " batched value animations in parallel")
+    {
+        batched_animations.Update();
+        return values.back();
+    };
+}
+
+TEST_CASE("Animations pool update benchmark", "[animations][benchmark]")
+{
+    tf::Executor executor;
+    for(uint32_t animations_count : { 1000U, 10000U, 100000U })
+    {
+        BenchmarkAnimationsUpdate(animations_count, executor);
+    }
+}
+
+TEST_CASE("Animations pool update benchmark of million animations", "[.][animations-large]")
+{
+    tf::Executor executor;
+    BenchmarkAnimationsUpdate(1000000U, executor);
+}
@@ -0,0 +1,230 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Test/AnimationsPoolTest.cpp
+Unit tests of animations pool with individual and batched animations.
+
+******************************************************************************/
+
+#include <Methane/Data/AnimationsPool.h>
+#include <Methane/Data/TimeAnimation.h>
+
+#include <catch2/catch_test_macros.hpp>
+#include <taskflow/taskflow.hpp>
+
+#include <vector>
+#include <stdexcept>
+#include <algorithm>
+
+using namespace Methane;
+using namespace Methane::Data;
+
+TEST_CASE("Animations pool with individual animations", "[animations]")
+{
+    AnimationsPool animations;
+
+    SECTION("Completed animations are removed preserving order")
+    {
+        std::vector<uint32_t> updated_ids;
+        for(uint32_t id = 0U; id < 6U; ++id)
+        {
+            animations.emplace_back(std::make_shared<TimeAnimation>([id, &updated_ids](double, double)
+            {
+                updated_ids.push_back(id);
+                return id % 2U != 0U;
+            }));
+        }
+
+        animations.Update();
+        CHECK(updated_ids == std::vector<uint32_t>{ 0U, 1U, 2U, 3U, 4U, 5U });
+        CHECK(animations.size() == 3U);
+
+        updated_ids.clear();
+        animations.Update();
+        CHECK(updated_ids == std::vector<uint32_t>{ 1U, 3U, 5U });
+    }
+
+    SECTION("Null animations are removed")
+    {
+        animations.emplace_back(nullptr);
+        animations.Update();
+        CHECK(animations.empty());
+    }
+}
+
+TEST_CASE("Animations pool with batched animations", "[animations]")
+{
+    AnimationsPool animations;
+
+    SECTION("Time animation is removed when update function returns false")
+    {
+        uint32_t update_count = 0U;
+        animations.AddTimeAnimation([&update_count](double elapsed_seconds, double delta_seconds)
+        {
+            CHECK(elapsed_seconds >= 0.0);
+            CHECK(delta_seconds >= 0.0);
+            return ++update_count < 3U;
+        });
+        CHECK(animations.GetBatchedAnimationsCount() == 1U);
+
+        for(uint32_t i = 0U; i < 5U; ++i)
+            animations.Update();
+
+        CHECK(update_count == 3U);
+        CHECK(animations.GetBatchedAnimationsCount() == 0U);
+    }
+
+    SECTION("Time animation is removed when duration is over")
+    {
+        bool is_updated = false;
+        animations.AddTimeAnimation([&is_updated](double, double) { return is_updated = true; }, 0.0);
+        animations.Update();
+        CHECK_FALSE(is_updated);
+        CHECK(animations.GetBatchedAnimationsCount() == 0U);
+    }
+
+    SECTION("Value animation updates value from start value")
+    {
+        double value = 1.0;
+        animations.AddValueAnimation<double>(value, [](double& value_to_update, const double& start_value, double, double)
+        {
+            value_to_update = start_value + 1.0;
+            return true;
+        });
+        animations.Update();
+        animations.Update();
+        CHECK(value == 2.0);
+        CHECK(animations.GetBatchedAnimationsCount() == 1U);
+
+        animations.ClearBatchedAnimations();
+        CHECK(animations.GetBatchedAnimationsCount() == 0U);
+    }
+
+    SECTION("Completed animations are removed with remaining animations updated")
+    {
+        constexpr uint32_t animations_count = 10U;
+        std::vector<uint32_t> update_counts(animations_count, 0U);
+        for(uint32_t id = 0U; id < animations_count; ++id)
+        {
+            animations.AddTimeAnimation([id, &update_counts](double, double)
+            {
+                ++update_counts[id];
+                return id % 2U != 0U;
+            });
+        }
+
+        animations.Update();
+        CHECK(animations.GetBatchedAnimationsCount() == animations_count / 2U);
+
+        animations.Update();
+        for(uint32_t id = 0U; id < animations_count; ++id)
+        {
+            CHECK(update_counts[id] == (id % 2U ? 2U : 1U));
+        }
+    }
+
+    SECTION("Animations added during update are deferred")
+    {
+        uint32_t nested_update_count = 0U;
+        animations.AddTimeAnimation([&animations, &nested_update_count](double, double)
+        {
+            animations.AddTimeAnimation([&nested_update_count](double, double) { return ++nested_update_count < 2U; });
+            return false;
+        });
+
+        animations.Update();
+        CHECK(nested_update_count == 0U);
+        CHECK(animations.GetBatchedAnimationsCount() == 1U);
+
+        animations.Update();
+        animations.Update();
+        CHECK(nested_update_count == 2U);
+        CHECK(animations.GetBatchedAnimationsCount() == 0U);
+    }
+
+    SECTION("Animations added after exception thrown from update function are not deferred")
+    {
+        animations.AddTimeAnimation([&animations](double, double) -> bool
+        {
+            animations.AddTimeAnimation([](double, double) { return true; });
+            throw std::runtime_error("animation update failure");
+        });
+
+        CHECK_THROWS_AS(animations.Update(), std::runtime_error);
+        CHECK(animations.GetBatchedAnimationsCount() == 2U);
+
+        animations.ClearBatchedAnimations();
+        animations.AddTimeAnimation([](double, double) { return true; });
+        CHECK(animations.GetBatchedAnimationsCount() == 1U);
+    }
+
+    SECTION("Paused animations are not updated, but dry updated when enabled")
+    {
+        uint32_t update_count = 0U;
+        uint32_t dry_update_count = 0U;
+        animations.AddTimeAnimation([&update_count, &dry_update_count](double, double delta_seconds)
+        {
+            if (delta_seconds == 0.0)
+                ++dry_update_count;
+            else
+                ++update_count;
+            return true;
+        });
+
+        animations.Pause();
+        animations.Update();
+        CHECK(update_count == 0U);
+        CHECK(dry_update_count == 0U);
+
+        animations.SetDryUpdateOnPauseEnabled(true);
+        animations.Update();
+        CHECK(dry_update_count == 1U);
+
+        animations.Resume();
+        CHECK_FALSE(animations.IsPaused());
+        CHECK(animations.GetBatchedAnimationsCount() == 1U);
+    }
+}
+
+TEST_CASE("Animations pool with parallel update of batched animations", "[animations][threads]")
+{
+    constexpr uint32_t animations_count = 10000U;
+    tf::Executor executor;
+    AnimationsPool animations;
+    animations.SetParallelExecutor(&executor, 2048U);
+
+    std::vector<float> values(animations_count, 0.F);
+    for(float& value : values)
+    {
+        animations.AddValueAnimation<float>(value, [](float& value_to_update, const float& start_value, double, double)
+        {
+            value_to_update += 1.F;
+            return value_to_update - start_value < 3.F;
+        });
+    }
+
+    for(uint32_t i = 0U; i < 2U; ++i)
+        animations.Update();
+
+    CHECK(animations.GetBatchedAnimationsCount() == animations_count);
+    CHECK(std::all_of(values.begin(), values.end(), [](float value) { return value == 2.F; }));
+
+    animations.Update();
+    CHECK(animations.GetBatchedAnimationsCount() == 0U);
+    CHECK(std::all_of(values.begin(), values.end(), [](float value) { return value == 3.F; }));
+}
@@ -27,6 +27,7 @@ Emitter and Recever wrappers for events testing.
 #include <Methane/Data/Transmitter.hpp>
 
 #include <functional>
+#include <atomic>
 
 namespace Methane::Data
 {
@@ -158,6 +159,44 @@ private:
     float        m_bar_c = 0.f;
 };
 
+class ThreadSafeTestReceiver
+    : public Receiver<ITestEvents>
+{
+public:
+    void Bind(TestEmitter& emitter)
+    {
+        emitter.Connect(*this);
+    }
+
+    void Unbind(TestEmitter& emitter)
+    {
+        emitter.Disconnect(*this);
+    }
+
+    uint32_t GetFooCallCount() const { return m_foo_call_count; }
+    uint32_t GetBarCallCount() const { return m_bar_call_count; }
+
+    using Receiver<ITestEvents>::GetConnectedEmittersCount;
+
+protected:
+    // ITestEvent implementation
+    void Foo() override                   { m_foo_call_count++; }
+    void Bar(int, bool, float) override   { m_bar_call_count++; }
+    void Call(const CallFunc& f) override { f(0U); }
+
+private:
+    std::atomic<uint32_t> m_foo_call_count{ 0U };
+    std::atomic<uint32_t> m_bar_call_count{ 0U };
+};
+
+// Thread-safe receiver ignoring emitted function calls, so that it does not run functions of other threads
+class ThreadSafeCountingTestReceiver final
+    : public ThreadSafeTestReceiver
+{
+protected:
+    void Call(const CallFunc&) override { /* emitted functions are not called */ }
+};
+
 constexpr int   g_bar_a = 1;
 constexpr bool  g_bar_b = true;
 constexpr float g_bar_c = 2.3F;
@@ -26,6 +26,8 @@ Benchmark connection and emit of events with emitter and receiver classes.
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/benchmark/catch_benchmark.hpp>
 
+#include <thread>
+
 using namespace Methane::Data;
 
 static uint32_t MeasureEmitToManyReceivers(uint32_t receivers_count, Catch::Benchmark::Chronometer meter)
@@ -119,6 +121,47 @@ static uint32_t MeasureConnectAndReceiveFromManyEmitters(uint32_t emitters_count
     return received_calls_count;
 }
 
+static uint32_t MeasureEmitToManyReceiversFromManyThreads(uint32_t receivers_count, uint32_t threads_count, Catch::Benchmark::Chronometer meter)
+{
+    constexpr uint32_t emits_per_thread = 100U;
+    TestEmitter emitter;
+    std::vector<ThreadSafeTestReceiver> receivers(receivers_count);
+
+    for(ThreadSafeTestReceiver& receiver : receivers)
+    {
+        receiver.Bind(emitter);
+    }
+
+    meter.measure([&]()
+    {
+        std::vector<std::thread> emit_threads;
+        emit_threads.reserve(threads_count);
+        for(uint32_t thread_index = 0U; thread_index < threads_count; ++thread_index)
+        {
+            emit_threads.emplace_back([&emitter]()
+            {
+                for(uint32_t emit_index = 0U; emit_index < emits_per_thread; ++emit_index)
+                {
+                    emitter.EmitBar(g_bar_a, g_bar_b, g_bar_c);
+                }
+            });
+        }
+        for(std::thread& emit_thread : emit_threads)
+        {
+            emit_thread.join();
+        }
+    });
+
+    // Prevent code removal by optimizer and check received calls count
+    uint32_t received_calls_count = 0U;
+    for(const ThreadSafeTestReceiver& receiver : receivers)
+    {
+        received_calls_count += receiver.GetBarCallCount();
+    }
+    CHECK(received_calls_count == receivers_count * threads_count * emits_per_thread * meter.runs());
+    return received_calls_count;
+}
+
 TEST_CASE("Benchmark connect and emit events", "[events][benchmark]")
 {
     SECTION("Emit to many receivers")
@@ -184,4 +227,20 @@ TEST_CASE("Benchmark connect and emit events", "[events][benchmark]")
             return MeasureConnectAndReceiveFromManyEmitters(1000, meter);
         };
     }
-}
\ No newline at end of file
+
+    SECTION("Emit to many receivers from many threads")
+    {
+        BENCHMARK_ADVANCED("Emit to 100 receivers from 1 thread")(Catch::Benchmark::Chronometer meter)
+        {
+            return MeasureEmitToManyReceiversFromManyThreads(100, 1, meter);
+        };
+        BENCHMARK_ADVANCED("Emit to 100 receivers from 4 threads")(Catch::Benchmark::Chronometer meter)
+        {
+            return MeasureEmitToManyReceiversFromManyThreads(100, 4, meter);
+        };
+        BENCHMARK_ADVANCED("Emit to 100 receivers from 8 threads")(Catch::Benchmark::Chronometer meter)
+        {
+            return MeasureEmitToManyReceiversFromManyThreads(100, 8, meter);
+        };
+    }
+}
@@ -28,6 +28,10 @@ Unit tests of event connections with Emitter and Receiver classes
 #include <catch2/catch_test_macros.hpp>
 
 #include <array>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
 
 using namespace Methane;
 using namespace Methane::Data;
@@ -496,4 +500,253 @@ TEST_CASE("Connect emitter to receiver through the transmitter", "[events]")
         CHECK_THROWS_AS(transmitter.Connect(receiver), TestTransmitter::NoTargetError);
         CHECK_THROWS_AS(transmitter.Disconnect(receiver), TestTransmitter::NoTargetError);
     }
-}
\ No newline at end of file
+}
+
+TEST_CASE("Emit events from multiple threads", "[events][threads]")
+{
+    constexpr size_t   threads_count    = 4U;
+    constexpr uint32_t emits_per_thread = 10000U;
+
+    SECTION("Concurrent emits to connected receivers")
+    {
+        TestEmitter emitter;
+        std::array<ThreadSafeTestReceiver, 8> receivers;
+        for(ThreadSafeTestReceiver& receiver : receivers)
+        {
+            receiver.Bind(emitter);
+        }
+
+        std::vector<std::thread> emit_threads;
+        for(size_t thread_index = 0U; thread_index < threads_count; ++thread_index)
+        {
+            emit_threads.emplace_back([&emitter]()
+            {
+                for(uint32_t emit_index = 0U; emit_index < emits_per_thread; ++emit_index)
+                {
+                    emitter.EmitFoo();
+                }
+            });
+        }
+        for(std::thread& emit_thread : emit_threads)
+        {
+            emit_thread.join();
+        }
+
+        for(const ThreadSafeTestReceiver& receiver : receivers)
+        {
+            CHECK(receiver.GetFooCallCount() == threads_count * emits_per_thread);
+        }
+    }
+
+    SECTION("Concurrent emits with receivers connected and disconnected on other thread")
+    {
+        TestEmitter emitter;
+        std::array<ThreadSafeTestReceiver, 8> receivers;
+        for(ThreadSafeTestReceiver& receiver : receivers)
+        {
+            receiver.Bind(emitter);
+        }
+
+        std::atomic<bool> is_emitting{ true };
+        uint32_t dynamic_receivers_count = 0U;
+        std::thread connect_thread([&emitter, &is_emitting, &dynamic_receivers_count]()
+        {
+            while (is_emitting)
+            {
+                auto dynamic_receiver_ptr = std::make_unique<ThreadSafeTestReceiver>();
+                dynamic_receiver_ptr->Bind(emitter);
+                std::this_thread::yield();
+
+                // Receiver is explicitly disconnected before destruction of derived class,
+                // disconnection waits for emits in progress on other threads which may still call it
+                dynamic_receiver_ptr->Unbind(emitter);
+                dynamic_receiver_ptr.reset();
+                dynamic_receivers_count++;
+            }
+        });
+
+        std::vector<std::thread> emit_threads;
+        for(size_t thread_index = 0U; thread_index < threads_count; ++thread_index)
+        {
+            emit_threads.emplace_back([&emitter]()
+            {
+                for(uint32_t emit_index = 0U; emit_index < emits_per_thread; ++emit_index)
+                {
+                    emitter.EmitBar(g_bar_a, g_bar_b, g_bar_c);
+                }
+            });
+        }
+        for(std::thread& emit_thread : emit_threads)
+        {
+            emit_thread.join();
+        }
+        is_emitting = false;
+        connect_thread.join();
+
+        CHECK(dynamic_receivers_count > 0U);
+        CHECK(emitter.GetConnectedReceiversCount() == receivers.size());
+        for(const ThreadSafeTestReceiver& receiver : receivers)
+        {
+            CHECK(receiver.GetBarCallCount() == threads_count * emits_per_thread);
+            CHECK(receiver.GetConnectedEmittersCount() == 1U);
+        }
+    }
+
+    SECTION("Disconnection completes under continuous emits on other threads")
+    {
+        TestEmitter emitter;
+        ThreadSafeTestReceiver receiver;
+        receiver.Bind(emitter);
+
+        std::atomic<bool> is_emitting{ true };
+        std::vector<std::thread> emit_threads;
+        for(size_t thread_index = 0U; thread_index < threads_count; ++thread_index)
+        {
+            emit_threads.emplace_back([&emitter, &is_emitting]()
+            {
+                while(is_emitting)
+                {
+                    emitter.EmitFoo();
+                }
+            });
+        }
+
+        // Disconnection waits only for emits started before it, so it can not be blocked by emits started later
+        for(uint32_t connection_index = 0U; connection_index < emits_per_thread / 10U; ++connection_index)
+        {
+            ThreadSafeTestReceiver dynamic_receiver;
+            dynamic_receiver.Bind(emitter);
+            dynamic_receiver.Unbind(emitter);
+        }
+
+        is_emitting = false;
+        for(std::thread& emit_thread : emit_threads)
+        {
+            emit_thread.join();
+        }
+        CHECK(emitter.GetConnectedReceiversCount() == 1U);
+        CHECK(receiver.GetFooCallCount() > 0U);
+    }
+
+    SECTION("Receiver reassignment does not deadlock with emitted calls using it")
+    {
+        TestEmitter emitter;
+        TestEmitter other_emitter;
+        ThreadSafeTestReceiver reassigned_receiver;
+        ThreadSafeTestReceiver empty_receiver;
+        ThreadSafeTestReceiver calling_receiver;
+        calling_receiver.Bind(emitter);
+
+        std::atomic<bool> is_emitting{ true };
+        std::thread emit_thread([&emitter, &other_emitter, &reassigned_receiver, &is_emitting]()
+        {
+            while(is_emitting)
+            {
+                emitter.EmitCall([&other_emitter, &reassigned_receiver](size_t)
+                {
+                    // Connection of the reassigned receiver locks it from the emitted call
+                    reassigned_receiver.Bind(other_emitter);
+                    reassigned_receiver.Unbind(other_emitter);
+                });
+            }
+        });
+
+        using ReceiverBase = Receiver<ITestEvents>;
+        for(uint32_t reassign_index = 0U; reassign_index < emits_per_thread / 10U; ++reassign_index)
+        {
+            reassigned_receiver.Bind(emitter);
+            static_cast<ReceiverBase&>(reassigned_receiver) = static_cast<const ReceiverBase&>(empty_receiver);
+        }
+
+        is_emitting = false;
+        emit_thread.join();
+        CHECK(emitter.GetConnectedReceiversCount() == 1U);
+        CHECK(reassigned_receiver.GetConnectedEmittersCount() == 0U);
+    }
+
+    SECTION("Concurrent emits with re-entrant connection from emitted calls")
+    {
+        TestEmitter emitter;
+        std::array<ThreadSafeTestReceiver, 4> receivers;
+        for(ThreadSafeTestReceiver& receiver : receivers)
+        {
+            receiver.Bind(emitter);
+        }
+
+        // Nested receivers do not run emitted functions of other threads, so disconnection of the nested receiver
+        // from emitted call waits only for its calls in progress, which do not wait for this thread
+        std::array<ThreadSafeCountingTestReceiver, threads_count> nested_receivers;
+        std::vector<std::thread> emit_threads;
+        for(ThreadSafeCountingTestReceiver& nested_receiver : nested_receivers)
+        {
+            emit_threads.emplace_back([&emitter, &nested_receiver]()
+            {
+                for(uint32_t emit_index = 0U; emit_index < emits_per_thread / 10U; ++emit_index)
+                {
+                    emitter.EmitCall([&emitter, &nested_receiver](size_t)
+                    {
+                        // Connection and disconnection from emitted call must not deadlock with concurrent emits
+                        nested_receiver.Bind(emitter);
+                        emitter.EmitFoo();
+                        nested_receiver.Unbind(emitter);
+                    });
+                }
+            });
+        }
+        for(std::thread& emit_thread : emit_threads)
+        {
+            emit_thread.join();
+        }
+
+        CHECK(emitter.GetConnectedReceiversCount() == receivers.size());
+        for(const ThreadSafeCountingTestReceiver& nested_receiver : nested_receivers)
+        {
+            CHECK(nested_receiver.GetFooCallCount() >= emits_per_thread / 10U * receivers.size());
+        }
+    }
+
+    SECTION("Disconnection from emitted call waits for receiver calls on other thread")
+    {
+        TestEmitter emitter;
+        ThreadSafeTestReceiver receiver;
+        receiver.Bind(emitter);
+
+        std::atomic<bool> is_other_call_started{ false };
+        std::atomic<bool> is_other_call_released{ false };
+        std::atomic<bool> is_other_call_finished{ false };
+        std::thread emit_thread([&emitter, &is_other_call_started, &is_other_call_released, &is_other_call_finished]()
+        {
+            emitter.EmitCall([&is_other_call_started, &is_other_call_released, &is_other_call_finished](size_t)
+            {
+                is_other_call_started = true;
+                while(!is_other_call_released)
+                {
+                    std::this_thread::yield();
+                }
+                // Receiver is still used by this call after it was disconnected on the other thread
+                std::this_thread::sleep_for(std::chrono::milliseconds(10));
+                is_other_call_finished = true;
+            });
+        });
+
+        while(!is_other_call_started)
+        {
+            std::this_thread::yield();
+        }
+
+        bool is_other_call_finished_on_disconnect = false;
+        emitter.EmitCall([&emitter, &receiver, &is_other_call_released, &is_other_call_finished, &is_other_call_finished_on_disconnect](size_t)
+        {
+            // Receiver disconnected from emitted call could be destroyed right after disconnection,
+            // so disconnection waits for the receiver call in progress on the other thread
+            is_other_call_released = true;
+            receiver.Unbind(emitter);
+            is_other_call_finished_on_disconnect = is_other_call_finished;
+        });
+
+        emit_thread.join();
+        CHECK(is_other_call_finished_on_disconnect);
+        CHECK(emitter.GetConnectedReceiversCount() == 0U);
+        CHECK(receiver.GetConnectedEmittersCount() == 0U);
+    }
+}
@@ -0,0 +1,182 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+*******************************************************************************
+
+FILE: Tests/Data/Primitives/FpsCounterTest.cpp
+Unit-tests of the FPS counter frame time statistics and time histogram
+
+******************************************************************************/
+
+#include <Methane/Data/FpsCounter.h>
+#include <Methane/Data/TimeHistogram.h>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+
+using namespace Methane;
+using namespace Methane::Data;
+using Catch::Approx;
+
+static FrameTiming GetFrameTimingMSec(double total_time_msec, double present_time_msec = 0.0, double gpu_wait_time_msec = 0.0)
+{
+    return FrameTiming(total_time_msec / 1000.0, present_time_msec / 1000.0, gpu_wait_time_msec / 1000.0);
+}
+
+TEST_CASE("Time histogram percentiles", "[fps][histogram]")
+{
+    TimeHistogram histogram;
+    CHECK(histogram.GetCount() == 0U);
+    CHECK(histogram.GetPercentile(50.0) == 0.0);
+
+    for(uint32_t index = 1U; index <= 100U; ++index)
+    {
+        histogram.Add(index / 1000.0);
+    }
+    CHECK(histogram.GetCount() == 100U);
+
+    SECTION("Percentiles are within bucket precision")
+    {
+        CHECK(histogram.GetPercentile(50.0) == Approx(0.050).epsilon(TimeHistogram::bucket_ratio - 1.0));
+        CHECK(histogram.GetPercentile(99.0) == Approx(0.099).epsilon(TimeHistogram::bucket_ratio - 1.0));
+        CHECK(histogram.GetPercentile(0.0)  == Approx(0.001).epsilon(TimeHistogram::bucket_ratio - 1.0));
+        CHECK(histogram.GetPercentile(100.0) == Approx(0.100).epsilon(TimeHistogram::bucket_ratio - 1.0));
+    }
+
+    SECTION("Removed samples do not affect percentiles")
+    {
+        for(uint32_t index = 51U; index <= 100U; ++index)
+        {
+            histogram.Remove(index / 1000.0);
+        }
+        CHECK(histogram.GetCount() == 50U);
+        CHECK(histogram.GetPercentile(100.0) == Approx(0.050).epsilon(TimeHistogram::bucket_ratio - 1.0));
+    }
+
+    SECTION("Out of range samples are collected in edge buckets")
+    {
+        histogram.Clear();
+        histogram.Add(0.0);
+        histogram.Add(1000.0);
+        CHECK(histogram.GetBucketCount(0U) == 1U);
+        CHECK(histogram.GetBucketCount(TimeHistogram::buckets_count - 1U) == 1U);
+    }
+}
+
+TEST_CASE("FPS counter frame time statistics", "[fps]")
+{
+    FpsCounter fps_counter(10U);
+    CHECK(fps_counter.GetAveragedTimingsCount() == 0U);
+    CHECK(fps_counter.GetPercentileFrameTimeSec(50.0) == 0.0);
+    CHECK(fps_counter.GetMaxFrameTimeSec() == 0.0);
+
+    SECTION("Averages, min, max and percentiles in window")
+    {
+        for(uint32_t index = 1U; index <= 10U; ++index)
+        {
+            fps_counter.AddFrameTiming(GetFrameTimingMSec(10.0 * index, 1.0, index));
+        }
+        CHECK(fps_counter.GetAveragedTimingsCount() == 10U);
+        CHECK(fps_counter.GetAverageFrameTiming().GetTotalTimeMSec() == Approx(55.0));
+        CHECK(fps_counter.GetFramesPerSecond() == 18U);
+        CHECK(fps_counter.GetMinFrameTimeSec() == Approx(0.010));
+        CHECK(fps_counter.GetMaxFrameTimeSec() == Approx(0.100));
+        CHECK(fps_counter.GetMinFrameTimeSec(FrameTimeType::Present) == Approx(0.001));
+        CHECK(fps_counter.GetMaxFrameTimeSec(FrameTimeType::GpuWait) == Approx(0.010));
+        CHECK(fps_counter.GetMaxFrameTimeSec(FrameTimeType::Cpu) == Approx(0.089));
+        CHECK(fps_counter.GetPercentileFrameTimeSec(50.0) == Approx(0.050).epsilon(TimeHistogram::bucket_ratio - 1.0));
+        CHECK(fps_counter.GetPercentileFrameTimeSec(100.0) == Approx(0.100));
+        CHECK(fps_counter.GetPercentileFrameTimeSec(0.0) == Approx(0.010));
+    }
+
+    SECTION("Ring buffer keeps only the last frame timings")
+    {
+        for(uint32_t index = 1U; index <= 25U; ++index)
+        {
+            fps_counter.AddFrameTiming(GetFrameTimingMSec(index));
+        }
+        CHECK(fps_counter.GetAveragedTimingsCount() == 10U);
+        CHECK(fps_counter.GetAverageFrameTiming().GetTotalTimeMSec() == Approx(20.5));
+        CHECK(fps_counter.GetMinFrameTimeSec() == Approx(0.016));
+        CHECK(fps_counter.GetMaxFrameTimeSec() == Approx(0.025));
+        CHECK(fps_counter.GetPercentileFrameTimeSec(0.0) == Approx(0.016));
+    }
+
+    SECTION("Stutter frames are counted above threshold")
+    {
+        fps_counter.SetStutterThresholdSec(0.020);
+        for(uint32_t index = 0U; index < 10U; ++index)
+        {
+            fps_counter.AddFrameTiming(GetFrameTimingMSec(index % 5U ? 16.0 : 50.0));
+        }
+        CHECK(fps_counter.GetStutterFramesCount() == 2U);
+
+        fps_counter.SetStutterThresholdSec(0.010);
+        CHECK(fps_counter.GetStutterFramesCount() == 10U);
+
+        for(uint32_t index = 0U; index < 10U; ++index)
+        {
+            fps_counter.AddFrameTiming(GetFrameTimingMSec(5.0));
+        }
+        CHECK(fps_counter.GetStutterFramesCount() == 0U);
+    }
+
+    SECTION("Hitch frames are counted in window")
+    {
+        for(uint32_t index = 0U; index < 10U; ++index)
+        {
+            fps_counter.AddFrameTiming(GetFrameTimingMSec(16.0), index % 5U ? 0.0 : 0.001 * (index + 1U));
+        }
+        CHECK(fps_counter.GetHitchFramesCount() == 2U);
+        CHECK(fps_counter.GetMaxHitchTimeSec() == Approx(0.006));
+        CHECK(fps_counter.GetLastFrameHitchTimeSec() == 0.0);
+
+        fps_counter.AddFrameTiming(GetFrameTimingMSec(16.0), 0.002);
+        CHECK(fps_counter.GetHitchFramesCount() == 2U);
+        CHECK(fps_counter.GetLastFrameHitchTimeSec() == Approx(0.002));
+
+        for(uint32_t index = 0U; index < 10U; ++index)
+        {
+            fps_counter.AddFrameTiming(GetFrameTimingMSec(16.0));
+        }
+        CHECK(fps_counter.GetHitchFramesCount() == 0U);
+        CHECK(fps_counter.GetMaxHitchTimeSec() == 0.0);
+    }
+
+    SECTION("Hitch time is accumulated for presented frame")
+    {
+        fps_counter.AddFrameHitchTime(0.002);
+        fps_counter.AddFrameHitchTime(0.003);
+        fps_counter.OnCpuFramePresented();
+        CHECK(fps_counter.GetHitchFramesCount() == 1U);
+        CHECK(fps_counter.GetLastFrameHitchTimeSec() == Approx(0.005));
+
+        fps_counter.OnCpuFramePresented();
+        CHECK(fps_counter.GetHitchFramesCount() == 1U);
+        CHECK(fps_counter.GetLastFrameHitchTimeSec() == 0.0);
+    }
+
+    SECTION("Reset clears statistics")
+    {
+        fps_counter.AddFrameTiming(GetFrameTimingMSec(50.0), 0.010);
+        fps_counter.Reset(5U);
+        CHECK(fps_counter.GetAveragedTimingsCount() == 0U);
+        CHECK(fps_counter.GetStutterFramesCount() == 0U);
+        CHECK(fps_counter.GetHitchFramesCount() == 0U);
+        CHECK(fps_counter.GetPercentileFrameTimeSec(99.0) == 0.0);
+    }
+}
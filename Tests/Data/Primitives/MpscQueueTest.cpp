@@ -0,0 +1,128 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Data/Primitives/MpscQueueTest.cpp
+Unit-tests of the lock-free multiple producers single consumer queue
+
+******************************************************************************/
+
+#include <Methane/Data/MpscQueue.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <memory>
+#include <vector>
+#include <thread>
+
+using namespace Methane::Data;
+
+TEST_CASE("Multiple producers single consumer queue", "[mpsc][queue]")
+{
+    SECTION("Empty queue pop")
+    {
+        MpscQueue<int> queue;
+        CHECK(queue.IsEmpty());
+        CHECK_FALSE(queue.TryPop().has_value());
+    }
+
+    SECTION("Items are popped in push order")
+    {
+        MpscQueue<int> queue;
+        for(int item = 0; item < 10; ++item)
+        {
+            queue.Push(item);
+        }
+        CHECK_FALSE(queue.IsEmpty());
+
+        for(int item = 0; item < 10; ++item)
+        {
+            const std::optional<int> popped_item_opt = queue.TryPop();
+            REQUIRE(popped_item_opt.has_value());
+            CHECK(*popped_item_opt == item);
+        }
+        CHECK(queue.IsEmpty());
+    }
+
+    SECTION("Move-only items are not leaked")
+    {
+        auto item_ptr = std::make_shared<int>(42);
+        {
+            MpscQueue<std::shared_ptr<int>> queue;
+            queue.Push(item_ptr);
+            queue.Push(item_ptr);
+            CHECK(item_ptr.use_count() == 3);
+
+            const std::optional<std::shared_ptr<int>> popped_item_opt = queue.TryPop();
+            REQUIRE(popped_item_opt.has_value());
+            CHECK(popped_item_opt->get() == item_ptr.get());
+        }
+        CHECK(item_ptr.use_count() == 1);
+    }
+
+    SECTION("Items pushed from multiple threads are popped in per-producer order")
+    {
+        constexpr int producers_count = 4;
+        constexpr int items_per_producer = 10000;
+
+        struct Item
+        {
+            int producer_index;
+            int item_index;
+        };
+
+        MpscQueue<Item> queue;
+        std::vector<std::thread> producer_threads;
+        for(int producer_index = 0; producer_index < producers_count; ++producer_index)
+        {
+            producer_threads.emplace_back([&queue, producer_index]()
+            {
+                for(int item_index = 0; item_index < items_per_producer; ++item_index)
+                {
+                    queue.Push(Item{ producer_index, item_index });
+                }
+            });
+        }
+
+        std::vector<int> next_item_indices(producers_count, 0);
+        int popped_items_count = 0;
+        bool is_order_valid = true;
+        while (popped_items_count < producers_count * items_per_producer)
+        {
+            const std::optional<Item> item_opt = queue.TryPop();
+            if (!item_opt)
+            {
+                std::this_thread::yield();
+                continue;
+            }
+
+            int& next_item_index = next_item_indices[item_opt->producer_index];
+            is_order_valid &= item_opt->item_index == next_item_index;
+            next_item_index++;
+            popped_items_count++;
+        }
+
+        for(std::thread& producer_thread : producer_threads)
+        {
+            producer_thread.join();
+        }
+
+        CHECK(is_order_valid);
+        CHECK(queue.IsEmpty());
+        CHECK(next_item_indices == std::vector<int>(producers_count, items_per_producer));
+    }
+}
@@ -0,0 +1,208 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Data/Primitives/RectBinPackTest.cpp
+Unit-tests of the rectangle bin packing algorithms
+
+******************************************************************************/
+
+#include <Methane/Data/RectBinPack.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include <vector>
+
+using namespace Methane;
+using namespace Methane::Data;
+
+using TestRect    = Rect<int32_t, uint32_t>;
+using TestBinPack = RectBinPack<TestRect>;
+
+static bool IsIntersecting(const TestRect& left, const TestRect& right)
+{
+    return left.GetLeft() < right.GetRight() && right.GetLeft() < left.GetRight() &&
+           left.GetTop() < right.GetBottom() && right.GetTop() < left.GetBottom();
+}
+
+static bool AreRectsPackedInBin(const std::vector<TestRect>& rects, const TestRect::Size& bin_size)
+{
+    for(size_t i = 0; i < rects.size(); ++i)
+    {
+        const TestRect& rect = rects[i];
+        if (rect.GetLeft() < 0 || rect.GetTop() < 0 ||
+            rect.GetRight()  > static_cast<int32_t>(bin_size.GetWidth()) ||
+            rect.GetBottom() > static_cast<int32_t>(bin_size.GetHeight()))
+            return false;
+
+        for(size_t j = i + 1; j < rects.size(); ++j)
+        {
+            if (IsIntersecting(rect, rects[j]))
+                return false;
+        }
+    }
+    return true;
+}
+
+static std::vector<TestRect> GenerateRects(size_t count)
+{
+    std::vector<TestRect> rects;
+    rects.reserve(count);
+    for(size_t i = 0; i < count; ++i)
+    {
+        rects.emplace_back(0, 0, static_cast<uint32_t>(4U + (i * 7U) % 13U), static_cast<uint32_t>(5U + (i * 5U) % 11U));
+    }
+    return rects;
+}
+
+static Refs<TestRect> GetRectRefs(std::vector<TestRect>& rects)
+{
+    Refs<TestRect> rect_refs;
+    rect_refs.reserve(rects.size());
+    for(TestRect& rect : rects)
+    {
+        rect_refs.emplace_back(rect);
+    }
+    return rect_refs;
+}
+
+TEST_CASE("Rectangle bin packing", "[rect-bin-pack]")
+{
+    const RectBinPackMethod method = GENERATE(RectBinPackMethod::Guillotine, RectBinPackMethod::MaxRects, RectBinPackMethod::Skyline);
+    const TestRect::Size    bin_size(128U, 128U);
+
+    SECTION("Pack single rectangle")
+    {
+        TestBinPack bin_pack(bin_size, TestRect::Size(), method);
+        TestRect rect(10, 10, 20U, 30U);
+        CHECK(bin_pack.TryPack(rect));
+        CHECK(rect.origin == TestRect::Point(0, 0));
+        CHECK(bin_pack.GetOccupancy() == static_cast<float>(20U * 30U) / static_cast<float>(128U * 128U));
+    }
+
+    SECTION("Pack rectangle larger than bin")
+    {
+        TestBinPack bin_pack(bin_size, TestRect::Size(), method);
+        TestRect rect(0, 0, 129U, 10U);
+        CHECK_FALSE(bin_pack.TryPack(rect));
+        CHECK(bin_pack.GetOccupancy() == 0.F);
+    }
+
+    SECTION("Pack rectangles without overlapping")
+    {
+        TestBinPack bin_pack(bin_size, TestRect::Size(), method);
+        std::vector<TestRect> rects = GenerateRects(100);
+        std::vector<TestRect> packed_rects;
+        for(TestRect& rect : rects)
+        {
+            if (bin_pack.TryPack(rect))
+                packed_rects.emplace_back(rect);
+        }
+        CHECK(packed_rects.size() > 50U);
+        CHECK(AreRectsPackedInBin(packed_rects, bin_size));
+    }
+
+    SECTION("Pack rectangles with margins")
+    {
+        const TestRect::Size margins(2U, 3U);
+        TestBinPack bin_pack(bin_size, margins, method);
+        std::vector<TestRect> rects = GenerateRects(50);
+        CHECK(bin_pack.TryPackAll(GetRectRefs(rects)));
+
+        std::vector<TestRect> rects_with_margins;
+        for(const TestRect& rect : rects)
+        {
+            rects_with_margins.emplace_back(rect.origin, rect.size + margins);
+        }
+        CHECK(AreRectsPackedInBin(rects_with_margins, bin_size));
+    }
+
+    SECTION("Pack all rectangles sorted by area")
+    {
+        TestBinPack bin_pack(bin_size, TestRect::Size(), method);
+        std::vector<TestRect> rects = GenerateRects(100);
+        CHECK(bin_pack.TryPackAll(GetRectRefs(rects)));
+        CHECK(AreRectsPackedInBin(rects, bin_size));
+        CHECK(bin_pack.GetOccupancy() > 0.5F);
+    }
+
+    SECTION("Removed rectangle space is reused")
+    {
+        TestBinPack bin_pack(TestRect::Size(64U, 64U), TestRect::Size(), method);
+        TestRect full_rect(0, 0, 64U, 64U);
+        CHECK(bin_pack.TryPack(full_rect));
+        CHECK(bin_pack.GetOccupancy() == 1.F);
+
+        TestRect extra_rect(0, 0, 8U, 8U);
+        CHECK_FALSE(bin_pack.TryPack(extra_rect));
+
+        CHECK(bin_pack.Remove(full_rect));
+        CHECK(bin_pack.GetOccupancy() == 0.F);
+        CHECK(bin_pack.TryPack(extra_rect));
+        CHECK(extra_rect.origin == TestRect::Point(0, 0));
+    }
+
+    SECTION("Not packed or already removed rectangle is not removed")
+    {
+        TestBinPack bin_pack(TestRect::Size(64U, 64U), TestRect::Size(), method);
+        TestRect packed_rect(0, 0, 32U, 32U);
+        CHECK(bin_pack.TryPack(packed_rect));
+
+        const TestRect unknown_rect(40, 40, 16U, 16U);
+        CHECK_FALSE(bin_pack.Remove(unknown_rect));
+        CHECK(bin_pack.Remove(packed_rect));
+        CHECK_FALSE(bin_pack.Remove(packed_rect));
+        CHECK(bin_pack.GetOccupancy() == 0.F);
+    }
+}
+
+TEST_CASE("Rectangle bin packing occupancy", "[rect-bin-pack]")
+{
+    const TestRect::Size bin_size(256U, 256U);
+    std::vector<TestRect> guillotine_rects = GenerateRects(400);
+    std::vector<TestRect> max_rects_rects  = guillotine_rects;
+
+    TestBinPack guillotine_bin_pack(bin_size, TestRect::Size(), RectBinPackMethod::Guillotine);
+    TestBinPack max_rects_bin_pack(bin_size, TestRect::Size(), RectBinPackMethod::MaxRects);
+    for(TestRect& rect : guillotine_rects)
+    {
+        guillotine_bin_pack.TryPack(rect);
+    }
+    for(TestRect& rect : max_rects_rects)
+    {
+        max_rects_bin_pack.TryPack(rect);
+    }
+
+    CHECK(max_rects_bin_pack.GetOccupancy() >= guillotine_bin_pack.GetOccupancy());
+}
+
+TEST_CASE("Rectangle bin packing with max rects coalesces removed space", "[rect-bin-pack]")
+{
+    TestBinPack bin_pack(TestRect::Size(64U, 64U), TestRect::Size(), RectBinPackMethod::MaxRects);
+    TestRect left_rect(0, 0, 32U, 64U);
+    TestRect right_rect(0, 0, 32U, 64U);
+    CHECK(bin_pack.TryPack(left_rect));
+    CHECK(bin_pack.TryPack(right_rect));
+
+    CHECK(bin_pack.Remove(left_rect));
+    CHECK(bin_pack.Remove(right_rect));
+
+    TestRect full_rect(0, 0, 64U, 64U);
+    CHECK(bin_pack.TryPack(full_rect));
+    CHECK(bin_pack.GetOccupancy() == 1.F);
+}
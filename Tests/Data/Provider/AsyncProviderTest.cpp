@@ -0,0 +1,221 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Test/AsyncProviderTest.cpp
+Unit tests of asynchronous data provider with prefetching and bounded concurrent loads.
+
+******************************************************************************/
+
+#include <Methane/Data/AsyncProvider.h>
+
+#include <catch2/catch_test_macros.hpp>
+#include <taskflow/taskflow.hpp>
+
+#include <atomic>
+#include <thread>
+#include <chrono>
+#include <stdexcept>
+#include <algorithm>
+
+using namespace Methane;
+using namespace Methane::Data;
+
+// Provider returns path string as data and counts loads and maximum number of loads running concurrently
+class CountingProvider final : public IProvider
+{
+public:
+    explicit CountingProvider(std::chrono::milliseconds load_delay = std::chrono::milliseconds(0))
+        : m_load_delay(load_delay)
+    { }
+
+    [[nodiscard]] uint32_t GetLoadsCount() const noexcept              { return m_loads_count; }
+    [[nodiscard]] uint32_t GetMaxConcurrentLoadsCount() const noexcept { return m_max_concurrent_loads_count; }
+
+    // IProvider interface
+    bool HasData(const std::string& path) const noexcept override { return path != "missing"; }
+
+    Chunk GetData(const std::string& path) const override
+    {
+        const uint32_t concurrent_loads_count = ++m_concurrent_loads_count;
+        uint32_t max_concurrent_loads_count = m_max_concurrent_loads_count;
+        while(concurrent_loads_count > max_concurrent_loads_count &&
+              !m_max_concurrent_loads_count.compare_exchange_weak(max_concurrent_loads_count, concurrent_loads_count));
+
+        std::this_thread::sleep_for(m_load_delay);
+        ++m_loads_count;
+        --m_concurrent_loads_count;
+
+        if (!HasData(path))
+            throw std::invalid_argument("missing data");
+
+        Bytes data(path.size());
+        std::transform(path.begin(), path.end(), data.begin(), [](char c) { return static_cast<Byte>(c); });
+        return Chunk(std::move(data));
+    }
+
+    std::vector<std::string> GetFiles(const std::string&) const override { return {}; }
+
+private:
+    const std::chrono::milliseconds m_load_delay;
+    mutable std::atomic<uint32_t>   m_loads_count{ 0U };
+    mutable std::atomic<uint32_t>   m_concurrent_loads_count{ 0U };
+    mutable std::atomic<uint32_t>   m_max_concurrent_loads_count{ 0U };
+};
+
+static std::string GetChunkString(const Chunk& chunk)
+{
+    return std::string(reinterpret_cast<const char*>(chunk.GetDataPtr()), chunk.GetDataSize()); // NOSONAR
+}
+
+TEST_CASE("Provider interface has synchronous default implementation of asynchronous loading", "[provider]")
+{
+    const CountingProvider provider;
+    const IProvider& provider_interface = provider;
+
+    SECTION("Get data asynchronously")
+    {
+        std::future<Chunk> data_future = provider_interface.GetDataAsync("data");
+        CHECK(GetChunkString(data_future.get()) == "data");
+    }
+
+    SECTION("Get data asynchronously with error")
+    {
+        std::future<Chunk> data_future = provider_interface.GetDataAsync("missing");
+        CHECK_THROWS_AS(data_future.get(), std::invalid_argument);
+    }
+
+    SECTION("Get many data chunks")
+    {
+        provider_interface.Prefetch({ "first", "second" });
+        CHECK(provider.GetLoadsCount() == 0U);
+
+        const std::vector<Chunk> data_chunks = provider_interface.GetDataMany({ "first", "second" });
+        REQUIRE(data_chunks.size() == 2U);
+        CHECK(GetChunkString(data_chunks[0]) == "first");
+        CHECK(GetChunkString(data_chunks[1]) == "second");
+    }
+}
+
+TEST_CASE("Asynchronous provider loads data in parallel", "[provider][threads]")
+{
+    tf::Executor executor(4);
+
+    SECTION("Get data asynchronously")
+    {
+        const CountingProvider provider;
+        const AsyncProvider async_provider(provider, executor);
+        std::future<Chunk> data_future = async_provider.GetDataAsync("data");
+        CHECK(GetChunkString(data_future.get()) == "data");
+        CHECK(provider.GetLoadsCount() == 1U);
+    }
+
+    SECTION("Get data asynchronously with error")
+    {
+        const CountingProvider provider;
+        const AsyncProvider async_provider(provider, executor);
+        std::future<Chunk> data_future = async_provider.GetDataAsync("missing");
+        CHECK_THROWS_AS(data_future.get(), std::invalid_argument);
+    }
+
+    SECTION("Get many data chunks in order of requested paths")
+    {
+        const CountingProvider provider(std::chrono::milliseconds(1));
+        const AsyncProvider async_provider(provider, executor);
+
+        std::vector<std::string> paths;
+        for(uint32_t index = 0U; index < 32U; ++index)
+            paths.emplace_back("data" + std::to_string(index));
+
+        const std::vector<Chunk> data_chunks = async_provider.GetDataMany(paths);
+        REQUIRE(data_chunks.size() == paths.size());
+        for(size_t index = 0U; index < paths.size(); ++index)
+        {
+            CHECK(GetChunkString(data_chunks[index]) == paths[index]);
+        }
+        CHECK(provider.GetLoadsCount() == paths.size());
+    }
+
+    SECTION("Prefetched data is loaded once and released when requested")
+    {
+        const CountingProvider provider;
+        const AsyncProvider async_provider(provider, executor);
+        async_provider.Prefetch({ "first", "second", "first" });
+        CHECK(async_provider.GetPrefetchedCount() == 2U);
+
+        CHECK(GetChunkString(async_provider.GetData("first")) == "first");
+        CHECK(GetChunkString(async_provider.GetDataAsync("second").get()) == "second");
+        CHECK(async_provider.GetPrefetchedCount() == 0U);
+        CHECK(provider.GetLoadsCount() == 2U);
+
+        CHECK(GetChunkString(async_provider.GetData("first")) == "first");
+        CHECK(provider.GetLoadsCount() == 3U);
+    }
+
+    SECTION("Number of concurrent loads is bounded")
+    {
+        const CountingProvider provider(std::chrono::milliseconds(2));
+        const AsyncProvider async_provider(provider, executor, 2U);
+
+        std::vector<std::future<Chunk>> data_futures;
+        for(uint32_t index = 0U; index < 16U; ++index)
+            data_futures.emplace_back(async_provider.GetDataAsync("data" + std::to_string(index)));
+
+        for(std::future<Chunk>& data_future : data_futures)
+            data_future.wait();
+
+        CHECK(provider.GetLoadsCount() == 16U);
+        CHECK(provider.GetMaxConcurrentLoadsCount() <= 2U);
+    }
+
+    SECTION("Prefetched data is requested from executor tasks")
+    {
+        const CountingProvider provider(std::chrono::milliseconds(1));
+        const AsyncProvider async_provider(provider, executor, 1U);
+
+        std::vector<std::string> paths;
+        for(uint32_t index = 0U; index < 16U; ++index)
+            paths.emplace_back("data" + std::to_string(index));
+        async_provider.Prefetch(paths);
+
+        std::vector<std::string> loaded_strings(paths.size());
+        tf::Taskflow load_task_flow;
+        load_task_flow.for_each_index(size_t(0U), paths.size(), size_t(1U),
+            [&async_provider, &paths, &loaded_strings](const size_t index)
+            {
+                loaded_strings[index] = GetChunkString(async_provider.GetData(paths[index]));
+            }
+        );
+        executor.run(load_task_flow).get();
+
+        CHECK(loaded_strings == paths);
+        CHECK(provider.GetLoadsCount() == paths.size());
+    }
+
+    SECTION("Pending loads are dropped on destruction")
+    {
+        const CountingProvider provider(std::chrono::milliseconds(5));
+        std::vector<std::future<Chunk>> data_futures;
+        {
+            const AsyncProvider async_provider(provider, executor, 1U);
+            for(uint32_t index = 0U; index < 8U; ++index)
+                data_futures.emplace_back(async_provider.GetDataAsync("data" + std::to_string(index)));
+        }
+        CHECK(provider.GetLoadsCount() < 8U);
+        CHECK_THROWS_AS(data_futures.back().get(), std::future_error);
+    }
+}
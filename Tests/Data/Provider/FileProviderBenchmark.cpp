@@ -0,0 +1,180 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Test/FileProviderBenchmark.cpp
+Benchmark of application resources loading at startup with reading versus memory-mapping files
+with sequential versus asynchronous loading and from the resource pack file.
+
+******************************************************************************/
+
+#include "TestFileProvider.hpp"
+
+#include <Methane/Data/AsyncProvider.h>
+#include <Methane/Data/PackWriter.h>
+#include <Methane/Data/PackProvider.h>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <taskflow/taskflow.hpp>
+
+#include <memory>
+#include <vector>
+#include <algorithm>
+
+using namespace Methane;
+using namespace Methane::Data;
+
+// Resource set similar to the resources of tutorial applications: compiled shaders, fonts and textures
+static std::vector<std::unique_ptr<TestFile>> CreateAppResourceFiles()
+{
+    struct ResourceKind { const char* name; uint32_t count; size_t size; };
+    constexpr ResourceKind resource_kinds[] = {
+        { "Shader",  24U,   8U * 1024U },
+        { "Font",     3U, 300U * 1024U },
+        { "Texture",  8U,   1024U * 1024U },
+    };
+
+    std::vector<std::unique_ptr<TestFile>> resource_files;
+    uint32_t seed = 0U;
+    for(const ResourceKind& resource_kind : resource_kinds)
+    {
+        for(uint32_t index = 0U; index < resource_kind.count; ++index)
+        {
+            resource_files.emplace_back(std::make_unique<TestFile>(
+                std::string("FileProviderBenchmark") + resource_kind.name + std::to_string(index) + ".bin",
+                GenerateTestBytes(resource_kind.size, ++seed)));
+        }
+    }
+    return resource_files;
+}
+
+// Resource data is consumed by copying to the staging memory, similar to resource upload
+static size_t LoadAllResources(const IProvider& provider, const std::vector<std::unique_ptr<TestFile>>& resource_files, Bytes& staging_memory)
+{
+    size_t staging_offset = 0U;
+    for(const std::unique_ptr<TestFile>& resource_file : resource_files)
+    {
+        const Chunk chunk = provider.GetData(resource_file->GetPath());
+        std::copy(chunk.GetDataPtr(), chunk.GetDataEndPtr(), staging_memory.data() + staging_offset);
+        staging_offset += chunk.GetDataSize();
+    }
+    return staging_offset;
+}
+
+static size_t LoadAllResourcesAsync(const IProvider& provider, const std::vector<std::unique_ptr<TestFile>>& resource_files, Bytes& staging_memory)
+{
+    std::vector<std::string> resource_paths;
+    resource_paths.reserve(resource_files.size());
+    for(const std::unique_ptr<TestFile>& resource_file : resource_files)
+        resource_paths.emplace_back(resource_file->GetPath());
+
+    size_t staging_offset = 0U;
+    for(const Chunk& chunk : provider.GetDataMany(resource_paths))
+    {
+        std::copy(chunk.GetDataPtr(), chunk.GetDataEndPtr(), staging_memory.data() + staging_offset);
+        staging_offset += chunk.GetDataSize();
+    }
+    return staging_offset;
+}
+
+TEST_CASE("File provider resources loading benchmark", "[provider][benchmark]")
+{
+    const std::vector<std::unique_ptr<TestFile>> resource_files = CreateAppResourceFiles();
+    const TestFileProvider read_file_provider(FileProvider::LoadMode::Read);
+    const TestFileProvider map_file_provider(FileProvider::LoadMode::Map);
+
+    Bytes staging_memory(16U * 1024U * 1024U);
+    CHECK(LoadAllResources(read_file_provider, resource_files, staging_memory) ==
+          LoadAllResources(map_file_provider, resource_files, staging_memory));
+
+    BENCHMARK("Load all application resources with file reading")
+    {
+        return LoadAllResources(read_file_provider, resource_files, staging_memory);
+    };
+
+    BENCHMARK("Load all application resources with file mapping")
+    {
+        return LoadAllResources(map_file_provider, resource_files, staging_memory);
+    };
+
+    BENCHMARK("Check all application resources existence")
+    {
+        return std::count_if(resource_files.begin(), resource_files.end(),
+                             [&map_file_provider](const std::unique_ptr<TestFile>& resource_file)
+                             { return map_file_provider.HasData(resource_file->GetPath()); });
+    };
+}
+
+TEST_CASE("Asynchronous provider resources loading benchmark", "[provider][benchmark]")
+{
+    const std::vector<std::unique_ptr<TestFile>> resource_files = CreateAppResourceFiles();
+    const TestFileProvider read_file_provider(FileProvider::LoadMode::Read);
+    tf::Executor executor;
+    const AsyncProvider async_provider(read_file_provider, executor);
+
+    Bytes staging_memory(16U * 1024U * 1024U);
+    CHECK(LoadAllResources(read_file_provider, resource_files, staging_memory) ==
+          LoadAllResourcesAsync(async_provider, resource_files, staging_memory));
+
+    BENCHMARK("Load all application resources sequentially")
+    {
+        return LoadAllResources(read_file_provider, resource_files, staging_memory);
+    };
+
+    BENCHMARK("Load all application resources asynchronously")
+    {
+        return LoadAllResourcesAsync(async_provider, resource_files, staging_memory);
+    };
+}
+
+TEST_CASE("Resource pack loading benchmark", "[provider][pack][benchmark]")
+{
+    const std::vector<std::unique_ptr<TestFile>> resource_files = CreateAppResourceFiles();
+    const TestFileProvider map_file_provider(FileProvider::LoadMode::Map);
+
+    PackWriter pack_writer;
+    for(const std::unique_ptr<TestFile>& resource_file : resource_files)
+    {
+        const Chunk chunk = map_file_provider.GetData(resource_file->GetPath());
+        pack_writer.AddFile(resource_file->GetPath(), Bytes(chunk.GetDataPtr(), chunk.GetDataEndPtr()));
+    }
+    const TestFile pack_file("FileProviderBenchmark.pack", pack_writer.Build());
+    const PackProvider pack_provider(pack_file.GetFullPath());
+
+    Bytes staging_memory(16U * 1024U * 1024U);
+    CHECK(LoadAllResources(map_file_provider, resource_files, staging_memory) ==
+          LoadAllResources(pack_provider, resource_files, staging_memory));
+
+    BENCHMARK("Load all application resources from mapped files")
+    {
+        return LoadAllResources(map_file_provider, resource_files, staging_memory);
+    };
+
+    BENCHMARK("Load all application resources from resource pack")
+    {
+        return LoadAllResources(pack_provider, resource_files, staging_memory);
+    };
+
+    BENCHMARK("Open resource pack and check all resources existence")
+    {
+        const PackProvider opened_pack_provider(pack_file.GetFullPath());
+        return std::count_if(resource_files.begin(), resource_files.end(),
+                             [&opened_pack_provider](const std::unique_ptr<TestFile>& resource_file)
+                             { return opened_pack_provider.HasData(resource_file->GetPath()); });
+    };
+}
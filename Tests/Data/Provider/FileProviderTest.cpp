@@ -0,0 +1,80 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Test/FileProviderTest.cpp
+Unit tests of file provider reading and memory-mapping files.
+
+******************************************************************************/
+
+#include "TestFileProvider.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include <algorithm>
+
+using namespace Methane;
+using namespace Methane::Data;
+
+TEST_CASE("File provider loads file data", "[provider]")
+{
+    const FileProvider::LoadMode load_mode = GENERATE(FileProvider::LoadMode::Read, FileProvider::LoadMode::Map);
+    const TestFileProvider file_provider(load_mode);
+    const Bytes file_content = GenerateTestBytes(10000U, 1U);
+    const TestFile test_file("FileProviderTest.bin", file_content);
+
+    SECTION("Provider has data of existing file only")
+    {
+        CHECK(file_provider.HasData(test_file.GetPath()));
+        CHECK(file_provider.HasData(test_file.GetFullPath()));
+        CHECK_FALSE(file_provider.HasData("FileProviderTestMissing.bin"));
+    }
+
+    SECTION("File data is loaded to chunk")
+    {
+        const Chunk chunk = file_provider.GetData(test_file.GetPath());
+        CHECK(chunk.GetDataSize() == file_content.size());
+        CHECK(std::equal(file_content.begin(), file_content.end(), chunk.GetDataPtr()));
+        CHECK(chunk.IsDataStored() == (load_mode == FileProvider::LoadMode::Read));
+        CHECK(chunk.HasDataOwner() == (load_mode == FileProvider::LoadMode::Map));
+    }
+
+    SECTION("Copied and moved chunks keep file data")
+    {
+        Chunk chunk = file_provider.GetData(test_file.GetPath());
+        const Chunk chunk_copy(chunk);
+        const Chunk chunk_moved(std::move(chunk));
+        chunk = Chunk();
+        CHECK(chunk_copy.GetDataSize() == file_content.size());
+        CHECK(std::equal(file_content.begin(), file_content.end(), chunk_copy.GetDataPtr()));
+        CHECK(chunk_moved.GetDataSize() == file_content.size());
+        CHECK(std::equal(file_content.begin(), file_content.end(), chunk_moved.GetDataPtr()));
+    }
+
+    SECTION("Empty file is loaded to empty chunk")
+    {
+        const TestFile empty_file("FileProviderTestEmpty.bin", Bytes());
+        const Chunk chunk = file_provider.GetData(empty_file.GetPath());
+        CHECK(chunk.IsEmptyOrNull());
+    }
+
+    SECTION("Missing file can not be loaded")
+    {
+        CHECK_THROWS(file_provider.GetData("FileProviderTestMissing.bin"));
+    }
+}
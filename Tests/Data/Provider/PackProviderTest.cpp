@@ -0,0 +1,246 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Test/PackProviderTest.cpp
+Unit tests of block compression, resource pack writer and pack provider.
+
+******************************************************************************/
+
+#include "TestFileProvider.hpp"
+
+#include <Methane/Data/BlockCompression.h>
+#include <Methane/Data/PackWriter.h>
+#include <Methane/Data/PackProvider.h>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+
+using namespace Methane;
+using namespace Methane::Data;
+
+static Bytes GenerateCompressibleBytes(size_t size, uint32_t seed)
+{
+    // Repeated words with random bytes in between, similar to shader byte code or text
+    const Bytes random_bytes = GenerateTestBytes(size, seed);
+    Bytes bytes(size);
+    for(size_t index = 0U; index < size; ++index)
+    {
+        bytes[index] = index % 64U < 48U ? static_cast<Byte>("Methane Kit resource data "[index % 26U]) : random_bytes[index];
+    }
+    return bytes;
+}
+
+static Bytes GenerateRepeatedBytes(size_t size, size_t period)
+{
+    Bytes bytes(size);
+    for(size_t index = 0U; index < size; ++index)
+    {
+        bytes[index] = static_cast<Byte>(index % period);
+    }
+    return bytes;
+}
+
+static bool IsChunkEqual(const Chunk& chunk, const Bytes& bytes)
+{
+    return chunk.GetDataSize() == bytes.size() &&
+           (bytes.empty() || std::memcmp(chunk.GetDataPtr(), bytes.data(), bytes.size()) == 0);
+}
+
+TEST_CASE("Block compression round trip", "[provider][compression]")
+{
+    const Bytes data = GENERATE(
+        Bytes(),
+        GenerateTestBytes(5U, 1U),
+        GenerateTestBytes(100000U, 2U),
+        GenerateCompressibleBytes(100000U, 3U),
+        GenerateRepeatedBytes(1000U, 1U),
+        GenerateRepeatedBytes(70000U, 3U),
+        GenerateRepeatedBytes(300000U, 70000U)
+    );
+
+    const Bytes compressed_data = CompressBlock(data.data(), static_cast<Size>(data.size()));
+    CHECK(compressed_data.size() <= GetMaxCompressedBlockSize(static_cast<Size>(data.size())));
+
+    Bytes decompressed_data(data.size());
+    DecompressBlock(compressed_data.data(), static_cast<Size>(compressed_data.size()),
+                    decompressed_data.data(), static_cast<Size>(decompressed_data.size()));
+    CHECK(decompressed_data == data);
+}
+
+TEST_CASE("Block compression reduces size of compressible data", "[provider][compression]")
+{
+    const Bytes compressible_data = GenerateCompressibleBytes(100000U, 1U);
+    CHECK(CompressBlock(compressible_data.data(), static_cast<Size>(compressible_data.size())).size() < compressible_data.size() / 2U);
+
+    const Bytes repeated_data = GenerateRepeatedBytes(100000U, 4U);
+    CHECK(CompressBlock(repeated_data.data(), static_cast<Size>(repeated_data.size())).size() < 1000U);
+}
+
+TEST_CASE("Block decompression detects corrupted data", "[provider][compression]")
+{
+    const Bytes data = GenerateCompressibleBytes(10000U, 1U);
+    const Bytes compressed_data = CompressBlock(data.data(), static_cast<Size>(data.size()));
+    Bytes decompressed_data(data.size());
+
+    SECTION("Truncated data")
+    {
+        CHECK_THROWS_AS(DecompressBlock(compressed_data.data(), static_cast<Size>(compressed_data.size() / 2U),
+                                        decompressed_data.data(), static_cast<Size>(decompressed_data.size())),
+                        std::runtime_error);
+    }
+
+    SECTION("Too small output buffer")
+    {
+        CHECK_THROWS_AS(DecompressBlock(compressed_data.data(), static_cast<Size>(compressed_data.size()),
+                                        decompressed_data.data(), static_cast<Size>(decompressed_data.size() - 1U)),
+                        std::runtime_error);
+    }
+
+    SECTION("Invalid match offset")
+    {
+        // Token with 1 literal and match referencing data before the block start
+        const Bytes invalid_data{ Byte{ 0x10 }, Byte{ 0xAA }, Byte{ 0x08 }, Byte{ 0x00 } };
+        CHECK_THROWS_AS(DecompressBlock(invalid_data.data(), static_cast<Size>(invalid_data.size()),
+                                        decompressed_data.data(), 5U),
+                        std::runtime_error);
+    }
+}
+
+TEST_CASE("Pack provider loads resources written by pack writer", "[provider][pack]")
+{
+    const bool compression_enabled = GENERATE(false, true);
+    PackWriter::Settings writer_settings;
+    writer_settings.compression_enabled = compression_enabled;
+    PackWriter pack_writer(writer_settings);
+
+    const std::vector<std::pair<std::string, Bytes>> resources{
+        { "Shaders/Cube_VS.spirv",      GenerateCompressibleBytes(8000U, 1U) },
+        { "Shaders/Cube_PS.spirv",      GenerateCompressibleBytes(6000U, 2U) },
+        { "Textures/Bubbles.jpg",       GenerateTestBytes(100000U, 3U) },
+        { "Textures/SkyBox/Top.jpg",    GenerateTestBytes(20000U, 4U) },
+        { "Fonts/Roboto/Roboto.ttf",    GenerateTestBytes(1000U, 5U) },
+        { "Empty.txt",                  Bytes() },
+    };
+    for(const auto& [path, data] : resources)
+    {
+        pack_writer.AddFile(path, Bytes(data));
+    }
+    CHECK(pack_writer.GetFilesCount() == resources.size());
+    CHECK_THROWS_AS(pack_writer.AddFile("Empty.txt", Bytes()), std::invalid_argument);
+
+    PackWriter::Statistics pack_statistics;
+    const TestFile pack_file("PackProviderTest.pack", pack_writer.Build(&pack_statistics));
+    CHECK(pack_statistics.files_count == resources.size());
+    CHECK(pack_statistics.compressed_count == (compression_enabled ? 2U : 0U));
+    CHECK(pack_statistics.stored_size <= pack_statistics.data_size);
+
+    const PackProvider pack_provider(pack_file.GetFullPath());
+    CHECK(pack_provider.GetEntriesCount() == resources.size());
+
+    SECTION("All resources are found and loaded")
+    {
+        for(const auto& [path, data] : resources)
+        {
+            CHECK(pack_provider.HasData(path));
+            CHECK(IsChunkEqual(pack_provider.GetData(path), data));
+        }
+    }
+
+    SECTION("Uncompressed resources are referenced in page-aligned mapped memory")
+    {
+        const Chunk texture_chunk = pack_provider.GetData("Textures/Bubbles.jpg");
+        CHECK(texture_chunk.HasDataOwner());
+        CHECK(reinterpret_cast<uintptr_t>(texture_chunk.GetDataPtr()) % Pack::g_page_size == 0U);
+    }
+
+    SECTION("Missing resources are not found")
+    {
+        CHECK_FALSE(pack_provider.HasData("Shaders/Missing.spirv"));
+        CHECK_FALSE(pack_provider.HasData("Shaders"));
+        CHECK_THROWS_AS(pack_provider.GetData("Textures/Missing.jpg"), std::invalid_argument);
+    }
+
+    SECTION("Files are listed by directory")
+    {
+        CHECK(pack_provider.GetFiles("Shaders") == std::vector<std::string>{ "Shaders/Cube_PS.spirv", "Shaders/Cube_VS.spirv" });
+        CHECK(pack_provider.GetFiles("Textures/") == std::vector<std::string>{ "Textures/Bubbles.jpg", "Textures/SkyBox/Top.jpg" });
+        CHECK(pack_provider.GetFiles("").size() == resources.size());
+        CHECK(pack_provider.GetFiles("Missing").empty());
+    }
+
+    SECTION("Resource data outlives pack provider")
+    {
+        std::unique_ptr<PackProvider> pack_provider_ptr = std::make_unique<PackProvider>(pack_file.GetFullPath());
+        const Chunk texture_chunk = pack_provider_ptr->GetData("Textures/SkyBox/Top.jpg");
+        pack_provider_ptr.reset();
+        CHECK(IsChunkEqual(texture_chunk, resources[3].second));
+    }
+}
+
+TEST_CASE("Pack provider rejects invalid pack files", "[provider][pack]")
+{
+    SECTION("File is not a pack")
+    {
+        const TestFile invalid_file("PackProviderTest.pack", GenerateTestBytes(1000U, 1U));
+        CHECK_THROWS_AS(PackProvider(invalid_file.GetFullPath()), std::runtime_error);
+    }
+
+    SECTION("Pack file is truncated")
+    {
+        PackWriter pack_writer;
+        pack_writer.AddFile("Data.bin", GenerateTestBytes(100U, 1U));
+        Bytes pack_data = pack_writer.Build();
+        pack_data.resize(sizeof(Pack::Header) + 8U);
+
+        const TestFile truncated_file("PackProviderTest.pack", pack_data);
+        CHECK_THROWS_AS(PackProvider(truncated_file.GetFullPath()), std::runtime_error);
+    }
+
+    SECTION("Pack entry is corrupted")
+    {
+        PackWriter pack_writer;
+        pack_writer.AddFile("Data.bin", GenerateTestBytes(100U, 1U));
+        Bytes pack_data = pack_writer.Build();
+
+        Pack::Header header;
+        std::memcpy(&header, pack_data.data(), sizeof(header));
+        Pack::Entry entry;
+        std::memcpy(&entry, pack_data.data() + header.entries_offset, sizeof(entry));
+
+        SECTION("Data offset overflows pack bounds check")
+        {
+            entry.data_offset = std::numeric_limits<uint64_t>::max() - entry.stored_size / 2U;
+        }
+
+        SECTION("Uncompressed data size differs from stored size")
+        {
+            entry.data_size = entry.stored_size + 1U;
+        }
+
+        std::memcpy(pack_data.data() + header.entries_offset, &entry, sizeof(entry));
+        const TestFile corrupted_file("PackProviderTest.pack", pack_data);
+        const PackProvider pack_provider(corrupted_file.GetFullPath());
+        CHECK(pack_provider.HasData("Data.bin"));
+        CHECK_THROWS_AS(pack_provider.GetData("Data.bin"), std::runtime_error);
+    }
+}
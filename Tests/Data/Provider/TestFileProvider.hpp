@@ -0,0 +1,83 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Test/TestFileProvider.hpp
+File provider with selectable load mode and temporary test files in resources directory.
+
+******************************************************************************/
+
+#pragma once
+
+#include <Methane/Data/FileProvider.hpp>
+
+#include <string>
+#include <fstream>
+#include <cstdio>
+
+namespace Methane::Data
+{
+
+class TestFileProvider final : public FileProvider
+{
+public:
+    explicit TestFileProvider(LoadMode load_mode)
+        : FileProvider(load_mode)
+    { }
+
+    using FileProvider::GetFullFilePath;
+};
+
+class TestFile
+{
+public:
+    TestFile(const std::string& path, const Bytes& content)
+        : m_path(path)
+        , m_full_path(TestFileProvider(FileProvider::LoadMode::Read).GetFullFilePath(path))
+    {
+        std::ofstream fs(m_full_path, std::ios::binary | std::ios::trunc);
+        fs.write(reinterpret_cast<const char*>(content.data()), static_cast<std::streamsize>(content.size())); // NOSONAR
+    }
+
+    TestFile(const TestFile&) = delete;
+    TestFile(TestFile&&) = delete;
+    ~TestFile() { std::remove(m_full_path.c_str()); }
+
+    TestFile& operator=(const TestFile&) = delete;
+    TestFile& operator=(TestFile&&) = delete;
+
+    [[nodiscard]] const std::string& GetPath() const noexcept     { return m_path; }
+    [[nodiscard]] const std::string& GetFullPath() const noexcept { return m_full_path; }
+
+private:
+    const std::string m_path;
+    const std::string m_full_path;
+};
+
+inline Bytes GenerateTestBytes(size_t size, uint32_t seed)
+{
+    Bytes bytes(size);
+    uint32_t value = seed;
+    for(Byte& byte : bytes)
+    {
+        value = value * 1664525U + 1013904223U;
+        byte  = static_cast<Byte>(value >> 24U);
+    }
+    return bytes;
+}
+
+} // namespace Methane::Data
@@ -0,0 +1,244 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Test/FlatRangeSetTest.cpp
+Unit tests of the FlatRangeSet data type and bulk operations of range sets
+
+******************************************************************************/
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+
+#include <Methane/Data/FlatRangeSet.hpp>
+#include <Methane/Data/RangeSet.hpp>
+
+#include <vector>
+
+using namespace Methane::Data;
+
+using FlatRangeSet32 = FlatRangeSet<uint32_t, 4U>;
+
+template<typename RangeSetT>
+static std::vector<Range<uint32_t>> GetRanges(const RangeSetT& range_set)
+{
+    return std::vector<Range<uint32_t>>(range_set.begin(), range_set.end());
+}
+
+TEST_CASE("Flat range set initialization", "[range-set][flat-range-set]")
+{
+    SECTION("Default constructor")
+    {
+        const FlatRangeSet32 range_set;
+        CHECK(range_set.IsEmpty());
+        CHECK(range_set.IsInline());
+    }
+
+    SECTION("Initializer list with non-intersecting ranges")
+    {
+        const FlatRangeSet32 range_set{ { 0, 2 }, { 4, 8 }, { 11, 12 } };
+        CHECK(range_set.Size() == 3);
+    }
+
+    SECTION("Initializer list with intersecting ranges")
+    {
+        const FlatRangeSet32 range_set{ { 0, 5 }, { 4, 8 }, { 11, 12 } };
+        CHECK(range_set.Size() == 2);
+    }
+
+    SECTION("Copy constructor of heap storage")
+    {
+        const FlatRangeSet32 orig_range_set{ { 0, 2 }, { 4, 8 }, { 11, 12 }, { 17, 20 }, { 25, 29 } };
+        const FlatRangeSet32 copy_range_set(orig_range_set);
+        CHECK_FALSE(orig_range_set.IsInline());
+        CHECK(copy_range_set == orig_range_set);
+    }
+
+    SECTION("Move constructor of inline storage")
+    {
+        FlatRangeSet32 orig_range_set{ { 0, 5 }, { 11, 12 } };
+        const FlatRangeSet32 moved_range_set(std::move(orig_range_set));
+        CHECK(moved_range_set == FlatRangeSet32{ { 0, 5 }, { 11, 12 } });
+    }
+}
+
+TEST_CASE("Flat range set add", "[range-set][flat-range-set]")
+{
+    const FlatRangeSet32 test_range_set{
+        { 0, 2 }, { 4, 8 }, { 11, 12 }, { 17, 20 }, { 25, 29 }
+    };
+
+    SECTION("Adding non-mergeable range")
+    {
+        FlatRangeSet32 range_set(test_range_set);
+        range_set.Add({ 14, 16 });
+        CHECK(range_set == FlatRangeSet32{ { 0, 2 }, { 4, 8 }, { 11, 12 }, { 14, 16 }, { 17, 20 }, { 25, 29 } });
+    }
+
+    SECTION("Adding mergeable range in the middle")
+    {
+        FlatRangeSet32 range_set(test_range_set);
+        range_set.Add({ 5, 12 });
+        CHECK(GetRanges(range_set) == std::vector<Range<uint32_t>>{ { 0, 2 }, { 4, 12 }, { 17, 20 }, { 25, 29 } });
+    }
+
+    SECTION("Adding mergeable range in the beginning")
+    {
+        FlatRangeSet32 range_set(test_range_set);
+        range_set.Add({ 0, 7 });
+        CHECK(GetRanges(range_set) == std::vector<Range<uint32_t>>{ { 0, 8 }, { 11, 12 }, { 17, 20 }, { 25, 29 } });
+    }
+
+    SECTION("Adding mergeable range in the end")
+    {
+        FlatRangeSet32 range_set(test_range_set);
+        range_set.Add({ 26, 35 });
+        CHECK(GetRanges(range_set) == std::vector<Range<uint32_t>>{ { 0, 2 }, { 4, 8 }, { 11, 12 }, { 17, 20 }, { 25, 35 } });
+    }
+
+    SECTION("Adding adjacent range in the middle")
+    {
+        FlatRangeSet32 range_set(test_range_set);
+        range_set.Add({ 8, 11 });
+        CHECK(GetRanges(range_set) == std::vector<Range<uint32_t>>{ { 0, 2 }, { 4, 12 }, { 17, 20 }, { 25, 29 } });
+    }
+
+    SECTION("Adding range covering all ranges")
+    {
+        FlatRangeSet32 range_set(test_range_set);
+        range_set.Add({ 0, 40 });
+        CHECK(GetRanges(range_set) == std::vector<Range<uint32_t>>{ { 0, 40 } });
+    }
+}
+
+TEST_CASE("Flat range set remove", "[range-set][flat-range-set]")
+{
+    const FlatRangeSet32 test_range_set{
+        { 0, 2 }, { 4, 8 }, { 11, 12 }, { 17, 20 }, { 25, 29 }
+    };
+
+    SECTION("Remove adjacent range")
+    {
+        FlatRangeSet32 range_set(test_range_set);
+        range_set.Remove({ 8, 11 });
+        CHECK(range_set == test_range_set);
+    }
+
+    SECTION("Remove existing full range")
+    {
+        FlatRangeSet32 range_set(test_range_set);
+        range_set.Remove({ 4, 8 });
+        CHECK(GetRanges(range_set) == std::vector<Range<uint32_t>>{ { 0, 2 }, { 11, 12 }, { 17, 20 }, { 25, 29 } });
+    }
+
+    SECTION("Remove overlapping range from middle")
+    {
+        FlatRangeSet32 range_set(test_range_set);
+        range_set.Remove({ 6, 18 });
+        CHECK(GetRanges(range_set) == std::vector<Range<uint32_t>>{ { 0, 2 }, { 4, 6 }, { 18, 20 }, { 25, 29 } });
+    }
+
+    SECTION("Remove range splitting existing range")
+    {
+        FlatRangeSet32 range_set(test_range_set);
+        range_set.Remove({ 5, 7 });
+        CHECK(GetRanges(range_set) == std::vector<Range<uint32_t>>{ { 0, 2 }, { 4, 5 }, { 7, 8 }, { 11, 12 }, { 17, 20 }, { 25, 29 } });
+    }
+
+    SECTION("Remove overlapping range from beginning")
+    {
+        FlatRangeSet32 range_set(test_range_set);
+        range_set.Remove({ 0, 3 });
+        CHECK(GetRanges(range_set) == std::vector<Range<uint32_t>>{ { 4, 8 }, { 11, 12 }, { 17, 20 }, { 25, 29 } });
+    }
+
+    SECTION("Remove overlapping range from end")
+    {
+        FlatRangeSet32 range_set(test_range_set);
+        range_set.Remove({ 23, 30 });
+        CHECK(GetRanges(range_set) == std::vector<Range<uint32_t>>{ { 0, 2 }, { 4, 8 }, { 11, 12 }, { 17, 20 } });
+    }
+}
+
+TEMPLATE_TEST_CASE("Range set bulk operations", "[range-set][flat-range-set]", RangeSet<uint32_t>, FlatRangeSet32)
+{
+    const TestType left_range_set{ { 0, 2 }, { 4, 8 }, { 11, 12 }, { 17, 20 }, { 25, 29 } };
+    const TestType right_range_set{ { 1, 5 }, { 8, 11 }, { 14, 15 }, { 18, 19 }, { 28, 35 } };
+
+    SECTION("Add ranges")
+    {
+        TestType range_set(left_range_set);
+        range_set.AddRanges(right_range_set);
+        CHECK(GetRanges(range_set) == std::vector<Range<uint32_t>>{ { 0, 12 }, { 14, 15 }, { 17, 20 }, { 25, 35 } });
+    }
+
+    SECTION("Remove ranges")
+    {
+        TestType range_set(left_range_set);
+        range_set.RemoveRanges(right_range_set);
+        CHECK(GetRanges(range_set) == std::vector<Range<uint32_t>>{ { 0, 1 }, { 5, 8 }, { 11, 12 }, { 17, 18 }, { 19, 20 }, { 25, 28 } });
+    }
+
+    SECTION("Remove ranges spanning multiple ranges")
+    {
+        TestType range_set(left_range_set);
+        range_set.RemoveRanges(TestType{ { 1, 18 } });
+        CHECK(GetRanges(range_set) == std::vector<Range<uint32_t>>{ { 0, 1 }, { 18, 20 }, { 25, 29 } });
+    }
+
+    SECTION("Union of ranges")
+    {
+        const TestType united_range_set = left_range_set.Union(right_range_set);
+        CHECK(GetRanges(united_range_set) == std::vector<Range<uint32_t>>{ { 0, 12 }, { 14, 15 }, { 17, 20 }, { 25, 35 } });
+    }
+
+    SECTION("Intersection of ranges")
+    {
+        const TestType intersected_range_set = left_range_set.Intersect(right_range_set);
+        CHECK(GetRanges(intersected_range_set) == std::vector<Range<uint32_t>>{ { 1, 2 }, { 4, 5 }, { 18, 19 }, { 28, 29 } });
+    }
+
+    SECTION("Intersection with empty set")
+    {
+        const TestType intersected_range_set = left_range_set.Intersect(TestType{});
+        CHECK(intersected_range_set.IsEmpty());
+    }
+
+    SECTION("Bulk add is equivalent to sequential add")
+    {
+        TestType bulk_range_set(left_range_set);
+        bulk_range_set.AddRanges(right_range_set);
+
+        TestType sequential_range_set(left_range_set);
+        for (const Range<uint32_t>& range : right_range_set)
+            sequential_range_set.Add(range);
+
+        CHECK(GetRanges(bulk_range_set) == GetRanges(sequential_range_set));
+    }
+
+    SECTION("Bulk remove is equivalent to sequential remove")
+    {
+        TestType bulk_range_set(left_range_set);
+        bulk_range_set.RemoveRanges(right_range_set);
+
+        TestType sequential_range_set(left_range_set);
+        for (const Range<uint32_t>& range : right_range_set)
+            sequential_range_set.Remove(range);
+
+        CHECK(GetRanges(bulk_range_set) == GetRanges(sequential_range_set));
+    }
+}
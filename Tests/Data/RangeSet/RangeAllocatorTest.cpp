@@ -0,0 +1,168 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Test/RangeAllocatorTest.cpp
+Unit tests of the RangeAllocator used for sub-allocation of memory blocks
+
+******************************************************************************/
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <Methane/Data/RangeAllocator.hpp>
+
+#include <vector>
+#include <random>
+#include <algorithm>
+#include <stdexcept>
+
+using namespace Methane;
+using namespace Methane::Data;
+
+using RangeAllocator64 = RangeAllocator<uint64_t>;
+using Range64 = Range<uint64_t>;
+
+TEST_CASE("Range allocator initialization", "[range-allocator]")
+{
+    const RangeAllocator64 allocator(1024U);
+    CHECK(allocator.GetCapacity() == 1024U);
+    CHECK(allocator.GetAllocatedSize() == 0U);
+    CHECK(allocator.GetFreeSize() == 1024U);
+    CHECK(allocator.GetLargestFreeLength() == 1024U);
+    CHECK(allocator.GetFreeRangesCount() == 1U);
+    CHECK(allocator.IsEmpty());
+}
+
+TEST_CASE("Range allocator allocations", "[range-allocator]")
+{
+    RangeAllocator64 allocator(1024U);
+
+    SECTION("Sequential allocations are placed one after another")
+    {
+        CHECK(allocator.Allocate(100U) == Range64(0U, 100U));
+        CHECK(allocator.Allocate(200U) == Range64(100U, 300U));
+        CHECK(allocator.GetAllocatedSize() == 300U);
+        CHECK(allocator.GetAllocationsCount() == 2U);
+        CHECK(allocator.GetFreeRangesCount() == 1U);
+    }
+
+    SECTION("Aligned allocation leaves padding free")
+    {
+        CHECK(allocator.Allocate(10U) == Range64(0U, 10U));
+        CHECK(allocator.Allocate(64U, 256U) == Range64(256U, 320U));
+        CHECK(allocator.GetFreeRangesCount() == 2U);
+        CHECK(allocator.Allocate(200U, 8U) == Range64(16U, 216U));
+    }
+
+    SECTION("Allocation takes best fitting free range")
+    {
+        const Opt<Range64> range_a = allocator.Allocate(100U);
+        const Opt<Range64> range_b = allocator.Allocate(10U);
+        const Opt<Range64> range_c = allocator.Allocate(50U);
+        const Opt<Range64> range_d = allocator.Allocate(10U);
+        REQUIRE((range_a && range_b && range_c && range_d));
+        allocator.Free(*range_a);
+        allocator.Free(*range_c);
+        CHECK(allocator.Allocate(40U) == Range64(110U, 150U));
+    }
+
+    SECTION("Allocation fails when no free range fits")
+    {
+        CHECK(allocator.Allocate(1000U).has_value());
+        CHECK_FALSE(allocator.Allocate(100U).has_value());
+        CHECK_FALSE(allocator.Allocate(2048U).has_value());
+    }
+
+    SECTION("Invalid alignment is rejected")
+    {
+        CHECK_THROWS_AS(allocator.Allocate(8U, 3U), std::invalid_argument);
+    }
+}
+
+TEST_CASE("Range allocator free", "[range-allocator]")
+{
+    RangeAllocator64 allocator(1024U);
+    const Opt<Range64> range_a = allocator.Allocate(100U);
+    const Opt<Range64> range_b = allocator.Allocate(100U);
+    const Opt<Range64> range_c = allocator.Allocate(100U);
+    REQUIRE((range_a && range_b && range_c));
+
+    SECTION("Freed ranges are merged with free neighbours")
+    {
+        allocator.Free(*range_a);
+        allocator.Free(*range_c);
+        CHECK(allocator.GetFreeRangesCount() == 2U);
+        allocator.Free(*range_b);
+        CHECK(allocator.GetFreeRangesCount() == 1U);
+        CHECK(allocator.GetLargestFreeLength() == 1024U);
+        CHECK(allocator.IsEmpty());
+    }
+
+    SECTION("Double free is rejected")
+    {
+        allocator.Free(*range_b);
+        CHECK_THROWS_AS(allocator.Free(*range_b), std::invalid_argument);
+    }
+
+    SECTION("Free out of capacity is rejected")
+    {
+        CHECK_THROWS_AS(allocator.Free(Range64(1000U, 2000U)), std::out_of_range);
+    }
+}
+
+TEST_CASE("Range allocator random allocations", "[range-allocator]")
+{
+    constexpr uint64_t capacity = 1U << 20U;
+    RangeAllocator64 allocator(capacity);
+    std::mt19937 random_engine(1234U); // NOSONAR - deterministic pseudo-random sequence
+    std::uniform_int_distribution<uint64_t> length_distribution(1U, 4096U);
+    std::uniform_int_distribution<uint32_t> alignment_log_distribution(0U, 8U);
+
+    std::vector<Range64> allocated_ranges;
+    for(uint32_t iteration = 0U; iteration < 2000U; ++iteration)
+    {
+        if (!allocated_ranges.empty() && (iteration % 3U == 0U))
+        {
+            const size_t free_index = random_engine() % allocated_ranges.size();
+            allocator.Free(allocated_ranges[free_index]);
+            allocated_ranges.erase(allocated_ranges.begin() + static_cast<std::ptrdiff_t>(free_index));
+            continue;
+        }
+
+        const uint64_t alignment = 1U << alignment_log_distribution(random_engine);
+        if (const Opt<Range64> range = allocator.Allocate(length_distribution(random_engine), alignment); range)
+        {
+            CHECK(range->GetStart() % alignment == 0U);
+            allocated_ranges.push_back(*range);
+        }
+    }
+
+    std::sort(allocated_ranges.begin(), allocated_ranges.end(),
+              [](const Range64& left, const Range64& right) { return left.GetStart() < right.GetStart(); });
+    for(size_t range_index = 1U; range_index < allocated_ranges.size(); ++range_index)
+    {
+        CHECK(allocated_ranges[range_index - 1U].GetEnd() <= allocated_ranges[range_index].GetStart());
+    }
+
+    for(const Range64& range : allocated_ranges)
+    {
+        allocator.Free(range);
+    }
+    CHECK(allocator.IsEmpty());
+    CHECK(allocator.GetFreeRangesCount() == 1U);
+    CHECK(allocator.GetLargestFreeLength() == capacity);
+}
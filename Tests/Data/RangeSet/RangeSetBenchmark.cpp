@@ -0,0 +1,213 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Test/RangeSetBenchmark.cpp
+Benchmark of RangeSet with std::set storage versus FlatRangeSet with contiguous storage.
+
+******************************************************************************/
+
+#include <Methane/Data/RangeSet.hpp>
+#include <Methane/Data/FlatRangeSet.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <random>
+#include <vector>
+#include <string>
+
+using namespace Methane::Data;
+
+using TreeRangeSet32 = RangeSet<uint32_t>;
+using FlatRangeSet32 = FlatRangeSet<uint32_t>;
+
+// Ranges [3*i + offset, 3*i + offset + 2) with gaps, so that offset ranges are partially overlapping
+template<typename RangeSetT>
+static RangeSetT MakeRangeSet(uint32_t ranges_count, uint32_t offset)
+{
+    RangeSetT range_set;
+    for (uint32_t i = 0U; i < ranges_count; ++i)
+    {
+        range_set.Add({ i * 3U + offset, i * 3U + offset + 2U });
+    }
+    return range_set;
+}
+
+template<typename RangeSetT>
+static size_t MeasureSequentialAdd(uint32_t ranges_count, Catch::Benchmark::Chronometer meter)
+{
+    size_t ranges_size = 0U;
+    meter.measure([&]()
+    {
+        const RangeSetT range_set = MakeRangeSet<RangeSetT>(ranges_count, 0U);
+        ranges_size += range_set.Size();
+    });
+    return ranges_size;
+}
+
+template<typename RangeSetT>
+static size_t MeasureRandomAddRemove(uint32_t ranges_count, Catch::Benchmark::Chronometer meter)
+{
+    constexpr uint32_t operations_count = 1000U;
+    std::mt19937 random_engine(1234U);
+    std::uniform_int_distribution<uint32_t> start_distribution(0U, ranges_count * 3U);
+    std::vector<Range<uint32_t>> random_ranges;
+    random_ranges.reserve(operations_count);
+    for (uint32_t i = 0U; i < operations_count; ++i)
+    {
+        const uint32_t start = start_distribution(random_engine);
+        random_ranges.emplace_back(start, start + 1U + i % 5U);
+    }
+
+    RangeSetT range_set = MakeRangeSet<RangeSetT>(ranges_count, 0U);
+    meter.measure([&]()
+    {
+        for (size_t i = 0U; i < random_ranges.size(); ++i)
+        {
+            if (i % 2U)
+                range_set.Remove(random_ranges[i]);
+            else
+                range_set.Add(random_ranges[i]);
+        }
+    });
+    return range_set.Size();
+}
+
+template<typename RangeSetT>
+static size_t MeasureUnion(uint32_t ranges_count, Catch::Benchmark::Chronometer meter)
+{
+    const RangeSetT left_range_set  = MakeRangeSet<RangeSetT>(ranges_count, 0U);
+    const RangeSetT right_range_set = MakeRangeSet<RangeSetT>(ranges_count, 1U);
+    size_t ranges_size = 0U;
+    meter.measure([&]()
+    {
+        ranges_size += left_range_set.Union(right_range_set).Size();
+    });
+    return ranges_size;
+}
+
+template<typename RangeSetT>
+static size_t MeasureIntersect(uint32_t ranges_count, Catch::Benchmark::Chronometer meter)
+{
+    const RangeSetT left_range_set  = MakeRangeSet<RangeSetT>(ranges_count, 0U);
+    const RangeSetT right_range_set = MakeRangeSet<RangeSetT>(ranges_count, 1U);
+    size_t ranges_size = 0U;
+    meter.measure([&]()
+    {
+        ranges_size += left_range_set.Intersect(right_range_set).Size();
+    });
+    return ranges_size;
+}
+
+template<typename RangeSetT>
+static size_t MeasureRemoveRanges(uint32_t ranges_count, Catch::Benchmark::Chronometer meter)
+{
+    const RangeSetT left_range_set  = MakeRangeSet<RangeSetT>(ranges_count, 0U);
+    const RangeSetT right_range_set = MakeRangeSet<RangeSetT>(ranges_count, 1U);
+    size_t ranges_size = 0U;
+    meter.measure([&]()
+    {
+        RangeSetT range_set(left_range_set);
+        range_set.RemoveRanges(right_range_set);
+        ranges_size += range_set.Size();
+    });
+    return ranges_size;
+}
+
+static void BenchmarkRangeSets(uint32_t ranges_count)
+{
+    const std::string count_str = std::to_string(ranges_count);
+
+    BENCHMARK_ADVANCED("Tree sequential add of " + count_str + " ranges")(Catch::Benchmark::Chronometer meter)
+    {
+        return MeasureSequentialAdd<TreeRangeSet32>(ranges_count, meter);
+    };
+    BENCHMARK_ADVANCED("Flat sequential add of " + count_str + " ranges")(Catch::Benchmark::Chronometer meter)
+    {
+        return MeasureSequentialAdd<FlatRangeSet32>(ranges_count, meter);
+    };
+
+    BENCHMARK_ADVANCED("Tree random add/remove in " + count_str + " ranges")(Catch::Benchmark::Chronometer meter)
+    {
+        return MeasureRandomAddRemove<TreeRangeSet32>(ranges_count, meter);
+    };
+    BENCHMARK_ADVANCED("Flat random add/remove in " + count_str + " ranges")(Catch::Benchmark::Chronometer meter)
+    {
+        return MeasureRandomAddRemove<FlatRangeSet32>(ranges_count, meter);
+    };
+
+    BENCHMARK_ADVANCED("Tree union of " + count_str + " ranges")(Catch::Benchmark::Chronometer meter)
+    {
+        return MeasureUnion<TreeRangeSet32>(ranges_count, meter);
+    };
+    BENCHMARK_ADVANCED("Flat union of " + count_str + " ranges")(Catch::Benchmark::Chronometer meter)
+    {
+        return MeasureUnion<FlatRangeSet32>(ranges_count, meter);
+    };
+
+    BENCHMARK_ADVANCED("Tree intersection of " + count_str + " ranges")(Catch::Benchmark::Chronometer meter)
+    {
+        return MeasureIntersect<TreeRangeSet32>(ranges_count, meter);
+    };
+    BENCHMARK_ADVANCED("Flat intersection of " + count_str + " ranges")(Catch::Benchmark::Chronometer meter)
+    {
+        return MeasureIntersect<FlatRangeSet32>(ranges_count, meter);
+    };
+
+    BENCHMARK_ADVANCED("Tree remove ranges of " + count_str + " ranges")(Catch::Benchmark::Chronometer meter)
+    {
+        return MeasureRemoveRanges<TreeRangeSet32>(ranges_count, meter);
+    };
+    BENCHMARK_ADVANCED("Flat remove ranges of " + count_str + " ranges")(Catch::Benchmark::Chronometer meter)
+    {
+        return MeasureRemoveRanges<FlatRangeSet32>(ranges_count, meter);
+    };
+}
+
+TEST_CASE("Benchmark range set storages", "[range-set][benchmark]")
+{
+    SECTION("100 ranges")
+    {
+        BenchmarkRangeSets(100U);
+    }
+
+    SECTION("1000 ranges")
+    {
+        BenchmarkRangeSets(1000U);
+    }
+
+    SECTION("10000 ranges")
+    {
+        BenchmarkRangeSets(10000U);
+    }
+}
+
+// Large range sets benchmark is hidden from default test run due to long execution time,
+// run it explicitly with "[range-set-large]" tag
+TEST_CASE("Benchmark large range set storages", "[.][range-set-large][benchmark]")
+{
+    SECTION("100000 ranges")
+    {
+        BenchmarkRangeSets(100000U);
+    }
+
+    SECTION("1000000 ranges")
+    {
+        BenchmarkRangeSets(1000000U);
+    }
+}
@@ -31,6 +31,7 @@ Unit-tests of the RHI Buffer
 #include <Methane/Graphics/RHI/CommandQueue.h>
 
 #include <memory>
+#include <vector>
 #include <taskflow/taskflow.hpp>
 #include <catch2/catch_test_macros.hpp>
 
@@ -164,6 +165,48 @@ TEST_CASE("RHI Buffer Functions", "[rhi][buffer][resource]")
         CHECK(vertex_buffer.GetFormattedItemsCount() == 256);
     }
 
+    SECTION("Set Data Sub-Range")
+    {
+        const Rhi::CommandQueue upload_queue = compute_context.GetUploadCommandKit().GetQueue();
+        const std::vector<std::byte> test_data(256, std::byte(8));
+        const Data::Chunk test_data_chunk(reinterpret_cast<Data::ConstRawPtr>(test_data.data()), // NOSONAR
+                                          static_cast<Data::Size>(test_data.size()));
+
+        REQUIRE_NOTHROW(buffer.SetData(upload_queue, 1024U, test_data_chunk));
+        CHECK(buffer.GetDataSize(Data::MemoryState::Initialized) == 1024U + test_data.size());
+
+        // Sub-range write before the end of initialized data keeps initialized data size
+        REQUIRE_NOTHROW(buffer.SetData(upload_queue, 0U, test_data_chunk));
+        CHECK(buffer.GetDataSize(Data::MemoryState::Initialized) == 1024U + test_data.size());
+
+        // Sub-range write ending at the buffer end is allowed
+        const Data::Size last_offset = constant_buffer_settings.size - static_cast<Data::Size>(test_data.size());
+        REQUIRE_NOTHROW(buffer.SetData(upload_queue, last_offset, test_data_chunk));
+        CHECK(buffer.GetDataSize(Data::MemoryState::Initialized) == constant_buffer_settings.size);
+    }
+
+    SECTION("Set Data Sub-Range Validation")
+    {
+        const Rhi::CommandQueue upload_queue = compute_context.GetUploadCommandKit().GetQueue();
+        const std::vector<std::byte> test_data(256, std::byte(8));
+        const Data::Chunk test_data_chunk(reinterpret_cast<Data::ConstRawPtr>(test_data.data()), // NOSONAR
+                                          static_cast<Data::Size>(test_data.size()));
+
+        // Offset is out of buffer bounds
+        CHECK_THROWS(buffer.SetData(upload_queue, constant_buffer_settings.size, test_data_chunk));
+        CHECK_THROWS(buffer.SetData(upload_queue, constant_buffer_settings.size + 1U, test_data_chunk));
+
+        // Offset is in buffer bounds, but data size exceeds the rest of buffer
+        CHECK_THROWS(buffer.SetData(upload_queue, constant_buffer_settings.size - 1U, test_data_chunk));
+
+        // Data size does not match the length of data range
+        CHECK_THROWS(buffer.SetData(upload_queue, Rhi::SubResource(reinterpret_cast<Data::ConstRawPtr>(test_data.data()), // NOSONAR
+                                                                   static_cast<Data::Size>(test_data.size()), Rhi::SubResource::Index(),
+                                                                   Rhi::BytesRange(0U, 128U))));
+
+        CHECK(buffer.GetDataSize(Data::MemoryState::Initialized) == 0U);
+    }
+
     SECTION("Get Data")
     {
         CHECK_NOTHROW(buffer.GetData(compute_context.GetUploadCommandKit().GetQueue()));
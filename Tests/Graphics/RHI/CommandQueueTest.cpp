@@ -34,6 +34,8 @@ Unit-tests of the RHI Command Queue
 #include <Methane/Graphics/Null/CommandListSet.h>
 
 #include <memory>
+#include <string>
+#include <vector>
 #include <taskflow/taskflow.hpp>
 #include <catch2/catch_test_macros.hpp>
 
@@ -114,6 +116,94 @@ TEST_CASE("RHI Command Queue Functions", "[rhi][queue]")
         CHECK(compute_cmd_list.GetState() == Rhi::CommandListState::Pending);
         CHECK(completed_command_list_ptr == compute_cmd_list.GetInterfacePtr().get());
     }
+
+    const Rhi::CommandQueue compute_cmd_queue = compute_context.CreateCommandQueue(Rhi::CommandListType::Compute);
+    const Rhi::ComputeCommandList first_cmd_list = compute_cmd_queue.CreateComputeCommandList();
+    const Rhi::ComputeCommandList second_cmd_list = compute_cmd_queue.CreateComputeCommandList();
+    const Rhi::CommandListSet first_cmd_list_set({ first_cmd_list.GetInterface() });
+    const Rhi::CommandListSet second_cmd_list_set({ second_cmd_list.GetInterface() });
+    for(const Rhi::ComputeCommandList& cmd_list : { first_cmd_list, second_cmd_list })
+    {
+        REQUIRE_NOTHROW(cmd_list.Reset());
+        REQUIRE_NOTHROW(cmd_list.Commit());
+    }
+
+    std::vector<std::string> completed_callbacks;
+    const auto get_completed_callback = [&completed_callbacks](std::string callback_name)
+    {
+        return [&completed_callbacks, callback_name](Rhi::ICommandList& command_list)
+        {
+            completed_callbacks.push_back(callback_name + " " + std::string(command_list.GetName()));
+        };
+    };
+    first_cmd_list.SetName("1");
+    second_cmd_list.SetName("2");
+
+    SECTION("Execute Batch of Command List Sets")
+    {
+        REQUIRE_NOTHROW(compute_cmd_queue.ExecuteBatch({ first_cmd_list_set, second_cmd_list_set }, get_completed_callback("Batch")));
+
+        CHECK(first_cmd_list.GetState() == Rhi::CommandListState::Executing);
+        CHECK(second_cmd_list.GetState() == Rhi::CommandListState::Executing);
+        CHECK(completed_callbacks.empty());
+
+        dynamic_cast<Null::CommandListSet&>(first_cmd_list_set.GetInterface()).Complete();
+        dynamic_cast<Null::CommandListSet&>(second_cmd_list_set.GetInterface()).Complete();
+
+        CHECK(first_cmd_list.GetState() == Rhi::CommandListState::Pending);
+        CHECK(second_cmd_list.GetState() == Rhi::CommandListState::Pending);
+        CHECK(completed_callbacks == std::vector<std::string>{ "Batch 1", "Batch 2" });
+    }
+
+    SECTION("Deferred Execution of Command List Sets")
+    {
+        CHECK_FALSE(compute_cmd_queue.IsDeferredExecution());
+        REQUIRE_NOTHROW(compute_cmd_queue.SetDeferredExecution(true));
+        CHECK(compute_cmd_queue.IsDeferredExecution());
+
+        REQUIRE_NOTHROW(compute_cmd_queue.Execute(first_cmd_list_set, get_completed_callback("First")));
+        REQUIRE_NOTHROW(compute_cmd_queue.Execute(second_cmd_list_set, get_completed_callback("Second")));
+
+        CHECK(first_cmd_list.GetState() == Rhi::CommandListState::Committed);
+        CHECK(second_cmd_list.GetState() == Rhi::CommandListState::Committed);
+
+        REQUIRE_NOTHROW(compute_cmd_queue.ExecuteDeferred());
+
+        CHECK(first_cmd_list.GetState() == Rhi::CommandListState::Executing);
+        CHECK(second_cmd_list.GetState() == Rhi::CommandListState::Executing);
+        CHECK(completed_callbacks.empty());
+
+        dynamic_cast<Null::CommandListSet&>(first_cmd_list_set.GetInterface()).Complete();
+        dynamic_cast<Null::CommandListSet&>(second_cmd_list_set.GetInterface()).Complete();
+
+        CHECK(completed_callbacks == std::vector<std::string>{ "First 1", "Second 2" });
+    }
+
+    SECTION("Deferred Execution is Submitted on Fence Signal")
+    {
+        const Rhi::Fence fence = compute_cmd_queue.CreateFence();
+        REQUIRE_NOTHROW(compute_cmd_queue.SetDeferredExecution(true));
+        REQUIRE_NOTHROW(compute_cmd_queue.ExecuteBatch({ first_cmd_list_set, second_cmd_list_set }));
+
+        CHECK(first_cmd_list.GetState() == Rhi::CommandListState::Committed);
+        CHECK(second_cmd_list.GetState() == Rhi::CommandListState::Committed);
+
+        REQUIRE_NOTHROW(fence.Signal());
+
+        CHECK(first_cmd_list.GetState() == Rhi::CommandListState::Executing);
+        CHECK(second_cmd_list.GetState() == Rhi::CommandListState::Executing);
+    }
+
+    SECTION("Deferred Execution is Submitted when Disabled")
+    {
+        REQUIRE_NOTHROW(compute_cmd_queue.SetDeferredExecution(true));
+        REQUIRE_NOTHROW(compute_cmd_queue.Execute(first_cmd_list_set));
+        CHECK(first_cmd_list.GetState() == Rhi::CommandListState::Committed);
+
+        REQUIRE_NOTHROW(compute_cmd_queue.SetDeferredExecution(false));
+        CHECK_FALSE(compute_cmd_queue.IsDeferredExecution());
+        CHECK(first_cmd_list.GetState() == Rhi::CommandListState::Executing);
+    }
 }
 
 TEST_CASE("RHI Compute Command Queue Factory", "[rhi][compute][context][factory]")
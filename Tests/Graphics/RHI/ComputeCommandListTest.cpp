@@ -43,6 +43,7 @@ Unit-tests of the RHI Compute Command List
 #include <Methane/Graphics/Null/CommandListDebugGroup.h>
 #include <Methane/Graphics/Null/ProgramBindings.h>
 
+#include <array>
 #include <chrono>
 #include <future>
 #include <memory>
@@ -219,6 +220,108 @@ TEST_CASE("RHI Compute Command List Functions", "[rhi][list][compute]")
         CHECK(dynamic_cast<Null::ComputeCommandList&>(cmd_list.GetInterface()).GetProgramBindingsPtr() == compute_program_bindings.GetInterfacePtr().get());
     }
 
+    SECTION("Retain Program Bindings Released Before Commit")
+    {
+        const Rhi::Texture texture = compute_context.CreateTexture(Rhi::TextureSettings::ForImage(Dimensions(640, 480), {}, PixelFormat::RGBA8, false));
+        const Rhi::Sampler sampler = compute_context.CreateSampler({
+            rhi::SamplerFilter  { rhi::SamplerFilter::MinMag::Linear },
+            rhi::SamplerAddress { rhi::SamplerAddress::Mode::ClampToEdge }
+        });
+        const Rhi::Buffer buffer = compute_context.CreateBuffer(Rhi::BufferSettings::ForConstantBuffer(42000, false, true));
+        const Rhi::CommandListSet cmd_list_set({ cmd_list.GetInterface() });
+
+        WeakPtr<Rhi::IProgramBindings> program_bindings_wptr;
+        REQUIRE_NOTHROW(cmd_list.ResetWithState(compute_state));
+        {
+            const Rhi::ProgramBindings compute_program_bindings = compute_program.CreateBindings({
+                { { Rhi::ShaderType::Compute, "InTexture" }, { { texture.GetInterface() } } },
+                { { Rhi::ShaderType::Compute, "InSampler" }, { { sampler.GetInterface() } } },
+                { { Rhi::ShaderType::Compute, "OutBuffer" }, { { buffer.GetInterface() } } },
+            });
+            program_bindings_wptr = compute_program_bindings.GetInterfacePtr();
+            REQUIRE_NOTHROW(cmd_list.SetProgramBindings(compute_program_bindings));
+        }
+
+        CHECK_FALSE(program_bindings_wptr.expired());
+        REQUIRE_NOTHROW(cmd_list.Commit());
+        REQUIRE_NOTHROW(compute_cmd_queue.Execute(cmd_list_set));
+        CHECK_FALSE(program_bindings_wptr.expired());
+
+        dynamic_cast<Null::CommandListSet&>(cmd_list_set.GetInterface()).Complete();
+        CHECK(program_bindings_wptr.expired());
+    }
+
+    SECTION("Skip Redundant State Changes and Count Statistics")
+    {
+        const Rhi::Texture texture = compute_context.CreateTexture(Rhi::TextureSettings::ForImage(Dimensions(640, 480), {}, PixelFormat::RGBA8, false));
+        const Rhi::Sampler sampler = compute_context.CreateSampler({
+            rhi::SamplerFilter  { rhi::SamplerFilter::MinMag::Linear },
+            rhi::SamplerAddress { rhi::SamplerAddress::Mode::ClampToEdge }
+        });
+        const Rhi::Buffer buffer = compute_context.CreateBuffer(Rhi::BufferSettings::ForConstantBuffer(42000, false, true));
+        const Rhi::ProgramBindings compute_program_bindings = compute_program.CreateBindings({
+            { { Rhi::ShaderType::Compute, "InTexture" }, { { texture.GetInterface() } } },
+            { { Rhi::ShaderType::Compute, "InSampler" }, { { sampler.GetInterface() } } },
+            { { Rhi::ShaderType::Compute, "OutBuffer" }, { { buffer.GetInterface() } } },
+        });
+
+        REQUIRE_NOTHROW(cmd_list.ResetWithState(compute_state));
+        REQUIRE_NOTHROW(cmd_list.SetComputeState(compute_state));
+        REQUIRE_NOTHROW(cmd_list.SetProgramBindings(compute_program_bindings));
+        REQUIRE_NOTHROW(cmd_list.SetProgramBindings(compute_program_bindings));
+        REQUIRE_NOTHROW(cmd_list.Dispatch(Rhi::ThreadGroupsCount(4U, 4U, 1U)));
+        REQUIRE_NOTHROW(cmd_list.Dispatch(Rhi::ThreadGroupsCount(4U, 4U, 1U)));
+
+        const Rhi::CommandListStatistics statistics = cmd_list.GetStatistics();
+        CHECK(statistics.dispatches_count == 2U);
+        CHECK(statistics.draws_count == 0U);
+        CHECK(statistics.applied_state_changes_count == 1U);
+        CHECK(statistics.skipped_state_changes_count == 2U);
+        CHECK(statistics.applied_bindings_count == 1U);
+
+        REQUIRE_NOTHROW(cmd_list.Reset());
+        CHECK(cmd_list.GetStatistics().dispatches_count == 0U);
+    }
+
+    SECTION("Dispatch Indirect with Arguments from Buffer")
+    {
+        const std::array<Rhi::DispatchIndirectArguments, 2> dispatch_args{ {
+            { 1U, 1U, 1U },
+            { 8U, 4U, 2U }
+        } };
+        const Rhi::Buffer args_buffer = compute_context.CreateBuffer(Rhi::BufferSettings::ForIndirectArgumentBuffer(static_cast<Data::Size>(sizeof(dispatch_args)), true));
+        CHECK(args_buffer.GetSettings().type == Rhi::BufferType::IndirectArgument);
+        REQUIRE_NOTHROW(args_buffer.SetData(compute_cmd_queue, {
+            reinterpret_cast<Data::ConstRawPtr>(dispatch_args.data()), // NOSONAR
+            static_cast<Data::Size>(sizeof(dispatch_args))
+        }));
+
+        REQUIRE_NOTHROW(cmd_list.ResetWithState(compute_state));
+        REQUIRE_NOTHROW(cmd_list.DispatchIndirect(args_buffer, static_cast<Data::Size>(sizeof(Rhi::DispatchIndirectArguments))));
+        CHECK(dynamic_cast<Null::ComputeCommandList&>(cmd_list.GetInterface()).GetDispatchedThreadGroupsCount() == Rhi::ThreadGroupsCount(8U, 4U, 2U));
+
+        const Rhi::CommandListStatistics statistics = cmd_list.GetStatistics();
+        CHECK(statistics.dispatches_count == 1U);
+        CHECK(statistics.indirect_commands_count == 1U);
+        REQUIRE_NOTHROW(cmd_list.Commit());
+    }
+
+    SECTION("Invalid Dispatch Indirect Commands")
+    {
+        const auto        args_size       = static_cast<Data::Size>(sizeof(Rhi::DispatchIndirectArguments));
+        const Rhi::Buffer args_buffer     = compute_context.CreateBuffer(Rhi::BufferSettings::ForIndirectArgumentBuffer(args_size, true));
+        const Rhi::Buffer constant_buffer = compute_context.CreateBuffer(Rhi::BufferSettings::ForConstantBuffer(256U, false, true));
+
+        REQUIRE_NOTHROW(cmd_list.ResetWithState(compute_state));
+        CHECK_THROWS(cmd_list.DispatchIndirect(constant_buffer));
+        CHECK_THROWS(cmd_list.DispatchIndirect(args_buffer, 2U));
+        CHECK_THROWS(cmd_list.DispatchIndirect(args_buffer, static_cast<Data::Size>(sizeof(uint32_t))));
+        CHECK(cmd_list.GetStatistics().indirect_commands_count == 0U);
+
+        REQUIRE_NOTHROW(cmd_list.Commit());
+        CHECK_THROWS(cmd_list.DispatchIndirect(args_buffer));
+    }
+
     SECTION("Set Resource Barriers")
     {
         const Rhi::ResourceBarriers barriers(Rhi::IResourceBarriers::Set{});
@@ -27,6 +27,7 @@ Unit-tests of the RHI ComputeContext
 #include <Methane/Graphics/RHI/ComputeContext.h>
 #include <Methane/Graphics/RHI/CommandKit.h>
 #include <Methane/Graphics/RHI/TransferCommandList.h>
+#include <Methane/Graphics/RHI/ComputeCommandList.h>
 #include <Methane/Graphics/RHI/System.h>
 #include <Methane/Graphics/RHI/Device.h>
 #include <Methane/Graphics/RHI/CommandQueue.h>
@@ -172,6 +173,30 @@ TEST_CASE("RHI Compute Context Functions", "[rhi][compute][context]")
         //FIXME: CHECK(transfer_cmd_list.GetState() == Rhi::CommandListState::Executing);
     }
 
+    SECTION("Context Compute Statistics")
+    {
+        const Rhi::ComputeState compute_state = compute_context.CreateComputeState({
+            compute_context.CreateProgram({
+                { { Rhi::ShaderType::Compute, { Data::ShaderProvider::Get(), { "Shader", "Main" } } } },
+            }),
+            Rhi::ThreadGroupSize(16, 16, 1)
+        });
+        const Rhi::ComputeCommandList compute_cmd_list = compute_context.GetComputeCommandKit().GetQueue().CreateComputeCommandList();
+        REQUIRE_NOTHROW(compute_cmd_list.ResetWithState(compute_state));
+        REQUIRE_NOTHROW(compute_cmd_list.Dispatch(Rhi::ThreadGroupsCount(4U, 4U, 1U)));
+        REQUIRE_NOTHROW(compute_cmd_list.Dispatch(Rhi::ThreadGroupsCount(4U, 4U, 1U)));
+        REQUIRE_NOTHROW(compute_cmd_list.Commit());
+        CHECK(compute_context.GetComputeStatistics().dispatches_count == 0U);
+
+        REQUIRE_NOTHROW(compute_context.WaitForGpu(Rhi::ContextWaitFor::ComputeComplete));
+        const Rhi::CommandListStatistics statistics = compute_context.GetComputeStatistics();
+        CHECK(statistics.dispatches_count == 2U);
+        CHECK(statistics.applied_state_changes_count == 1U);
+
+        REQUIRE_NOTHROW(compute_context.WaitForGpu(Rhi::ContextWaitFor::ComputeComplete));
+        CHECK(compute_context.GetComputeStatistics().dispatches_count == 0U);
+    }
+
     SECTION("Context Complete Initialization")
     {
         ContextCallbackTester context_callback_tester(compute_context);
@@ -0,0 +1,83 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+FILE: Tests/Graphics/RHI/ExecutionCompletionServiceBenchmark.cpp
+Benchmark of the latency between command list set execution and its completion callback
+delivered by the execution completion service.
+
+******************************************************************************/
+
+#include "RhiTestHelpers.hpp"
+
+#include <Methane/Graphics/RHI/ComputeContext.h>
+#include <Methane/Graphics/RHI/CommandQueue.h>
+#include <Methane/Graphics/RHI/ComputeCommandList.h>
+#include <Methane/Graphics/RHI/CommandListSet.h>
+#include <Methane/Graphics/Base/ExecutionCompletionService.h>
+#include <Methane/Graphics/Base/CommandListSet.h>
+
+#include <atomic>
+#include <thread>
+#include <taskflow/taskflow.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+
+static tf::Executor g_parallel_executor;
+
+class ExecutionCompletionCounter final
+    : public Base::IExecutionCompletionClient
+{
+public:
+    void OnCommandListSetExecutionCompleted(Base::CommandListSet&) override { ++m_completed_count; }
+
+    void WaitForCompleted(size_t completed_count) const
+    {
+        while(m_completed_count < completed_count)
+            std::this_thread::yield();
+    }
+
+private:
+    std::atomic<size_t> m_completed_count{ 0U };
+};
+
+TEST_CASE("RHI Execution Completion Service benchmark", "[rhi][queue][execution][benchmark]")
+{
+    const Rhi::ComputeContext compute_context = Rhi::ComputeContext(GetTestDevice(), g_parallel_executor, {});
+    const Rhi::CommandQueue compute_cmd_queue = compute_context.CreateCommandQueue(Rhi::CommandListType::Compute);
+    const Rhi::ComputeCommandList compute_cmd_list = compute_cmd_queue.CreateComputeCommandList();
+    const Rhi::CommandListSet cmd_list_set({ compute_cmd_list.GetInterface() });
+    const auto base_cmd_list_set_ptr = std::static_pointer_cast<Base::CommandListSet>(cmd_list_set.GetInterfacePtr());
+
+    Base::ExecutionCompletionService completion_service;
+    ExecutionCompletionCounter completion_counter;
+    size_t executions_count = 0U;
+
+    BENCHMARK("Command list set execution completion callback latency")
+    {
+        compute_cmd_list.Reset();
+        compute_cmd_list.Commit();
+        compute_cmd_queue.Execute(cmd_list_set);
+        completion_service.AddExecutingCommandListSet(completion_counter, base_cmd_list_set_ptr);
+        completion_counter.WaitForCompleted(++executions_count);
+        return executions_count;
+    };
+
+    completion_service.RemoveClient(completion_counter);
+}
@@ -0,0 +1,364 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+FILE: Tests/Graphics/RHI/ExecutionCompletionServiceTest.cpp
+Unit-tests of the command list sets execution completion service shared by command queues.
+
+******************************************************************************/
+
+#include "RhiTestHelpers.hpp"
+
+#include <Methane/Graphics/RHI/ComputeContext.h>
+#include <Methane/Graphics/RHI/CommandQueue.h>
+#include <Methane/Graphics/RHI/ComputeCommandList.h>
+#include <Methane/Graphics/RHI/CommandListSet.h>
+#include <Methane/Graphics/Base/ExecutionCompletionService.h>
+#include <Methane/Graphics/Base/CommandListSet.h>
+
+#include <vector>
+#include <algorithm>
+#include <mutex>
+#include <condition_variable>
+#include <taskflow/taskflow.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+
+static tf::Executor g_parallel_executor;
+
+class ExecutionCompletionClientTester final
+    : public Base::IExecutionCompletionClient
+{
+public:
+    void OnCommandListSetExecutionCompleted(Base::CommandListSet& command_list_set) override
+    {
+        std::scoped_lock lock_guard(m_mutex);
+        m_completed_command_list_sets.push_back(&command_list_set);
+        m_completed_condition_var.notify_all();
+    }
+
+    std::vector<Base::CommandListSet*> GetCompleted()
+    {
+        std::scoped_lock lock_guard(m_mutex);
+        return m_completed_command_list_sets;
+    }
+
+    std::vector<Base::CommandListSet*> WaitForCompleted(size_t completed_count)
+    {
+        std::unique_lock lock(m_mutex);
+        m_completed_condition_var.wait(lock, [this, completed_count]
+            { return m_completed_command_list_sets.size() >= completed_count; });
+        return m_completed_command_list_sets;
+    }
+
+private:
+    std::vector<Base::CommandListSet*> m_completed_command_list_sets;
+    std::mutex                         m_mutex;
+    std::condition_variable            m_completed_condition_var;
+};
+
+// Completion client, which removes itself from the completion service in the completion callback
+class SelfRemovingCompletionClientTester final
+    : public Base::IExecutionCompletionClient
+{
+public:
+    explicit SelfRemovingCompletionClientTester(Base::ExecutionCompletionService& completion_service)
+        : m_completion_service(completion_service)
+    { }
+
+    void OnCommandListSetExecutionCompleted(Base::CommandListSet&) override
+    {
+        m_completion_service.RemoveClient(*this);
+        std::scoped_lock lock_guard(m_mutex);
+        m_is_removed = true;
+        m_removed_condition_var.notify_all();
+    }
+
+    void WaitForRemoved()
+    {
+        std::unique_lock lock(m_mutex);
+        m_removed_condition_var.wait(lock, [this] { return m_is_removed; });
+    }
+
+private:
+    Base::ExecutionCompletionService& m_completion_service;
+    bool                              m_is_removed = false;
+    std::mutex                        m_mutex;
+    std::condition_variable           m_removed_condition_var;
+};
+
+// Completion service, which waits for command list sets completed manually from the test thread in any order
+class ManualExecutionCompletionService final
+    : public Base::ExecutionCompletionService
+{
+public:
+    ~ManualExecutionCompletionService() override
+    {
+        Shutdown();
+    }
+
+    // Completes any command list set and wakes up the service, even if it is not the first one waited
+    void Complete(Base::CommandListSet& command_list_set)
+    {
+        std::scoped_lock lock_guard(m_mutex);
+        command_list_set.WaitUntilCompleted();
+        m_checked_command_list_set_ptr = nullptr;
+        m_is_completion_notified = true;
+        m_completed_condition_var.notify_all();
+    }
+
+    // Blocks until completion service checks if the given command list set is completed after the last completion
+    void WaitForCompletionChecked(const Base::CommandListSet& command_list_set)
+    {
+        std::unique_lock lock(m_mutex);
+        m_completed_condition_var.wait(lock, [this, &command_list_set]
+            { return m_checked_command_list_set_ptr == &command_list_set; });
+    }
+
+protected:
+    void WaitForAnyCompleted(const Ptrs<Base::CommandListSet>& command_list_sets) override
+    {
+        std::unique_lock lock(m_mutex);
+        m_completed_condition_var.wait(lock, [this, &command_list_sets]
+        {
+            return m_is_interrupted || m_is_completion_notified ||
+                   std::any_of(command_list_sets.begin(), command_list_sets.end(),
+                       [](const Ptr<Base::CommandListSet>& command_list_set_ptr) { return !command_list_set_ptr->IsExecuting(); });
+        });
+        m_is_completion_notified = false;
+    }
+
+    bool IsCompleted(const Base::CommandListSet& command_list_set) const override
+    {
+        std::scoped_lock lock_guard(m_mutex);
+        m_checked_command_list_set_ptr = &command_list_set;
+        m_completed_condition_var.notify_all();
+        return !command_list_set.IsExecuting();
+    }
+
+    void ResetWaitingInterrupt() override
+    {
+        std::scoped_lock lock_guard(m_mutex);
+        m_is_interrupted = false;
+    }
+
+    void InterruptWaiting() override
+    {
+        std::scoped_lock lock_guard(m_mutex);
+        m_is_interrupted = true;
+        m_completed_condition_var.notify_all();
+    }
+
+private:
+    mutable std::mutex                     m_mutex;
+    mutable std::condition_variable        m_completed_condition_var;
+    mutable const Base::CommandListSet*    m_checked_command_list_set_ptr = nullptr;
+    bool                                   m_is_interrupted = false;
+    bool                                   m_is_completion_notified = false;
+};
+
+// Command list set, which blocks in WaitUntilCompleted until it is released from the test thread
+class BlockingCommandListSet final
+    : public Base::CommandListSet
+{
+public:
+    using Base::CommandListSet::CommandListSet;
+
+    void WaitUntilCompleted() override
+    {
+        std::unique_lock lock(m_mutex);
+        m_released_condition_var.wait(lock, [this] { return m_is_released; });
+        Complete();
+    }
+
+    void Release()
+    {
+        std::scoped_lock lock_guard(m_mutex);
+        m_is_released = true;
+        m_released_condition_var.notify_all();
+    }
+
+private:
+    bool                    m_is_released = false;
+    std::mutex              m_mutex;
+    std::condition_variable m_released_condition_var;
+};
+
+static Ptr<BlockingCommandListSet> ExecuteBlockingCommandListSet(const Rhi::ComputeCommandList& cmd_list)
+{
+    cmd_list.Reset();
+    cmd_list.Commit();
+    auto command_list_set_ptr = std::make_shared<BlockingCommandListSet>(Refs<Rhi::ICommandList>{ cmd_list.GetInterface() }, std::nullopt);
+    command_list_set_ptr->Execute({});
+    return command_list_set_ptr;
+}
+
+static Ptr<Base::CommandListSet> ExecuteCommandListSet(const Rhi::CommandQueue& cmd_queue,
+                                                       const Rhi::ComputeCommandList& cmd_list,
+                                                       const Rhi::CommandListSet& cmd_list_set)
+{
+    cmd_list.Reset();
+    cmd_list.Commit();
+    cmd_queue.Execute(cmd_list_set);
+    return std::static_pointer_cast<Base::CommandListSet>(cmd_list_set.GetInterfacePtr());
+}
+
+TEST_CASE("RHI Execution Completion Service", "[rhi][queue][execution]")
+{
+    const Rhi::ComputeContext compute_context = Rhi::ComputeContext(GetTestDevice(), g_parallel_executor, {});
+    const Rhi::CommandQueue compute_cmd_queue = compute_context.CreateCommandQueue(Rhi::CommandListType::Compute);
+    const Rhi::ComputeCommandList first_cmd_list = compute_cmd_queue.CreateComputeCommandList();
+    const Rhi::ComputeCommandList second_cmd_list = compute_cmd_queue.CreateComputeCommandList();
+    const Rhi::CommandListSet first_cmd_list_set({ first_cmd_list.GetInterface() });
+    const Rhi::CommandListSet second_cmd_list_set({ second_cmd_list.GetInterface() });
+
+    SECTION("Command List Sets Completed in Order of Execution")
+    {
+        Base::ExecutionCompletionService completion_service;
+        ExecutionCompletionClientTester completion_client;
+
+        const Ptr<Base::CommandListSet> first_set_ptr  = ExecuteCommandListSet(compute_cmd_queue, first_cmd_list, first_cmd_list_set);
+        const Ptr<Base::CommandListSet> second_set_ptr = ExecuteCommandListSet(compute_cmd_queue, second_cmd_list, second_cmd_list_set);
+        REQUIRE_NOTHROW(completion_service.AddExecutingCommandListSet(completion_client, first_set_ptr));
+        REQUIRE_NOTHROW(completion_service.AddExecutingCommandListSet(completion_client, second_set_ptr));
+
+        const std::vector<Base::CommandListSet*> completed_sets = completion_client.WaitForCompleted(2U);
+        REQUIRE(completed_sets.size() == 2U);
+        CHECK(completed_sets[0] == first_set_ptr.get());
+        CHECK(completed_sets[1] == second_set_ptr.get());
+        CHECK(first_cmd_list.GetState() == Rhi::CommandListState::Pending);
+        CHECK(second_cmd_list.GetState() == Rhi::CommandListState::Pending);
+        REQUIRE_NOTHROW(completion_service.RemoveClient(completion_client));
+    }
+
+    SECTION("Command List Sets Completed out of Order are Dispatched in Order of Execution")
+    {
+        ManualExecutionCompletionService completion_service;
+        ExecutionCompletionClientTester completion_client;
+
+        const Ptr<Base::CommandListSet> first_set_ptr  = ExecuteCommandListSet(compute_cmd_queue, first_cmd_list, first_cmd_list_set);
+        const Ptr<Base::CommandListSet> second_set_ptr = ExecuteCommandListSet(compute_cmd_queue, second_cmd_list, second_cmd_list_set);
+        REQUIRE_NOTHROW(completion_service.AddExecutingCommandListSet(completion_client, first_set_ptr));
+        REQUIRE_NOTHROW(completion_service.AddExecutingCommandListSet(completion_client, second_set_ptr));
+
+        // Second command list set completion is not dispatched until the first one is completed
+        completion_service.Complete(*second_set_ptr);
+        completion_service.WaitForCompletionChecked(*first_set_ptr);
+        CHECK(completion_client.GetCompleted().empty());
+
+        completion_service.Complete(*first_set_ptr);
+        const std::vector<Base::CommandListSet*> completed_sets = completion_client.WaitForCompleted(2U);
+        REQUIRE(completed_sets.size() == 2U);
+        CHECK(completed_sets[0] == first_set_ptr.get());
+        CHECK(completed_sets[1] == second_set_ptr.get());
+        REQUIRE_NOTHROW(completion_service.RemoveClient(completion_client));
+    }
+
+    SECTION("Command List Sets Completed for Multiple Clients")
+    {
+        Base::ExecutionCompletionService completion_service;
+        ExecutionCompletionClientTester first_completion_client;
+        ExecutionCompletionClientTester second_completion_client;
+
+        const Ptr<Base::CommandListSet> first_set_ptr  = ExecuteCommandListSet(compute_cmd_queue, first_cmd_list, first_cmd_list_set);
+        const Ptr<Base::CommandListSet> second_set_ptr = ExecuteCommandListSet(compute_cmd_queue, second_cmd_list, second_cmd_list_set);
+        REQUIRE_NOTHROW(completion_service.AddExecutingCommandListSet(first_completion_client, first_set_ptr));
+        REQUIRE_NOTHROW(completion_service.AddExecutingCommandListSet(second_completion_client, second_set_ptr));
+
+        CHECK(first_completion_client.WaitForCompleted(1U) == std::vector<Base::CommandListSet*>{ first_set_ptr.get() });
+        CHECK(second_completion_client.WaitForCompleted(1U) == std::vector<Base::CommandListSet*>{ second_set_ptr.get() });
+        REQUIRE_NOTHROW(completion_service.RemoveClient(first_completion_client));
+        REQUIRE_NOTHROW(completion_service.RemoveClient(second_completion_client));
+    }
+
+    SECTION("Command List Sets of Multiple Clients Completed out of Order")
+    {
+        Base::ExecutionCompletionService completion_service;
+        ExecutionCompletionClientTester first_completion_client;
+        ExecutionCompletionClientTester second_completion_client;
+
+        const Ptr<BlockingCommandListSet> first_set_ptr  = ExecuteBlockingCommandListSet(first_cmd_list);
+        const Ptr<BlockingCommandListSet> second_set_ptr = ExecuteBlockingCommandListSet(second_cmd_list);
+        REQUIRE_NOTHROW(completion_service.AddExecutingCommandListSet(first_completion_client, first_set_ptr));
+        REQUIRE_NOTHROW(completion_service.AddExecutingCommandListSet(second_completion_client, second_set_ptr));
+
+        // Completion of the second client is dispatched while command list set of the first client is still executing
+        second_set_ptr->Release();
+        CHECK(second_completion_client.WaitForCompleted(1U) == std::vector<Base::CommandListSet*>{ second_set_ptr.get() });
+        CHECK(first_completion_client.GetCompleted().empty());
+
+        first_set_ptr->Release();
+        CHECK(first_completion_client.WaitForCompleted(1U) == std::vector<Base::CommandListSet*>{ first_set_ptr.get() });
+        REQUIRE_NOTHROW(completion_service.RemoveClient(first_completion_client));
+        REQUIRE_NOTHROW(completion_service.RemoveClient(second_completion_client));
+    }
+
+    SECTION("Remove Client Interrupts Waiting for Command List Set Completion")
+    {
+        Base::ExecutionCompletionService completion_service;
+        ExecutionCompletionClientTester completion_client;
+
+        const Ptr<BlockingCommandListSet> set_ptr = ExecuteBlockingCommandListSet(first_cmd_list);
+        REQUIRE_NOTHROW(completion_service.AddExecutingCommandListSet(completion_client, set_ptr));
+        REQUIRE_NOTHROW(completion_service.RemoveClient(completion_client));
+        CHECK(set_ptr->IsExecuting());
+        CHECK(completion_client.GetCompleted().empty());
+
+        // Completion waiter thread is joined on service destruction after command list set is completed
+        set_ptr->Release();
+    }
+
+    SECTION("Command List Sets Execution Repeated")
+    {
+        constexpr size_t executions_count = 100U;
+        Base::ExecutionCompletionService completion_service;
+        ExecutionCompletionClientTester completion_client;
+
+        for(size_t execution_index = 1U; execution_index <= executions_count; ++execution_index)
+        {
+            const Ptr<Base::CommandListSet> set_ptr = ExecuteCommandListSet(compute_cmd_queue, first_cmd_list, first_cmd_list_set);
+            REQUIRE_NOTHROW(completion_service.AddExecutingCommandListSet(completion_client, set_ptr));
+            CHECK(completion_client.WaitForCompleted(execution_index).size() == execution_index);
+        }
+        REQUIRE_NOTHROW(completion_service.RemoveClient(completion_client));
+    }
+
+    SECTION("Remove Client from Completion Callback")
+    {
+        Base::ExecutionCompletionService completion_service;
+        SelfRemovingCompletionClientTester self_removing_client(completion_service);
+        ExecutionCompletionClientTester completion_client;
+
+        const Ptr<Base::CommandListSet> first_set_ptr  = ExecuteCommandListSet(compute_cmd_queue, first_cmd_list, first_cmd_list_set);
+        REQUIRE_NOTHROW(completion_service.AddExecutingCommandListSet(self_removing_client, first_set_ptr));
+        self_removing_client.WaitForRemoved();
+
+        // Completion service keeps dispatching command list sets of other clients after client removal
+        const Ptr<Base::CommandListSet> second_set_ptr = ExecuteCommandListSet(compute_cmd_queue, second_cmd_list, second_cmd_list_set);
+        REQUIRE_NOTHROW(completion_service.AddExecutingCommandListSet(completion_client, second_set_ptr));
+        CHECK(completion_client.WaitForCompleted(1U) == std::vector<Base::CommandListSet*>{ second_set_ptr.get() });
+        REQUIRE_NOTHROW(completion_service.RemoveClient(completion_client));
+    }
+
+    SECTION("Remove Client Without Executions")
+    {
+        Base::ExecutionCompletionService completion_service;
+        ExecutionCompletionClientTester completion_client;
+        REQUIRE_NOTHROW(completion_service.RemoveClient(completion_client));
+    }
+}
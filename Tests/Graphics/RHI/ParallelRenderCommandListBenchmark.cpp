@@ -0,0 +1,88 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+FILE: Tests/Graphics/RHI/ParallelRenderCommandListBenchmark.cpp
+Benchmark of parallel render command list reset and commit with different number of per-thread command lists.
+
+******************************************************************************/
+
+#include "RhiTestHelpers.hpp"
+
+#include <Methane/Platform/AppEnvironment.h>
+#include <Methane/Graphics/RHI/RenderContext.h>
+#include <Methane/Graphics/RHI/RenderPattern.h>
+#include <Methane/Graphics/RHI/RenderPass.h>
+#include <Methane/Graphics/RHI/Texture.h>
+#include <Methane/Graphics/RHI/CommandQueue.h>
+#include <Methane/Graphics/RHI/CommandKit.h>
+#include <Methane/Graphics/RHI/ParallelRenderCommandList.h>
+#include <Methane/Graphics/RHI/CommandListSet.h>
+#include <Methane/Graphics/Null/CommandListSet.h>
+
+#include <taskflow/taskflow.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <string>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+
+static tf::Executor g_parallel_executor;
+
+TEST_CASE("RHI Parallel Render Command List reset and commit benchmark", "[rhi][render][parallel][benchmark]")
+{
+    Rhi::RenderContextSettings context_settings;
+    context_settings.frame_size = FrameSize(640U, 480U);
+
+    const Rhi::RenderContext render_context = GetTestDevice().CreateRenderContext(Platform::AppEnvironment{}, g_parallel_executor, context_settings);
+    const Rhi::RenderPattern render_pattern = render_context.CreateRenderPattern({
+        Rhi::RenderPattern::ColorAttachments{
+            Rhi::IRenderPass::ColorAttachment(0U, render_context.GetSettings().color_format, 1U,
+                                              Rhi::IRenderPass::Attachment::LoadAction::Clear,
+                                              Rhi::IRenderPass::Attachment::StoreAction::Store)
+        },
+        std::nullopt, // No depth attachment
+        std::nullopt, // No stencil attachment
+        Rhi::RenderPassAccessMask{},
+        true // final pass
+    });
+    const Rhi::Texture    screen_texture = render_context.CreateTexture(Rhi::TextureSettings::ForFrameBuffer(render_context.GetSettings(), 0U));
+    const Rhi::RenderPass screen_pass(render_pattern, {
+        Rhi::TextureViews{ Rhi::TextureView(screen_texture.GetInterface()) },
+        context_settings.frame_size
+    });
+    const Rhi::CommandQueue render_cmd_queue = render_context.GetRenderCommandKit().GetQueue();
+
+    for(uint32_t parallel_lists_count : { 1U, 4U, 16U, 32U, 64U })
+    {
+        const Rhi::ParallelRenderCommandList parallel_cmd_list = render_cmd_queue.CreateParallelRenderCommandList(screen_pass);
+        parallel_cmd_list.SetParallelCommandListsCount(parallel_lists_count);
+        const Rhi::CommandListSet cmd_list_set({ parallel_cmd_list.GetInterface() });
+
+        BENCHMARK("Reset and commit of " + std::to_string(parallel_lists_count) + " parallel render command lists")
+        {
+            parallel_cmd_list.Reset();
+            parallel_cmd_list.Commit();
+
+            // Complete execution instead of GPU to make command list available for the next reset
+            render_cmd_queue.Execute(cmd_list_set);
+            dynamic_cast<Null::CommandListSet&>(cmd_list_set.GetInterface()).Complete();
+            return parallel_cmd_list.GetState();
+        };
+    }
+}
@@ -0,0 +1,184 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/RHI/ProgramBindingsBenchmark.cpp
+Benchmarks of program bindings creation and applying in command list,
+and of context initialization completion with many registered program bindings.
+
+******************************************************************************/
+
+#include "RhiTestHelpers.hpp"
+
+#include <Methane/Data/AppShadersProvider.h>
+#include <Methane/Graphics/RHI/ComputeContext.h>
+#include <Methane/Graphics/RHI/CommandQueue.h>
+#include <Methane/Graphics/RHI/ComputeCommandList.h>
+#include <Methane/Graphics/RHI/ComputeState.h>
+#include <Methane/Graphics/RHI/Program.h>
+#include <Methane/Graphics/RHI/ProgramBindings.h>
+#include <Methane/Graphics/RHI/Buffer.h>
+#include <Methane/Graphics/RHI/Texture.h>
+#include <Methane/Graphics/RHI/Sampler.h>
+#include <Methane/Graphics/Null/Program.h>
+
+#include <taskflow/taskflow.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <vector>
+#include <string>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+
+static tf::Executor g_parallel_executor;
+
+static void BenchmarkInitializationCompletion(uint32_t registered_bindings_count)
+{
+    const Rhi::ComputeContext compute_context = Rhi::ComputeContext(GetTestDevice(), g_parallel_executor, {});
+    const Rhi::ProgramArgumentAccessor buffer_accessor{ Rhi::ShaderType::Compute, "OutBuffer", Rhi::ProgramArgumentAccessType::Mutable };
+    const Rhi::Program compute_program = compute_context.CreateProgram(
+        Rhi::ProgramSettingsImpl
+        {
+            Rhi::ProgramSettingsImpl::ShaderSet
+            {
+                { Rhi::ShaderType::Compute, { Data::ShaderProvider::Get(), { "Compute", "Main" } } }
+            },
+            Rhi::ProgramInputBufferLayouts{ },
+            Rhi::ProgramArgumentAccessors{ buffer_accessor }
+        });
+    dynamic_cast<Null::Program&>(compute_program.GetInterface()).SetArgumentBindings({
+        { buffer_accessor, { Rhi::ResourceType::Buffer, 1U } }
+    });
+
+    const Rhi::Buffer buffer = compute_context.CreateBuffer(Rhi::BufferSettings::ForConstantBuffer(256, false, true));
+    const Rhi::Buffer other_buffer = compute_context.CreateBuffer(Rhi::BufferSettings::ForConstantBuffer(256, false, true));
+    const Rhi::Program::ResourceViewsByArgument resource_views{
+        { { Rhi::ShaderType::Compute, "OutBuffer" }, { { buffer.GetInterface() } } }
+    };
+
+    std::vector<Rhi::ProgramBindings> program_bindings;
+    program_bindings.reserve(registered_bindings_count);
+    for(uint32_t bindings_index = 0U; bindings_index < registered_bindings_count; ++bindings_index)
+    {
+        program_bindings.push_back(compute_program.CreateBindings(resource_views));
+    }
+    compute_context.CompleteInitialization();
+
+    const std::string count_str = std::to_string(registered_bindings_count);
+    BENCHMARK("Complete initialization with " + count_str + " unchanged program bindings")
+    {
+        compute_context.CompleteInitialization();
+        return program_bindings.size();
+    };
+
+    BENCHMARK("Complete initialization of 1 new program bindings with " + count_str + " registered")
+    {
+        program_bindings.push_back(compute_program.CreateBindings(resource_views));
+        compute_context.CompleteInitialization();
+        return program_bindings.size();
+    };
+
+    bool is_other_buffer_bound = false;
+    BENCHMARK("Complete initialization of 1 updated program bindings with " + count_str + " registered")
+    {
+        is_other_buffer_bound = !is_other_buffer_bound;
+        program_bindings.front().Get({ Rhi::ShaderType::Compute, "OutBuffer" }).SetResourceViews(
+            { { is_other_buffer_bound ? other_buffer.GetInterface() : buffer.GetInterface() } });
+        compute_context.CompleteInitialization();
+        return program_bindings.size();
+    };
+}
+
+TEST_CASE("RHI Program Bindings initialization completion benchmark", "[rhi][program][bindings][benchmark]")
+{
+    for(uint32_t registered_bindings_count : { 1000U, 100000U })
+    {
+        BenchmarkInitializationCompletion(registered_bindings_count);
+    }
+}
+
+TEST_CASE("RHI Program Bindings creation and applying benchmark", "[rhi][program][bindings][benchmark]")
+{
+    // Program arguments layout is similar to the cubes grid of ParallelRendering tutorial:
+    // constant texture with sampler and mutable uniforms buffer bound to every cube
+    constexpr uint32_t bindings_count = 100000U;
+    const Rhi::ComputeContext compute_context = Rhi::ComputeContext(GetTestDevice(), g_parallel_executor, {});
+    const Rhi::CommandQueue compute_cmd_queue = compute_context.CreateCommandQueue(Rhi::CommandListType::Compute);
+    const Rhi::ProgramArgumentAccessor texture_accessor{ Rhi::ShaderType::Compute, "InTexture", Rhi::ProgramArgumentAccessType::Constant };
+    const Rhi::ProgramArgumentAccessor sampler_accessor{ Rhi::ShaderType::Compute, "InSampler", Rhi::ProgramArgumentAccessType::Constant };
+    const Rhi::ProgramArgumentAccessor buffer_accessor { Rhi::ShaderType::Compute, "OutBuffer", Rhi::ProgramArgumentAccessType::Mutable };
+    const Rhi::Program compute_program = compute_context.CreateProgram(
+        Rhi::ProgramSettingsImpl
+        {
+            Rhi::ProgramSettingsImpl::ShaderSet
+            {
+                { Rhi::ShaderType::Compute, { Data::ShaderProvider::Get(), { "Compute", "Main" } } }
+            },
+            Rhi::ProgramInputBufferLayouts{ },
+            Rhi::ProgramArgumentAccessors{ texture_accessor, sampler_accessor, buffer_accessor }
+        });
+    dynamic_cast<Null::Program&>(compute_program.GetInterface()).SetArgumentBindings({
+        { texture_accessor, { Rhi::ResourceType::Texture, 1U } },
+        { sampler_accessor, { Rhi::ResourceType::Sampler, 1U } },
+        { buffer_accessor,  { Rhi::ResourceType::Buffer,  1U } },
+    });
+
+    const Rhi::ComputeState compute_state = compute_context.CreateComputeState({
+        compute_program,
+        Rhi::ThreadGroupSize(16, 16, 1)
+    });
+
+    const Rhi::Texture texture = compute_context.CreateTexture(Rhi::TextureSettings::ForImage(Dimensions(640, 480), {}, PixelFormat::RGBA8, false));
+    const Rhi::Sampler sampler = compute_context.CreateSampler({
+        rhi::SamplerFilter  { rhi::SamplerFilter::MinMag::Linear },
+        rhi::SamplerAddress { rhi::SamplerAddress::Mode::ClampToEdge }
+    });
+    const Rhi::Buffer buffer = compute_context.CreateBuffer(Rhi::BufferSettings::ForConstantBuffer(256, false, true));
+    const Rhi::Program::ResourceViewsByArgument resource_views{
+        { { Rhi::ShaderType::Compute, "InTexture" }, { { texture.GetInterface() } } },
+        { { Rhi::ShaderType::Compute, "InSampler" }, { { sampler.GetInterface() } } },
+        { { Rhi::ShaderType::Compute, "OutBuffer" }, { { buffer.GetInterface() } } },
+    };
+
+    std::vector<Rhi::ProgramBindings> program_bindings;
+    program_bindings.reserve(bindings_count);
+
+    BENCHMARK("Create " + std::to_string(bindings_count) + " program bindings")
+    {
+        program_bindings.clear();
+        for(uint32_t bindings_index = 0U; bindings_index < bindings_count; ++bindings_index)
+        {
+            program_bindings.push_back(compute_program.CreateBindings(resource_views));
+        }
+        return program_bindings.size();
+    };
+
+    REQUIRE(program_bindings.size() == bindings_count);
+    const Rhi::ComputeCommandList compute_cmd_list = compute_cmd_queue.CreateComputeCommandList();
+
+    BENCHMARK("Apply " + std::to_string(bindings_count) + " program bindings")
+    {
+        compute_cmd_list.ResetWithState(compute_state);
+        for(const Rhi::ProgramBindings& bindings : program_bindings)
+        {
+            compute_cmd_list.SetProgramBindings(bindings);
+        }
+        return program_bindings.size();
+    };
+}
@@ -167,6 +167,22 @@ TEST_CASE("RHI Program Bindings Functions", "[rhi][program][bindings]")
         CHECK(copy_program_bindings.Get({ Rhi::ShaderType::Compute, "OutBuffer" }).GetResourceViews().at(0).GetResourcePtr().get() == buffer2.GetInterfacePtr().get());
     }
 
+    SECTION("Create A Transient Copy of Program Bindings with Replacements")
+    {
+        Rhi::ProgramBindings orig_program_bindings = compute_program.CreateBindings(compute_resource_views, 2U);
+        Rhi::ProgramBindings transient_program_bindings;
+        REQUIRE_NOTHROW(transient_program_bindings = orig_program_bindings.CreateTransientCopy({
+            { { Rhi::ShaderType::Compute, "OutBuffer" }, { { buffer2.GetInterface() } } },
+        }, 3U));
+        REQUIRE(transient_program_bindings.IsInitialized());
+        CHECK(transient_program_bindings.GetInterfacePtr() != orig_program_bindings.GetInterfacePtr());
+        CHECK(transient_program_bindings.GetArguments().size() == 3U);
+        CHECK(transient_program_bindings.GetFrameIndex() == 3U);
+        CHECK(transient_program_bindings.Get({ Rhi::ShaderType::Compute, "InTexture" }).GetResourceViews().at(0).GetResourcePtr().get() == texture.GetInterfacePtr().get());
+        CHECK(transient_program_bindings.Get({ Rhi::ShaderType::Compute, "OutBuffer" }).GetResourceViews().at(0).GetResourcePtr().get() == buffer2.GetInterfacePtr().get());
+        CHECK(orig_program_bindings.Get({ Rhi::ShaderType::Compute, "OutBuffer" }).GetResourceViews().at(0).GetResourcePtr().get() == buffer1.GetInterfacePtr().get());
+    }
+
     SECTION("Object Destroyed Callback")
     {
         auto program_bindings_ptr = std::make_unique<Rhi::ProgramBindings>(compute_program, compute_resource_views);
@@ -0,0 +1,213 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/RHI/RenderCommandListTest.cpp
+Unit-tests of the RHI RenderCommandList
+
+******************************************************************************/
+
+#include "RhiTestHelpers.hpp"
+
+#include <Methane/Data/AppShadersProvider.h>
+#include <Methane/Platform/AppEnvironment.h>
+#include <Methane/Graphics/RHI/RenderContext.h>
+#include <Methane/Graphics/RHI/RenderPattern.h>
+#include <Methane/Graphics/RHI/RenderPass.h>
+#include <Methane/Graphics/RHI/RenderState.h>
+#include <Methane/Graphics/RHI/ViewState.h>
+#include <Methane/Graphics/RHI/Program.h>
+#include <Methane/Graphics/RHI/Texture.h>
+#include <Methane/Graphics/RHI/Buffer.h>
+#include <Methane/Graphics/RHI/BufferSet.h>
+#include <Methane/Graphics/RHI/CommandQueue.h>
+#include <Methane/Graphics/RHI/CommandKit.h>
+#include <Methane/Graphics/RHI/RenderCommandList.h>
+#include <Methane/Graphics/Null/RenderContext.h>
+#include <Methane/Graphics/Null/RenderState.h>
+
+#include <taskflow/taskflow.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <array>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+
+static tf::Executor g_parallel_executor;
+
+TEST_CASE("RHI Render Command List Functions", "[rhi][list][render]")
+{
+    Rhi::RenderContextSettings context_settings;
+    context_settings.frame_size = FrameSize(640U, 480U);
+
+    const Rhi::RenderContext render_context = GetTestDevice().CreateRenderContext(Platform::AppEnvironment{}, g_parallel_executor, context_settings);
+    const Rhi::RenderContextSettings& settings = render_context.GetSettings();
+    const Rhi::RenderPattern render_pattern = render_context.CreateRenderPattern({
+        Rhi::RenderPattern::ColorAttachments{
+            Rhi::IRenderPass::ColorAttachment(0U, settings.color_format, 1U,
+                                              Rhi::IRenderPass::Attachment::LoadAction::Clear,
+                                              Rhi::IRenderPass::Attachment::StoreAction::Store)
+        },
+        std::nullopt, // No depth attachment
+        std::nullopt, // No stencil attachment
+        Rhi::RenderPassAccessMask{},
+        true // final pass
+    });
+
+    const Rhi::RenderState render_state = render_context.CreateRenderState({
+        render_context.CreateProgram({
+            Rhi::Program::ShaderSet
+            {
+                { Rhi::ShaderType::Vertex, { Data::ShaderProvider::Get(), { "HelloCube", "CubeVS" } } },
+                { Rhi::ShaderType::Pixel,  { Data::ShaderProvider::Get(), { "HelloCube", "CubePS" } } },
+            },
+            Rhi::ProgramInputBufferLayouts
+            {
+                Rhi::ProgramInputBufferLayout
+                {
+                    Rhi::ProgramInputBufferLayout::ArgumentSemantics{ "POSITION" , "COLOR" }
+                }
+            },
+            Rhi::ProgramArgumentAccessors{ },
+            render_pattern.GetAttachmentFormats()
+        }),
+        render_pattern
+    });
+
+    const Rhi::ViewState view_state({
+        { GetFrameViewport(settings.frame_size)    },
+        { GetFrameScissorRect(settings.frame_size) }
+    });
+
+    const Rhi::Texture    screen_texture = render_context.CreateTexture(Rhi::TextureSettings::ForFrameBuffer(settings, 0U));
+    const Rhi::RenderPass screen_pass(render_pattern, {
+        Rhi::TextureViews{ Rhi::TextureView(screen_texture.GetInterface()) },
+        settings.frame_size
+    });
+
+    const Rhi::CommandQueue render_cmd_queue = render_context.GetRenderCommandKit().GetQueue();
+    const Rhi::Buffer vertex_buffer = render_context.CreateBuffer(Rhi::BufferSettings::ForVertexBuffer(
+        static_cast<Data::Size>(sizeof(float) * 6U * 8U), static_cast<Data::Size>(sizeof(float) * 6U), true));
+    const Rhi::BufferSet vertex_buffer_set(Rhi::BufferType::Vertex, { vertex_buffer });
+    const Rhi::Buffer index_buffer = render_context.CreateBuffer(Rhi::BufferSettings::ForIndexBuffer(
+        static_cast<Data::Size>(sizeof(uint16_t) * 36U), PixelFormat::R16Uint));
+
+    Rhi::RenderCommandList cmd_list = render_cmd_queue.CreateRenderCommandList(screen_pass);
+
+    SECTION("Skip Redundant State Changes and Count Statistics")
+    {
+        REQUIRE_NOTHROW(cmd_list.ResetWithState(render_state));
+        REQUIRE_NOTHROW(cmd_list.SetRenderState(render_state));
+        REQUIRE_NOTHROW(cmd_list.SetViewState(view_state));
+        REQUIRE_NOTHROW(cmd_list.SetViewState(view_state));
+        CHECK(cmd_list.SetVertexBuffers(vertex_buffer_set));
+        CHECK_FALSE(cmd_list.SetVertexBuffers(vertex_buffer_set));
+        CHECK(cmd_list.SetIndexBuffer(index_buffer));
+        CHECK_FALSE(cmd_list.SetIndexBuffer(index_buffer));
+
+        const Rhi::CommandListStatistics statistics = cmd_list.GetStatistics();
+        CHECK(statistics.applied_state_changes_count == 4U);
+        CHECK(statistics.skipped_state_changes_count == 4U);
+        REQUIRE_NOTHROW(cmd_list.Commit());
+    }
+
+    SECTION("Skip Redundant Deferred Render State Setup After Draw")
+    {
+        const Rhi::RenderState deferred_render_state(std::make_shared<Null::RenderState>(
+            dynamic_cast<const Null::RenderContext&>(render_context.GetInterface()), render_state.GetInterface().GetSettings(), true));
+
+        REQUIRE_NOTHROW(cmd_list.ResetWithState(deferred_render_state));
+        REQUIRE_NOTHROW(cmd_list.SetViewState(view_state));
+        REQUIRE_NOTHROW(cmd_list.SetVertexBuffers(vertex_buffer_set));
+        REQUIRE_NOTHROW(cmd_list.SetIndexBuffer(index_buffer));
+        REQUIRE_NOTHROW(cmd_list.DrawIndexed(Rhi::RenderPrimitive::Triangle, 36U));
+
+        // Deferred render state is applied on draw, but remains set up in command list for the next draws
+        REQUIRE_NOTHROW(cmd_list.SetRenderState(deferred_render_state));
+        REQUIRE_NOTHROW(cmd_list.DrawIndexed(Rhi::RenderPrimitive::Triangle, 36U));
+
+        const Rhi::CommandListStatistics statistics = cmd_list.GetStatistics();
+        CHECK(statistics.applied_state_changes_count == 4U);
+        CHECK(statistics.skipped_state_changes_count == 1U);
+        CHECK(statistics.draws_count == 2U);
+        REQUIRE_NOTHROW(cmd_list.Commit());
+    }
+
+    SECTION("Draw Indirect with Arguments from Buffer")
+    {
+        const std::array<Rhi::DrawIndirectArguments, 2> draw_args{ {
+            { 36U, 1U, 0U, 0U },
+            { 24U, 2U, 0U, 0U }
+        } };
+        const Rhi::Buffer args_buffer = render_context.CreateBuffer(Rhi::BufferSettings::ForIndirectArgumentBuffer(static_cast<Data::Size>(sizeof(draw_args)), true));
+
+        REQUIRE_NOTHROW(cmd_list.ResetWithState(render_state));
+        REQUIRE_NOTHROW(cmd_list.SetViewState(view_state));
+        REQUIRE_NOTHROW(cmd_list.SetVertexBuffers(vertex_buffer_set));
+        REQUIRE_NOTHROW(cmd_list.DrawIndirect(Rhi::RenderPrimitive::Triangle, args_buffer, 0U, static_cast<uint32_t>(draw_args.size())));
+
+        const Rhi::CommandListStatistics statistics = cmd_list.GetStatistics();
+        CHECK(statistics.draws_count == 2U);
+        CHECK(statistics.indirect_commands_count == 1U);
+        REQUIRE_NOTHROW(cmd_list.Commit());
+    }
+
+    SECTION("Draw Indexed Indirect with Arguments from Buffer")
+    {
+        const std::array<Rhi::DrawIndexedIndirectArguments, 3> draw_args{ {
+            { 36U, 1U, 0U, 0, 0U },
+            { 12U, 1U, 6U, 0, 0U },
+            { 6U,  4U, 0U, 0, 0U }
+        } };
+        const Rhi::Buffer args_buffer = render_context.CreateBuffer(Rhi::BufferSettings::ForIndirectArgumentBuffer(static_cast<Data::Size>(sizeof(draw_args)), true));
+
+        REQUIRE_NOTHROW(cmd_list.ResetWithState(render_state));
+        REQUIRE_NOTHROW(cmd_list.SetViewState(view_state));
+        REQUIRE_NOTHROW(cmd_list.SetVertexBuffers(vertex_buffer_set));
+        REQUIRE_NOTHROW(cmd_list.SetIndexBuffer(index_buffer));
+        REQUIRE_NOTHROW(cmd_list.DrawIndexedIndirect(Rhi::RenderPrimitive::Triangle, args_buffer,
+                                                     static_cast<Data::Size>(sizeof(Rhi::DrawIndexedIndirectArguments)), 2U));
+
+        const Rhi::CommandListStatistics statistics = cmd_list.GetStatistics();
+        CHECK(statistics.draws_count == 2U);
+        CHECK(statistics.indirect_commands_count == 1U);
+        REQUIRE_NOTHROW(cmd_list.Commit());
+    }
+
+    SECTION("Invalid Draw Indirect Commands")
+    {
+        const auto        args_size       = static_cast<Data::Size>(sizeof(Rhi::DrawIndexedIndirectArguments));
+        const Rhi::Buffer args_buffer     = render_context.CreateBuffer(Rhi::BufferSettings::ForIndirectArgumentBuffer(args_size, true));
+        const Rhi::Buffer constant_buffer = render_context.CreateBuffer(Rhi::BufferSettings::ForConstantBuffer(256U, false, true));
+
+        REQUIRE_NOTHROW(cmd_list.ResetWithState(render_state));
+        REQUIRE_NOTHROW(cmd_list.SetViewState(view_state));
+        REQUIRE_NOTHROW(cmd_list.SetVertexBuffers(vertex_buffer_set));
+        CHECK_THROWS(cmd_list.DrawIndexedIndirect(Rhi::RenderPrimitive::Triangle, args_buffer));
+        REQUIRE_NOTHROW(cmd_list.SetIndexBuffer(index_buffer));
+        CHECK_THROWS(cmd_list.DrawIndirect(Rhi::RenderPrimitive::Triangle, constant_buffer));
+        CHECK_THROWS(cmd_list.DrawIndexedIndirect(Rhi::RenderPrimitive::Triangle, args_buffer, 2U));
+        CHECK_THROWS(cmd_list.DrawIndexedIndirect(Rhi::RenderPrimitive::Triangle, args_buffer, 0U, 2U));
+        CHECK_THROWS(cmd_list.DrawIndexedIndirect(Rhi::RenderPrimitive::Triangle, args_buffer, 0U, 0U));
+        CHECK(cmd_list.GetStatistics().indirect_commands_count == 0U);
+        CHECK(cmd_list.GetStatistics().draws_count == 0U);
+
+        REQUIRE_NOTHROW(cmd_list.Commit());
+        CHECK_THROWS(cmd_list.DrawIndexedIndirect(Rhi::RenderPrimitive::Triangle, args_buffer));
+    }
+}
@@ -0,0 +1,231 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/RHI/RenderFrameAllocationsTest.cpp
+Regression test of memory allocations in steady-state frames of the HelloCube
+rendering loop on Null RHI. Instrumented allocation operators are compiled into the test
+when memory allocations tracking is disabled in the instrumentation library.
+
+******************************************************************************/
+
+#include "RhiTestHelpers.hpp"
+
+#include <Methane/MemoryAllocations.h>
+#include <Methane/Data/AppShadersProvider.h>
+#include <Methane/Platform/AppEnvironment.h>
+#include <Methane/Graphics/RHI/RenderContext.h>
+#include <Methane/Graphics/RHI/RenderPattern.h>
+#include <Methane/Graphics/RHI/RenderPass.h>
+#include <Methane/Graphics/RHI/RenderState.h>
+#include <Methane/Graphics/RHI/ViewState.h>
+#include <Methane/Graphics/RHI/Program.h>
+#include <Methane/Graphics/RHI/Texture.h>
+#include <Methane/Graphics/RHI/Buffer.h>
+#include <Methane/Graphics/RHI/BufferSet.h>
+#include <Methane/Graphics/RHI/CommandQueue.h>
+#include <Methane/Graphics/RHI/CommandKit.h>
+#include <Methane/Graphics/RHI/RenderCommandList.h>
+#include <Methane/Graphics/RHI/CommandListSet.h>
+#include <Methane/Graphics/RHI/CommandListDebugGroup.h>
+#include <Methane/Graphics/Null/CommandListSet.h>
+
+#include <taskflow/taskflow.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <array>
+#include <vector>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+
+static tf::Executor g_parallel_executor;
+
+struct CubeVertex
+{
+    std::array<float, 3> position;
+    std::array<float, 3> color;
+};
+
+static const std::array<CubeVertex, 8> g_cube_vertices{ {
+    { { -1.F, -1.F, -1.F }, { 0.F, 0.F, 0.F } },
+    { {  1.F, -1.F, -1.F }, { 1.F, 0.F, 0.F } },
+    { {  1.F,  1.F, -1.F }, { 1.F, 1.F, 0.F } },
+    { { -1.F,  1.F, -1.F }, { 0.F, 1.F, 0.F } },
+    { { -1.F, -1.F,  1.F }, { 0.F, 0.F, 1.F } },
+    { {  1.F, -1.F,  1.F }, { 1.F, 0.F, 1.F } },
+    { {  1.F,  1.F,  1.F }, { 1.F, 1.F, 1.F } },
+    { { -1.F,  1.F,  1.F }, { 0.F, 1.F, 1.F } },
+} };
+
+static const std::array<uint16_t, 36> g_cube_indices{
+    0, 2, 1, 0, 3, 2,  4, 5, 6, 4, 6, 7,  0, 1, 5, 0, 5, 4,
+    3, 6, 2, 3, 7, 6,  0, 4, 7, 0, 7, 3,  1, 2, 6, 1, 6, 5
+};
+
+struct CubeFrame
+{
+    Rhi::Texture           screen_texture;
+    Rhi::RenderPass        screen_pass;
+    Rhi::BufferSet         vertex_buffer_set;
+    Rhi::RenderCommandList render_cmd_list;
+    Rhi::CommandListSet    execute_cmd_list_set;
+};
+
+// Reproduces initialization and rendering of the HelloCube tutorial without application window and GPU
+class CubeRenderer
+{
+public:
+    explicit CubeRenderer(const Rhi::RenderContextSettings& context_settings)
+        : m_render_context(GetTestDevice().CreateRenderContext(Platform::AppEnvironment{}, g_parallel_executor, context_settings))
+    {
+        const Rhi::RenderContextSettings& settings = m_render_context.GetSettings();
+        m_render_pattern = m_render_context.CreateRenderPattern({
+            Rhi::RenderPattern::ColorAttachments{
+                Rhi::IRenderPass::ColorAttachment(0U, settings.color_format, 1U,
+                                                  Rhi::IRenderPass::Attachment::LoadAction::Clear,
+                                                  Rhi::IRenderPass::Attachment::StoreAction::Store)
+            },
+            std::nullopt, // No depth attachment
+            std::nullopt, // No stencil attachment
+            Rhi::RenderPassAccessMask{},
+            true // final pass
+        });
+
+        m_render_state = m_render_context.CreateRenderState({
+            m_render_context.CreateProgram({
+                Rhi::Program::ShaderSet
+                {
+                    { Rhi::ShaderType::Vertex, { Data::ShaderProvider::Get(), { "HelloCube", "CubeVS" } } },
+                    { Rhi::ShaderType::Pixel,  { Data::ShaderProvider::Get(), { "HelloCube", "CubePS" } } },
+                },
+                Rhi::ProgramInputBufferLayouts
+                {
+                    Rhi::ProgramInputBufferLayout
+                    {
+                        Rhi::ProgramInputBufferLayout::ArgumentSemantics{ "POSITION" , "COLOR" }
+                    }
+                },
+                Rhi::ProgramArgumentAccessors{ },
+                m_render_pattern.GetAttachmentFormats()
+            }),
+            m_render_pattern
+        });
+
+        m_view_state = Rhi::ViewState({
+            { GetFrameViewport(settings.frame_size)    },
+            { GetFrameScissorRect(settings.frame_size) }
+        });
+
+        m_render_cmd_queue = m_render_context.GetRenderCommandKit().GetQueue();
+
+        const auto index_data_size = static_cast<Data::Size>(sizeof(g_cube_indices));
+        m_index_buffer = m_render_context.CreateBuffer(Rhi::BufferSettings::ForIndexBuffer(index_data_size, PixelFormat::R16Uint));
+        m_index_buffer.SetData(m_render_cmd_queue, {
+            reinterpret_cast<Data::ConstRawPtr>(g_cube_indices.data()), // NOSONAR
+            index_data_size
+        });
+
+        m_frames.resize(settings.frame_buffers_count);
+        for(uint32_t frame_index = 0U; frame_index < settings.frame_buffers_count; ++frame_index)
+        {
+            CubeFrame& frame = m_frames[frame_index];
+            frame.screen_texture = m_render_context.CreateTexture(Rhi::TextureSettings::ForFrameBuffer(settings, frame_index));
+            frame.screen_pass    = Rhi::RenderPass(m_render_pattern, {
+                Rhi::TextureViews{ Rhi::TextureView(frame.screen_texture.GetInterface()) },
+                settings.frame_size
+            });
+
+            Rhi::Buffer vertex_buffer = m_render_context.CreateBuffer(Rhi::BufferSettings::ForVertexBuffer(
+                static_cast<Data::Size>(sizeof(g_cube_vertices)), static_cast<Data::Size>(sizeof(CubeVertex)), true));
+            frame.vertex_buffer_set    = Rhi::BufferSet(Rhi::BufferType::Vertex, { vertex_buffer });
+            frame.render_cmd_list      = m_render_cmd_queue.CreateRenderCommandList(frame.screen_pass);
+            frame.execute_cmd_list_set = Rhi::CommandListSet({ frame.render_cmd_list.GetInterface() }, frame_index);
+        }
+
+        m_render_context.WaitForGpu(Rhi::IContext::WaitFor::RenderComplete);
+    }
+
+    void RenderFrame()
+    {
+        const CubeFrame& frame = m_frames[m_render_context.GetFrameBufferIndex()];
+
+        // Update vertex buffer with vertices in camera's projection view
+        frame.vertex_buffer_set[0].SetData(m_render_cmd_queue, {
+            reinterpret_cast<Data::ConstRawPtr>(g_cube_vertices.data()), // NOSONAR
+            static_cast<Data::Size>(sizeof(g_cube_vertices))
+        });
+
+        // Issue commands for cube rendering
+        META_DEBUG_GROUP_VAR(s_debug_group, "Cube Rendering");
+        frame.render_cmd_list.ResetWithState(m_render_state, &s_debug_group);
+        frame.render_cmd_list.SetViewState(m_view_state);
+        frame.render_cmd_list.SetVertexBuffers(frame.vertex_buffer_set);
+        frame.render_cmd_list.SetIndexBuffer(m_index_buffer);
+        frame.render_cmd_list.DrawIndexed(Rhi::RenderPrimitive::Triangle);
+        frame.render_cmd_list.Commit();
+
+        // Execute command list on render queue, complete its execution instead of GPU and present frame
+        m_render_cmd_queue.Execute(frame.execute_cmd_list_set);
+        dynamic_cast<Null::CommandListSet&>(frame.execute_cmd_list_set.GetInterface()).Complete();
+        m_render_context.Present();
+    }
+
+private:
+    Rhi::RenderContext     m_render_context;
+    Rhi::RenderPattern     m_render_pattern;
+    Rhi::RenderState       m_render_state;
+    Rhi::ViewState         m_view_state;
+    Rhi::CommandQueue      m_render_cmd_queue;
+    Rhi::Buffer            m_index_buffer;
+    std::vector<CubeFrame> m_frames;
+};
+
+#ifdef METHANE_MEMORY_ALLOCATIONS_TRACKING_ENABLED
+
+TEST_CASE("RHI Render Frame Memory Allocations", "[rhi][render][memory]")
+{
+    Rhi::RenderContextSettings context_settings;
+    context_settings.frame_size = FrameSize(640U, 480U);
+    context_settings.clear_color = Color4F(0.F, 0.F, 0.F, 1.F);
+    CubeRenderer cube_renderer(context_settings);
+
+    // First frames of every frame buffer are rendering with lazy initialization of command lists and fences
+    for(uint32_t frame_index = 0U; frame_index < context_settings.frame_buffers_count * 2U; ++frame_index)
+    {
+        cube_renderer.RenderFrame();
+    }
+
+    // Frame counters are saved to preallocated array to keep measured frames free of allocations made by tests;
+    // frames are measured around rendering calls, because frame delimiters are not instrumented when tracking is compiled into the test
+    constexpr size_t frames_count = 16U;
+    std::array<MemoryAllocations::Counters, frames_count> frame_allocations{ };
+    for(MemoryAllocations::Counters& frame_counters : frame_allocations)
+    {
+        const MemoryAllocations::Counters frame_start_counters = MemoryAllocations::GetTotalCounters();
+        cube_renderer.RenderFrame();
+        frame_counters = MemoryAllocations::GetTotalCounters() - frame_start_counters;
+    }
+
+    for(size_t frame_index = 0U; frame_index < frames_count; ++frame_index)
+    {
+        INFO("Frame " << frame_index << " has " << static_cast<std::string>(frame_allocations[frame_index]));
+        CHECK(frame_allocations[frame_index].allocations_count == 0U);
+    }
+}
+
+#endif // ifdef METHANE_MEMORY_ALLOCATIONS_TRACKING_ENABLED
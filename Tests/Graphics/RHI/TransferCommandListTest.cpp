@@ -30,6 +30,8 @@ Unit-tests of the RHI Transfer Command List
 #include <Methane/Graphics/RHI/CommandListDebugGroup.h>
 #include <Methane/Graphics/RHI/ResourceBarriers.h>
 #include <Methane/Graphics/RHI/CommandListSet.h>
+#include <Methane/Graphics/RHI/Buffer.h>
+#include <Methane/Graphics/RHI/Texture.h>
 #include <Methane/Graphics/Null/CommandListSet.h>
 #include <Methane/Graphics/Null/CommandListDebugGroup.h>
 #include <Methane/Graphics/Null/TransferCommandList.h>
@@ -37,6 +39,7 @@ Unit-tests of the RHI Transfer Command List
 #include <chrono>
 #include <future>
 #include <memory>
+#include <algorithm>
 #include <taskflow/taskflow.hpp>
 #include <catch2/catch_test_macros.hpp>
 #include <thread>
@@ -46,6 +49,16 @@ using namespace Methane::Graphics;
 
 static tf::Executor g_parallel_executor;
 
+static Data::Bytes GetTestBytes(Data::Size size)
+{
+    Data::Bytes test_bytes(size);
+    for(Data::Size byte_index = 0U; byte_index < size; ++byte_index)
+    {
+        test_bytes[byte_index] = static_cast<Data::Byte>(byte_index);
+    }
+    return test_bytes;
+}
+
 TEST_CASE("RHI Transfer Command List Functions", "[rhi][list][transfer]")
 {
     const Rhi::ComputeContext compute_context = Rhi::ComputeContext(GetTestDevice(), g_parallel_executor, {});
@@ -213,6 +226,93 @@ TEST_CASE("RHI Transfer Command List Functions", "[rhi][list][transfer]")
         CHECK(cmd_list.GetState() == Rhi::CommandListState::Pending);
     }
 
+    SECTION("Copy Buffer Region")
+    {
+        const Data::Bytes src_data = GetTestBytes(256U);
+        const Rhi::Buffer src_buffer = compute_context.CreateBuffer(Rhi::BufferSettings::ForConstantBuffer(256U));
+        const Rhi::Buffer dst_buffer = compute_context.CreateBuffer(Rhi::BufferSettings::ForConstantBuffer(256U));
+        REQUIRE_NOTHROW(src_buffer.SetData(compute_cmd_queue, Rhi::SubResource(src_data.data(), 256U)));
+
+        REQUIRE_NOTHROW(cmd_list.Reset());
+        REQUIRE_NOTHROW(cmd_list.CopyBuffer(src_buffer, dst_buffer, Rhi::BufferCopyRegion{ 16U, 32U, 64U }));
+        CHECK(src_buffer.GetState() == Rhi::ResourceState::CopySource);
+        CHECK(dst_buffer.GetState() == Rhi::ResourceState::CopyDest);
+
+        const Rhi::SubResource dst_data = dst_buffer.GetData(compute_cmd_queue, Rhi::BytesRange(32U, 96U));
+        REQUIRE(dst_data.GetDataSize() == 64U);
+        CHECK(std::equal(dst_data.GetDataPtr(), dst_data.GetDataEndPtr(), src_data.begin() + 16U));
+    }
+
+    SECTION("Copy Buffer to Texture and Texture Region to Buffer")
+    {
+        const Data::Bytes src_data = GetTestBytes(64U);
+        const Rhi::Buffer src_buffer = compute_context.CreateBuffer(Rhi::BufferSettings::ForConstantBuffer(64U));
+        const Rhi::Buffer dst_buffer = compute_context.CreateBuffer(Rhi::BufferSettings::ForReadBackBuffer(64U));
+        const Rhi::Texture texture   = compute_context.CreateTexture(Rhi::TextureSettings::ForImage(Dimensions(4U, 4U), {}, PixelFormat::R8Unorm, false));
+        REQUIRE_NOTHROW(src_buffer.SetData(compute_cmd_queue, Rhi::SubResource(src_data.data(), 16U)));
+
+        REQUIRE_NOTHROW(cmd_list.Reset());
+        REQUIRE_NOTHROW(cmd_list.CopyBufferToTexture(src_buffer, 0U, texture, Rhi::TextureCopyRegion{}));
+        REQUIRE_NOTHROW(cmd_list.CopyTextureToBuffer(texture, Rhi::TextureCopyRegion{ Rhi::SubResourceIndex(), { 1U, 1U, 2U, 2U } }, dst_buffer, 8U));
+        CHECK(texture.GetState() == Rhi::ResourceState::CopySource);
+
+        const Rhi::SubResource dst_data = dst_buffer.GetData(compute_cmd_queue, Rhi::BytesRange(8U, 12U));
+        const Data::Bytes expected_data{ src_data[5], src_data[6], src_data[9], src_data[10] };
+        CHECK(Data::Bytes(dst_data.GetDataPtr(), dst_data.GetDataEndPtr()) == expected_data);
+    }
+
+    SECTION("Copy Texture Region")
+    {
+        const Data::Bytes src_data = GetTestBytes(16U);
+        const Rhi::TextureSettings texture_settings = Rhi::TextureSettings::ForImage(Dimensions(4U, 4U), {}, PixelFormat::R8Unorm, false);
+        const Rhi::Texture src_texture = compute_context.CreateTexture(texture_settings);
+        const Rhi::Texture dst_texture = compute_context.CreateTexture(texture_settings);
+        REQUIRE_NOTHROW(src_texture.SetData(compute_cmd_queue, { Rhi::SubResource(src_data.data(), 16U) }));
+
+        REQUIRE_NOTHROW(cmd_list.Reset());
+        REQUIRE_NOTHROW(cmd_list.CopyTexture(src_texture, Rhi::TextureCopyRegion{ Rhi::SubResourceIndex(), { 0U, 0U, 2U, 2U } },
+                                             dst_texture, Rhi::TextureCopyRegion{ Rhi::SubResourceIndex(), { 2U, 2U, 0U, 0U } }));
+
+        const Rhi::SubResource dst_data = dst_texture.GetData(compute_cmd_queue, Rhi::SubResourceIndex(), Rhi::BytesRange(10U, 16U));
+        const Data::Bytes expected_data{ src_data[0], src_data[1], Data::Byte{}, Data::Byte{}, src_data[4], src_data[5] };
+        CHECK(Data::Bytes(dst_data.GetDataPtr(), dst_data.GetDataEndPtr()) == expected_data);
+    }
+
+    SECTION("Generate Texture Mipmaps")
+    {
+        const Data::Bytes src_data = GetTestBytes(16U);
+        const Rhi::Texture texture = compute_context.CreateTexture(Rhi::TextureSettings::ForImage(Dimensions(4U, 4U), {}, PixelFormat::R8Unorm, true));
+        REQUIRE(texture.GetSubresourceCount().GetMipLevelsCount() == 3U);
+        REQUIRE_NOTHROW(texture.SetData(compute_cmd_queue, { Rhi::SubResource(src_data.data(), 16U) }));
+
+        REQUIRE_NOTHROW(cmd_list.Reset());
+        REQUIRE_NOTHROW(cmd_list.GenerateMipmaps(texture));
+        CHECK(texture.GetState() == Rhi::ResourceState::ShaderResource);
+
+        // Mip pixels are averages of 2x2 pixel blocks of the previous level rounded to the nearest integer
+        const Rhi::SubResource mip1_data = texture.GetData(compute_cmd_queue, Rhi::SubResourceIndex(0U, 0U, 1U));
+        const Data::Bytes expected_mip1_data{ Data::Byte{ 3U }, Data::Byte{ 5U }, Data::Byte{ 11U }, Data::Byte{ 13U } };
+        CHECK(Data::Bytes(mip1_data.GetDataPtr(), mip1_data.GetDataEndPtr()) == expected_mip1_data);
+
+        const Rhi::SubResource mip2_data = texture.GetData(compute_cmd_queue, Rhi::SubResourceIndex(0U, 0U, 2U));
+        const Data::Bytes expected_mip2_data{ Data::Byte{ 8U } };
+        CHECK(Data::Bytes(mip2_data.GetDataPtr(), mip2_data.GetDataEndPtr()) == expected_mip2_data);
+    }
+
+    SECTION("Invalid Copy Commands")
+    {
+        const Rhi::Buffer buffer   = compute_context.CreateBuffer(Rhi::BufferSettings::ForConstantBuffer(64U));
+        const Rhi::Texture texture = compute_context.CreateTexture(Rhi::TextureSettings::ForImage(Dimensions(4U, 4U), {}, PixelFormat::RGBA8Unorm, false));
+
+        CHECK_THROWS(cmd_list.CopyBuffer(buffer, buffer, Rhi::BufferCopyRegion{ 0U, 32U, 16U }));
+        REQUIRE_NOTHROW(cmd_list.Reset());
+        CHECK_THROWS(cmd_list.CopyBuffer(buffer, buffer, Rhi::BufferCopyRegion{ 0U, 32U, 16U }));
+        CHECK_THROWS(cmd_list.CopyBufferToTexture(buffer, 16U, texture, Rhi::TextureCopyRegion{}));
+        CHECK_THROWS(cmd_list.CopyTextureToBuffer(texture, Rhi::TextureCopyRegion{ Rhi::SubResourceIndex(), { 3U, 3U, 2U, 1U } }, buffer, 0U));
+        CHECK_THROWS(cmd_list.CopyTextureToBuffer(texture, Rhi::TextureCopyRegion{ Rhi::SubResourceIndex(0U, 0U, 1U), {} }, buffer, 0U));
+        CHECK_THROWS(cmd_list.GenerateMipmaps(texture));
+    }
+
     SECTION("Get GPU Time Range")
     {
         REQUIRE_NOTHROW(cmd_list.Reset());
@@ -0,0 +1,181 @@
+/******************************************************************************
+
+Copyright 2023 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Graphics/RHI/TransientFramePoolsTest.cpp
+Unit-tests of the transient frame pools used for per-frame descriptor sets allocation
+
+******************************************************************************/
+
+#include <Methane/Graphics/Base/TransientFramePools.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <vector>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+
+struct TestPool
+{
+    uint32_t id;
+    uint32_t capacity;
+    uint32_t allocated_count;
+};
+
+class TestPoolsProvider
+{
+public:
+    explicit TestPoolsProvider(uint32_t pool_capacity)
+        : m_pool_capacity(pool_capacity)
+    { }
+
+    TestPool AcquirePool()
+    {
+        if (!m_free_pools.empty())
+        {
+            TestPool pool = m_free_pools.back();
+            m_free_pools.pop_back();
+            return pool;
+        }
+        return TestPool{ m_created_pools_count++, m_pool_capacity, 0U };
+    }
+
+    void ResetPool(TestPool& pool)
+    {
+        m_reset_pool_ids.push_back(pool.id);
+        pool.allocated_count = 0U;
+        m_free_pools.push_back(pool);
+    }
+
+    // Returns allocation index incremented by one, so that zero is returned on allocation failure
+    static uint32_t TryAllocate(TestPool& pool)
+    {
+        if (pool.allocated_count >= pool.capacity)
+            return 0U;
+
+        return ++pool.allocated_count;
+    }
+
+    uint32_t                     GetCreatedPoolsCount() const noexcept { return m_created_pools_count; }
+    size_t                       GetFreePoolsCount() const noexcept    { return m_free_pools.size(); }
+    const std::vector<uint32_t>& GetResetPoolIds() const noexcept      { return m_reset_pool_ids; }
+
+private:
+    const uint32_t        m_pool_capacity;
+    uint32_t              m_created_pools_count = 0U;
+    std::vector<TestPool> m_free_pools;
+    std::vector<uint32_t> m_reset_pool_ids;
+};
+
+static uint32_t Allocate(Base::TransientFramePools<TestPool>& transient_pools, TestPoolsProvider& pools_provider, Data::Index frame_index)
+{
+    return transient_pools.Allocate(frame_index,
+                                    [](TestPool& pool) { return TestPoolsProvider::TryAllocate(pool); },
+                                    [&pools_provider]() { return pools_provider.AcquirePool(); });
+}
+
+TEST_CASE("Transient Frame Pools", "[rhi][descriptors]")
+{
+    TestPoolsProvider pools_provider(2U);
+    Base::TransientFramePools<TestPool> transient_pools;
+
+    SECTION("Allocations of one frame are made from the same pool until it is full")
+    {
+        CHECK(Allocate(transient_pools, pools_provider, 0U) == 1U);
+        CHECK(Allocate(transient_pools, pools_provider, 0U) == 2U);
+        CHECK(transient_pools.GetPoolsCount() == 1U);
+        CHECK(Allocate(transient_pools, pools_provider, 0U) == 1U);
+        CHECK(transient_pools.GetPoolsCount() == 2U);
+        CHECK(transient_pools.GetFramesCount() == 1U);
+        CHECK(transient_pools.GetAllocationsCount() == 3U);
+        CHECK(pools_provider.GetCreatedPoolsCount() == 2U);
+    }
+
+    SECTION("Allocations of the next frame are made from another pool")
+    {
+        CHECK(Allocate(transient_pools, pools_provider, 0U) == 1U);
+        CHECK(Allocate(transient_pools, pools_provider, 1U) == 1U);
+        CHECK(transient_pools.GetFramesCount() == 2U);
+        CHECK(transient_pools.GetPoolsCount() == 2U);
+        CHECK(transient_pools.GetAllocationsCount() == 2U);
+    }
+
+    SECTION("Allocations of frames out of order are rejected")
+    {
+        CHECK(Allocate(transient_pools, pools_provider, 2U) == 1U);
+        CHECK_THROWS(Allocate(transient_pools, pools_provider, 1U));
+    }
+
+    SECTION("Pools of completed frames are reset, while pools of frames in flight are retained")
+    {
+        for(Data::Index frame_index = 0U; frame_index < 3U; ++frame_index)
+        {
+            for(uint32_t allocation_index = 0U; allocation_index < 3U; ++allocation_index)
+                CHECK(Allocate(transient_pools, pools_provider, frame_index) > 0U);
+        }
+        CHECK(transient_pools.GetPoolsCount() == 6U);
+        CHECK(transient_pools.GetAllocationsCount() == 9U);
+
+        transient_pools.CompleteFrames(0U, [&pools_provider](TestPool& pool) { pools_provider.ResetPool(pool); });
+        CHECK(pools_provider.GetResetPoolIds() == std::vector<uint32_t>{ 0U, 1U });
+        CHECK(transient_pools.GetFramesCount() == 2U);
+        CHECK(transient_pools.GetPoolsCount() == 4U);
+        CHECK(transient_pools.GetAllocationsCount() == 6U);
+
+        // Frames are completed in order, so completion of the last frame completes all previous frames too
+        transient_pools.CompleteFrames(2U, [&pools_provider](TestPool& pool) { pools_provider.ResetPool(pool); });
+        CHECK(pools_provider.GetResetPoolIds() == std::vector<uint32_t>{ 0U, 1U, 2U, 3U, 4U, 5U });
+        CHECK(transient_pools.GetFramesCount() == 0U);
+        CHECK(transient_pools.GetPoolsCount() == 0U);
+        CHECK(transient_pools.GetAllocationsCount() == 0U);
+    }
+
+    SECTION("Completion of frame without transient allocations does not reset pools of the next frames")
+    {
+        CHECK(Allocate(transient_pools, pools_provider, 3U) == 1U);
+        transient_pools.CompleteFrames(2U, [&pools_provider](TestPool& pool) { pools_provider.ResetPool(pool); });
+        CHECK(pools_provider.GetResetPoolIds().empty());
+        CHECK(transient_pools.GetPoolsCount() == 1U);
+        CHECK(transient_pools.GetAllocationsCount() == 1U);
+    }
+
+    SECTION("Reset pools are reused by allocations of the next frames")
+    {
+        CHECK(Allocate(transient_pools, pools_provider, 0U) == 1U);
+        CHECK(Allocate(transient_pools, pools_provider, 1U) == 1U);
+        transient_pools.CompleteFrames(0U, [&pools_provider](TestPool& pool) { pools_provider.ResetPool(pool); });
+        CHECK(pools_provider.GetFreePoolsCount() == 1U);
+
+        CHECK(Allocate(transient_pools, pools_provider, 2U) == 1U);
+        CHECK(pools_provider.GetFreePoolsCount() == 0U);
+        CHECK(pools_provider.GetCreatedPoolsCount() == 2U);
+    }
+
+    SECTION("Pools of all frames are returned on release without reset")
+    {
+        CHECK(Allocate(transient_pools, pools_provider, 0U) == 1U);
+        CHECK(Allocate(transient_pools, pools_provider, 1U) == 1U);
+
+        std::vector<uint32_t> released_pool_ids;
+        transient_pools.Release([&released_pool_ids](const TestPool& pool) { released_pool_ids.push_back(pool.id); });
+        CHECK(released_pool_ids == std::vector<uint32_t>{ 0U, 1U });
+        CHECK(pools_provider.GetResetPoolIds().empty());
+        CHECK(transient_pools.GetFramesCount() == 0U);
+        CHECK(transient_pools.GetAllocationsCount() == 0U);
+    }
+}